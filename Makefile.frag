@@ -14,13 +14,13 @@ GEN_SRC_DIR = src
 CFLAGS += -Werror
 
 # Force header generation before any compilation
-$(shared_objects_valkey_glide): include/glide_bindings.h cluster_scan_cursor_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h src/client_constructor_mock_arginfo.h valkey-glide/ffi/target/release/libglide_ffi.a
+$(shared_objects_valkey_glide): include/glide_bindings.h cluster_scan_cursor_arginfo.h cluster_scan_iterator_arginfo.h valkey_glide_batch_iterator_arginfo.h valkey_glide_future_arginfo.h valkey_glide_route_arginfo.h valkey_glide_script_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h src/client_constructor_mock_arginfo.h src/glide_bench_arginfo.h valkey-glide/ffi/target/release/libglide_ffi.a
 
 # Ensure protobuf files exist before compiling object files that need them
 src/command_request.lo src/connection_request.lo src/response.lo: include/glide_bindings.h
 
 # Backward compatibility alias
-build-modules-pre: include/glide_bindings.h cluster_scan_cursor_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h src/client_constructor_mock_arginfo.h valkey-glide/ffi/target/release/libglide_ffi.a
+build-modules-pre: include/glide_bindings.h cluster_scan_cursor_arginfo.h cluster_scan_iterator_arginfo.h valkey_glide_batch_iterator_arginfo.h valkey_glide_future_arginfo.h valkey_glide_route_arginfo.h valkey_glide_script_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h src/client_constructor_mock_arginfo.h src/glide_bench_arginfo.h valkey-glide/ffi/target/release/libglide_ffi.a
 
 # Debug what files exist
 debug-files:
@@ -50,6 +50,21 @@ endif
 cluster_scan_cursor_arginfo.h: cluster_scan_cursor.stub.php
 	@php -f $(top_srcdir)/build/gen_stub.php cluster_scan_cursor.stub.php || echo "cluster_scan_cursor arginfo generation failed"
 
+cluster_scan_iterator_arginfo.h: cluster_scan_iterator.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php cluster_scan_iterator.stub.php || echo "cluster_scan_iterator arginfo generation failed"
+
+valkey_glide_batch_iterator_arginfo.h: valkey_glide_batch_iterator.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php valkey_glide_batch_iterator.stub.php || echo "valkey_glide_batch_iterator arginfo generation failed"
+
+valkey_glide_future_arginfo.h: valkey_glide_future.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php valkey_glide_future.stub.php || echo "valkey_glide_future arginfo generation failed"
+
+valkey_glide_route_arginfo.h: valkey_glide_route.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php valkey_glide_route.stub.php || echo "valkey_glide_route arginfo generation failed"
+
+valkey_glide_script_arginfo.h: valkey_glide_script.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php valkey_glide_script.stub.php || echo "valkey_glide_script arginfo generation failed"
+
 valkey_glide_arginfo.h: valkey_glide.stub.php
 	@php -f $(top_srcdir)/build/gen_stub.php valkey_glide.stub.php || echo "valkey_glide arginfo generation failed"
 
@@ -62,6 +77,9 @@ logger_arginfo.h: logger.stub.php
 src/client_constructor_mock_arginfo.h: src/client_constructor_mock.stub.php
 	@php -f $(top_srcdir)/build/gen_stub.php src/client_constructor_mock.stub.php || echo "client_constructor_mock arginfo generation failed"
 
+src/glide_bench_arginfo.h: src/glide_bench.stub.php
+	@php -f $(top_srcdir)/build/gen_stub.php src/glide_bench.stub.php || echo "glide_bench arginfo generation failed"
+
 valkey-glide/ffi/target/release/libglide_ffi.a: ensure-submodules
 	@echo "=== BUILDING FFI LIBRARY ==="
 	@if [ ! -f valkey-glide/ffi/target/release/libglide_ffi.a ]; then \
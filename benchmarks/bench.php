@@ -0,0 +1,191 @@
+<?php
+
+/**
+ * Valkey GLIDE PHP network benchmark
+ *
+ * Measures throughput and latency percentiles of the hot commands against a
+ * running standalone server or cluster. Every command is timed per call (or
+ * per exec() when pipelining) with hrtime(), so the numbers include the full
+ * PHP -> C glue -> Glide core -> server round trip.
+ *
+ * Usage:
+ *   php benchmarks/bench.php [--cluster] [--host=127.0.0.1] [--port=6379]
+ *       [--ops=20000] [--value-size=16,256,4096] [--pipeline=1,16,128]
+ *       [--elements=10] [--commands=get,set,mget,hgetall,zrange,xread] [--json]
+ */
+
+error_reporting(E_ALL);
+
+if (!extension_loaded('valkey_glide')) {
+    fwrite(STDERR, "The valkey_glide extension is not loaded.\n");
+    exit(1);
+}
+
+$opts = getopt('', [
+    'cluster', 'host:', 'port:', 'ops:', 'value-size:', 'pipeline:', 'elements:', 'commands:', 'json',
+]);
+
+$cluster     = isset($opts['cluster']);
+$host        = $opts['host'] ?? '127.0.0.1';
+$port        = (int)($opts['port'] ?? ($cluster ? 7001 : 6379));
+$ops         = max(1, (int)($opts['ops'] ?? 20000));
+$value_sizes = array_map('intval', explode(',', $opts['value-size'] ?? '16,256,4096'));
+$depths      = array_map('intval', explode(',', $opts['pipeline'] ?? '1,16,128'));
+$elements    = max(1, (int)($opts['elements'] ?? 10));
+$commands    = explode(',', $opts['commands'] ?? 'get,set,mget,hgetall,zrange,xread');
+$json        = isset($opts['json']);
+
+$addresses = [['host' => $host, 'port' => $port]];
+$client    = $cluster ? new ValkeyGlideCluster($addresses) : new ValkeyGlide($addresses);
+
+/* All keys share a hash tag so multi-key commands stay on one slot in cluster mode */
+$prefix = '{glide-bench}:';
+
+/**
+ * Populate the keys read by the read-only commands.
+ */
+function bench_prepare($client, string $prefix, int $value_size, int $elements): void
+{
+    $value = str_repeat('x', $value_size);
+
+    $keys = [];
+    $hash = [];
+    for ($i = 0; $i < $elements; $i++) {
+        $keys[$prefix . "mget:$i"] = $value;
+        $hash["field:$i"]          = $value;
+    }
+
+    $client->del($prefix . 'hash', $prefix . 'zset', $prefix . 'stream');
+    $client->set($prefix . 'string', $value);
+    $client->mset($keys);
+    $client->hMset($prefix . 'hash', $hash);
+    for ($i = 0; $i < $elements; $i++) {
+        $client->zAdd($prefix . 'zset', $i, "member:$i:" . substr($value, 0, max(0, $value_size - 16)));
+        $client->xadd($prefix . 'stream', '*', ['payload' => $value]);
+    }
+}
+
+/**
+ * Return a closure issuing one call of the named command.
+ */
+function bench_command($client, string $prefix, string $name, int $value_size, int $elements): ?Closure
+{
+    $value     = str_repeat('x', $value_size);
+    $mget_keys = [];
+    for ($i = 0; $i < $elements; $i++) {
+        $mget_keys[] = $prefix . "mget:$i";
+    }
+
+    switch ($name) {
+        case 'get':
+            return fn($c) => $c->get($prefix . 'string');
+        case 'set':
+            return fn($c) => $c->set($prefix . 'set', $value);
+        case 'mget':
+            return fn($c) => $c->mget($mget_keys);
+        case 'hgetall':
+            return fn($c) => $c->hGetAll($prefix . 'hash');
+        case 'zrange':
+            return fn($c) => $c->zRange($prefix . 'zset', 0, -1, true);
+        case 'xread':
+            return fn($c) => $c->xread([$prefix . 'stream' => '0'], $elements);
+    }
+
+    return null;
+}
+
+/**
+ * Nearest-rank percentile of an already sorted sample.
+ */
+function bench_percentile(array $sorted, float $p): float
+{
+    $idx = (int)ceil($p / 100 * count($sorted)) - 1;
+    return $sorted[max(0, min($idx, count($sorted) - 1))];
+}
+
+/**
+ * Run $ops calls of $call, $depth commands per round trip.
+ *
+ * Latencies are per round trip: one call when $depth is 1, one exec() otherwise.
+ */
+function bench_run($client, Closure $call, int $ops, int $depth): array
+{
+    /* Warm up the connection and the code paths before measuring */
+    for ($i = 0; $i < min(100, $ops); $i++) {
+        $call($client);
+    }
+
+    $rounds    = max(1, intdiv($ops, $depth));
+    $latencies = [];
+    $start     = hrtime(true);
+
+    for ($r = 0; $r < $rounds; $r++) {
+        $t0 = hrtime(true);
+        if ($depth === 1) {
+            $call($client);
+        } else {
+            $client->pipeline();
+            for ($i = 0; $i < $depth; $i++) {
+                $call($client);
+            }
+            $client->exec();
+        }
+        $latencies[] = (hrtime(true) - $t0) / 1000;
+    }
+
+    $elapsed = (hrtime(true) - $start) / 1e9;
+    sort($latencies);
+
+    return [
+        'ops'        => $rounds * $depth,
+        'ops_per_s'  => $rounds * $depth / $elapsed,
+        'p50_us'     => bench_percentile($latencies, 50),
+        'p99_us'     => bench_percentile($latencies, 99),
+    ];
+}
+
+$results = [];
+
+if (!$json) {
+    printf("Valkey GLIDE PHP benchmark (%s %s:%d, %d ops)\n\n", $cluster ? 'cluster' : 'standalone', $host, $port, $ops);
+    printf("%-8s %8s %6s %12s %10s %10s\n", 'command', 'size', 'depth', 'ops/sec', 'p50 us', 'p99 us');
+}
+
+foreach ($value_sizes as $value_size) {
+    bench_prepare($client, $prefix, $value_size, $elements);
+
+    foreach ($commands as $name) {
+        $call = bench_command($client, $prefix, $name, $value_size, $elements);
+        if ($call === null) {
+            fwrite(STDERR, "Unknown command '$name', skipping\n");
+            continue;
+        }
+
+        foreach ($depths as $depth) {
+            $row = ['command' => $name, 'value_size' => $value_size, 'depth' => max(1, $depth)]
+                + bench_run($client, $call, $ops, max(1, $depth));
+            $results[] = $row;
+
+            if (!$json) {
+                printf(
+                    "%-8s %8d %6d %12.0f %10.1f %10.1f\n",
+                    $row['command'],
+                    $row['value_size'],
+                    $row['depth'],
+                    $row['ops_per_s'],
+                    $row['p50_us'],
+                    $row['p99_us']
+                );
+            }
+        }
+    }
+}
+
+$client->del($prefix . 'string', $prefix . 'set', $prefix . 'hash', $prefix . 'zset', $prefix . 'stream');
+
+if ($json) {
+    echo json_encode([
+        'mode'    => $cluster ? 'cluster' : 'standalone',
+        'results' => $results,
+    ], JSON_PRETTY_PRINT), "\n";
+}
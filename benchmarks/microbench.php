@@ -0,0 +1,68 @@
+<?php
+
+/**
+ * Valkey GLIDE PHP C-glue microbenchmark
+ *
+ * Times argument marshalling and command_response_to_zval() in isolation,
+ * without a server. Requires an extension built with
+ * ./configure --enable-valkey-glide-bench.
+ *
+ * Usage:
+ *   php benchmarks/microbench.php [--iterations=200000] [--json]
+ */
+
+error_reporting(E_ALL);
+
+if (!class_exists('ValkeyGlideBench')) {
+    fwrite(STDERR, "ValkeyGlideBench is not available, rebuild with --enable-valkey-glide-bench.\n");
+    exit(1);
+}
+
+$opts       = getopt('', ['iterations:', 'json']);
+$iterations = max(1, (int)($opts['iterations'] ?? 200000));
+$json       = isset($opts['json']);
+
+$results = [];
+
+$marshal_cases = [
+    'get'        => ['bench:key'],
+    'set-16'     => ['bench:key', str_repeat('x', 16)],
+    'set-4096'   => ['bench:key', str_repeat('x', 4096)],
+    'set-ex-nx'  => ['bench:key', 'value', 'EX', 60, 'NX'],
+    'zadd-float' => ['bench:zset', 1.5, 'a', 2.5, 'b', 3.5, 'c'],
+    'mget-100'   => array_map(fn($i) => "bench:key:$i", range(1, 100)),
+];
+
+foreach ($marshal_cases as $name => $args) {
+    $ns        = ValkeyGlideBench::marshalArgs($args, $iterations);
+    $results[] = ['bench' => 'marshal', 'case' => $name, 'ns_per_op' => $ns / $iterations];
+}
+
+$convert_cases = [
+    ['string', 1, 16],
+    ['string', 1, 4096],
+    ['array', 10, 16],
+    ['array', 100, 256],
+    ['map', 10, 16],
+    ['map', 100, 256],
+];
+
+foreach ($convert_cases as [$type, $elements, $size]) {
+    $ns        = ValkeyGlideBench::convertResponse($type, $elements, $size, $iterations);
+    $results[] = [
+        'bench'     => 'convert',
+        'case'      => "$type-$elements-x$size",
+        'ns_per_op' => $ns / $iterations,
+    ];
+}
+
+if ($json) {
+    echo json_encode(['iterations' => $iterations, 'results' => $results], JSON_PRETTY_PRINT), "\n";
+    exit(0);
+}
+
+printf("Valkey GLIDE PHP microbenchmark (%d iterations)\n\n", $iterations);
+printf("%-8s %-20s %12s\n", 'bench', 'case', 'ns/op');
+foreach ($results as $row) {
+    printf("%-8s %-20s %12.1f\n", $row['bench'], $row['case'], $row['ns_per_op']);
+}
@@ -0,0 +1,27 @@
+#!/bin/bash
+
+# Start the test servers and run the benchmark suite against standalone and cluster.
+# Extra arguments are passed through to bench.php.
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+TESTS_DIR="$SCRIPT_DIR/../tests"
+
+if [ "${SKIP_SERVERS:-0}" != "1" ]; then
+  "$TESTS_DIR/start_valkey_with_replicas.sh"
+  "$TESTS_DIR/create-valkey-cluster.sh"
+fi
+
+echo "=== Standalone ==="
+php "$SCRIPT_DIR/bench.php" --port=6379 "$@"
+
+echo
+echo "=== Cluster ==="
+php "$SCRIPT_DIR/bench.php" --cluster --port=7001 "$@"
+
+if php -r 'exit(class_exists("ValkeyGlideBench") ? 0 : 1);'; then
+  echo
+  echo "=== C glue ==="
+  php "$SCRIPT_DIR/microbench.php"
+fi
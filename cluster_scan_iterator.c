@@ -0,0 +1,531 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "cluster_scan_iterator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <zend_exceptions.h>
+#include <zend_interfaces.h>
+
+#include "cluster_scan_cursor.h"
+#include "cluster_scan_iterator_arginfo.h"
+#include "command_response.h"
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_route.h"
+
+#define CLUSTER_SCAN_FINISHED_CURSOR "finished"
+
+/* Global variables */
+zend_class_entry*           cluster_scan_iterator_ce;
+static zend_object_handlers cluster_scan_iterator_object_handlers;
+
+/* Object creation and destruction */
+static zend_object* create_cluster_scan_iterator_object(zend_class_entry* ce) {
+    cluster_scan_iterator_object* iterator =
+        ecalloc(1, sizeof(cluster_scan_iterator_object) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&iterator->std, ce);
+    object_properties_init(&iterator->std, ce);
+
+    ZVAL_UNDEF(&iterator->client);
+    ZVAL_UNDEF(&iterator->page);
+    iterator->std.handlers = &cluster_scan_iterator_object_handlers;
+
+    return &iterator->std;
+}
+
+/* New cursor of a completed page, or NULL if the reply is not a SCAN reply */
+static const CommandResponse* scan_reply_cursor(const CommandResponse* response) {
+    if (!response || response->response_type != Array || response->array_value_len != 2 ||
+        response->array_value[0].response_type != String) {
+        return NULL;
+    }
+    return &response->array_value[0];
+}
+
+static void free_cluster_scan_iterator_object(zend_object* object) {
+    cluster_scan_iterator_object* iterator =
+        VALKEY_GLIDE_PHP_GET_OBJECT(cluster_scan_iterator_object, object);
+    size_t i;
+
+    for (i = 0; i < iterator->source_count; i++) {
+        cluster_scan_source_t* source = &iterator->sources[i];
+        bool core_cursor = !source->route_bytes && source->cursor && !source->finished;
+
+        /* The core keeps state for its cursors until told otherwise */
+        if (core_cursor && source->request) {
+            valkey_glide_async_request_wait(source->request);
+
+            const CommandResponse* cursor = scan_reply_cursor(source->request->response);
+            if (cursor) {
+                char* next = estrndup(cursor->string_value, cursor->string_value_len);
+
+                efree(source->cursor);
+                source->cursor = next;
+            }
+        }
+        if (core_cursor && strcmp(source->cursor, "0") != 0 &&
+            strcmp(source->cursor, CLUSTER_SCAN_FINISHED_CURSOR) != 0) {
+            remove_cluster_scan_cursor(source->cursor);
+        }
+
+        if (source->request) {
+            valkey_glide_async_request_drop(source->request);
+        }
+        if (source->cursor) {
+            efree(source->cursor);
+        }
+        if (source->route_bytes) {
+            efree(source->route_bytes);
+        }
+    }
+    if (iterator->sources) {
+        efree(iterator->sources);
+    }
+
+    if (iterator->args) {
+        efree(iterator->args);
+        efree(iterator->args_len);
+    }
+    if (iterator->pattern) {
+        zend_string_release(iterator->pattern);
+    }
+    if (iterator->type) {
+        zend_string_release(iterator->type);
+    }
+
+    zval_ptr_dtor(&iterator->page);
+    zval_ptr_dtor(&iterator->client);
+
+    /* Clean up the standard object */
+    zend_object_std_dtor(&iterator->std);
+}
+
+/* Add a primary from one CLUSTER NODES line, if it owns slots */
+static void add_node_source(cluster_scan_iterator_object* iterator, const char* line, size_t len) {
+    const char* fields[9];
+    size_t      lengths[9];
+    size_t      field = 0, start = 0, i;
+
+    for (i = 0; i <= len && field < 9; i++) {
+        if (i == len || line[i] == ' ') {
+            fields[field]    = line + start;
+            lengths[field++] = i - start;
+            start            = i + 1;
+        }
+    }
+
+    /* id address flags master ping pong epoch state slot... */
+    if (field < 9 || !zend_memnstr(fields[2], "master", 6, fields[2] + lengths[2]) ||
+        zend_memnstr(fields[2], "fail", 4, fields[2] + lengths[2]) ||
+        zend_memnstr(fields[2], "noaddr", 6, fields[2] + lengths[2])) {
+        return;
+    }
+
+    /* ip:port@cport[,hostname] */
+    const char* at    = memchr(fields[1], '@', lengths[1]);
+    size_t      addr  = at ? (size_t) (at - fields[1]) : lengths[1];
+    const char* colon = zend_memrchr(fields[1], ':', addr);
+    if (!colon || colon == fields[1]) {
+        return;
+    }
+
+    cluster_route_t route;
+    char*           host = estrndup(fields[1], colon - fields[1]);
+
+    memset(&route, 0, sizeof(route));
+    route.type                      = ROUTE_TYPE_HOST_PORT;
+    route.data.host_port_route.host = host;
+    route.data.host_port_route.port = atoi(colon + 1);
+
+    cluster_scan_source_t* source = &iterator->sources[iterator->source_count];
+    source->route_bytes = create_route_bytes_from_route(&route, &source->route_bytes_len);
+    efree(host);
+
+    if (source->route_bytes) {
+        source->cursor = estrdup("0");
+        iterator->source_count++;
+    }
+}
+
+/* One source per primary, from CLUSTER NODES */
+static bool load_node_sources(cluster_scan_iterator_object* iterator, const void* glide_client) {
+    uintptr_t      args[2]     = {(uintptr_t) "CLUSTER", (uintptr_t) "NODES"};
+    unsigned long  args_len[2] = {7, 5};
+    zval           route;
+    CommandResult* result;
+    bool           loaded = false;
+
+    ZVAL_STRINGL(&route, "randomNode", sizeof("randomNode") - 1);
+    result = execute_command_with_route(glide_client, CustomCommand, 2, args, args_len, &route);
+    zval_ptr_dtor(&route);
+
+    if (result && !result->command_error && result->response &&
+        result->response->response_type == String) {
+        const char* nodes = result->response->string_value;
+        size_t      len   = result->response->string_value_len;
+        size_t      lines = 1, start = 0, i;
+
+        for (i = 0; i < len; i++) {
+            lines += nodes[i] == '\n';
+        }
+        iterator->sources = ecalloc(lines, sizeof(cluster_scan_source_t));
+
+        for (i = 0; i <= len; i++) {
+            if (i == len || nodes[i] == '\n') {
+                if (i > start) {
+                    add_node_source(iterator, nodes + start, i - start);
+                }
+                start = i + 1;
+            }
+        }
+        loaded = iterator->source_count > 0;
+    }
+
+    if (result) {
+        free_command_result(result);
+    }
+    return loaded;
+}
+
+/* Build the request arguments once; node sources put SCAN and their cursor in front */
+static void build_scan_args(cluster_scan_iterator_object* iterator, zend_long count, bool nodes) {
+    unsigned long i = 0;
+
+    iterator->arg_count = (nodes ? 2 : 0) + (iterator->pattern ? 2 : 0) + (count > 0 ? 2 : 0) +
+                          (iterator->type ? 2 : 0);
+    if (iterator->arg_count == 0) {
+        return;
+    }
+
+    iterator->args     = emalloc(iterator->arg_count * sizeof(uintptr_t));
+    iterator->args_len = emalloc(iterator->arg_count * sizeof(unsigned long));
+
+#define SCAN_ITERATOR_ADD_ARG(value, len)                \
+    do {                                                 \
+        iterator->args[i]       = (uintptr_t) (value);   \
+        iterator->args_len[i++] = (unsigned long) (len); \
+    } while (0)
+
+    if (nodes) {
+        SCAN_ITERATOR_ADD_ARG("SCAN", 4);
+        SCAN_ITERATOR_ADD_ARG("0", 1); /* Replaced by the cursor of each request */
+    }
+    if (iterator->pattern) {
+        SCAN_ITERATOR_ADD_ARG("MATCH", 5);
+        SCAN_ITERATOR_ADD_ARG(ZSTR_VAL(iterator->pattern), ZSTR_LEN(iterator->pattern));
+    }
+    if (count > 0) {
+        int count_len = snprintf(iterator->count, sizeof(iterator->count), ZEND_LONG_FMT, count);
+
+        SCAN_ITERATOR_ADD_ARG("COUNT", 5);
+        SCAN_ITERATOR_ADD_ARG(iterator->count, count_len);
+    }
+    if (iterator->type) {
+        SCAN_ITERATOR_ADD_ARG("TYPE", 4);
+        SCAN_ITERATOR_ADD_ARG(ZSTR_VAL(iterator->type), ZSTR_LEN(iterator->type));
+    }
+
+#undef SCAN_ITERATOR_ADD_ARG
+}
+
+/* Request the next page of a source on the async connection */
+static bool dispatch_page(cluster_scan_iterator_object* iterator, cluster_scan_source_t* source) {
+    CommandResult* result;
+
+    source->request = valkey_glide_async_request_new();
+    if (!source->request) {
+        return false;
+    }
+
+    if (source->route_bytes) {
+        iterator->args[1]     = (uintptr_t) source->cursor;
+        iterator->args_len[1] = strlen(source->cursor);
+
+        result = command(iterator->async_client,
+                         (uintptr_t) source->request, /* callback index */
+                         CustomCommand,               /* command type */
+                         iterator->arg_count,         /* number of arguments */
+                         iterator->args,              /* arguments */
+                         iterator->args_len,          /* argument lengths */
+                         source->route_bytes,         /* route bytes */
+                         source->route_bytes_len,     /* route bytes length */
+                         0                            /* span pointer */
+        );
+    } else {
+        result = request_cluster_scan(iterator->async_client,
+                                      (uintptr_t) source->request,
+                                      source->cursor,
+                                      iterator->arg_count,
+                                      iterator->args,
+                                      iterator->args_len);
+    }
+
+    /* Async connections report through the callbacks; a direct result means it was rejected */
+    if (result) {
+        free_command_result(result);
+        free(source->request);
+        source->request = NULL;
+        return false;
+    }
+    return true;
+}
+
+/* Keep up to `parallel` pages in flight; false if a request could not be sent */
+static bool dispatch_pages(cluster_scan_iterator_object* iterator) {
+    size_t in_flight = 0, i;
+
+    for (i = 0; i < iterator->source_count; i++) {
+        in_flight += iterator->sources[i].request != NULL;
+    }
+
+    for (i = 0; i < iterator->source_count && in_flight < iterator->parallel; i++) {
+        size_t                 index  = (iterator->next_source + i) % iterator->source_count;
+        cluster_scan_source_t* source = &iterator->sources[index];
+
+        if (!source->request && !source->finished) {
+            if (!dispatch_page(iterator, source)) {
+                return false;
+            }
+            in_flight++;
+        }
+    }
+
+    iterator->next_source = (iterator->next_source + 1) % iterator->source_count;
+    return true;
+}
+
+/* Take the first page to complete and queue its source's next page before converting it */
+static bool receive_page(cluster_scan_iterator_object* iterator) {
+    valkey_glide_async_request_t** pending;
+    valkey_glide_async_request_t*  request;
+    cluster_scan_source_t*         source = NULL;
+    const CommandResponse*         cursor;
+    size_t*                        owners;
+    size_t                         count = 0, i;
+
+    pending = emalloc(iterator->source_count * sizeof(valkey_glide_async_request_t*));
+    owners  = emalloc(iterator->source_count * sizeof(size_t));
+    for (i = 0; i < iterator->source_count; i++) {
+        if (iterator->sources[i].request) {
+            pending[count]  = iterator->sources[i].request;
+            owners[count++] = i;
+        }
+    }
+
+    if (count > 0) {
+        source = &iterator->sources[owners[valkey_glide_async_request_wait_any(pending, count)]];
+    }
+    efree(pending);
+    efree(owners);
+    if (count == 0) {
+        return false;
+    }
+
+    request         = source->request;
+    cursor          = scan_reply_cursor(request->response);
+    source->request = NULL;
+
+    if (request->error_message || !cursor ||
+        request->response->array_value[1].response_type != Array) {
+        zend_throw_exception(get_valkey_glide_cluster_exception_ce(),
+                             request->error_message ? request->error_message
+                                                    : "Unexpected SCAN reply",
+                             0);
+        source->finished = true;
+        valkey_glide_async_request_drop(request);
+        return false;
+    }
+
+    efree(source->cursor);
+    source->cursor   = estrndup(cursor->string_value, cursor->string_value_len);
+    source->finished = strcmp(source->cursor, "0") == 0 ||
+                       strcmp(source->cursor, CLUSTER_SCAN_FINISHED_CURSOR) == 0;
+
+    /* The next page is fetched while PHP works through this one */
+    if (!dispatch_pages(iterator)) {
+        zend_throw_exception(get_valkey_glide_cluster_exception_ce(),
+                             "Failed to send SCAN request",
+                             0);
+        valkey_glide_async_request_drop(request);
+        return false;
+    }
+
+    const CommandResponse* keys = &request->response->array_value[1];
+
+    zval_ptr_dtor(&iterator->page);
+    array_init_size(&iterator->page, (uint32_t) keys->array_value_len);
+    for (i = 0; i < (size_t) keys->array_value_len; i++) {
+        if (keys->array_value[i].response_type == String) {
+            add_next_index_stringl(&iterator->page,
+                                   keys->array_value[i].string_value,
+                                   keys->array_value[i].string_value_len);
+        }
+    }
+    iterator->page_pos = 0;
+
+    valkey_glide_async_request_drop(request);
+    return true;
+}
+
+/* Position on a key, waiting for more pages when the current one is exhausted */
+static bool cluster_scan_iterator_fetch(cluster_scan_iterator_object* iterator) {
+    if (!iterator->started) {
+        iterator->started = true;
+        if (!dispatch_pages(iterator)) {
+            zend_throw_exception(get_valkey_glide_cluster_exception_ce(),
+                                 "Failed to send SCAN request",
+                                 0);
+            return false;
+        }
+    }
+
+    while (Z_ISUNDEF(iterator->page) ||
+           iterator->page_pos >= zend_hash_num_elements(Z_ARRVAL(iterator->page))) {
+        if (EG(exception) || !receive_page(iterator)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int execute_scan_iterator_command(zval*             object,
+                                  int               argc,
+                                  zval*             return_value,
+                                  zend_class_entry* ce) {
+    valkey_glide_object*          valkey_glide;
+    cluster_scan_iterator_object* iterator;
+    zend_string *                 pattern = NULL, *type = NULL;
+    zend_long                     count = 0, parallel = 1;
+
+    if (zend_parse_method_parameters(
+            argc, object, "O|S!lS!l", &object, ce, &pattern, &count, &type, &parallel) ==
+        FAILURE) {
+        return 0;
+    }
+
+    if (count < 0) {
+        zend_argument_value_error(2, "must be greater than or equal to 0");
+        return 0;
+    }
+    if (parallel < 1) {
+        zend_argument_value_error(4, "must be greater than 0");
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    const void* async_client = valkey_glide_get_async_client(valkey_glide);
+    if (!async_client) {
+        return 0;
+    }
+
+    object_init_ex(return_value, cluster_scan_iterator_ce);
+    iterator = CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(return_value);
+
+    ZVAL_COPY(&iterator->client, object);
+    iterator->async_client = async_client;
+    iterator->parallel     = (size_t) parallel;
+    if (pattern && ZSTR_LEN(pattern) > 0) {
+        iterator->pattern = zend_string_copy(pattern);
+    }
+    if (type && ZSTR_LEN(type) > 0) {
+        iterator->type = zend_string_copy(type);
+    }
+
+    /* A single cursor goes through the core, which follows slot migrations */
+    if (parallel == 1) {
+        iterator->sources         = ecalloc(1, sizeof(cluster_scan_source_t));
+        iterator->sources->cursor = estrdup("0");
+        iterator->source_count    = 1;
+    } else if (!load_node_sources(iterator, valkey_glide->glide_client)) {
+        VALKEY_LOG_ERROR("cluster_scan", "Failed to list the cluster primaries");
+        return 0;
+    }
+
+    build_scan_args(iterator, count, parallel > 1);
+    return 1;
+}
+
+/* Class methods implementation */
+
+PHP_METHOD(ClusterScanIterator, __construct) {
+    /* Instances are only created by ValkeyGlideCluster::scanIterator() */
+    ZEND_PARSE_PARAMETERS_NONE();
+}
+
+/**
+ * current(): The key at the current position
+ */
+PHP_METHOD(ClusterScanIterator, current) {
+    cluster_scan_iterator_object* iterator;
+    zval*                         value;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    iterator = CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(getThis());
+    if (!cluster_scan_iterator_fetch(iterator)) {
+        RETURN_NULL();
+    }
+
+    value = zend_hash_index_find(Z_ARRVAL(iterator->page), iterator->page_pos);
+    if (!value) {
+        RETURN_NULL();
+    }
+    RETURN_COPY(value);
+}
+
+/**
+ * key(): Number of keys returned before the current one
+ */
+PHP_METHOD(ClusterScanIterator, key) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG(CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(getThis())->position);
+}
+
+PHP_METHOD(ClusterScanIterator, next) {
+    cluster_scan_iterator_object* iterator;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    iterator = CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(getThis());
+    if (cluster_scan_iterator_fetch(iterator)) {
+        iterator->page_pos++;
+        iterator->position++;
+    }
+}
+
+/**
+ * rewind(): Starts the scan. A scan cannot be restarted, so rewinding an
+ * iterator that has already advanced does nothing.
+ */
+PHP_METHOD(ClusterScanIterator, rewind) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    cluster_scan_iterator_fetch(CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(getThis()));
+}
+
+PHP_METHOD(ClusterScanIterator, valid) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_BOOL(cluster_scan_iterator_fetch(CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(getThis())));
+}
+
+/* Class registration function using generated arginfo */
+void register_cluster_scan_iterator_class(void) {
+    cluster_scan_iterator_ce                = register_class_ClusterScanIterator(zend_ce_iterator);
+    cluster_scan_iterator_ce->create_object = create_cluster_scan_iterator_object;
+
+    memcpy(&cluster_scan_iterator_object_handlers,
+           zend_get_std_object_handlers(),
+           sizeof(cluster_scan_iterator_object_handlers));
+    cluster_scan_iterator_object_handlers.offset   = XtOffsetOf(cluster_scan_iterator_object, std);
+    cluster_scan_iterator_object_handlers.free_obj = free_cluster_scan_iterator_object;
+    cluster_scan_iterator_object_handlers.clone_obj = NULL;
+}
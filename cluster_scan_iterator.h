@@ -0,0 +1,62 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef CLUSTER_SCAN_ITERATOR_H
+#define CLUSTER_SCAN_ITERATOR_H
+
+#include "common.h"
+#include "php.h"
+#include "valkey_glide_future.h"
+
+/*
+ * One cursor being walked. With parallel == 1 there is a single source using
+ * the core's cluster-wide scan cursor; otherwise there is one per primary,
+ * each running plain SCAN routed to its address.
+ */
+typedef struct {
+    char*                         cursor;      /* emalloc'd, "0" before the first page */
+    uint8_t*                      route_bytes; /* Node address route, NULL for the core cursor */
+    size_t                        route_bytes_len;
+    valkey_glide_async_request_t* request; /* Page in flight, NULL if none */
+    bool                          finished;
+} cluster_scan_source_t;
+
+/* ClusterScanIterator object structure */
+typedef struct {
+    zval                   client;       /* Owning client, kept alive while iterating */
+    const void*            async_client; /* Connection the pages are fetched on */
+    cluster_scan_source_t* sources;
+    size_t                 source_count;
+    size_t                 parallel;     /* Most pages in flight at once */
+    size_t                 next_source;  /* Round-robin start for dispatching */
+    uintptr_t*             args;         /* Request arguments, built once */
+    unsigned long*         args_len;
+    unsigned long          arg_count;
+    zend_string*           pattern;
+    zend_string*           type;
+    char                   count[MAX_LENGTH_OF_LONG];
+    zval                   page;     /* Keys of the current page */
+    uint32_t               page_pos; /* Position inside page */
+    zend_long              position; /* Position across the whole scan */
+    bool                   started;
+    zend_object            std; /* Standard PHP object */
+} cluster_scan_iterator_object;
+
+/* Class entry */
+extern zend_class_entry* cluster_scan_iterator_ce;
+
+/* Class methods */
+PHP_METHOD(ClusterScanIterator, __construct);
+PHP_METHOD(ClusterScanIterator, current);
+PHP_METHOD(ClusterScanIterator, key);
+PHP_METHOD(ClusterScanIterator, next);
+PHP_METHOD(ClusterScanIterator, rewind);
+PHP_METHOD(ClusterScanIterator, valid);
+
+/* Helper macros */
+#define CLUSTER_SCAN_ITERATOR_ZVAL_GET_OBJECT(zv) \
+    VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(cluster_scan_iterator_object, zv)
+
+/* Class registration function */
+void register_cluster_scan_iterator_class(void);
+
+#endif /* CLUSTER_SCAN_ITERATOR_H */
@@ -0,0 +1,50 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * ClusterScanIterator yields the keys of a cluster-wide SCAN one at a time.
+ *
+ * Instances are returned by ValkeyGlideCluster::scanIterator(). The next page of keys is
+ * requested in the background while the current one is consumed. Keys are the number of
+ * keys returned before the current one. The iterator is forward-only.
+ */
+final class ClusterScanIterator implements Iterator
+{
+    private function __construct()
+    {
+    }
+
+    /**
+     * Get the key at the current position.
+     */
+    public function current(): mixed
+    {
+    }
+
+    /**
+     * Get the number of keys returned before the current one.
+     */
+    public function key(): int
+    {
+    }
+
+    public function next(): void
+    {
+    }
+
+    /**
+     * Start the scan. Does nothing once the iterator has advanced.
+     */
+    public function rewind(): void
+    {
+    }
+
+    public function valid(): bool
+    {
+    }
+}
@@ -21,34 +21,15 @@
 #include "include/glide_bindings.h"
 #include "logger.h"
 #include "valkey_glide_commands_common.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_numeric.h"
 #include "valkey_glide_otel.h"
+#include "valkey_glide_route.h"
+#include "valkey_glide_serializer.h"
+#include "valkey_glide_stats.h"
 
 #define DEBUG_COMMAND_RESPONSE_TO_ZVAL 0
 
-/* Parse a cluster route from a zval parameter */
-typedef struct {
-    enum {
-        ROUTE_TYPE_KEY,       /* Route by key */
-        ROUTE_TYPE_HOST_PORT, /* Route by host:port */
-        ROUTE_TYPE_SIMPLE     /* Simple route: "randomNode", "allPrimaries", "allNodes" */
-    } type;
-
-    union {
-        struct {
-            char*  key;
-            size_t key_len;
-            int    key_allocated; /* Flag to indicate if key was dynamically allocated */
-        } key_route;
-
-        struct {
-            char* host;
-            int   port;
-        } host_port_route;
-
-        int simple_route_type; /* Using SimpleRoutes_C enum values */
-    } data;
-} cluster_route_t;
-
 /* Parse a cluster route parameter from a zval */
 int parse_cluster_route(zval* route_zval, cluster_route_t* route) {
     /* Default to route by key */
@@ -236,40 +217,14 @@ uint8_t* create_route_bytes_from_route(cluster_route_t* route, size_t* route_byt
     return route_bytes;
 }
 
-/* Execute a command and handle common error checking */
-CommandResult* execute_command_with_route(const void*          glide_client,
-                                          enum RequestType     command_type,
-                                          unsigned long        arg_count,
-                                          const uintptr_t*     args,
-                                          const unsigned long* args_len,
-                                          zval*                arg_route) {
-    /* Validate route parameter */
-    if (!arg_route) {
-        VALKEY_LOG_ERROR("route_processing", "arg_route is NULL");
-        return NULL;
-    }
-
-    /* Parse the route from the first parameter */
-    cluster_route_t route;
-    memset(&route, 0, sizeof(cluster_route_t));
-    if (!parse_cluster_route(arg_route, &route)) {
-        /* Failed to parse the route */
-        VALKEY_LOG_ERROR("route_processing", "Failed to parse cluster route");
-        return NULL;
-    }
-
-    /* Create serialized route bytes */
-    size_t   route_bytes_len = 0;
-    uint8_t* route_bytes     = create_route_bytes_from_route(&route, &route_bytes_len);
-    if (!route_bytes) {
-        VALKEY_LOG_ERROR("route_processing", "Failed to create route bytes");
-        /* Free dynamically allocated key if needed before returning */
-        if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
-            efree(route.data.key_route.key);
-        }
-        return NULL;
-    }
-
+/* Execute a command with already serialized route bytes */
+CommandResult* execute_command_with_route_bytes(const void*          glide_client,
+                                                enum RequestType     command_type,
+                                                unsigned long        arg_count,
+                                                const uintptr_t*     args,
+                                                const unsigned long* args_len,
+                                                const uint8_t*       route_bytes,
+                                                size_t               route_bytes_len) {
     /* Validate all parameters before FFI call */
     if (!glide_client) {
         VALKEY_LOG_ERROR("parameter_validation", "glide_client is NULL");
@@ -300,6 +255,7 @@ CommandResult* execute_command_with_route(const void*          glide_client,
 
     /* Create OTEL span for tracing */
     uint64_t span_ptr = valkey_glide_create_span(command_type);
+    uint64_t start_ns = valkey_glide_stats_now();
 
     /* Execute the command */
     CommandResult* result = command(glide_client,
@@ -313,19 +269,13 @@ CommandResult* execute_command_with_route(const void*          glide_client,
                                     span_ptr         /* span pointer */
     );
 
+    valkey_glide_stats_record_command(
+        glide_client, command_type, start_ns, arg_count, args_len, result);
+    valkey_glide_near_cache_invalidate_args(glide_client, command_type, args, args_len, arg_count);
+
     /* Cleanup span */
     valkey_glide_drop_span(span_ptr);
 
-    /* Free route bytes */
-    if (route_bytes) {
-        efree(route_bytes);
-    }
-
-    /* Free dynamically allocated key if needed */
-    if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
-        efree(route.data.key_route.key);
-    }
-
     /* Validate result before returning */
     if (!result) {
         VALKEY_LOG_ERROR("command_response", "Command execution returned NULL result");
@@ -340,6 +290,85 @@ CommandResult* execute_command_with_route(const void*          glide_client,
     return result;
 }
 
+CommandResult* execute_command_with_route(const void*          glide_client,
+                                          enum RequestType     command_type,
+                                          unsigned long        arg_count,
+                                          const uintptr_t*     args,
+                                          const unsigned long* args_len,
+                                          zval*                arg_route) {
+    /* Validate route parameter */
+    if (!arg_route) {
+        VALKEY_LOG_ERROR("route_processing", "arg_route is NULL");
+        return NULL;
+    }
+
+    /* ValkeyGlideRoute objects and the simple-route keywords are packed only once */
+    size_t         route_bytes_len = 0;
+    const uint8_t* packed_route    = valkey_glide_route_get_packed(arg_route, &route_bytes_len);
+    if (packed_route) {
+        return execute_command_with_route_bytes(
+            glide_client, command_type, arg_count, args, args_len, packed_route, route_bytes_len);
+    }
+
+    /* Parse the route from the first parameter */
+    cluster_route_t route;
+    memset(&route, 0, sizeof(cluster_route_t));
+    if (!parse_cluster_route(arg_route, &route)) {
+        /* Failed to parse the route */
+        VALKEY_LOG_ERROR("route_processing", "Failed to parse cluster route");
+        return NULL;
+    }
+
+    /* Create serialized route bytes */
+    uint8_t* route_bytes = create_route_bytes_from_route(&route, &route_bytes_len);
+    if (!route_bytes) {
+        VALKEY_LOG_ERROR("route_processing", "Failed to create route bytes");
+        /* Free dynamically allocated key if needed before returning */
+        if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
+            efree(route.data.key_route.key);
+        }
+        return NULL;
+    }
+
+    CommandResult* result = execute_command_with_route_bytes(
+        glide_client, command_type, arg_count, args, args_len, route_bytes, route_bytes_len);
+
+    /* Free route bytes */
+    efree(route_bytes);
+
+    /* Free dynamically allocated key if needed */
+    if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
+        efree(route.data.key_route.key);
+    }
+
+    return result;
+}
+
+/* Serialize a route once, for commands that are sent later */
+uint8_t* pack_cluster_route(zval* arg_route, size_t* route_bytes_len) {
+    size_t         packed_len   = 0;
+    const uint8_t* packed_route = valkey_glide_route_get_packed(arg_route, &packed_len);
+    if (packed_route) {
+        uint8_t* route_bytes = emalloc(packed_len);
+        memcpy(route_bytes, packed_route, packed_len);
+        *route_bytes_len = packed_len;
+        return route_bytes;
+    }
+
+    cluster_route_t route;
+    memset(&route, 0, sizeof(cluster_route_t));
+    if (!parse_cluster_route(arg_route, &route)) {
+        VALKEY_LOG_ERROR("route_processing", "Failed to parse cluster route");
+        return NULL;
+    }
+
+    uint8_t* route_bytes = create_route_bytes_from_route(&route, route_bytes_len);
+    if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
+        efree(route.data.key_route.key);
+    }
+    return route_bytes;
+}
+
 /* Execute a command and handle common error checking */
 CommandResult* execute_command(const void*          glide_client,
                                enum RequestType     command_type,
@@ -353,6 +382,7 @@ CommandResult* execute_command(const void*          glide_client,
 
     /* Create OTEL span for tracing */
     uint64_t span_ptr = valkey_glide_create_span(command_type);
+    uint64_t start_ns = valkey_glide_stats_now();
 
     /* Execute the command with span support */
     CommandResult* result = command(glide_client,
@@ -366,14 +396,33 @@ CommandResult* execute_command(const void*          glide_client,
                                     span_ptr      /* span pointer */
     );
 
+    valkey_glide_stats_record_command(
+        glide_client, command_type, start_ns, arg_count, args_len, result);
+    valkey_glide_near_cache_invalidate_args(glide_client, command_type, args, args_len, arg_count);
+
     /* Cleanup span */
     valkey_glide_drop_span(span_ptr);
 
     return result;
 }
 
+/* Build a zend_string from a String response */
+zend_string* command_response_to_zend_string(const CommandResponse* response) {
+    size_t len = response->string_value_len;
+
+    if (len == 0) {
+        return ZSTR_EMPTY_ALLOC();
+    }
+    if (len == 1) {
+        return ZSTR_CHAR((zend_uchar) response->string_value[0]);
+    }
+
+    /* Copy the binary data once, directly into the zend_string that ends up in the zval */
+    return zend_string_init(response->string_value, len, 0);
+}
+
 /* Handle a string response */
-int handle_string_response(CommandResult* result, char** output, size_t* output_len) {
+int handle_string_response(CommandResult* result, zend_string** output) {
     /* Check if the command was successful */
     if (!result) {
         return -1;
@@ -394,39 +443,15 @@ int handle_string_response(CommandResult* result, char** output, size_t* output_
     if (result->response) {
         switch (result->response->response_type) {
             case String:
-
                 /* Command returns a string/binary data */
-                if (result->response->string_value_len == 0) {
-                    *output = emalloc(1);  // Allocate at least one byte using PHP's memory manager
-                    if (*output) {
-                        (*output)[0] = '\0';  // Empty string is still null-terminated
-                    }
-                    *output_len = 0;
-                } else {
-                    // Allocate exact size needed for binary data using PHP's memory manager
-                    *output = emalloc(result->response->string_value_len + 1);
-                    (*output)[result->response->string_value_len] = '\0';
-                    if (*output) {
-                        // Copy binary data without assuming null-termination
-                        memcpy(*output,
-                               result->response->string_value,
-                               result->response->string_value_len);
-                    }
-                    *output_len = result->response->string_value_len;
-                }
-                // Check if allocation failed
-                if (!*output) {
-                    ret_val = -1;  // Memory allocation failed
-                } else {
-                    ret_val = 1;  // Success
-                }
+                *output = command_response_to_zend_string(result->response);
+                ret_val = 1;
                 break;
             case Null:
 
                 /* Key didn't exist, return NULL */
-                *output     = NULL;
-                *output_len = 0;
-                ret_val     = 0;
+                *output = NULL;
+                ret_val = 0;
                 break;
             default:
 
@@ -500,7 +525,7 @@ int command_response_to_zval(CommandResponse* response,
                                  "CommandResponse is String with length: %ld",
                                  response->string_value_len);
 #endif
-            ZVAL_STRINGL(output, response->string_value, response->string_value_len);
+            ZVAL_STR(output, command_response_to_zend_string(response));
             return 1;
         case Array:
 #if DEBUG_COMMAND_RESPONSE_TO_ZVAL
@@ -526,7 +551,7 @@ int command_response_to_zval(CommandResponse* response,
                                              use_false_if_null);
 
                     if (Z_TYPE(field) == IS_STRING) {
-                        add_assoc_zval(output, Z_STRVAL(field), &value);
+                        zend_symtable_update(Z_ARRVAL_P(output), Z_STR(field), &value);
                         zval_dtor(&field);
                     } else {
                         zval_dtor(&field);
@@ -640,10 +665,8 @@ int command_response_to_zval(CommandResponse* response,
 
                 if (use_associative_array != COMMAND_RESPONSE_NOT_ASSOSIATIVE &&
                     Z_TYPE(key) == IS_STRING) {
-                    // printf("%s:%d - DEBUG: Adding key %s \n", __FILE__, __LINE__,
-                    // Z_STRVAL(key)); php_var_dump(&value, 2); // No need to modify this as
-                    // it's not printf
-                    add_assoc_zval(output, Z_STRVAL(key), &value);
+                    /* The key string is hashed once and kept, binary keys included */
+                    zend_symtable_update(Z_ARRVAL_P(output), Z_STR(key), &value);
                     zval_dtor(&key);  // Clean up the key since we're using it as an index
                 } else {
                     // Add the key as a separate array element (original behavior)
@@ -662,7 +685,7 @@ int command_response_to_zval(CommandResponse* response,
                 CommandResponse* set_item = &response->sets_value[i];
 
                 if (set_item->response_type == String) {
-                    ZVAL_STRINGL(&value, set_item->string_value, set_item->string_value_len);
+                    ZVAL_STR(&value, command_response_to_zend_string(set_item));
                     add_next_index_zval(output, &value);
                 }
             }
@@ -680,133 +703,296 @@ int command_response_to_zval(CommandResponse* response,
     }
 }
 
+/* One reply element, with plain strings converted inline */
+static inline void element_to_zval(const valkey_glide_codec_t* codec,
+                                   CommandResponse*            element,
+                                   zval*                       output,
+                                   int                         use_associative_array,
+                                   bool                        use_false_if_null) {
+    if (element->response_type == String && !codec) {
+        ZVAL_STR(output, command_response_to_zend_string(element));
+    } else {
+        valkey_glide_response_to_zval(
+            codec, element, output, use_associative_array, use_false_if_null);
+    }
+}
+
+/* Append a map entry whose key is not a string as a key, value pair, like the generic path */
+static void append_map_entry_as_pair(HashTable*       table,
+                                     CommandResponse* element,
+                                     zval*            value,
+                                     int              use_associative_array,
+                                     bool             use_false_if_null) {
+    zval key;
+
+    if (element->map_key) {
+        command_response_to_zval(element->map_key, &key, use_associative_array, use_false_if_null);
+    } else {
+        ZVAL_NULL(&key);
+    }
+    zend_hash_next_index_insert(table, &key);
+    zend_hash_next_index_insert(table, value);
+}
+
+int command_response_to_string_list(const valkey_glide_codec_t* codec,
+                                    CommandResponse*            response,
+                                    zval*                       output,
+                                    int                         use_associative_array,
+                                    bool                        use_false_if_null) {
+    CommandResponse* elements;
+    int64_t          count;
+    bool             strings_only;
+    int64_t          i;
+
+    if (!response) {
+        ZVAL_NULL(output);
+        return 0;
+    }
+    if (response->response_type == Array &&
+        (use_associative_array == COMMAND_RESPONSE_NOT_ASSOSIATIVE ||
+         (!codec && use_associative_array != COMMAND_RESPONSE_SCAN_ASSOSIATIVE_ARRAY &&
+          use_associative_array != COMMAND_RESPONSE_ARRAY_ASSOCIATIVE))) {
+        elements     = response->array_value;
+        count        = response->array_value_len;
+        strings_only = false;
+    } else if (response->response_type == Sets && !codec) {
+        elements     = response->sets_value;
+        count        = response->sets_value_len;
+        strings_only = true;
+    } else {
+        return valkey_glide_response_to_zval(
+            codec, response, output, use_associative_array, use_false_if_null);
+    }
+
+    array_init_size(output, (uint32_t) count);
+    zend_hash_real_init_packed(Z_ARRVAL_P(output));
+    ZEND_HASH_FILL_PACKED(Z_ARRVAL_P(output)) {
+        for (i = 0; i < count; i++) {
+            zval value;
+
+            /* Sets only ever carry strings, anything else is dropped as before */
+            if (strings_only && elements[i].response_type != String) {
+                continue;
+            }
+            element_to_zval(codec, &elements[i], &value, use_associative_array, use_false_if_null);
+            ZEND_HASH_FILL_ADD(&value);
+        }
+    }
+    ZEND_HASH_FILL_END();
+    return 1;
+}
+
+int command_response_to_string_map(const valkey_glide_codec_t* codec,
+                                   CommandResponse*            response,
+                                   zval*                       output,
+                                   int                         use_associative_array,
+                                   bool                        use_false_if_null) {
+    HashTable* table;
+    int64_t    i;
+
+    if (!response || response->response_type != Map ||
+        (use_associative_array != COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP &&
+         (codec || use_associative_array != COMMAND_RESPONSE_ARRAY_ASSOCIATIVE))) {
+        return valkey_glide_response_to_zval(
+            codec, response, output, use_associative_array, use_false_if_null);
+    }
+
+    array_init_size(output, (uint32_t) response->array_value_len);
+    table = Z_ARRVAL_P(output);
+    for (i = 0; i < response->array_value_len; i++) {
+        CommandResponse* element = &response->array_value[i];
+        zval             value;
+
+        if (element->map_value) {
+            element_to_zval(
+                codec, element->map_value, &value, use_associative_array, use_false_if_null);
+        } else {
+            ZVAL_NULL(&value);
+        }
+
+        /* Field names are hashed straight from the reply buffer, numeric ones as integers */
+        if (element->map_key && element->map_key->response_type == String) {
+            zend_symtable_str_update(
+                table, element->map_key->string_value, element->map_key->string_value_len, &value);
+        } else {
+            append_map_entry_as_pair(
+                table, element, &value, use_associative_array, use_false_if_null);
+        }
+    }
+    return 1;
+}
+
+int command_response_to_score_map(CommandResponse* response, zval* output, bool use_false_if_null) {
+    HashTable* table;
+    int64_t    i;
+
+    if (response && response->response_type == Array) {
+        /* [[member, score], ...], entries of another shape are skipped */
+        array_init_size(output, (uint32_t) response->array_value_len);
+        table = Z_ARRVAL_P(output);
+        for (i = 0; i < response->array_value_len; i++) {
+            CommandResponse* pair = &response->array_value[i];
+            zval             score;
+
+            if (pair->response_type != Array || pair->array_value_len != 2 ||
+                pair->array_value[0].response_type != String) {
+                continue;
+            }
+            if (pair->array_value[1].response_type == Float) {
+                ZVAL_DOUBLE(&score, pair->array_value[1].float_value);
+            } else {
+                command_response_to_zval(&pair->array_value[1],
+                                         &score,
+                                         COMMAND_RESPONSE_NOT_ASSOSIATIVE,
+                                         use_false_if_null);
+            }
+            zend_symtable_str_update(table,
+                                     pair->array_value[0].string_value,
+                                     pair->array_value[0].string_value_len,
+                                     &score);
+        }
+        return 1;
+    }
+    if (!response || response->response_type != Map) {
+        return command_response_to_zval(
+            response, output, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, use_false_if_null);
+    }
+
+    array_init_size(output, (uint32_t) response->array_value_len);
+    table = Z_ARRVAL_P(output);
+    for (i = 0; i < response->array_value_len; i++) {
+        CommandResponse* element = &response->array_value[i];
+        zval             score;
+
+        if (element->map_value && element->map_value->response_type == Float) {
+            ZVAL_DOUBLE(&score, element->map_value->float_value);
+        } else {
+            command_response_to_zval(element->map_value,
+                                     &score,
+                                     COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP,
+                                     use_false_if_null);
+        }
+
+        if (element->map_key && element->map_key->response_type == String) {
+            zend_symtable_str_update(
+                table, element->map_key->string_value, element->map_key->string_value_len, &score);
+        } else {
+            append_map_entry_as_pair(
+                table, element, &score, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, use_false_if_null);
+        }
+    }
+    return 1;
+}
+
 /* Convert a long value to a string */
 char* long_to_string(long value, size_t* len) {
-    char buffer[32];
-    *len      = snprintf(buffer, sizeof(buffer), "%ld", value);
-    char* str = (char*) emalloc(*len + 1);
-    if (str) {
-        memcpy(str, buffer, *len);
-        str[*len] = '\0';
-    }
-    return str;
+    return valkey_glide_long_estrdup(value, len);
 }
 
 /* Convert a double value to a string */
 char* double_to_string(double value, size_t* len) {
-    char buffer[64];
-    /* Use %.6g format to get a more user-friendly representation */
-    *len      = snprintf(buffer, sizeof(buffer), "%.6g", value);
-    char* str = (char*) emalloc(*len + 1);
-    if (str) {
-        memcpy(str, buffer, *len);
-        str[*len] = '\0';
+    return valkey_glide_double_estrdup(value, len);
+}
+
+/*
+ * Field names repeat across the entries of a stream reply, so each distinct
+ * name is built once and the same string keys every entry. Its hash is kept
+ * in the string for the inserts; finding it again hashes the reply bytes.
+ */
+static zend_string* stream_field_name(HashTable* names, const CommandResponse* field) {
+    zval*        known = zend_hash_str_find(names, field->string_value, field->string_value_len);
+    zend_string* name;
+    zval         entry;
+
+    if (known) {
+        return zend_string_copy(Z_STR_P(known));
     }
-    return str;
+
+    name = command_response_to_zend_string(field);
+    zend_string_hash_val(name);
+    ZVAL_STR_COPY(&entry, name);
+    zend_hash_add_new(names, name, &entry);
+    return name;
 }
+
+/* Add one field of a stream entry under its shared name */
+static void stream_field_add(HashTable*             fields,
+                             HashTable*             names,
+                             const CommandResponse* field,
+                             CommandResponse*       value) {
+    zend_string* name = stream_field_name(names, field);
+    zval         converted;
+
+    command_response_to_zval(value, &converted, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+    zend_symtable_update(fields, name, &converted);
+    zend_string_release(name);
+}
+
 /* Helper function to convert a CommandResponse to a PHP stream format
  * This is specifically for XRANGE/XREVRANGE commands that return stream entries
  * We need to handle both Array and Map response types
  * The output should be: ["stream_id" => ["field1" => "value1", "field2" => "value2", ...]]
  */
 int command_response_to_stream_zval(CommandResponse* response, zval* output) {
-    // printf("%s:%d - ------------------------------------------------\n", __FILE__, __LINE__);
+    HashTable* table;
+    HashTable  names;
+    int64_t    i, j;
+
     if (!response) {
-        // printf("%s:%d - DEBUG: Response is NULL\n", __FILE__, __LINE__);
         ZVAL_NULL(output);
         return 0;
     }
-    array_init(output);
 
-    /* Handle different response types */
-    // printf("%s:%d - DEBUG: Processing command response of type %d\n", __FILE__, __LINE__,
-    // response->response_type);
     switch (response->response_type) {
         case Map:
-            /* Process map response where keys are stream IDs and values are field-value pairs
-             */
-            for (int i = 0; i < response->array_value_len; i++) {
+            /* Keys are stream IDs, values the entry's field-value pairs */
+            array_init_size(output, (uint32_t) response->array_value_len);
+            table = Z_ARRVAL_P(output);
+            zend_hash_init(&names, 8, NULL, ZVAL_PTR_DTOR, 0);
+            for (i = 0; i < response->array_value_len; i++) {
                 CommandResponse* element = &response->array_value[i];
+                CommandResponse* pairs;
+                zval             fields;
 
-                /* Skip if we don't have both key and value */
-                if (!element->map_key || !element->map_value) {
+                if (!element->map_key || !element->map_value ||
+                    element->map_key->response_type != String) {
                     continue;
                 }
 
-                /* Extract stream ID from key */
-                if (element->map_key->response_type != String) {
+                pairs = element->map_value;
+                if (pairs->response_type != Array && pairs->response_type != Map) {
                     continue;
                 }
 
-                char*  stream_id     = element->map_key->string_value;
-                size_t stream_id_len = element->map_key->string_value_len;
-                // printf("%s:%d - NEW STREAM ID: %.*s\n", __FILE__, __LINE__,
-                // (int)stream_id_len, stream_id);
-
-                /* Create associative array for field-value pairs */
-
-                // printf("%s:%d - DEBUG: Processing stream ID: %.*s,
-                // element->map_value->response_type = %d\n", __FILE__, __LINE__,
-                // (int)stream_id_len, stream_id, element->map_value->response_type);
-                /* Process nested field-value pairs - add safety check */
-                if (element->map_value->response_type == Array) {
-                    zval field_array;
-                    array_init(&field_array);
-                    /* Safe version that checks array bounds */
-                    if (element->map_value->array_value_len > 0) {
-                        // printf("%s:%d - DEBUG: Processing Array response for stream ID: %.*s,
-                        // array_value_len = %ld\n", __FILE__, __LINE__, (int)stream_id_len,
-                        // stream_id, element->map_value->array_value_len);
-                        CommandResponse* field_resp1 = &element->map_value->array_value[0];
-
-                        if (field_resp1->response_type == Array &&
-                            field_resp1->array_value_len == 2) {
-                            zval field, value;
-                            command_response_to_zval(&field_resp1->array_value[0],
-                                                     &field,
-                                                     COMMAND_RESPONSE_NOT_ASSOSIATIVE,
-                                                     false);
-                            command_response_to_zval(&field_resp1->array_value[1],
-                                                     &value,
-                                                     COMMAND_RESPONSE_NOT_ASSOSIATIVE,
-                                                     false);
-
-                            if (Z_TYPE(field) == IS_STRING) {
-                                // printf("%s:%d - DEBUG: Adding field %s with value %s\n",
-                                // __FILE__, __LINE__, Z_STRVAL(field), Z_STRVAL(value));
-                                add_assoc_zval(&field_array, Z_STRVAL(field), &value);
-                                zval_dtor(&field);
-                            } else {
-                                zval_dtor(&field);
-                                zval_dtor(&value);
-                            }
+                array_init_size(&fields, (uint32_t) pairs->array_value_len);
+                for (j = 0; j < pairs->array_value_len; j++) {
+                    CommandResponse* pair = &pairs->array_value[j];
+
+                    if (pairs->response_type == Map) {
+                        /* {field: value, ...} */
+                        if (pair->map_key && pair->map_key->response_type == String) {
+                            stream_field_add(
+                                Z_ARRVAL(fields), &names, pair->map_key, pair->map_value);
                         }
+                    } else if (pair->response_type == Array && pair->array_value_len == 2 &&
+                               pair->array_value[0].response_type == String) {
+                        /* [[field, value], ...] */
+                        stream_field_add(
+                            Z_ARRVAL(fields), &names, &pair->array_value[0], &pair->array_value[1]);
                     }
-                    /* Add the stream entry to the output array */
-                    add_assoc_zval_ex(output, stream_id, stream_id_len, &field_array);
-                } else if (element->map_value->response_type == Map) {
-                    CommandResponse* map = element->map_value;
-                    // printf("%s:%d - DEBUG: Processing Map response for stream ID: %.*s,
-                    // map->array_value_len = %ld\n", __FILE__, __LINE__, (int)stream_id_len,
-                    // stream_id, map->array_value_len); printf("%s:%d - DEBUG: Map response
-                    // type = %d\n", __FILE__, __LINE__, map->response_type);
-                    zval output1;
-                    command_response_to_zval(
-                        map, &output1, COMMAND_RESPONSE_ARRAY_ASSOCIATIVE, false);
-                    add_assoc_zval_ex(output, stream_id, stream_id_len, &output1);
-                } else {
-                    // printf("%s:%d - DEBUG: Unexpected response type for stream fields: %d\n",
-                    // __FILE__, __LINE__, element->map_value->response_type);
                 }
+
+                zend_symtable_str_update(table,
+                                         element->map_key->string_value,
+                                         element->map_key->string_value_len,
+                                         &fields);
             }
+            zend_hash_destroy(&names);
             break;
         case Null:
-            /* If the response is Null, set output to NULL */
-            // printf("%s:%d - DEBUG: Response is Null\n", __FILE__, __LINE__);
+            array_init(output);
             break;
-
         default:
-            zval_dtor(output); /* Clean up the initialized array */
             ZVAL_NULL(output);
             return 0;
     }
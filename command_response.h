@@ -51,15 +51,35 @@ CommandResult* execute_command_with_route(const void*          glide_client,
                                           const unsigned long* args_len,
                                           zval*                arg_route);
 
+/* Same as execute_command_with_route, for a route already serialized by pack_cluster_route */
+CommandResult* execute_command_with_route_bytes(const void*          glide_client,
+                                                enum RequestType     command_type,
+                                                unsigned long        arg_count,
+                                                const uintptr_t*     args,
+                                                const unsigned long* args_len,
+                                                const uint8_t*       route_bytes,
+                                                size_t               route_bytes_len);
+
+/*
+ * Serialize a route for a command that is sent later, as a queued batch command is.
+ * Returns emalloc'd bytes the caller frees, or NULL if the route cannot be parsed.
+ */
+uint8_t* pack_cluster_route(zval* arg_route, size_t* route_bytes_len);
 
 /*
  * Handle a string response
  * Returns 1 on success, 0 if the key doesn't exist, -1 on error
- * The output and output_len parameters are set to the string value and length
- * The caller is responsible for freeing the output string using efree()
+ * The output parameter is set to a zend_string built straight from the FFI buffer
+ * The caller owns the returned reference (release it or hand it to a zval)
  * This function frees the CommandResult
  */
-int handle_string_response(CommandResult* result, char** output, size_t* output_len);
+int handle_string_response(CommandResult* result, zend_string** output);
+
+/*
+ * Build a zend_string from a String response with a single copy out of the FFI buffer
+ * Empty and single-byte replies reuse PHP's interned strings and allocate nothing
+ */
+zend_string* command_response_to_zend_string(const CommandResponse* response);
 
 /*
  * Handle a map response
@@ -82,6 +102,36 @@ int command_response_to_zval(CommandResponse* response,
                              int              use_associative_array,
                              bool             use_false_if_null);
 
+struct valkey_glide_codec;
+
+/*
+ * Typed converters for the hot reply shapes. Each pre-sizes its table from the
+ * reply length and fills it in one pass, converting plain strings inline; any
+ * other element, or a reply of another shape, goes through the generic
+ * conversion with the same flags, so the result matches it. A codec, when
+ * given, decodes values but never keys or scores.
+ */
+
+/* Array or Set of strings to a list: LRANGE, SMEMBERS, MGET, ZRANGE */
+int command_response_to_string_list(const struct valkey_glide_codec* codec,
+                                    CommandResponse*                 response,
+                                    zval*                            output,
+                                    int                              use_associative_array,
+                                    bool                             use_false_if_null);
+
+/* Map of strings to an associative array: HGETALL */
+int command_response_to_string_map(const struct valkey_glide_codec* codec,
+                                   CommandResponse*                 response,
+                                   zval*                            output,
+                                   int                              use_associative_array,
+                                   bool                             use_false_if_null);
+
+/*
+ * Map of members to scores, or an Array of [member, score] pairs, to member => float:
+ * ZRANGE WITHSCORES, ZPOPMIN/ZPOPMAX, ZRANDMEMBER WITHSCORES
+ */
+int command_response_to_score_map(CommandResponse* response, zval* output, bool use_false_if_null);
+
 /*
  * Helper function to convert a long value to a string
  * Returns a newly allocated string or NULL on error
@@ -102,6 +102,19 @@ typedef struct {
 #define VALKEY_GLIDE_EXPONENT_BASE "exponent_base"
 #define VALKEY_GLIDE_JITTER_PERCENT "jitter_percent"
 #define VALKEY_GLIDE_CONNECTION_TIMEOUT "connection_timeout"
+#define VALKEY_GLIDE_PERSISTENT "persistent"
+#define VALKEY_GLIDE_NEAR_CACHE "near_cache"
+#define VALKEY_GLIDE_NEAR_CACHE_MAX_ENTRIES "max_entries"
+#define VALKEY_GLIDE_NEAR_CACHE_MAX_BYTES "max_bytes"
+#define VALKEY_GLIDE_NEAR_CACHE_TTL "ttl"
+#define VALKEY_GLIDE_NEAR_CACHE_BCAST "bcast"
+#define VALKEY_GLIDE_NEAR_CACHE_PREFIXES "prefixes"
+#define VALKEY_GLIDE_SERIALIZER "serializer"
+#define VALKEY_GLIDE_COMPRESSION "compression"
+#define VALKEY_GLIDE_COMPRESSION_ALGORITHM "algorithm"
+#define VALKEY_GLIDE_COMPRESSION_LEVEL "level"
+#define VALKEY_GLIDE_COMPRESSION_MIN_SIZE "min_size"
+#define VALKEY_GLIDE_COMPRESSION_DICTIONARY "dictionary"
 
 #define VALKEY_GLIDE_DEFAULT_NUM_OF_RETRIES 5
 #define VALKEY_GLIDE_DEFAULT_FACTOR 100
@@ -134,9 +147,46 @@ typedef struct {
     bool     use_insecure_tls; /* Whether to use insecure TLS (skips certificate verification) */
 } valkey_glide_tls_advanced_configuration_t;
 
+typedef struct {
+    size_t  max_entries;
+    size_t  max_bytes;
+    long    ttl;      /* Seconds an entry may be served, 0 for no limit */
+    bool    bcast;    /* Track key prefixes instead of the keys that were read */
+    char**  prefixes; /* BCAST prefixes, NULL for every key */
+    size_t* prefix_lens;
+    int     prefix_count;
+} valkey_glide_near_cache_config_t;
+
+/* Value serializers, numbered like the ValkeyGlide::SERIALIZER_* constants */
+typedef enum {
+    VALKEY_GLIDE_SERIALIZER_NONE     = 0,
+    VALKEY_GLIDE_SERIALIZER_PHP      = 1,
+    VALKEY_GLIDE_SERIALIZER_IGBINARY = 2,
+    VALKEY_GLIDE_SERIALIZER_MSGPACK  = 3
+} valkey_glide_serializer_t;
+
+/* Value compression, numbered like the ValkeyGlide::COMPRESSION_* constants */
+typedef enum {
+    VALKEY_GLIDE_COMPRESSION_NONE = 0,
+    VALKEY_GLIDE_COMPRESSION_LZ4  = 1,
+    VALKEY_GLIDE_COMPRESSION_ZSTD = 2
+} valkey_glide_compression_t;
+
+typedef struct {
+    valkey_glide_compression_t algorithm;
+    int                        level;      /* Algorithm specific, 0 for its default */
+    size_t                     min_size;   /* Shorter values are sent uncompressed */
+    char*                      dictionary; /* Zstd dictionary, NULL if none */
+    size_t                     dictionary_len;
+} valkey_glide_compression_config_t;
+
 typedef struct {
     int                                        connection_timeout; /* In milliseconds. */
     valkey_glide_tls_advanced_configuration_t* tls_config;         /* NULL if not set */
+    bool                                       persistent; /* Keep the client across requests */
+    valkey_glide_near_cache_config_t*          near_cache;  /* NULL if not set */
+    valkey_glide_serializer_t                  serializer;  /* Applied to values sent and read */
+    valkey_glide_compression_config_t*         compression; /* NULL if not set */
 } valkey_glide_advanced_base_client_configuration_t;
 
 typedef struct {
@@ -219,24 +269,71 @@ typedef int (*z_result_processor_t)(CommandResponse* response, void* output, zva
 /* Batch command structure for buffering commands - FFI aligned */
 struct batch_command {
     enum RequestType     request_type;
-    uint8_t**            args;        /* FFI expects uint8_t** */
-    uintptr_t*           arg_lengths; /* FFI expects uintptr_t* */
-    uintptr_t            arg_count;   /* FFI expects uintptr_t */
-    void*                result_ptr;  /* Pointer to store result */
+    size_t               first_arg;    /* Index of the first argument in the batch slab */
+    uintptr_t            arg_count;    /* FFI expects uintptr_t */
+    size_t               route_offset; /* Serialized route in the slab data, if route_len */
+    size_t               route_len;    /* 0 lets the core route the command */
+    void*                result_ptr;   /* Pointer to store result */
     z_result_processor_t process_result;
 };
 
+/* Contiguous storage for the arguments of every buffered batch command */
+typedef struct {
+    uint8_t*   data;          /* Argument payloads appended back to back */
+    size_t     data_len;      /* Bytes used in data */
+    size_t     data_capacity; /* Bytes allocated for data */
+    uintptr_t* args;          /* Offset of each argument in data, rewritten to pointers by exec */
+    uintptr_t* arg_lengths;   /* FFI expects uintptr_t* */
+    size_t     arg_count;     /* Arguments stored across all commands */
+    size_t     arg_capacity;  /* Slots allocated in args/arg_lengths */
+} valkey_glide_batch_slab_t;
+
+/* Commands buffered by multi()/pipeline(), laid out so batch() can be called without allocating */
+typedef struct {
+    struct batch_command*     commands;
+    size_t                    command_count;
+    size_t                    command_capacity;
+    valkey_glide_batch_slab_t slab;
+    struct CmdInfo*           cmd_infos;     /* One per buffered command */
+    const struct CmdInfo**    cmd_info_ptrs; /* BatchInfo.cmds view of cmd_infos */
+    bool                      frozen;        /* slab.args hold pointers rather than offsets */
+    size_t                    routed_count;  /* Commands carrying their own route */
+    struct BatchOptionsInfo   options;       /* Timeout and retry strategy for batch() */
+    bool                      has_options;   /* options was set by multi()/pipeline() */
+} valkey_glide_batch_buffer_t;
+
 typedef struct {
     const void* glide_client; /* Valkey Glide client pointer */
+    bool        persistent;   /* glide_client belongs to the persistent pool */
+
+    /* Async connection backing the *Async() methods, opened on first use */
+    const void* async_client;
+    uint8_t*    connection_request; /* Serialized request used to open async_client */
+    size_t      connection_request_len;
 
     /* Batch mode tracking */
     bool is_in_batch_mode;
     int  batch_type; /* ATOMIC, MULTI, or PIPELINE */
 
     /* Command buffering */
-    struct batch_command* buffered_commands;
-    size_t                command_count;
-    size_t                command_capacity;
+    valkey_glide_batch_buffer_t batch;
+
+    /* Pipeline auto-flush thresholds, 0 disables */
+    size_t flush_max_commands;
+    size_t flush_max_bytes;
+    zval   flushed_results; /* Replies of sub-batches already sent by auto-flush */
+
+    /* Client-side cache of glide_client, NULL unless advanced_config['near_cache'] is set */
+    struct valkey_glide_near_cache* near_cache;
+
+    /* Serializer and compression for values, NULL unless advanced_config sets either */
+    struct valkey_glide_codec* codec;
+
+    /* Subscriber connection and queued messages, NULL until the first subscribe() */
+    struct valkey_glide_pubsub* pubsub;
+
+    /* Scripts sent with EVAL in the current batch, NULL until the first one */
+    HashTable* scripts;
 
     zend_object std;
 } valkey_glide_object;
@@ -10,6 +10,24 @@ PHP_ARG_ENABLE(valkey_glide_debug, whether to enable debug mode,
 PHP_ARG_ENABLE(debug, whether to enable debug mode (alias for valkey-glide-debug),
 [  --enable-debug   Enable debug mode (alias for valkey-glide-debug)], no, no)
 
+PHP_ARG_ENABLE(valkey_glide_bench, whether to build the ValkeyGlideBench microbenchmark class,
+[  --enable-valkey-glide-bench   Build the ValkeyGlideBench class used by benchmarks/microbench.php], no, no)
+
+PHP_ARG_ENABLE(valkey_glide_trace_logging, whether to compile in debug and trace logging,
+[  --disable-valkey-glide-trace-logging   Compile out the extension's DEBUG and TRACE log statements], yes, no)
+
+PHP_ARG_ENABLE(valkey_glide_igbinary, whether to enable the igbinary serializer,
+[  --enable-valkey-glide-igbinary   Enable ValkeyGlide::SERIALIZER_IGBINARY (requires the igbinary extension)], no, no)
+
+PHP_ARG_ENABLE(valkey_glide_msgpack, whether to enable the msgpack serializer,
+[  --enable-valkey-glide-msgpack   Enable ValkeyGlide::SERIALIZER_MSGPACK (requires the msgpack extension)], no, no)
+
+PHP_ARG_ENABLE(valkey_glide_lz4, whether to enable LZ4 value compression,
+[  --enable-valkey-glide-lz4   Enable ValkeyGlide::COMPRESSION_LZ4 (requires liblz4)], no, no)
+
+PHP_ARG_ENABLE(valkey_glide_zstd, whether to enable Zstd value compression,
+[  --enable-valkey-glide-zstd   Enable ValkeyGlide::COMPRESSION_ZSTD (requires libzstd)], no, no)
+
 PHP_ARG_ENABLE(header_generation, whether to enable header generation during configure,
 [  --disable-header-generation   Skip header and protobuf generation during configure], yes, no)
 
@@ -68,6 +86,54 @@ if test "$PHP_VALKEY_GLIDE" != "no"; then
     LDFLAGS="$LDFLAGS $PHP_VALKEY_GLIDE_LDFLAGS"
   fi
   
+  if test "$PHP_VALKEY_GLIDE_BENCH" = "yes"; then
+    AC_DEFINE([VALKEY_GLIDE_BENCH], [1], [Define to build the ValkeyGlideBench class])
+  fi
+
+  if test "$PHP_VALKEY_GLIDE_TRACE_LOGGING" = "no"; then
+    AC_DEFINE([VALKEY_GLIDE_NO_TRACE_LOGGING], [1], [Define to compile out DEBUG and TRACE logging])
+  fi
+
+  dnl Optional serializers are built against the headers the other extension installs
+  if test "$PHP_VALKEY_GLIDE_IGBINARY" = "yes"; then
+    AC_MSG_CHECKING([for igbinary includes])
+    if test -f "$phpincludedir/ext/igbinary/igbinary.h"; then
+      AC_MSG_RESULT([$phpincludedir])
+      AC_DEFINE([VALKEY_GLIDE_IGBINARY], [1], [Define to enable the igbinary serializer])
+    else
+      AC_MSG_ERROR([igbinary headers not found. Please install the igbinary extension])
+    fi
+  fi
+
+  if test "$PHP_VALKEY_GLIDE_MSGPACK" = "yes"; then
+    AC_MSG_CHECKING([for msgpack includes])
+    if test -f "$phpincludedir/ext/msgpack/php_msgpack.h"; then
+      AC_MSG_RESULT([$phpincludedir])
+      AC_DEFINE([VALKEY_GLIDE_MSGPACK], [1], [Define to enable the msgpack serializer])
+    else
+      AC_MSG_ERROR([msgpack headers not found. Please install the msgpack extension])
+    fi
+  fi
+
+  dnl Optional compression libraries
+  if test "$PHP_VALKEY_GLIDE_LZ4" = "yes"; then
+    PHP_CHECK_LIBRARY(lz4, LZ4_compress_HC, [
+      PHP_ADD_LIBRARY(lz4, 1, VALKEY_GLIDE_SHARED_LIBADD)
+      AC_DEFINE([VALKEY_GLIDE_LZ4], [1], [Define to enable LZ4 value compression])
+    ], [
+      AC_MSG_ERROR([lz4 library not found. Please install liblz4-dev])
+    ])
+  fi
+
+  if test "$PHP_VALKEY_GLIDE_ZSTD" = "yes"; then
+    PHP_CHECK_LIBRARY(zstd, ZSTD_createCDict, [
+      PHP_ADD_LIBRARY(zstd, 1, VALKEY_GLIDE_SHARED_LIBADD)
+      AC_DEFINE([VALKEY_GLIDE_ZSTD], [1], [Define to enable Zstd value compression])
+    ], [
+      AC_MSG_ERROR([zstd library not found. Please install libzstd-dev])
+    ])
+  fi
+
   dnl Add protobuf-c library linking (Linux only - macOS uses rpath)
   case $host_os in
     darwin*)
@@ -86,9 +152,16 @@ if test "$PHP_VALKEY_GLIDE" != "no"; then
   esac
   
   PHP_NEW_EXTENSION(valkey_glide,
-    valkey_glide.c valkey_glide_cluster.c cluster_scan_cursor.c command_response.c logger.c valkey_glide_otel.c valkey_glide_commands.c valkey_glide_commands_2.c valkey_glide_commands_3.c valkey_glide_core_commands.c valkey_glide_core_common.c valkey_glide_expire_commands.c valkey_glide_geo_commands.c valkey_glide_geo_common.c valkey_glide_hash_common.c valkey_glide_list_common.c valkey_glide_s_common.c valkey_glide_str_commands.c valkey_glide_x_commands.c valkey_glide_x_common.c valkey_glide_z.c valkey_glide_z_common.c valkey_z_php_methods.c src/command_request.pb-c.c src/connection_request.pb-c.c src/response.pb-c.c src/client_constructor_mock.c,
+    valkey_glide.c valkey_glide_cluster.c cluster_scan_cursor.c cluster_scan_iterator.c command_response.c logger.c valkey_glide_otel.c valkey_glide_arena.c valkey_glide_numeric.c valkey_glide_info.c valkey_glide_batch_iterator.c valkey_glide_future.c valkey_glide_route.c valkey_glide_script.c valkey_glide_pool.c valkey_glide_stats.c valkey_glide_near_cache.c valkey_glide_serializer.c valkey_glide_compression.c valkey_glide_pubsub.c valkey_glide_slot.c valkey_glide_commands.c valkey_glide_commands_2.c valkey_glide_commands_3.c valkey_glide_core_commands.c valkey_glide_core_common.c valkey_glide_expire_commands.c valkey_glide_geo_commands.c valkey_glide_geo_common.c valkey_glide_hash_common.c valkey_glide_list_common.c valkey_glide_s_common.c valkey_glide_str_commands.c valkey_glide_x_commands.c valkey_glide_x_common.c valkey_glide_z.c valkey_glide_z_common.c valkey_z_php_methods.c src/command_request.pb-c.c src/connection_request.pb-c.c src/response.pb-c.c src/client_constructor_mock.c src/glide_bench.c,
     $ext_shared,, $VALKEY_GLIDE_SHARED_LIBADD)
 
+  if test "$PHP_VALKEY_GLIDE_IGBINARY" = "yes"; then
+    PHP_ADD_EXTENSION_DEP(valkey_glide, igbinary)
+  fi
+  if test "$PHP_VALKEY_GLIDE_MSGPACK" = "yes"; then
+    PHP_ADD_EXTENSION_DEP(valkey_glide, msgpack)
+  fi
+
   dnl Add FFI library only for macOS (keep Mac working as before)
   case $host_os in
     darwin*)
@@ -457,7 +530,7 @@ if test "$PHP_VALKEY_GLIDE" != "no"; then
       cp -r "$PECL_SOURCE_DIR/valkey-glide" "$BUILD_DIR/" 2>/dev/null || true
       
       dnl Copy arginfo.h files explicitly
-      for arginfo_file in cluster_scan_cursor_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h; do
+      for arginfo_file in cluster_scan_cursor_arginfo.h cluster_scan_iterator_arginfo.h valkey_glide_batch_iterator_arginfo.h valkey_glide_future_arginfo.h valkey_glide_route_arginfo.h valkey_glide_script_arginfo.h valkey_glide_arginfo.h valkey_glide_cluster_arginfo.h logger_arginfo.h; do
         if test -f "$PECL_SOURCE_DIR/$arginfo_file"; then
           AC_MSG_RESULT([Debug: copying $arginfo_file])
           cp "$PECL_SOURCE_DIR/$arginfo_file" "$BUILD_DIR/"
@@ -3,6 +3,7 @@
 
 #include "logger.h"
 
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -19,6 +20,9 @@ static int  current_log_level  = VALKEY_LOG_LEVEL_DEFAULT;
 
 static enum Level current_ffi_log_level = WARN; /* FFI level tracking */
 
+/* Admit everything until initialized, so the first message triggers auto-initialization */
+int valkey_glide_log_threshold = VALKEY_LOG_LEVEL_TRACE;
+
 
 /* Simple mutex simulation using static variable for initialization protection */
 static volatile bool initialization_in_progress = false;
@@ -162,6 +166,8 @@ static int internal_init_logger(const char* level, const char* filename) {
     current_log_level     = ffi_level_to_int(log_result->level);
     logger_initialized    = true;
 
+    valkey_glide_log_threshold = current_log_level == VALKEY_LOG_LEVEL_OFF ? -1 : current_log_level;
+
     /* Clean up the LogResult */
     free_log_result(log_result);
 
@@ -206,7 +212,8 @@ int valkey_glide_logger_set_config(const char* level, const char* filename) {
      */
 
     /* Reset state to allow reinitialization */
-    logger_initialized = false;
+    logger_initialized         = false;
+    valkey_glide_log_threshold = VALKEY_LOG_LEVEL_TRACE;
 
     return internal_init_logger(level, filename);
 }
@@ -256,7 +263,11 @@ void valkey_glide_logger_debug(const char* identifier, const char* message) {
  * C Extension Interface Functions - Direct access for C code
  * ============================================================================ */
 
-void valkey_glide_c_log_error(const char* identifier, const char* message) {
+/**
+ * Common path of the C logging functions. Call sites are already filtered by
+ * VALKEY_LOG_ENABLED(), the check here covers the first, auto-initializing call.
+ */
+static void c_log(enum Level level, const char* identifier, const char* message) {
     /* Auto-initialize if needed */
     ensure_logger_initialized();
 
@@ -265,78 +276,53 @@ void valkey_glide_c_log_error(const char* identifier, const char* message) {
     }
 
     /* Check if message level is at or above current log level */
-    if (current_ffi_log_level == OFF || ERROR > current_ffi_log_level) {
+    if (current_ffi_log_level == OFF || level > current_ffi_log_level) {
         return; /* Don't log if level is below threshold or logging is off */
     }
 
     /* Call the FFI log function and handle result */
-    valkey_glide_log_wrapper(ERROR, identifier, message);
+    valkey_glide_log_wrapper(level, identifier, message);
 }
 
-void valkey_glide_c_log_warn(const char* identifier, const char* message) {
-    /* Auto-initialize if needed */
-    ensure_logger_initialized();
-
-    if (identifier == NULL || message == NULL) {
-        return;
-    }
-
-    /* Check if message level is at or above current log level */
-    if (current_ffi_log_level == OFF || WARN > current_ffi_log_level) {
-        return; /* Don't log if level is below threshold or logging is off */
-    }
+void valkey_glide_c_log_error(const char* identifier, const char* message) {
+    c_log(ERROR, identifier, message);
+}
 
-    /* Call the FFI log function and handle result */
-    valkey_glide_log_wrapper(WARN, identifier, message);
+void valkey_glide_c_log_warn(const char* identifier, const char* message) {
+    c_log(WARN, identifier, message);
 }
 
 void valkey_glide_c_log_info(const char* identifier, const char* message) {
-    /* Auto-initialize if needed */
-    ensure_logger_initialized();
-
-    if (identifier == NULL || message == NULL) {
-        return;
-    }
+    c_log(INFO, identifier, message);
+}
 
-    /* Check if message level is at or above current log level */
-    if (current_ffi_log_level == OFF || INFO > current_ffi_log_level) {
-        return; /* Don't log if level is below threshold or logging is off */
-    }
+void valkey_glide_c_log_debug(const char* identifier, const char* message) {
+    c_log(DEBUG, identifier, message);
+}
 
-    /* Call the FFI log function and handle result */
-    valkey_glide_log_wrapper(INFO, identifier, message);
+void valkey_glide_c_log_trace(const char* identifier, const char* message) {
+    c_log(TRACE, identifier, message);
 }
 
-void valkey_glide_c_log_debug(const char* identifier, const char* message) {
-    /* Auto-initialize if needed */
-    ensure_logger_initialized();
+void valkey_glide_c_log_fmt(int level, const char* identifier, const char* format, ...) {
+    char    message[VALKEY_LOG_FMT_BUFFER_SIZE];
+    va_list args;
+    int     len;
 
-    if (identifier == NULL || message == NULL) {
+    if (format == NULL) {
         return;
     }
 
-    /* Check if message level is at or above current log level */
-    if (current_ffi_log_level == OFF || DEBUG > current_ffi_log_level) {
-        return; /* Don't log if level is below threshold or logging is off */
-    }
-
-    /* Call the FFI log function and handle result */
-    valkey_glide_log_wrapper(DEBUG, identifier, message);
-}
+    va_start(args, format);
+    len = vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
 
-void valkey_glide_c_log_trace(const char* identifier, const char* message) {
-    /* Auto-initialize if needed */
-    ensure_logger_initialized();
-
-    if (identifier == NULL || message == NULL) {
+    if (len < 0) {
         return;
     }
-
-    /* Check if message level is at or above current log level */
-    if (current_ffi_log_level == OFF || TRACE > current_ffi_log_level) {
-        return; /* Don't log if level is below threshold or logging is off */
+    if ((size_t) len >= sizeof(message)) {
+        memcpy(message + sizeof(message) - 4, "...", 4);
     }
 
-    /* Call the FFI log function and handle result */
-    valkey_glide_log_wrapper(TRACE, identifier, message);
+    c_log(int_to_ffi_level(level), identifier, message);
 }
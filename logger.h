@@ -4,6 +4,10 @@
 #ifndef VALKEY_GLIDE_LOGGER_H
 #define VALKEY_GLIDE_LOGGER_H
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -32,6 +36,30 @@ extern "C" {
 /* Default log level */
 #define VALKEY_LOG_LEVEL_DEFAULT VALKEY_LOG_LEVEL_WARN
 
+/* Most verbose level compiled in; --disable-valkey-glide-trace-logging drops DEBUG and TRACE */
+#ifdef VALKEY_GLIDE_NO_TRACE_LOGGING
+#define VALKEY_LOG_MAX_COMPILED_LEVEL VALKEY_LOG_LEVEL_INFO
+#else
+#define VALKEY_LOG_MAX_COMPILED_LEVEL VALKEY_LOG_LEVEL_TRACE
+#endif
+
+/* Formatted messages longer than this are truncated and end with "..." */
+#define VALKEY_LOG_FMT_BUFFER_SIZE 1024
+
+/**
+ * Most verbose level that currently reaches the core logger, or -1 when logging
+ * is off. Until the logger is initialized it admits every level, so the first
+ * message still auto-initializes it.
+ */
+extern int valkey_glide_log_threshold;
+
+/**
+ * Whether a message at level would be logged. Sites above the compiled level
+ * fold to a constant false, the rest cost one load and compare, with no call.
+ */
+#define VALKEY_LOG_ENABLED(level) \
+    ((level) <= VALKEY_LOG_MAX_COMPILED_LEVEL && (level) <= valkey_glide_log_threshold)
+
 /* ============================================================================
  * External FFI Function Declarations
  * ============================================================================ */
@@ -146,59 +174,54 @@ void valkey_glide_c_log_debug(const char* identifier, const char* message);
  */
 void valkey_glide_c_log_trace(const char* identifier, const char* message);
 
+/**
+ * Format and log a message from C extension code.
+ * Formats into a stack buffer of VALKEY_LOG_FMT_BUFFER_SIZE bytes, without allocating.
+ */
+void valkey_glide_c_log_fmt(int level, const char* identifier, const char* format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((format(printf, 3, 4)))
+#endif
+    ;
+
 /* ============================================================================
  * Convenience Macros for C Extension Code
  * ============================================================================ */
 
-#define VALKEY_LOG_ERROR(identifier, message) valkey_glide_c_log_error(identifier, message)
-#define VALKEY_LOG_WARN(identifier, message) valkey_glide_c_log_warn(identifier, message)
-#define VALKEY_LOG_INFO(identifier, message) valkey_glide_c_log_info(identifier, message)
-#define VALKEY_LOG_DEBUG(identifier, message) valkey_glide_c_log_debug(identifier, message)
-#define VALKEY_LOG_TRACE(identifier, message) valkey_glide_c_log_trace(identifier, message)
-
-/* Base macro for formatted logging with dynamic allocation */
-#define VALKEY_LOG_FMT_BASE(level_constant, level_function, level_name, category, format, ...)  \
-    do {                                                                                        \
-        if (valkey_glide_logger_get_level() == VALKEY_LOG_LEVEL_OFF ||                          \
-            level_constant > valkey_glide_logger_get_level())                                   \
-            break;                                                                              \
-        int   needed_size = snprintf(NULL, 0, format, __VA_ARGS__) + 1;                         \
-        char* log_msg     = emalloc(needed_size);                                               \
-        if (log_msg) {                                                                          \
-            snprintf(log_msg, needed_size, format, __VA_ARGS__);                                \
-            level_function(category, log_msg);                                                  \
-            efree(log_msg);                                                                     \
-        } else {                                                                                \
-            VALKEY_LOG_ERROR(category, "Failed to allocate memory for " level_name " message"); \
-        }                                                                                       \
+#define VALKEY_LOG_AT(level, function, identifier, message) \
+    do {                                                    \
+        if (VALKEY_LOG_ENABLED(level))                      \
+            function(identifier, message);                  \
+    } while (0)
+
+#define VALKEY_LOG_ERROR(identifier, message) \
+    VALKEY_LOG_AT(VALKEY_LOG_LEVEL_ERROR, valkey_glide_c_log_error, identifier, message)
+#define VALKEY_LOG_WARN(identifier, message) \
+    VALKEY_LOG_AT(VALKEY_LOG_LEVEL_WARN, valkey_glide_c_log_warn, identifier, message)
+#define VALKEY_LOG_INFO(identifier, message) \
+    VALKEY_LOG_AT(VALKEY_LOG_LEVEL_INFO, valkey_glide_c_log_info, identifier, message)
+#define VALKEY_LOG_DEBUG(identifier, message) \
+    VALKEY_LOG_AT(VALKEY_LOG_LEVEL_DEBUG, valkey_glide_c_log_debug, identifier, message)
+#define VALKEY_LOG_TRACE(identifier, message) \
+    VALKEY_LOG_AT(VALKEY_LOG_LEVEL_TRACE, valkey_glide_c_log_trace, identifier, message)
+
+/* Base macro for formatted logging; arguments are only evaluated when the level is enabled */
+#define VALKEY_LOG_FMT_BASE(level_constant, category, format, ...)                 \
+    do {                                                                           \
+        if (VALKEY_LOG_ENABLED(level_constant))                                    \
+            valkey_glide_c_log_fmt(level_constant, category, format, __VA_ARGS__); \
     } while (0)
 
-/* Dynamic allocation macro for formatted debug logging */
-#define VALKEY_LOG_DEBUG_FMT(category, format, ...) \
-    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_DEBUG,     \
-                        VALKEY_LOG_DEBUG,           \
-                        VALKEY_LOG_LEVEL_DEBUG_STR, \
-                        category,                   \
-                        format,                     \
-                        __VA_ARGS__)
-
-/* Dynamic allocation macro for formatted error logging */
 #define VALKEY_LOG_ERROR_FMT(category, format, ...) \
-    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_ERROR,     \
-                        VALKEY_LOG_ERROR,           \
-                        VALKEY_LOG_LEVEL_ERROR_STR, \
-                        category,                   \
-                        format,                     \
-                        __VA_ARGS__)
-
-/* Dynamic allocation macro for formatted warning logging */
+    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_ERROR, category, format, __VA_ARGS__)
 #define VALKEY_LOG_WARN_FMT(category, format, ...) \
-    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_WARN,     \
-                        VALKEY_LOG_WARN,           \
-                        VALKEY_LOG_LEVEL_WARN_STR, \
-                        category,                  \
-                        format,                    \
-                        __VA_ARGS__)
+    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_WARN, category, format, __VA_ARGS__)
+#define VALKEY_LOG_INFO_FMT(category, format, ...) \
+    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_INFO, category, format, __VA_ARGS__)
+#define VALKEY_LOG_DEBUG_FMT(category, format, ...) \
+    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_DEBUG, category, format, __VA_ARGS__)
+#define VALKEY_LOG_TRACE_FMT(category, format, ...) \
+    VALKEY_LOG_FMT_BASE(VALKEY_LOG_LEVEL_TRACE, category, format, __VA_ARGS__)
 
 /* ============================================================================
  * Utility Functions
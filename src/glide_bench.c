@@ -0,0 +1,163 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef VALKEY_GLIDE_BENCH
+
+#include <string.h>
+#include <time.h>
+
+#include "command_response.h"
+#include "common.h"
+#include "php.h"
+#include "src/glide_bench_arginfo.h"
+#include "valkey_glide_arena.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_s_common.h"
+#include "zend_exceptions.h"
+
+/* Global variables */
+zend_class_entry* glide_bench_ce;
+
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/* Fill a String response with value_size bytes */
+static void bench_fill_string(CommandResponse* response, char* value, size_t value_size) {
+    response->response_type    = String;
+    response->string_value     = value;
+    response->string_value_len = value_size;
+}
+
+PHP_METHOD(ValkeyGlideBench, marshalArgs) {
+    HashTable*           args_ht;
+    zend_long            iterations;
+    zval*                entry;
+    zval*                args;
+    uintptr_t*           cmd_args;
+    unsigned long*       cmd_args_len;
+    valkey_glide_arena_t arena;
+    uint32_t             count, i = 0;
+
+    ZEND_PARSE_PARAMETERS_START(2, 2)
+    Z_PARAM_ARRAY_HT(args_ht)
+    Z_PARAM_LONG(iterations)
+    ZEND_PARSE_PARAMETERS_END();
+
+    /* Commands receive their arguments as a contiguous zval array */
+    count = zend_hash_num_elements(args_ht);
+    args  = safe_emalloc(count, sizeof(zval), 0);
+    ZEND_HASH_FOREACH_VAL(args_ht, entry) {
+        ZVAL_COPY_VALUE(&args[i++], entry);
+    }
+    ZEND_HASH_FOREACH_END();
+
+    uint64_t start = bench_now_ns();
+    for (zend_long n = 0; n < iterations; n++) {
+        valkey_glide_arena_init(&arena);
+        valkey_glide_arena_alloc_arg_arrays(&arena, count, &cmd_args, &cmd_args_len);
+        convert_zval_to_string_args(&arena, args, count, &cmd_args, &cmd_args_len, 0);
+        valkey_glide_arena_reset(&arena);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    efree(args);
+    RETURN_LONG((zend_long) elapsed);
+}
+
+PHP_METHOD(ValkeyGlideBench, convertResponse) {
+    char*            type;
+    size_t           type_len;
+    zend_long        elements, value_size, iterations;
+    CommandResponse  root;
+    CommandResponse* items = NULL;
+    CommandResponse* keys  = NULL;
+    CommandResponse* vals  = NULL;
+    char*            value;
+
+    ZEND_PARSE_PARAMETERS_START(4, 4)
+    Z_PARAM_STRING(type, type_len)
+    Z_PARAM_LONG(elements)
+    Z_PARAM_LONG(value_size)
+    Z_PARAM_LONG(iterations)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (elements < 0 || value_size < 0) {
+        zend_argument_value_error(2, "must be greater than or equal to 0");
+        RETURN_THROWS();
+    }
+
+    /* Every string in the reply shares one buffer; conversion copies it anyway */
+    value = emalloc(value_size + 1);
+    memset(value, 'v', value_size);
+    value[value_size] = '\0';
+
+    memset(&root, 0, sizeof(root));
+    if (strcmp(type, "string") == 0) {
+        bench_fill_string(&root, value, value_size);
+    } else if (strcmp(type, "array") == 0 || strcmp(type, "map") == 0) {
+        bool is_map = type[0] == 'm';
+
+        items = ecalloc(elements ? elements : 1, sizeof(CommandResponse));
+        if (is_map) {
+            keys = ecalloc(elements ? elements : 1, sizeof(CommandResponse));
+            vals = ecalloc(elements ? elements : 1, sizeof(CommandResponse));
+        }
+
+        for (zend_long i = 0; i < elements; i++) {
+            if (is_map) {
+                /* Distinct field names so the PHP array really has `elements` entries */
+                char* field = emalloc(24);
+                bench_fill_string(&keys[i], field, snprintf(field, 24, "field%ld", (long) i));
+                bench_fill_string(&vals[i], value, value_size);
+                items[i].map_key   = &keys[i];
+                items[i].map_value = &vals[i];
+            } else {
+                bench_fill_string(&items[i], value, value_size);
+            }
+        }
+
+        root.response_type   = is_map ? Map : Array;
+        root.array_value     = items;
+        root.array_value_len = elements;
+    } else {
+        efree(value);
+        zend_argument_value_error(1, "must be one of \"string\", \"array\" or \"map\"");
+        RETURN_THROWS();
+    }
+
+    uint64_t start = bench_now_ns();
+    for (zend_long n = 0; n < iterations; n++) {
+        zval output;
+
+        command_response_to_zval(&root, &output, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+        zval_ptr_dtor(&output);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    if (keys) {
+        for (zend_long i = 0; i < elements; i++) {
+            efree(keys[i].string_value);
+        }
+        efree(keys);
+        efree(vals);
+    }
+    if (items) {
+        efree(items);
+    }
+    efree(value);
+
+    RETURN_LONG((zend_long) elapsed);
+}
+
+void register_glide_bench_class(void) {
+    glide_bench_ce = register_class_ValkeyGlideBench();
+}
+
+#endif /* VALKEY_GLIDE_BENCH */
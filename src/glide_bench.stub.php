@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * Microbenchmarks for the C glue between PHP and the Glide core.
+ *
+ * Only available when the extension is configured with --enable-valkey-glide-bench.
+ * Every method runs the measured step $iterations times without touching the
+ * network and returns the total elapsed time in nanoseconds.
+ */
+final class ValkeyGlideBench
+{
+    /**
+     * Time converting command arguments into the FFI argument arrays.
+     *
+     * @param array $args       Arguments as they would be passed to a command.
+     * @param int   $iterations Number of conversions.
+     *
+     * @return int Elapsed nanoseconds.
+     */
+    public static function marshalArgs(array $args, int $iterations): int
+    {
+    }
+
+    /**
+     * Time converting a synthetic reply into a PHP value with command_response_to_zval().
+     *
+     * @param string $type       "string", "array" (MGET/ZRANGE-like) or "map" (HGETALL-like).
+     * @param int    $elements   Number of elements for "array" and "map".
+     * @param int    $value_size Size in bytes of every string in the reply.
+     * @param int    $iterations Number of conversions.
+     *
+     * @return int Elapsed nanoseconds.
+     */
+    public static function convertResponse(string $type, int $elements, int $value_size, int $iterations): int
+    {
+    }
+}
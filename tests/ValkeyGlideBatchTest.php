@@ -671,6 +671,128 @@ class ValkeyGlideBatchTest extends ValkeyGlideBaseTest
         $this->valkey_glide->del($key1);
     }
 
+    public function testLargePipelineBatch()
+    {
+        $key1 = 'batch_large_pipeline_' . uniqid();
+        $count = 5000;
+
+        // Enough commands and payload to grow the batch slab several times
+        $pipeline = $this->valkey_glide->pipeline();
+        for ($i = 0; $i < $count; $i++) {
+            $pipeline->hset($key1, "field$i", str_repeat('v', $i % 64));
+        }
+        $pipeline->hlen($key1);
+        $pipeline->hget($key1, 'field63');
+        $pipeline->hget($key1, 'field64');
+        $results = $pipeline->exec();
+
+        // Verify pipeline results
+        $this->assertIsArray($results);
+        $this->assertCount($count + 3, $results);
+        $this->assertEquals(1, $results[0]);
+        $this->assertEquals(1, $results[$count - 1]);
+        $this->assertEquals($count, $results[$count]);
+        $this->assertEquals(str_repeat('v', 63), $results[$count + 1]);
+        $this->assertEquals('', $results[$count + 2]);
+
+        // A second batch on the same client starts from an empty slab
+        $results = $this->valkey_glide->multi()
+            ->hget($key1, 'field1')
+            ->hlen($key1)
+            ->exec();
+        $this->assertEquals(['v', $count], $results);
+
+        // Cleanup
+        $this->valkey_glide->del($key1);
+    }
+
+    public function testAutoFlushPipelineBatch()
+    {
+        $key1 = 'batch_autoflush_' . uniqid();
+        $count = 250;
+
+        // Flush every 100 commands; the replies still come back together from exec()
+        $pipeline = $this->valkey_glide->pipeline(100);
+        for ($i = 0; $i < $count; $i++) {
+            $pipeline->rpush($key1, "item$i");
+        }
+
+        // The first sub-batches have already reached the server; this client is still queueing
+        $other = $this->newInstance();
+        $this->assertEquals(200, $other->llen($key1));
+
+        $pipeline->llen($key1);
+        $results = $pipeline->exec();
+
+        $this->assertIsArray($results);
+        $this->assertCount($count + 1, $results);
+        $this->assertEquals(range(1, $count), array_slice($results, 0, $count));
+        $this->assertEquals($count, $results[$count]);
+
+        // A byte threshold flushes too, and an exactly flushed buffer still returns its replies
+        $results = $this->valkey_glide->pipeline(0, 64)
+            ->set($key1, str_repeat('x', 64))
+            ->exec();
+        $this->assertEquals([true], $results);
+
+        // Negative thresholds are rejected
+        $this->assertFalse(@$this->valkey_glide->pipeline(-1));
+
+        // Cleanup
+        $this->valkey_glide->del($key1);
+    }
+
+    public function testExecIteratorBatch()
+    {
+        $key1 = 'batch_exec_iterator_' . uniqid();
+        $count = 25;
+
+        $pipeline = $this->valkey_glide->pipeline();
+        for ($i = 0; $i < $count; $i++) {
+            $pipeline->set("$key1:$i", "value$i");
+            $pipeline->get("$key1:$i");
+        }
+        $iterator = $pipeline->execIterator(7);
+
+        $this->assertInstanceOf(ValkeyGlideBatchIterator::class, $iterator);
+
+        // The client leaves batch mode as soon as the iterator is created
+        $this->assertEquals('value0', $this->valkey_glide->get("$key1:0"));
+
+        $seen = 0;
+        foreach ($iterator as $index => $value) {
+            $this->assertEquals($seen, $index);
+            $this->assertEquals($index % 2 ? 'value' . intdiv($index, 2) : true, $value);
+            $seen++;
+        }
+        $this->assertEquals($count * 2, $seen);
+
+        // Replies from auto-flushed sub-batches come first, then the buffered tail
+        $pipeline = $this->valkey_glide->pipeline(10);
+        for ($i = 0; $i < $count; $i++) {
+            $pipeline->incr($key1);
+        }
+        $this->assertEquals(range(1, $count), iterator_to_array($pipeline->execIterator(4)));
+
+        // A transaction is executed atomically even with a small chunk size
+        $iterator = $this->valkey_glide->multi()
+            ->set($key1, 'a')
+            ->append($key1, 'b')
+            ->get($key1)
+            ->execIterator(1);
+        $this->assertEquals([true, 2, 'ab'], iterator_to_array($iterator));
+
+        // Nothing queued
+        $this->assertFalse($this->valkey_glide->execIterator());
+
+        // Cleanup
+        $keys = [$key1];
+        for ($i = 0; $i < $count; $i++) {
+            $keys[] = "$key1:$i";
+        }
+        $this->valkey_glide->del($keys);
+    }
+
     public function testHashRandfieldBatch()
     {
         $key1 = 'batch_hash_randfield_' . uniqid();
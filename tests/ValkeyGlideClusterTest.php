@@ -116,6 +116,10 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
     {
         $this->markTestSkipped();
     }
+    public function testPersistentClient()
+    {
+        $this->markTestSkipped();
+    }
 
     public function testSelect()
     {
@@ -393,6 +397,92 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
         $this->assertGT(10, count($allSectionsInfo), "All sections should return many fields");
     }
 
+    public function testRouteObject()
+    {
+        $primaries = new ValkeyGlideRoute('allPrimaries');
+        $this->assertEquals($this->valkey_glide->dbsize('allPrimaries'), $this->valkey_glide->dbsize($primaries));
+
+        // The same object can be reused for any number of calls
+        $node = new ValkeyGlideRoute(['type' => 'routeByAddress', 'host' => '127.0.0.1', 'port' => 7001]);
+        for ($i = 0; $i < 3; $i++) {
+            $info = $this->valkey_glide->info($node, 'memory');
+            $this->assertIsArray($info);
+            $this->assertArrayKey($info, 'used_memory');
+        }
+
+        $this->valkey_glide->set('route-object-key', 'value');
+        $slot_key = new ValkeyGlideRoute(['type' => 'primarySlotKey', 'key' => 'route-object-key']);
+        $this->assertEquals('value', $this->valkey_glide->rawCommand($slot_key, 'get', 'route-object-key'));
+        $this->valkey_glide->del('route-object-key');
+
+        $threw = false;
+        try {
+            new ValkeyGlideRoute(['type' => 'routeByAddress']);
+        } catch (ValueError $ex) {
+            $threw = true;
+        }
+        $this->assertTrue($threw);
+    }
+
+    public function testKeySlot()
+    {
+        $this->assertEquals(12182, $this->valkey_glide->keySlot('foo'));
+        $this->assertEquals(
+            $this->valkey_glide->keySlot('{user1000}.following'),
+            $this->valkey_glide->keySlot('{user1000}.followers')
+        );
+
+        foreach (['foo', 'bar', '{user1000}.following', 'foo{}{bar}', 'foo{{bar}}zap', '', "bin\0ary"] as $key) {
+            $this->assertEquals(
+                $this->valkey_glide->rawCommand('randomNode', 'cluster', 'keyslot', $key),
+                $this->valkey_glide->keySlot($key)
+            );
+        }
+    }
+
+    public function testMgetMsetBySlot()
+    {
+        $pairs = [];
+        for ($i = 0; $i < 500; $i++) {
+            $pairs["slot-batch:$i"] = "value:$i";
+        }
+
+        $this->assertTrue($this->valkey_glide->msetBySlot($pairs));
+
+        // Values come back in input order, with false for missing keys
+        $keys = array_reverse(array_keys($pairs));
+        $keys[] = 'slot-batch:missing';
+        $values = $this->valkey_glide->mgetBySlot($keys);
+        $this->assertCount(501, $values);
+        foreach (array_slice($keys, 0, 500) as $i => $key) {
+            $this->assertEquals($pairs[$key], $values[$i]);
+        }
+        $this->assertFalse($values[500]);
+
+        $this->assertEquals([], $this->valkey_glide->mgetBySlot([]));
+
+        // Missing keys are not counted
+        $this->assertEquals(500, $this->valkey_glide->delBySlot($keys));
+        $this->assertEquals(0, $this->valkey_glide->delBySlot(array_keys($pairs)));
+        $this->assertEquals(0, $this->valkey_glide->delBySlot([]));
+    }
+
+    public function testInfoAllNodes()
+    {
+        $info = $this->valkey_glide->infoAllNodes('server', 'cpu');
+        $this->assertIsArray($info);
+        $this->assertEquals(count($this->valkey_glide->info('allNodes', 'cpu')) / 2, count($info));
+
+        foreach ($info as $node => $node_info) {
+            $this->assertTrue(str_contains($node, ':'), "Nodes are keyed by host:port");
+            $this->assertIsInt($node_info['tcp_port']);
+            $this->assertTrue(str_ends_with($node, ':' . $node_info['tcp_port']));
+            $this->assertIsFloat($node_info['used_cpu_sys']);
+            $this->assertArrayKey($node_info, 'redis_version');
+            $this->assertFalse(isset($node_info['used_memory']));
+        }
+    }
+
     public function testClient()
     {
         $key = 'key-' . rand(1, 100);
@@ -454,6 +544,43 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
         set_time_limit(0);  // Reset to unlimited (or default) at the end
     }
 
+    public function testScanIterator()
+    {
+        $id = uniqid();
+        $keys = [];
+        for ($i = 0; $i < 200; $i++) {
+            $keys[] = "scanit:$id:$i";
+            $this->valkey_glide->set("scanit:$id:$i", $i);
+        }
+        $this->valkey_glide->rpush("scanit:$id:list", 'foo');
+
+        foreach ([1, 4] as $parallel) {
+            $found = [];
+            foreach ($this->valkey_glide->scanIterator("scanit:$id:*", 50, 'string', $parallel) as $pos => $key) {
+                $this->assertEquals(count($found), $pos);
+                $found[] = $key;
+            }
+            $this->assertEqualsCanonicalizing($keys, array_values(array_unique($found)));
+        }
+
+        /* Abandoning a scan half way releases its cursor */
+        $iterator = $this->valkey_glide->scanIterator("scanit:$id:*", 10);
+        $iterator->rewind();
+        $this->assertTrue($iterator->valid());
+        $this->assertTrue(str_starts_with($iterator->current(), "scanit:$id:"));
+        unset($iterator);
+
+        $threw = false;
+        try {
+            $this->valkey_glide->scanIterator(null, 0, null, 0);
+        } catch (ValueError $ex) {
+            $threw = true;
+        }
+        $this->assertTrue($threw);
+
+        $this->valkey_glide->del(array_merge($keys, ["scanit:$id:list"]));
+    }
+
     public function testScanPattern()
     {
          return;//TODO
@@ -626,7 +753,6 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
      * we can direct it to a given node */
     public function testScript()
     {
-        $this->markTestSkipped();
         $key = uniqid() . '-' . rand(1, 1000);
 
         // Flush any scripts we have
@@ -659,7 +785,6 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
      * direct the command at */
     public function testEvalSHA()
     {
-        $this->markTestSkipped();
         $key = uniqid() . '-' . rand(1, 1000);
 
         // Flush any loaded scripts
@@ -680,6 +805,27 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
         $this->assertEquals(1, $this->valkey_glide->evalsha($sha, [$key], 1));
     }
 
+    /* SCRIPT FLUSH takes a route in cluster mode */
+    public function testInvokeScript()
+    {
+        $script = new ValkeyGlideScript("local cb='" . uniqid() . "' return redis.call('INCRBY', KEYS[1], ARGV[1])");
+
+        $this->valkey_glide->del('{script}counter');
+        $this->assertEquals(5, $this->valkey_glide->invokeScript($script, ['{script}counter'], [5]));
+
+        $this->valkey_glide->script('allPrimaries', 'flush');
+        $this->assertEquals(6, $this->valkey_glide->invokeScript($script, ['{script}counter'], [1]));
+
+        $this->valkey_glide->script('allPrimaries', 'flush');
+        $ret = $this->valkey_glide->pipeline()
+            ->invokeScript($script, ['{script}counter'], [1])
+            ->invokeScript($script, ['{script}counter'], [2])
+            ->exec();
+        $this->assertEquals([7, 9], $ret);
+
+        $this->valkey_glide->del('{script}counter');
+    }
+
     public function testEvalBulkResponse()
     {
         $this->markTestSkipped();
@@ -897,6 +1043,46 @@ class ValkeyGlideClusterTest extends ValkeyGlideTest
         $this->assertEquals(['A', 'B', 'C', 'D'], $this->valkey_glide->lrange('mylist', 0, -1));
     }
 
+    /* Routed commands in a pipeline go to their route, with replies in queued order */
+    public function testPipelineRoutes()
+    {
+        $key = uniqid();
+
+        $ret = $this->valkey_glide->pipeline(0, 0, ['timeout' => 5000, 'retry_server_error' => true])
+            ->set($key, 'value')
+            ->rawCommand($key, 'get', $key)
+            ->rawCommand('randomNode', 'echo', 'routed')
+            ->get($key)
+            ->exec();
+        $this->assertEquals([true, 'value', 'routed', 'value'], $ret);
+
+        /* Consecutive commands with one route share a batch; multi-node routes fan out */
+        $ret = $this->valkey_glide->pipeline()
+            ->rawCommand($key, 'set', $key, 'other')
+            ->rawCommand($key, 'get', $key)
+            ->rawCommand('allPrimaries', 'echo', 'all')
+            ->get($key)
+            ->exec();
+        $this->assertEquals('other', $ret[1]);
+        $this->assertIsArray($ret[2]);
+        $this->assertEquals('other', $ret[3]);
+
+        /* Retrying could run part of a transaction twice */
+        $this->assertFalse(@$this->valkey_glide->multi(ValkeyGlide::MULTI, ['retry_connection_error' => true]));
+        $this->assertFalse(@$this->valkey_glide->pipeline(0, 0, ['timeout' => -1]));
+
+        /* SCRIPT keeps its route too, so the script is loaded where EVALSHA runs */
+        $src = "return 'routed'";
+        $sha = sha1($src);
+        $this->valkey_glide->script('allPrimaries', 'flush');
+        $ret = $this->valkey_glide->pipeline()
+            ->script($key, 'load', $src)
+            ->rawCommand($key, 'evalsha', $sha, 1, $key)
+            ->exec();
+        $this->assertEquals([$sha, 'routed'], $ret);
+        $this->valkey_glide->del($key);
+    }
+
     protected function rawCommandArray($key, $args)
     {
         array_unshift($args, $key);
@@ -168,7 +168,7 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         }
     }
 
-/*    public function testPipelinePublish() {
+    public function testPipelinePublish() {
         $ret = $this->valkey_glide->pipeline()
             ->publish('chan', 'msg')
             ->exec();
@@ -177,7 +177,7 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         $this->assertGT(-1, $ret[0] ?? -1);
     }
 
-    // Run some simple tests against the PUBSUB command.  This is problematic, as we
+/*    // Run some simple tests against the PUBSUB command.  This is problematic, as we
     // can't be sure what's going on in the instance, but we can do some things.
     public function testPubSub() {
         // Only available since 2.8.0
@@ -520,6 +520,111 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         }
     }
 
+    public function testGetBinaryValueSizes()
+    {
+        // Empty and single byte replies use interned strings, larger ones are copied once
+        foreach (['', "\0", 'a', "a\0b", random_bytes(2 * 1024 * 1024)] as $value) {
+            $this->assertTrue($this->valkey_glide->set('x', $value));
+            $this->assertEquals($value, $this->valkey_glide->get('x'));
+            $this->assertEquals($value, $this->valkey_glide->set('x', $value, ['GET']));
+        }
+    }
+
+    public function testStats()
+    {
+        $this->assertTrue($this->valkey_glide->resetStats());
+        $stats = $this->valkey_glide->getStats();
+        $this->assertEquals(0, $stats['calls']);
+        $this->assertEquals([], $stats['commands']);
+
+        $value = str_repeat('x', 100);
+        for ($i = 0; $i < 10; $i++) {
+            $this->valkey_glide->set('stats_key', $value);
+            $this->valkey_glide->get('stats_key');
+        }
+        $this->valkey_glide->get('stats_missing');
+
+        // A command against the wrong type counts as an error
+        $this->valkey_glide->set('stats_string', 'value');
+        $this->valkey_glide->lPush('stats_string', 'element');
+
+        $stats = $this->valkey_glide->getStats();
+        $this->assertEquals(23, $stats['calls']);
+        $this->assertEquals(1, $stats['errors']);
+        $this->assertGTE(1100, $stats['bytes_sent']);
+        $this->assertGTE(1000, $stats['bytes_received']);
+        $this->assertCount(3, $stats['commands']);
+
+        $calls = array_column($stats['commands'], 'calls');
+        sort($calls);
+        $this->assertEquals([1, 11, 11], $calls);
+
+        foreach ($stats['commands'] as $command) {
+            $latency = $command['latency_us'];
+            $this->assertLTE($latency['p90'], $latency['p50']);
+            $this->assertLTE($latency['p99'], $latency['p90']);
+            $this->assertLTE($latency['max'], $latency['p999']);
+        }
+
+        $this->assertTrue($this->valkey_glide->resetStats());
+        $this->assertEquals(0, $this->valkey_glide->getStats()['calls']);
+
+        $this->valkey_glide->del('stats_key', 'stats_string');
+    }
+
+    public function testAsyncCommands()
+    {
+        $keys = [];
+        for ($i = 0; $i < 50; $i++) {
+            $keys[] = "async_key:$i";
+            $this->valkey_glide->set("async_key:$i", "value$i");
+        }
+        $this->valkey_glide->del('async_missing');
+
+        // Fan out every read before waiting for any of them
+        $futures = [];
+        foreach ($keys as $key) {
+            $futures[$key] = $this->valkey_glide->getAsync($key);
+            $this->assertInstanceOf(ValkeyGlideFuture::class, $futures[$key]);
+        }
+        $futures['missing'] = $this->valkey_glide->getAsync('async_missing');
+
+        $values = ValkeyGlideFuture::awaitAll($futures);
+        $this->assertCount(51, $values);
+        foreach ($keys as $i => $key) {
+            $this->assertEquals("value$i", $values[$key]);
+        }
+        $this->assertFalse($values['missing']);
+
+        // Awaiting again returns the same reply
+        $this->assertEquals('value0', $futures['async_key:0']->await());
+        $this->assertTrue($futures['async_key:0']->isReady());
+
+        // Arbitrary commands
+        $this->valkey_glide->del('async_counter');
+        $incr = [
+            'a' => $this->valkey_glide->sendAsync('INCRBY', 'async_counter', 5),
+            'b' => $this->valkey_glide->sendAsync('INCRBY', 'async_counter', 5),
+        ];
+        $first = ValkeyGlideFuture::awaitAny($incr);
+        $this->assertContains($first, ['a', 'b']);
+        $replies = array_values(array_map(fn ($f) => $f->await(), $incr));
+        sort($replies);
+        $this->assertEquals([5, 10], $replies);
+        $this->assertEquals('10', $this->valkey_glide->get('async_counter'));
+
+        // Server errors resolve to false
+        $this->assertFalse($this->valkey_glide->sendAsync('INCR', 'async_key:0')->await());
+
+        // A future dropped before its reply arrives must not break later commands
+        $this->valkey_glide->getAsync('async_key:1');
+        $this->assertEquals('value1', $this->valkey_glide->getAsync('async_key:1')->await());
+
+        $this->assertFalse(ValkeyGlideFuture::awaitAny([]));
+
+        $this->valkey_glide->del(array_merge($keys, ['async_counter']));
+    }
+
     public function testEcho()
     {
         $this->assertEquals('hello', $this->valkey_glide->echo('hello'));
@@ -2695,6 +2800,12 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
             }
         }
 
+        // Identifiers that look like numbers are not converted
+        $info = $this->valkey_glide->info('server');
+        $this->assertTrue(is_string($info['redis_git_sha1']));
+        $this->assertTrue(is_string($info['run_id']));
+        $this->assertTrue(is_int($info['uptime_in_seconds']));
+
         if (! $this->minVersionCheck('7.0.0')) {
             return;
         }
@@ -2770,6 +2881,29 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         $this->assertFalse($this->valkey_glide->msetnx([])); // set ø → FALSE
     }
 
+    public function testMsetLargeNumericArguments()
+    {
+        // Enough stringified numbers to spill out of the inline argument buffer
+        $set_array = [];
+        for ($i = 0; $i < 200; $i++) {
+            $set_array['mset_large_' . $i] = $i * 1000;
+        }
+
+        $this->valkey_glide->del(array_keys($set_array));
+        $this->assertTrue($this->valkey_glide->mset($set_array));
+        $this->assertEquals(
+            array_map('strval', array_values($set_array)),
+            $this->valkey_glide->mget(array_keys($set_array))
+        );
+
+        $this->valkey_glide->del('mset_large_set');
+        $this->assertEquals(200, $this->valkey_glide->sAdd('mset_large_set', ...range(1, 200)));
+        $this->assertEquals(200, $this->valkey_glide->sCard('mset_large_set'));
+
+        $this->valkey_glide->del(array_keys($set_array));
+        $this->valkey_glide->del('mset_large_set');
+    }
+
 
 
     public function testZAddFirstArg()
@@ -3261,6 +3395,49 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         $this->assertEquals($mems, $this->valkey_glide->zRange('{z}', 0, -1, ['withscores' => true]));
     }
 
+    public function testZAddScorePrecision()
+    {
+        $this->valkey_glide->del('{z}');
+
+        /* Scores reach the server exactly, not rounded to six significant digits */
+        foreach ([0.1, 1234567.891, -2.5e-8, 1e300, 42.0] as $i => $score) {
+            $this->assertEquals(1, $this->valkey_glide->zAdd('{z}', $score, "mem:$i"));
+            $this->assertEquals($score, $this->valkey_glide->zScore('{z}', "mem:$i"));
+        }
+    }
+
+    public function testZRangeIterator()
+    {
+        $this->valkey_glide->del('{z}');
+
+        $mems = [];
+        for ($i = 0; $i < 25; $i++) {
+            $mems["mem:$i"] = (float)$i;
+            $this->valkey_glide->zAdd('{z}', $i, "mem:$i");
+        }
+
+        $it = null;
+        $seen = [];
+        $calls = 0;
+        while (($chunk = $this->valkey_glide->zRangeIterator('{z}', $it, 10, true)) !== false) {
+            $this->assertLTE(10, count($chunk));
+            $seen += $chunk;
+            $calls++;
+        }
+        $this->assertEquals(3, $calls);
+        $this->assertEquals(0, $it);
+        $this->assertEquals($mems, $seen);
+
+        /* Without scores the chunks are lists of members */
+        $it = null;
+        $this->assertEquals(['mem:0', 'mem:1'], $this->valkey_glide->zRangeIterator('{z}', $it, 2));
+        $this->assertEquals(2, $it);
+
+        $it = null;
+        $this->assertFalse($this->valkey_glide->zRangeIterator('{missing}', $it));
+        $this->assertEquals(0, $it);
+    }
+
     public function testZRangeByLex()
     {
         /* ZRANGEBYLEX available on versions >= 2.8.9 */
@@ -3875,6 +4052,38 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         }
     }
 
+    public function testHashesMany()
+    {
+        $hashes = [];
+        for ($i = 0; $i < 50; $i++) {
+            $hashes["hash-many:$i"] = ['name' => "item $i", 'price' => $i];
+        }
+        $this->valkey_glide->del(array_keys($hashes));
+
+        $written = $this->valkey_glide->hMsetMany($hashes);
+        $this->assertEquals(array_fill_keys(array_keys($hashes), true), $written);
+
+        // Results are indexed by key, with an empty hash for missing keys
+        $keys = array_reverse(array_keys($hashes));
+        $keys[] = 'hash-many:missing';
+        $all = $this->valkey_glide->hGetAllMany($keys);
+        $this->assertCount(51, $all);
+        foreach ($hashes as $key => $fields) {
+            $this->assertEquals(['name' => $fields['name'], 'price' => (string)$fields['price']], $all[$key]);
+        }
+        $this->assertEquals([], $all['hash-many:missing']);
+
+        $prices = $this->valkey_glide->hMgetMany(['hash-many:1', 'hash-many:missing'], ['price', 'nope']);
+        $this->assertEquals([
+            'hash-many:1' => ['price' => '1', 'nope' => false],
+            'hash-many:missing' => ['price' => false, 'nope' => false],
+        ], $prices);
+
+        $this->assertEquals([], $this->valkey_glide->hGetAllMany([]));
+
+        $this->valkey_glide->del(array_keys($hashes));
+    }
+
     public function testHashExpiration()
     {
         if (!$this->compare_major_version_number(9)) {
@@ -5222,8 +5431,6 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
 
     public function testScript()
     {
-        //TODO
-        $this->markTestSkipped();
         if (version_compare($this->version, '2.5.0') < 0) {
             $this->markTestSkipped();
         }
@@ -5394,8 +5601,6 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
 
     public function testEvalSHA()
     {
-        //TODO
-        $this->markTestSkipped();
         if (version_compare($this->version, '2.5.0') < 0) {
             $this->markTestSkipped();
         }
@@ -5424,6 +5629,46 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         }
     }
 
+    public function testInvokeScript()
+    {
+        $script = new ValkeyGlideScript("local cb='" . uniqid() . "' return redis.call('INCRBY', KEYS[1], ARGV[1])");
+        $this->assertEquals(sha1($script->getCode()), $script->getHash());
+
+        $this->valkey_glide->del('{script}counter');
+
+        // Not cached yet, so the body is sent once and EVALSHA works afterwards
+        $this->assertEquals(5, $this->valkey_glide->invokeScript($script, ['{script}counter'], [5]));
+        $this->assertEquals(6, $this->valkey_glide->invokeScript($script, ['{script}counter'], [1]));
+        $this->assertEquals(6, $this->valkey_glide->evalsha($script->getHash(), ['{script}counter', 0], 1));
+
+        // Flushed scripts are loaded again, directly and in batches
+        $this->valkey_glide->script('flush');
+        $this->assertEquals(7, $this->valkey_glide->invokeScript($script, ['{script}counter'], [1]));
+
+        $this->valkey_glide->script('flush');
+        $ret = $this->valkey_glide->pipeline()
+            ->invokeScript($script, ['{script}counter'], [1])
+            ->invokeScript($script, ['{script}counter'], [2])
+            ->exec();
+        $this->assertEquals([8, 10], $ret);
+
+        $ret = $this->valkey_glide->multi()
+            ->invokeScript($script, ['{script}counter'], [1])
+            ->get('{script}counter')
+            ->exec();
+        $this->assertEquals([11, '11'], $ret);
+
+        // A flush by another client between batches does not break the next batch
+        $other = $this->newInstance();
+        $other->script('flush');
+        $ret = $this->valkey_glide->pipeline()
+            ->invokeScript($script, ['{script}counter'], [1])
+            ->exec();
+        $this->assertEquals([12], $ret);
+
+        $this->valkey_glide->del('{script}counter');
+    }
+
     public function testClient()
     {
         /* CLIENT SETNAME */
@@ -5433,6 +5678,12 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         $clients = $this->valkey_glide->client('list');
         $this->assertIsArray($clients);
 
+        /* Integer fields are converted, addresses and names are not */
+        $this->assertIsInt($clients[0]['id']);
+        $this->assertIsInt($clients[0]['db']);
+        $this->assertIsString($clients[0]['addr']);
+        $this->assertIsString($clients[0]['name']);
+
         // Figure out which ip:port is us!
         $address = null;
         foreach ($clients as $client) {
@@ -6843,6 +7094,24 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
         $this->assertEquals(['A', 'B', 'C', 'D'], $this->valkey_glide->lrange('mylist', 0, -1));
     }
 
+    /* rawCommand is queued like any other command inside MULTI and pipelines */
+    public function testRawCommandInBatch()
+    {
+        $key = '{raw}' . uniqid();
+
+        foreach ([ValkeyGlide::MULTI, ValkeyGlide::PIPELINE] as $mode) {
+            $this->valkey_glide->del($key);
+            $this->valkey_glide->multi($mode);
+            $this->rawCommandArray($key, ['set', $key, 'raw-value']);
+            $this->rawCommandArray($key, ['get', $key]);
+            $this->rawCommandArray($key, ['rpush', $key . ':list', 'A', 'B']);
+            $ret = $this->valkey_glide->exec();
+
+            $this->assertEquals([true, 'raw-value', 2], $ret);
+            $this->valkey_glide->del($key . ':list');
+        }
+    }
+
     /* STREAMS */
 
     protected function addStreamEntries($key, $count)
@@ -6940,6 +7209,12 @@ class ValkeyGlideTest extends ValkeyGlideBaseTest
             $messages = $this->valkey_glide->$cmd($key, $a1, $a2, $count);
             $this->assertEquals(count($messages), $count);
         }
+
+        /* Every field of an entry is returned, numeric field names as integer keys */
+        $msg = ['f1' => 'v1', 'f2' => 'v2', '3' => 'v3'];
+        $id = $this->valkey_glide->xAdd($key, '*', $msg);
+        $messages = $this->valkey_glide->$cmd($key, $id, $id);
+        $this->assertEquals([$id => $msg], $messages);
     }
 
     public function testXRange()
@@ -7854,6 +8129,314 @@ if (extension_loaded("valkey_glide") || dl("' . __DIR__ . '/../modules/valkey_gl
         $client->close();
     }
 
+    public function testPersistentClient()
+    {
+        $args = [
+            'addresses' => [['host' => $this->getHost(), 'port' => $this->getPort()]],
+            'client_name' => 'persistent_test_' . uniqid(),
+            'advanced_config' => ['persistent' => true],
+        ];
+
+        $first = new ValkeyGlide(...$args);
+        $this->assertConnected($first);
+        $id = $first->rawcommand('CLIENT', 'ID');
+
+        // Objects with the same configuration share the native client
+        $second = new ValkeyGlide(...$args);
+        $this->assertEquals($id, $second->rawcommand('CLIENT', 'ID'));
+
+        // The client outlives the objects that used it
+        unset($first, $second);
+        $third = new ValkeyGlide(...$args);
+        $this->assertEquals($id, $third->rawcommand('CLIENT', 'ID'));
+
+        // Connection state shared with other users cannot be changed
+        $this->assertThrowsMatch($third, function ($client) {
+            $client->select(1);
+        }, '/persistent/');
+        $this->assertThrowsMatch($third, function ($client) {
+            $client->rawcommand('select', '1');
+        }, '/persistent/');
+        $this->assertThrowsMatch($third, function ($client) {
+            $client->rawcommand('CLIENT', 'SETNAME', 'other');
+        }, '/persistent/');
+        $this->assertEquals($id, $third->rawcommand('CLIENT', 'ID'));
+
+        // Keys left watched by an object are unwatched when the client is checked in
+        unset($third);
+        $key = 'persistent_watch_' . uniqid();
+        $watcher = new ValkeyGlide(...$args);
+        $this->assertTrue($watcher->watch($key));
+        unset($watcher);
+        $this->valkey_glide->set($key, 'changed');
+        $fresh = new ValkeyGlide(...$args);
+        $this->assertEquals($id, $fresh->rawcommand('CLIENT', 'ID'));
+        $this->assertEquals([true], $fresh->multi()->set($key, 'fresh')->exec());
+        $this->assertEquals('fresh', $this->valkey_glide->get($key));
+        $this->valkey_glide->del($key);
+        unset($fresh);
+
+        // Any configuration difference gets its own client
+        $args['database_id'] = 1;
+        $other = new ValkeyGlide(...$args);
+        $this->assertNotEquals($id, $other->rawcommand('CLIENT', 'ID'));
+
+        // Without the flag a private client is created
+        unset($args['advanced_config']);
+        $private = new ValkeyGlide(...$args);
+        $this->assertNotEquals($id, $private->rawcommand('CLIENT', 'ID'));
+    }
+
+    public function testNearCache()
+    {
+        $this->assertFalse($this->valkey_glide->getNearCacheStats());
+        $this->assertFalse($this->valkey_glide->clearNearCache());
+
+        $client = new ValkeyGlide(
+            addresses: [['host' => $this->getHost(), 'port' => $this->getPort()]],
+            advanced_config: ['near_cache' => ['max_entries' => 2]]
+        );
+        $this->assertTrue($client->getNearCacheStats()['tracking']);
+
+        $client->set('near_cache_key', 'first');
+        $this->assertEquals('first', $client->get('near_cache_key'));
+        $this->assertEquals('first', $client->get('near_cache_key'));
+
+        $stats = $client->getNearCacheStats();
+        $this->assertEquals(1, $stats['hits']);
+        $this->assertEquals(1, $stats['misses']);
+        $this->assertEquals(1, $stats['entries']);
+
+        // Writes through the caching client are visible right away
+        $client->set('near_cache_key', 'second');
+        $this->assertEquals('second', $client->get('near_cache_key'));
+
+        // Writes from other connections arrive as invalidation pushes
+        $this->valkey_glide->set('near_cache_key', 'third');
+        usleep(100000);
+        $this->assertEquals('third', $client->get('near_cache_key'));
+        $this->assertGT(0, $client->getNearCacheStats()['invalidations']);
+
+        // Aggregate replies are cached as well
+        $client->del('near_cache_hash');
+        $client->hMset('near_cache_hash', ['a' => '1', 'b' => '2']);
+        $this->assertEquals(['a' => '1', 'b' => '2'], $client->hGetAll('near_cache_hash'));
+        $hits = $client->getNearCacheStats()['hits'];
+        $this->assertEquals(['a' => '1', 'b' => '2'], $client->hGetAll('near_cache_hash'));
+        $this->assertEquals($hits + 1, $client->getNearCacheStats()['hits']);
+
+        // The least recently used entry makes room for new ones
+        $client->get('near_cache_missing');
+        $stats = $client->getNearCacheStats();
+        $this->assertEquals(2, $stats['entries']);
+        $this->assertGT(0, $stats['evictions']);
+
+        $this->assertTrue($client->clearNearCache());
+        $this->assertEquals(0, $client->getNearCacheStats()['entries']);
+
+        $client->del('near_cache_key', 'near_cache_hash');
+        $client->close();
+    }
+
+    public function testSerializerPhp()
+    {
+        $client = new ValkeyGlide(
+            addresses: [['host' => $this->getHost(), 'port' => $this->getPort()]],
+            advanced_config: ['serializer' => ValkeyGlide::SERIALIZER_PHP]
+        );
+        $value = ['a' => 1, 'b' => [true, 1.5, null], 'c' => 'str'];
+
+        $client->set('serializer_key', $value);
+        $this->assertEquals($value, $client->get('serializer_key'));
+        $this->assertEquals(serialize($value), $this->valkey_glide->get('serializer_key'));
+        $this->assertEquals($value, $client->getset('serializer_key', 42));
+        $this->assertEquals(42, $client->get('serializer_key'));
+
+        $client->mset(['serializer_a' => [1, 2], 'serializer_b' => 'text']);
+        $this->assertEquals([[1, 2], 'text', false], $client->mget(['serializer_a', 'serializer_b', 'serializer_missing']));
+
+        $client->del('serializer_hash');
+        $client->hMset('serializer_hash', ['x' => ['nested' => 1], 'y' => 2.5]);
+        $client->hSet('serializer_hash', 'z', false);
+        $this->assertEquals(['nested' => 1], $client->hGet('serializer_hash', 'x'));
+        $this->assertEquals(['x' => ['nested' => 1], 'y' => 2.5], $client->hMget('serializer_hash', ['x', 'y']));
+        $this->assertEquals(['x' => ['nested' => 1], 'y' => 2.5, 'z' => false], $client->hGetAll('serializer_hash'));
+
+        // Values that were not written serialized come back as they are
+        $this->valkey_glide->set('serializer_key', 'raw');
+        $this->assertEquals('raw', $client->get('serializer_key'));
+
+        $client->del('serializer_key', 'serializer_a', 'serializer_b', 'serializer_hash');
+        $client->close();
+    }
+
+    public function testSerializerIgbinary()
+    {
+        $this->checkSerializer(ValkeyGlide::SERIALIZER_IGBINARY, 'igbinary_serialize');
+    }
+
+    public function testSerializerMsgpack()
+    {
+        $this->checkSerializer(ValkeyGlide::SERIALIZER_MSGPACK, 'msgpack_pack');
+    }
+
+    /* Round trip values through an optional serializer, skipped when it is not built in */
+    protected function checkSerializer($serializer, $encode)
+    {
+        try {
+            $client = new ValkeyGlide(
+                addresses: [['host' => $this->getHost(), 'port' => $this->getPort()]],
+                advanced_config: ['serializer' => $serializer]
+            );
+        } catch (Exception $e) {
+            $this->markTestSkipped();
+            return;
+        }
+        $value = ['a' => 1, 'b' => [true, 1.5, null], 'c' => 'str'];
+
+        $client->set('serializer_key', $value);
+        $this->assertEquals($value, $client->get('serializer_key'));
+        if (function_exists($encode)) {
+            $this->assertEquals($encode($value), $this->valkey_glide->get('serializer_key'));
+        }
+        $this->assertEquals($value, $client->getset('serializer_key', 42));
+        $this->assertEquals(42, $client->get('serializer_key'));
+
+        $client->mset(['serializer_a' => [1, 2], 'serializer_b' => 'text']);
+        $this->assertEquals([[1, 2], 'text', false], $client->mget(['serializer_a', 'serializer_b', 'serializer_missing']));
+
+        $client->del('serializer_hash');
+        $client->hMset('serializer_hash', ['x' => ['nested' => 1], 'y' => 2.5]);
+        $this->assertEquals(['x' => ['nested' => 1], 'y' => 2.5], $client->hGetAll('serializer_hash'));
+
+        $client->del('serializer_key', 'serializer_a', 'serializer_b', 'serializer_hash');
+        $client->close();
+    }
+
+    /* Without a serializer, value parameters convert like string parameters */
+    public function testValueConversion()
+    {
+        $this->valkey_glide->del('conversion_key', 'conversion_hash');
+
+        $this->assertTrue($this->valkey_glide->setex('conversion_key', 60, 42));
+        $this->assertEquals('42', $this->valkey_glide->get('conversion_key'));
+        $this->assertTrue($this->valkey_glide->psetex('conversion_key', 60000, 1.5));
+        $this->assertEquals('1.5', $this->valkey_glide->get('conversion_key'));
+        $this->assertEquals('1.5', $this->valkey_glide->getset('conversion_key', true));
+        $this->assertEquals('1', $this->valkey_glide->get('conversion_key'));
+        $this->assertFalse($this->valkey_glide->setnx('conversion_key', 7));
+        $this->assertTrue($this->valkey_glide->hsetnx('conversion_hash', 'field', 7));
+        $this->assertEquals('7', $this->valkey_glide->hget('conversion_hash', 'field'));
+
+        // Arrays are rejected as they would be by a string parameter
+        foreach (['setnx', 'getset'] as $method) {
+            $threw = false;
+            try {
+                $this->valkey_glide->$method('conversion_key', [1]);
+            } catch (TypeError $e) {
+                $threw = true;
+            }
+            $this->assertTrue($threw);
+        }
+        $this->assertEquals('1', $this->valkey_glide->get('conversion_key'));
+
+        $this->valkey_glide->del('conversion_key', 'conversion_hash');
+    }
+
+    public function testCompression()
+    {
+        $tested = 0;
+        $large  = str_repeat('compressible value ', 100);
+
+        foreach ([ValkeyGlide::COMPRESSION_LZ4, ValkeyGlide::COMPRESSION_ZSTD] as $algorithm) {
+            try {
+                $client = new ValkeyGlide(
+                    addresses: [['host' => $this->getHost(), 'port' => $this->getPort()]],
+                    advanced_config: ['compression' => ['algorithm' => $algorithm, 'min_size' => 64]]
+                );
+            } catch (Exception $e) {
+                continue; // Not compiled into this build
+            }
+            $tested++;
+
+            $client->set('compression_key', $large);
+            $this->assertEquals($large, $client->get('compression_key'));
+            $stored = $this->valkey_glide->get('compression_key');
+            $this->assertEquals("\xC1", $stored[0]);
+            $this->assertLT(strlen($large), strlen($stored));
+
+            // Values under min_size are stored as is
+            $client->set('compression_short', 'short');
+            $this->assertEquals('short', $this->valkey_glide->get('compression_short'));
+
+            $client->mset(['compression_a' => $large, 'compression_b' => 'short']);
+            $this->assertEquals([$large, 'short'], $client->mget(['compression_a', 'compression_b']));
+
+            $client->del('compression_hash');
+            $client->hSet('compression_hash', 'field', $large);
+            $this->assertEquals($large, $client->hGet('compression_hash', 'field'));
+            $this->assertEquals(['field' => $large], $client->hGetAll('compression_hash'));
+
+            // Batched commands encode and decode the same way
+            $ret = $client->pipeline()
+                ->set('compression_key', $large)
+                ->get('compression_key')
+                ->exec();
+            $this->assertEquals([true, $large], $ret);
+
+            $client->del('compression_key', 'compression_short', 'compression_a', 'compression_b', 'compression_hash');
+            $client->close();
+        }
+
+        if ($tested == 0) {
+            $this->markTestSkipped();
+        }
+    }
+
+    public function testPubSubPoll()
+    {
+        $channel = 'pubsub_' . uniqid();
+
+        $client = new ValkeyGlide(
+            addresses: [['host' => $this->getHost(), 'port' => $this->getPort()]]
+        );
+        $this->assertFalse($client->poll());
+        $this->assertTrue($client->subscribe([$channel]));
+        $this->assertTrue($client->psubscribe([$channel . ':*']));
+
+        // The client stays usable while subscribed
+        $this->assertTrue($client->set('pubsub_key', 'value'));
+
+        $this->assertEquals(1, $this->valkey_glide->publish($channel, 'first'));
+        $this->valkey_glide->publish($channel . ':x', 'second');
+
+        $messages = [];
+        for ($i = 0; $i < 10 && count($messages) < 2; $i++) {
+            $messages = array_merge($messages, $client->poll(10, 0.5));
+        }
+        $this->assertEquals([
+            ['type' => 'message', 'channel' => $channel, 'message' => 'first'],
+            ['type' => 'pmessage', 'channel' => $channel . ':x', 'message' => 'second', 'pattern' => $channel . ':*'],
+        ], $messages);
+
+        $this->assertEquals([$channel => true, 'not-subscribed' => false],
+                            $client->unsubscribe([$channel, 'not-subscribed']));
+        $this->assertEquals([$channel . ':*' => true], $client->punsubscribe());
+        $this->assertEquals(['not-subscribed' => false], $client->unsubscribe(['not-subscribed']));
+        $this->assertEquals([], $client->poll(10, 0.1));
+
+        // Shard channels need a cluster
+        $this->assertThrowsMatch($client, function ($r) use ($channel) {
+            $r->ssubscribe([$channel]);
+        }, '/cluster mode/');
+        $this->assertThrowsMatch($client, function ($r) {
+            $r->sunsubscribe();
+        }, '/cluster mode/');
+
+        $client->del('pubsub_key');
+        $client->close();
+    }
+
     // TLS Tests
     // ---------
 
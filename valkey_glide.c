@@ -7,10 +7,20 @@
 #endif
 #include "cluster_scan_cursor.h"          // Include ClusterScanCursor class
 #include "cluster_scan_cursor_arginfo.h"  // Include ClusterScanCursor arginfo header
+#include "cluster_scan_iterator.h"        // Include ClusterScanIterator class
 #include "common.h"
 #include "logger.h"          // Include logger functionality
 #include "logger_arginfo.h"  // Include logger functions arginfo - MUST BE LAST for ext_functions
 #include "valkey_glide_arginfo.h"          // Include generated arginfo header
+#include "valkey_glide_batch_iterator.h"   // Include ValkeyGlideBatchIterator class
+#include "valkey_glide_future.h"           // Include ValkeyGlideFuture class
+#include "valkey_glide_near_cache.h"       // Include client-side cache
+#include "valkey_glide_pool.h"             // Include persistent client pool
+#include "valkey_glide_pubsub.h"           // Include Pub/Sub subscriber
+#include "valkey_glide_route.h"            // Include ValkeyGlideRoute class
+#include "valkey_glide_script.h"           // Include ValkeyGlideScript class
+#include "valkey_glide_serializer.h"       // Include value serializers and compression
+#include "valkey_glide_stats.h"            // Include per-client statistics
 #include "valkey_glide_cluster_arginfo.h"  // Include generated arginfo header
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_core_common.h"
@@ -41,6 +51,9 @@ extern void free_valkey_glide_client_configuration(
     valkey_glide_base_client_configuration_t* config);
 
 void register_mock_constructor_class(void);
+#ifdef VALKEY_GLIDE_BENCH
+void register_glide_bench_class(void);
+#endif
 
 /* Default values for addresses */
 static const char* const DEFAULT_HOST            = "localhost";
@@ -139,6 +152,13 @@ static valkey_glide_tls_advanced_configuration_t* _build_advanced_tls_config(
     valkey_glide_php_common_constructor_params_t* params, bool is_cluster);
 static valkey_glide_advanced_base_client_configuration_t* _build_advanced_config(
     valkey_glide_php_common_constructor_params_t* params, bool is_cluster);
+static bool _determine_persistent(valkey_glide_php_common_constructor_params_t* params);
+static valkey_glide_serializer_t _determine_serializer(
+    valkey_glide_php_common_constructor_params_t* params);
+static valkey_glide_compression_config_t* _build_compression_config(
+    valkey_glide_php_common_constructor_params_t* params);
+static valkey_glide_near_cache_config_t* _build_near_cache_config(
+    valkey_glide_php_common_constructor_params_t* params);
 
 static void _initialize_open_telemetry(valkey_glide_php_common_constructor_params_t* params,
                                        bool                                          is_cluster);
@@ -174,7 +194,8 @@ void valkey_glide_build_client_config_base(valkey_glide_php_common_constructor_p
     config->client_name = params->client_name ? params->client_name : NULL;
 
     /* Set inflight requests limit to -1 (unset). A synchronous API does not need a request limit
-       since it is effectively one-request-at-a-time. */
+       since it is effectively one-request-at-a-time, and the async connection opened by the
+       *Async() methods relies on the core's default limit. */
     config->inflight_requests_limit = -1;
 
     /* Set client availability zone */
@@ -426,6 +447,13 @@ const zend_function_entry valkey_glide_cluster_methods[] = {
            arginfo_class_ValkeyGlideCluster___construct,
            ZEND_ACC_PUBLIC | ZEND_ACC_CTOR) PHP_FE_END};
 
+/* Persistent pool settings: cap per process, idle seconds before closing, seconds between pings */
+PHP_INI_BEGIN()
+PHP_INI_ENTRY(VALKEY_GLIDE_POOL_MAX_CLIENTS_INI, "16", PHP_INI_SYSTEM, NULL)
+PHP_INI_ENTRY(VALKEY_GLIDE_POOL_MAX_IDLE_INI, "300", PHP_INI_SYSTEM, NULL)
+PHP_INI_ENTRY(VALKEY_GLIDE_POOL_HEALTH_CHECK_INI, "30", PHP_INI_SYSTEM, NULL)
+PHP_INI_END()
+
 /**
  * PHP_MINIT_FUNCTION
  */
@@ -440,6 +468,8 @@ PHP_MINIT_FUNCTION(valkey_glide) {
             "Failed to initialize ValkeyGlide logger, will auto-initialize on first use");
     }
     valkey_glide_logger_debug("php_init", "Initializing Valkey Glide PHP extension");
+    REGISTER_INI_ENTRIES();
+
     /* ValkeyGlide class - use generated registration function */
     valkey_glide_ce = register_class_ValkeyGlide();
 
@@ -450,9 +480,29 @@ PHP_MINIT_FUNCTION(valkey_glide) {
     /* Register ClusterScanCursor class */
     register_cluster_scan_cursor_class();
 
+    /* Register ClusterScanIterator class */
+    register_cluster_scan_iterator_class();
+
+    /* Register ValkeyGlideBatchIterator class */
+    register_valkey_glide_batch_iterator_class();
+
+    /* Register ValkeyGlideFuture class */
+    register_valkey_glide_future_class();
+
+    /* Register ValkeyGlideRoute class */
+    register_valkey_glide_route_class();
+
+    /* Register ValkeyGlideScript class */
+    register_valkey_glide_script_class();
+
     /* Register mock constructor class used for testing only. */
     register_mock_constructor_class();
 
+#ifdef VALKEY_GLIDE_BENCH
+    /* Register microbenchmark class, only built with --enable-valkey-glide-bench */
+    register_glide_bench_class();
+#endif
+
     /* ValkeyGlideException class */
     valkey_glide_exception_ce = register_class_ValkeyGlideException(spl_ce_RuntimeException);
     if (!valkey_glide_exception_ce) {
@@ -479,11 +529,35 @@ PHP_MINIT_FUNCTION(valkey_glide) {
     return SUCCESS;
 }
 
-zend_module_entry valkey_glide_module_entry = {STANDARD_MODULE_HEADER,
+/**
+ * PHP_MSHUTDOWN_FUNCTION
+ */
+PHP_MSHUTDOWN_FUNCTION(valkey_glide) {
+    /* Close the clients kept alive by the persistent pool */
+    valkey_glide_pool_shutdown();
+    valkey_glide_compression_shutdown();
+
+    UNREGISTER_INI_ENTRIES();
+    return SUCCESS;
+}
+
+/* Optional serializers must be loaded first */
+static const zend_module_dep valkey_glide_deps[] = {
+#ifdef VALKEY_GLIDE_IGBINARY
+    ZEND_MOD_REQUIRED("igbinary")
+#endif
+#ifdef VALKEY_GLIDE_MSGPACK
+    ZEND_MOD_REQUIRED("msgpack")
+#endif
+    ZEND_MOD_END};
+
+zend_module_entry valkey_glide_module_entry = {STANDARD_MODULE_HEADER_EX,
+                                               NULL,
+                                               valkey_glide_deps,
                                                "valkey_glide",
                                                ext_functions,
                                                PHP_MINIT(valkey_glide),
-                                               NULL,
+                                               PHP_MSHUTDOWN(valkey_glide),
                                                NULL,
                                                NULL,
                                                NULL,
@@ -497,12 +571,42 @@ ZEND_GET_MODULE(valkey_glide)
 void free_valkey_glide_object(zend_object* object) {
     valkey_glide_object* valkey_glide = VALKEY_GLIDE_PHP_GET_OBJECT(valkey_glide_object, object);
 
-    /* Free the Valkey Glide client if it exists */
+    /* Free the Valkey Glide client if it exists; persistent clients go back to the pool */
     if (valkey_glide->glide_client) {
-        close_glide_client(valkey_glide->glide_client);
+        valkey_glide_stats_detach(valkey_glide->glide_client);
+        if (valkey_glide->persistent) {
+            valkey_glide_pool_checkin(valkey_glide->glide_client);
+        } else {
+            valkey_glide_near_cache_destroy(valkey_glide->glide_client);
+            close_glide_client(valkey_glide->glide_client);
+        }
         valkey_glide->glide_client = NULL;
+        valkey_glide->near_cache   = NULL;
     }
 
+    if (valkey_glide->async_client) {
+        close_glide_client(valkey_glide->async_client);
+        valkey_glide->async_client = NULL;
+    }
+    valkey_glide_pubsub_free(valkey_glide->pubsub);
+    valkey_glide->pubsub = NULL;
+    if (valkey_glide->scripts) {
+        zend_hash_destroy(valkey_glide->scripts);
+        FREE_HASHTABLE(valkey_glide->scripts);
+        valkey_glide->scripts = NULL;
+    }
+    if (valkey_glide->connection_request) {
+        efree(valkey_glide->connection_request);
+        valkey_glide->connection_request = NULL;
+    }
+
+    /* Drop a batch that was never executed */
+    valkey_glide_batch_buffer_free(&valkey_glide->batch);
+    zval_ptr_dtor(&valkey_glide->flushed_results);
+
+    valkey_glide_codec_free(valkey_glide->codec);
+    valkey_glide->codec = NULL;
+
     /* Clean up the standard object */
     zend_object_std_dtor(&valkey_glide->std);
 }
@@ -539,6 +643,26 @@ void valkey_glide_cleanup_client_config(valkey_glide_base_client_configuration_t
             efree(config->advanced_config->tls_config);
             config->advanced_config->tls_config = NULL;
         }
+        if (config->advanced_config->near_cache) {
+            valkey_glide_near_cache_config_t* near_cache = config->advanced_config->near_cache;
+
+            for (int i = 0; i < near_cache->prefix_count; i++) {
+                efree(near_cache->prefixes[i]);
+            }
+            if (near_cache->prefixes) {
+                efree(near_cache->prefixes);
+                efree(near_cache->prefix_lens);
+            }
+            efree(near_cache);
+            config->advanced_config->near_cache = NULL;
+        }
+        if (config->advanced_config->compression) {
+            if (config->advanced_config->compression->dictionary) {
+                efree(config->advanced_config->compression->dictionary);
+            }
+            efree(config->advanced_config->compression);
+            config->advanced_config->compression = NULL;
+        }
         efree(config->advanced_config);
         config->advanced_config = NULL;
     }
@@ -612,18 +736,16 @@ PHP_METHOD(ValkeyGlide, __construct) {
     valkey_glide_build_client_config_base(&common_params, &client_config, false);
 
     /* Issue the connection request. */
-    const ConnectionResponse* conn_resp = create_glide_client(&client_config);
+    char* error_message = valkey_glide_connect_client(valkey_glide, &client_config);
 
-    if (conn_resp->connection_error_message) {
-        VALKEY_LOG_ERROR("php_construct", conn_resp->connection_error_message);
-        zend_throw_exception(valkey_glide_exception_ce, conn_resp->connection_error_message, 0);
+    if (error_message) {
+        VALKEY_LOG_ERROR("php_construct", error_message);
+        zend_throw_exception(valkey_glide_exception_ce, error_message, 0);
+        efree(error_message);
     } else {
         VALKEY_LOG_INFO("php_construct", "ValkeyGlide client created successfully");
-        valkey_glide->glide_client = conn_resp->conn_ptr;
     }
 
-    free_connection_response((ConnectionResponse*) conn_resp);
-
     /* Clean up temporary configuration structures */
     valkey_glide_cleanup_client_config(&client_config);
 }
@@ -680,33 +802,18 @@ CLEAR_CONNECTION_PASSWORD_METHOD_IMPL(ValkeyGlide)
 
 /* Basic method stubs - these need to be implemented with ValkeyGlide */
 
-PHP_METHOD(ValkeyGlide, publish) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, psubscribe) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, ssubscribe) { /* TODO: Implement */
+/* Shard channels only exist on a cluster; use ValkeyGlideCluster::ssubscribe() */
+PHP_METHOD(ValkeyGlide, ssubscribe) {
+    zend_throw_exception(
+        valkey_glide_exception_ce, "Sharded pub/sub requires cluster mode (ValkeyGlideCluster)", 0);
 }
-PHP_METHOD(ValkeyGlide, subscribe) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, unsubscribe) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, punsubscribe) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, sunsubscribe) { /* TODO: Implement */
+PHP_METHOD(ValkeyGlide, sunsubscribe) {
+    zend_throw_exception(
+        valkey_glide_exception_ce, "Sharded pub/sub requires cluster mode (ValkeyGlideCluster)", 0);
 }
 
 PHP_METHOD(ValkeyGlide, pubsub) { /* TODO: Implement */
 }
-PHP_METHOD(ValkeyGlide, eval) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, eval_ro) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, evalsha) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, evalsha_ro) { /* TODO: Implement */
-}
-PHP_METHOD(ValkeyGlide, script) { /* TODO: Implement */
-}
 
 /* ============================================================================
  * Logger PHP Functions - Bridge between PHP stub and C implementation
@@ -940,6 +1047,198 @@ static int _determine_connection_timeout(valkey_glide_php_common_constructor_par
     return Z_LVAL_P(conn_timeout_val);
 }
 
+/**
+ * Determines whether the client should be kept in the persistent pool.
+ *
+ * @param params Pointer to the common constructor parameters structure.
+ * @return       true if advanced_config['persistent'] is true, false otherwise.
+ */
+static bool _determine_persistent(valkey_glide_php_common_constructor_params_t* params) {
+    HashTable* advanced_config_ht = _get_advanced_config_ht(params);
+    if (!advanced_config_ht) {
+        return false;
+    }
+
+    zval* persistent_val = zend_hash_str_find(
+        advanced_config_ht, VALKEY_GLIDE_PERSISTENT, sizeof(VALKEY_GLIDE_PERSISTENT) - 1);
+    return persistent_val && Z_TYPE_P(persistent_val) == IS_TRUE;
+}
+
+/**
+ * Determines the value serializer from advanced_config['serializer'].
+ * Unknown values are passed through and rejected when connecting.
+ *
+ * @param params Pointer to the common constructor parameters structure.
+ * @return       The ValkeyGlide::SERIALIZER_* value, SERIALIZER_NONE if not set.
+ */
+static valkey_glide_serializer_t _determine_serializer(
+    valkey_glide_php_common_constructor_params_t* params) {
+    HashTable* advanced_config_ht = _get_advanced_config_ht(params);
+    if (!advanced_config_ht) {
+        return VALKEY_GLIDE_SERIALIZER_NONE;
+    }
+
+    zval* serializer_val = zend_hash_str_find(
+        advanced_config_ht, VALKEY_GLIDE_SERIALIZER, sizeof(VALKEY_GLIDE_SERIALIZER) - 1);
+    if (!serializer_val || Z_TYPE_P(serializer_val) == IS_NULL) {
+        return VALKEY_GLIDE_SERIALIZER_NONE;
+    }
+    return (valkey_glide_serializer_t) zval_get_long(serializer_val);
+}
+
+/**
+ * Builds the value compression configuration from advanced_config['compression'],
+ * given either as a ValkeyGlide::COMPRESSION_* constant or as an array of options.
+ * Returns NULL if compression is not enabled.
+ *
+ * @param params Pointer to the common constructor parameters structure.
+ * @return       Pointer to the compression configuration, or NULL.
+ */
+static valkey_glide_compression_config_t* _build_compression_config(
+    valkey_glide_php_common_constructor_params_t* params) {
+    HashTable* advanced_config_ht = _get_advanced_config_ht(params);
+    if (!advanced_config_ht) {
+        return NULL;
+    }
+
+    zval* compression_val = zend_hash_str_find(
+        advanced_config_ht, VALKEY_GLIDE_COMPRESSION, sizeof(VALKEY_GLIDE_COMPRESSION) - 1);
+    if (!compression_val || Z_TYPE_P(compression_val) == IS_NULL) {
+        return NULL;
+    }
+
+    zval*      algorithm_val  = compression_val;
+    HashTable* compression_ht = NULL;
+    if (Z_TYPE_P(compression_val) == IS_ARRAY) {
+        compression_ht = Z_ARRVAL_P(compression_val);
+        algorithm_val  = zend_hash_str_find(compression_ht,
+                                           VALKEY_GLIDE_COMPRESSION_ALGORITHM,
+                                           sizeof(VALKEY_GLIDE_COMPRESSION_ALGORITHM) - 1);
+    }
+
+    /* Unknown algorithms are passed through and rejected when connecting */
+    zend_long algorithm = algorithm_val ? zval_get_long(algorithm_val) : 0;
+    if (algorithm == VALKEY_GLIDE_COMPRESSION_NONE) {
+        return NULL;
+    }
+
+    valkey_glide_compression_config_t* config =
+        ecalloc(1, sizeof(valkey_glide_compression_config_t));
+    config->algorithm = (valkey_glide_compression_t) algorithm;
+    config->min_size  = VALKEY_GLIDE_COMPRESSION_DEFAULT_MIN_SIZE;
+
+    if (!compression_ht) {
+        return config;
+    }
+
+    zval* val;
+
+    val = zend_hash_str_find(compression_ht,
+                             VALKEY_GLIDE_COMPRESSION_MIN_SIZE,
+                             sizeof(VALKEY_GLIDE_COMPRESSION_MIN_SIZE) - 1);
+    if (val && Z_TYPE_P(val) == IS_LONG && Z_LVAL_P(val) >= 0) {
+        config->min_size = (size_t) Z_LVAL_P(val);
+    }
+
+    val = zend_hash_str_find(compression_ht,
+                             VALKEY_GLIDE_COMPRESSION_LEVEL,
+                             sizeof(VALKEY_GLIDE_COMPRESSION_LEVEL) - 1);
+    if (val && Z_TYPE_P(val) == IS_LONG) {
+        config->level = (int) Z_LVAL_P(val);
+    }
+
+    val = zend_hash_str_find(compression_ht,
+                             VALKEY_GLIDE_COMPRESSION_DICTIONARY,
+                             sizeof(VALKEY_GLIDE_COMPRESSION_DICTIONARY) - 1);
+    if (val && Z_TYPE_P(val) == IS_STRING && Z_STRLEN_P(val) > 0) {
+        config->dictionary     = estrndup(Z_STRVAL_P(val), Z_STRLEN_P(val));
+        config->dictionary_len = Z_STRLEN_P(val);
+    }
+
+    return config;
+}
+
+/**
+ * Builds the client-side cache configuration from advanced_config['near_cache'].
+ * Returns NULL if the near cache is not enabled.
+ *
+ * @param params Pointer to the common constructor parameters structure.
+ * @return       Pointer to the near cache configuration, or NULL.
+ */
+static valkey_glide_near_cache_config_t* _build_near_cache_config(
+    valkey_glide_php_common_constructor_params_t* params) {
+    HashTable* advanced_config_ht = _get_advanced_config_ht(params);
+    if (!advanced_config_ht) {
+        return NULL;
+    }
+
+    zval* near_cache_val = zend_hash_str_find(
+        advanced_config_ht, VALKEY_GLIDE_NEAR_CACHE, sizeof(VALKEY_GLIDE_NEAR_CACHE) - 1);
+    if (!near_cache_val ||
+        (Z_TYPE_P(near_cache_val) != IS_ARRAY && Z_TYPE_P(near_cache_val) != IS_TRUE)) {
+        return NULL;
+    }
+
+    valkey_glide_near_cache_config_t* config =
+        ecalloc(1, sizeof(valkey_glide_near_cache_config_t));
+    config->max_entries = VALKEY_GLIDE_NEAR_CACHE_DEFAULT_MAX_ENTRIES;
+    config->max_bytes   = VALKEY_GLIDE_NEAR_CACHE_DEFAULT_MAX_BYTES;
+
+    if (Z_TYPE_P(near_cache_val) != IS_ARRAY) {
+        return config;
+    }
+
+    HashTable* near_cache_ht = Z_ARRVAL_P(near_cache_val);
+    zval*      val;
+
+    val = zend_hash_str_find(near_cache_ht,
+                             VALKEY_GLIDE_NEAR_CACHE_MAX_ENTRIES,
+                             sizeof(VALKEY_GLIDE_NEAR_CACHE_MAX_ENTRIES) - 1);
+    if (val && Z_TYPE_P(val) == IS_LONG && Z_LVAL_P(val) > 0) {
+        config->max_entries = (size_t) Z_LVAL_P(val);
+    }
+
+    val = zend_hash_str_find(near_cache_ht,
+                             VALKEY_GLIDE_NEAR_CACHE_MAX_BYTES,
+                             sizeof(VALKEY_GLIDE_NEAR_CACHE_MAX_BYTES) - 1);
+    if (val && Z_TYPE_P(val) == IS_LONG && Z_LVAL_P(val) > 0) {
+        config->max_bytes = (size_t) Z_LVAL_P(val);
+    }
+
+    val = zend_hash_str_find(
+        near_cache_ht, VALKEY_GLIDE_NEAR_CACHE_TTL, sizeof(VALKEY_GLIDE_NEAR_CACHE_TTL) - 1);
+    if (val && Z_TYPE_P(val) == IS_LONG && Z_LVAL_P(val) > 0) {
+        config->ttl = Z_LVAL_P(val);
+    }
+
+    val = zend_hash_str_find(
+        near_cache_ht, VALKEY_GLIDE_NEAR_CACHE_BCAST, sizeof(VALKEY_GLIDE_NEAR_CACHE_BCAST) - 1);
+    config->bcast = val && Z_TYPE_P(val) == IS_TRUE;
+
+    val = zend_hash_str_find(near_cache_ht,
+                             VALKEY_GLIDE_NEAR_CACHE_PREFIXES,
+                             sizeof(VALKEY_GLIDE_NEAR_CACHE_PREFIXES) - 1);
+    if (config->bcast && val && Z_TYPE_P(val) == IS_ARRAY &&
+        zend_hash_num_elements(Z_ARRVAL_P(val)) > 0) {
+        uint32_t count = zend_hash_num_elements(Z_ARRVAL_P(val));
+        zval*    prefix;
+
+        config->prefixes    = ecalloc(count, sizeof(char*));
+        config->prefix_lens = ecalloc(count, sizeof(size_t));
+        ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(val), prefix) {
+            if (Z_TYPE_P(prefix) == IS_STRING) {
+                config->prefixes[config->prefix_count] =
+                    estrndup(Z_STRVAL_P(prefix), Z_STRLEN_P(prefix));
+                config->prefix_lens[config->prefix_count] = Z_STRLEN_P(prefix);
+                config->prefix_count++;
+            }
+        }
+        ZEND_HASH_FOREACH_END();
+    }
+
+    return config;
+}
+
 /**
  * Determines whether to use TLS from the given constructor parameters.
  *
@@ -1082,6 +1381,10 @@ static valkey_glide_advanced_base_client_configuration_t* _build_advanced_config
 
     advanced_config->connection_timeout = _determine_connection_timeout(params);
     advanced_config->tls_config         = _build_advanced_tls_config(params, is_cluster);
+    advanced_config->persistent         = _determine_persistent(params);
+    advanced_config->near_cache         = _build_near_cache_config(params);
+    advanced_config->serializer         = _determine_serializer(params);
+    advanced_config->compression        = _build_compression_config(params);
 
     return advanced_config;
 }
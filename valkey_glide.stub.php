@@ -195,6 +195,48 @@ class ValkeyGlide
            */
     public const  READ_FROM_AZ_AFFINITY_REPLICAS_AND_PRIMARY = 3;
 
+    /**
+     * @var int
+     * Values are sent and read back as plain strings (default).
+     */
+    public const SERIALIZER_NONE = 0;
+
+    /**
+     * @var int
+     * Values are encoded with PHP's serialize() format.
+     */
+    public const SERIALIZER_PHP = 1;
+
+    /**
+     * @var int
+     * Values are encoded with igbinary. Requires a build with --enable-valkey-glide-igbinary.
+     */
+    public const SERIALIZER_IGBINARY = 2;
+
+    /**
+     * @var int
+     * Values are encoded with msgpack. Requires a build with --enable-valkey-glide-msgpack.
+     */
+    public const SERIALIZER_MSGPACK = 3;
+
+    /**
+     * @var int
+     * Values are sent as is (default).
+     */
+    public const COMPRESSION_NONE = 0;
+
+    /**
+     * @var int
+     * Values are compressed with LZ4, favouring latency. Requires a build with --enable-valkey-glide-lz4.
+     */
+    public const COMPRESSION_LZ4 = 1;
+
+    /**
+     * @var int
+     * Values are compressed with Zstandard, favouring ratio. Requires a build with --enable-valkey-glide-zstd.
+     */
+    public const COMPRESSION_ZSTD = 2;
+
     /**
      * @var string
      * COPY command option key for replacing existing destination key
@@ -325,6 +367,24 @@ class ValkeyGlide
      *                                                      ->flushIntervalMs(5000)
      *                                                      ->build()].
      *                                          connection_timeout is in milliseconds.
+     *                                          'persistent' => true keeps the native client open across
+     *                                          requests in this process and shares it between objects with
+     *                                          an identical configuration. See the valkey_glide.persistent_*
+     *                                          INI settings for the pool limits.
+     *                                          'near_cache' => ['max_entries' => 10000, 'max_bytes' => 16777216,
+     *                                          'ttl' => 0, 'bcast' => false, 'prefixes' => []] keeps GET,
+     *                                          HGETALL, SMEMBERS and ZRANGE replies in process memory, kept
+     *                                          fresh with CLIENT TRACKING. See getNearCacheStats().
+     *                                          'serializer' => ValkeyGlide::SERIALIZER_PHP serializes the
+     *                                          values written by SET, MSET, HSET and related commands, and
+     *                                          unserializes the values read back by GET, MGET, HGET, HMGET,
+     *                                          HVALS and HGETALL. Keys and field names are left as is.
+     *                                          'compression' => ['algorithm' => ValkeyGlide::COMPRESSION_LZ4,
+     *                                          'min_size' => 1024, 'level' => 0, 'dictionary' => null]
+     *                                          compresses those same values once they are at least min_size
+     *                                          bytes, after serialization, and decompresses them when read.
+     *                                          A bare COMPRESSION_* constant uses the defaults. 'dictionary'
+     *                                          is a trained Zstd dictionary shared by every writer and reader.
      * @param bool|null $lazy_connect           Whether to use lazy connection.
      * @param resource|null $context            Stream context for the connection.
      */
@@ -534,6 +594,15 @@ class ValkeyGlide
 
     public function close(): bool;
 
+    /**
+     * Drop every reply held by the near cache.
+     *
+     * @return bool True on success, false if the client has no near cache.
+     *
+     * @see ValkeyGlide::getNearCacheStats()
+     */
+    public function clearNearCache(): bool;
+
     /**
      * Set the OpenTelemetry sample percentage at runtime.
      *
@@ -756,15 +825,15 @@ class ValkeyGlide
      * @return mixed LUA scripts may return arbitrary data so this method can return
      *               strings, arrays, nested arrays, etc.
      */
-   /*TODO  public function eval(string $script, array $args = [], int $num_keys = 0): mixed;*/
+    public function eval(string $script, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * This is simply the read-only variant of eval, meaning the underlying script
      * may not modify data in valkey.
      *
-     * @see ValkeyGlide::eval_ro()
+     * @see ValkeyGlide::eval()
      */
-    /* TODO public function eval_ro(string $script_sha, array $args = [], int $num_keys = 0): mixed; */
+    public function eval_ro(string $script, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * Execute a LUA script on the server but instead of sending the script, send
@@ -781,9 +850,10 @@ class ValkeyGlide
      *
      * @see https://valkey.io/commands/evalsha/
      * @see ValkeyGlide::eval();
+     * @see ValkeyGlide::invokeScript() to have the script loaded when it is missing.
      *
      */
-   /* TODO public function evalsha(string $sha1, array $args = [], int $num_keys = 0): mixed; */
+    public function evalsha(string $sha1, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * This is simply the read-only variant of evalsha, meaning the underlying script
@@ -791,7 +861,29 @@ class ValkeyGlide
      *
      * @see ValkeyGlide::evalsha()
      */
-    /* TODO public function evalsha_ro(string $sha1, array $args = [], int $num_keys = 0): mixed; */
+    public function evalsha_ro(string $sha1, array $args = [], int $num_keys = 0): mixed;
+
+    /**
+     * Run a ValkeyGlideScript by its hash, sending the body only to a server that does not
+     * have it cached yet.
+     *
+     * In pipeline() and multi() the first call of a script in the batch is queued as EVAL,
+     * which also caches it, and later calls in the same batch only carry the hash.
+     *
+     * @param ValkeyGlideScript $script    The script to run.
+     * @param array             $keys      Key names, passed to the script as KEYS.
+     * @param array             $args      Other arguments, passed to the script as ARGV.
+     * @param bool              $read_only Use EVALSHA_RO, for scripts that do not write.
+     *
+     * @return mixed Whatever the script returns, or $this in a batch.
+     *
+     * @see ValkeyGlideScript
+     *
+     * @example
+     * $script = new ValkeyGlideScript("return redis.call('GET', KEYS[1])");
+     * $valkey_glide->invokeScript($script, ['key']);
+     */
+    public function invokeScript(ValkeyGlideScript $script, array $keys = [], array $args = [], bool $read_only = false): mixed;
 
     /**
      * Execute either a MULTI or PIPELINE block and return the array of replies.
@@ -813,6 +905,32 @@ class ValkeyGlide
      */
     public function exec(): ValkeyGlide|array|false;
 
+    /**
+     * Execute a MULTI or PIPELINE block and iterate over the replies instead of
+     * materialising them all at once.
+     *
+     * Pipelined commands are sent in sub-batches of `$chunk_size` as the iterator
+     * advances. A MULTI transaction is always sent as a single atomic batch.
+     *
+     * @param int $chunk_size The number of pipelined commands to send per round trip.
+     *
+     * @return ValkeyGlideBatchIterator|false An iterator yielding one reply per queued command,
+     *                                        or false if there is nothing to execute.
+     *
+     * @see ValkeyGlide::exec()
+     * @see ValkeyGlide::pipeline()
+     *
+     * @example
+     * $valkey_glide->pipeline();
+     * foreach ($keys as $key) {
+     *     $valkey_glide->get($key);
+     * }
+     * foreach ($valkey_glide->execIterator(500) as $i => $value) {
+     *     process($keys[$i], $value);
+     * }
+     */
+    public function execIterator(int $chunk_size = 1000): ValkeyGlideBatchIterator|false;
+
     /**
      * Test if one or more keys exist.
      *
@@ -1102,6 +1220,24 @@ class ValkeyGlide
      */
     public function get(string $key): mixed;
 
+    /**
+     * Send a GET without waiting for the reply.
+     *
+     * The command goes out on a separate async connection, opened on first use, so many
+     * requests can be in flight at once instead of paying one round trip each.
+     *
+     * @param  string $key The key to query
+     * @return ValkeyGlideFuture|false A future resolving to the value, or false if it did not exist.
+     *
+     * @see ValkeyGlide::get()
+     * @see ValkeyGlideFuture::awaitAll()
+     *
+     * @example
+     * $futures = array_map(fn ($key) => $valkey_glide->getAsync($key), $keys);
+     * $values  = ValkeyGlideFuture::awaitAll($futures);
+     */
+    public function getAsync(string $key): ValkeyGlideFuture|false;
+
     /**
      * Get the bit at a given index in a string key.
      *
@@ -1166,6 +1302,83 @@ class ValkeyGlide
      */
     public function getRange(string $key, int $start, int $end): ValkeyGlide|string|false;
 
+    /**
+     * Retrieve the counters of the client-side cache.
+     *
+     * The near cache is enabled with advanced_config['near_cache']. Cached replies are
+     * dropped when the server reports that their key changed (CLIENT TRACKING, or its
+     * BCAST mode with 'bcast' => true and optional key 'prefixes'), when this client
+     * writes the key, and after 'ttl' seconds if set. Objects sharing a persistent
+     * client share its cache.
+     *
+     * @return array|false False if the client has no near cache, otherwise:
+     *
+     *               <code>
+     *               [
+     *                   'tracking'      => bool,  # Replies are only served while tracking is on
+     *                   'hits'          => int,
+     *                   'misses'        => int,
+     *                   'evictions'     => int,   # Dropped to stay within max_entries/max_bytes
+     *                   'invalidations' => int,
+     *                   'entries'       => int,
+     *                   'bytes'         => int,
+     *                   'max_entries'   => int,
+     *                   'max_bytes'     => int,
+     *               ]
+     *               </code>
+     *
+     * @see ValkeyGlide::clearNearCache()
+     *
+     * @example
+     * $valkey_glide = new ValkeyGlide([['host' => 'localhost', 'port' => 6379]],
+     *                                 advanced_config: ['near_cache' => ['max_entries' => 1000]]);
+     * $valkey_glide->get('config:flags');
+     * $valkey_glide->get('config:flags');
+     * $stats = $valkey_glide->getNearCacheStats();   // ['hits' => 1, 'misses' => 1, ...]
+     */
+    public function getNearCacheStats(): array|false;
+
+    /**
+     * Retrieve the in-process statistics collected for this client.
+     *
+     * Every command sent through the native client is counted and timed, without a
+     * round trip to the server. Latencies are kept in a log-linear histogram, so
+     * percentiles are accurate to within 12.5%. Objects sharing a persistent client
+     * share its statistics.
+     *
+     * @return array An array with the following layout:
+     *
+     *               <code>
+     *               [
+     *                   'since'          => int,   # Unix time of creation or last resetStats()
+     *                   'calls'          => int,   # Commands sent, batched ones included
+     *                   'errors'         => int,
+     *                   'bytes_sent'     => int,   # Argument bytes
+     *                   'bytes_received' => int,   # String payload bytes in replies
+     *                   'commands'       => [      # Keyed by the Glide core RequestType id
+     *                       int => [
+     *                           'calls'          => int,
+     *                           'errors'         => int,
+     *                           'bytes_sent'     => int,
+     *                           'bytes_received' => int,
+     *                           'latency_us'     => ['mean' => float, 'p50' => int, 'p90' => int,
+     *                                               'p99' => int, 'p999' => int, 'max' => int],
+     *                       ],
+     *                   ],
+     *                   'batch'          => [...],  # Same fields per exec() round trip, plus 'commands'
+     *               ]
+     *               </code>
+     *
+     * @see ValkeyGlide::resetStats()
+     *
+     * @example
+     * $stats = $valkey_glide->getStats();
+     * foreach ($stats['commands'] as $type => $command) {
+     *     printf("%d: %d calls, p99 %dus\n", $type, $command['calls'], $command['latency_us']['p99']);
+     * }
+     */
+    public function getStats(): array;
+
     /**
      * Get the longest common subsequence between two string keys.
      *
@@ -1258,6 +1471,23 @@ class ValkeyGlide
      */
     public function hGetAll(string $key): ValkeyGlide|array|false;
 
+    /**
+     * Read every field and value from many hashes in one round trip.
+     *
+     * The HGETALL commands are sent as a single non-atomic batch. In cluster mode
+     * each one is routed to the node owning its key.
+     *
+     * @param array $keys The hashes to query.
+     * @return array|false An array indexed by key with the fields and values of each
+     *                     hash (an empty array if the hash doesn't exist), or false
+     *                     on failure.
+     *
+     * @see ValkeyGlide::hGetAll
+     *
+     * @example $valkey_glide->hGetAllMany(['session:1', 'session:2']);
+     */
+    public function hGetAllMany(array $keys): array|false;
+
     /**
      * Increment a hash field's value by an integer
      *
@@ -1331,6 +1561,21 @@ class ValkeyGlide
      */
     public function hMget(string $key, array $fields): ValkeyGlide|array|false;
 
+    /**
+     * Get the same fields from many hashes in one round trip.
+     *
+     * @param array $keys   The hashes to query.
+     * @param array $fields One or more fields to query in every hash.
+     *
+     * @return array|false An array indexed by key with the fields and values of each
+     *                     hash, as returned by hMget(), or false on failure.
+     *
+     * @see ValkeyGlide::hMget
+     *
+     * @example $valkey_glide->hMgetMany(['product:1', 'product:2'], ['name', 'price']);
+     */
+    public function hMgetMany(array $keys, array $fields): array|false;
+
     /**
      * Add or update one or more hash fields and values
      *
@@ -1345,6 +1590,21 @@ class ValkeyGlide
      */
     public function hMset(string $key, array $fieldvals): ValkeyGlide|bool;
 
+    /**
+     * Add or update fields in many hashes in one round trip.
+     *
+     * @param array $key_fields An array mapping each hash to an associative array of
+     *                          its fields and values.
+     *
+     * @return array|false An array indexed by key with true for every hash that was
+     *                     updated, or false on failure.
+     *
+     * @see ValkeyGlide::hMset
+     *
+     * @example $valkey_glide->hMsetMany(['user:1' => ['name' => 'Ann'], 'user:2' => ['name' => 'Bo']]);
+     */
+    public function hMsetMany(array $key_fields): array|false;
+
     /**
      * Get one or more random field from a hash.
      *
@@ -1993,8 +2253,12 @@ class ValkeyGlide
     /**
      * Begin a transaction.
      *
-     * @param int $value  The type of transaction to start.  This can either be `ValkeyGlide::MULTI` or
-     *                    `ValkeyGlide::PIPELINE'.
+     * @param int   $value   The type of transaction to start.  This can either be `ValkeyGlide::MULTI` or
+     *                       `ValkeyGlide::PIPELINE'.
+     * @param array $options Batch options.  'timeout' is how long, in milliseconds, to wait for
+     *                       the whole batch.  ValkeyGlideCluster pipelines also accept
+     *                       'retry_server_error' and 'retry_connection_error', which retry the
+     *                       commands that hit a TRYAGAIN-style server error or a lost connection.
      *
      * @return ValkeyGlide|bool True if the transaction could be started.
      *
@@ -2005,8 +2269,10 @@ class ValkeyGlide
      * $valkey_glide->set('foo', 'bar');
      * $valkey_glide->get('foo');
      * $valkey_glide->exec();
+     *
+     * $valkey_glide->multi(ValkeyGlide::MULTI, ['timeout' => 500]);
      */
-    public function multi(int $value = ValkeyGlide::MULTI): bool|ValkeyGlide;
+    public function multi(int $value = ValkeyGlide::MULTI, array $options = []): bool|ValkeyGlide;
 
     public function object(string $subcommand, string $key): ValkeyGlide|int|string|false;
 
@@ -2109,6 +2375,19 @@ class ValkeyGlide
      *
      * NOTE:  That this is shorthand for ValkeyGlide::multi(ValkeyGlide::PIPELINE)
      *
+     * When a flush threshold is given, the commands queued so far are sent as soon as
+     * either threshold is reached, keeping the client-side buffer bounded for very
+     * long pipelines. The replies are still returned together by ValkeyGlide::exec().
+     *
+     * On ValkeyGlideCluster the pipeline is split by the node owning each key and the parts
+     * run concurrently. Commands given a route, such as rawCommand() or info(), are sent to
+     * that route instead; the replies still come back in the order the commands were queued.
+     *
+     * @param int   $flush_commands Send the buffered commands once this many are queued (0 = never).
+     * @param int   $flush_bytes    Send the buffered commands once their arguments reach this
+     *                              many bytes (0 = never).
+     * @param array $options        Batch options, as for ValkeyGlide::multi().
+     *
      * @return ValkeyGlide The valkey object is returned, to facilitate method chaining.
      *
      * @example
@@ -2118,7 +2397,26 @@ class ValkeyGlide
      *       ->rpush('mylist', 'a', 'b', 'c')
      *       ->exec();
      */
-    public function pipeline(): bool|ValkeyGlide;
+    public function pipeline(int $flush_commands = 0, int $flush_bytes = 0, array $options = []): bool|ValkeyGlide;
+
+    /**
+     * Read the messages received on subscribed channels and patterns without blocking
+     * in a subscribe loop, e.g. from an event loop tick.
+     *
+     * @param int   $max_messages The most messages to return.
+     * @param float $timeout      How long to wait, in seconds, when no message is queued.
+     *
+     * @return array|false A list of messages, each an array with 'type' ('message' or
+     *                     'pmessage'), 'channel', 'message' and, for patterns, 'pattern'.
+     *                     False if the client never subscribed.
+     *
+     * @example
+     * $valkey_glide->subscribe(['news']);
+     * foreach ($valkey_glide->poll(100, 0.5) as $msg) {
+     *     echo "{$msg['channel']}: {$msg['message']}\n";
+     * }
+     */
+    public function poll(int $max_messages = 1000, float $timeout = 0.0): array|false;
 
     /**
      * Set a key with an expiration time in milliseconds
@@ -2137,17 +2435,21 @@ class ValkeyGlide
      * Subscribe to one or more glob-style patterns
      *
      * @param array     $patterns One or more patterns to subscribe to.
-     * @param callable  $cb       A callback with the following prototype:
+     * @param ?callable $cb       A callback with the following prototype:
      *
      *                            <code>
-     *                            function ($valkey_glide, $channel, $message) { }
+     *                            function ($valkey_glide, $pattern, $channel, $message) { }
      *                            </code>
      *
+     *                            Without a callback the patterns are added and messages are
+     *                            read with ValkeyGlide::poll().
+     *
      * @see https://valkey.io/commands/psubscribe
+     * @see ValkeyGlide::subscribe()
      *
      * @return bool True if we were subscribed.
      */
-    /* TODO public function psubscribe(array $patterns, callable $cb): bool; */
+    public function psubscribe(array $patterns, ?callable $cb = null): bool;
 
     /**
      * Get a keys time to live in milliseconds.
@@ -2174,9 +2476,9 @@ class ValkeyGlide
      * @param string $channel The channel to publish to.
      * @param string $message The message itself.
      *
-     * @return ValkeyGlide|int The number of subscribed clients to the given channel.
+     * @return ValkeyGlide|int|false The number of subscribed clients to the given channel.
      */
-   /* TODO  public function publish(string $channel, string $message): ValkeyGlide|int|false;*/
+    public function publish(string $channel, string $message): ValkeyGlide|int|false;
 
     /* TODO public function pubsub(string $command, mixed $arg = null): mixed;*/
 
@@ -2187,11 +2489,12 @@ class ValkeyGlide
      * @see https://valkey.io/commands/subscribe
      * @see ValkeyGlide::subscribe()
      *
-     * @param array $patterns One or more glob-style patterns of channel names.
+     * @param array $patterns One or more glob-style patterns of channel names, or none for all
+     *                        of them.
      *
-     * @return ValkeyGlide|array|bool  The array of subscribed patterns or false on failure.
+     * @return array|false An array of pattern => whether it was subscribed, or false on failure.
      */
-   /* public function punsubscribe(array $patterns): ValkeyGlide|array|bool;*/
+    public function punsubscribe(array $patterns = []): array|false;
 
     /**
      * Pop one or more elements from the end of a list.
@@ -2233,6 +2536,21 @@ class ValkeyGlide
      */
     public function rawcommand(string $command, mixed ...$args): mixed;
 
+    /**
+     * Send an arbitrary command without waiting for the reply.
+     *
+     * @param string $command The command to execute
+     * @param mixed  $args    One or more arguments to pass to the command.
+     *
+     * @return ValkeyGlideFuture|false A future resolving to what rawcommand() would return.
+     *
+     * @see ValkeyGlide::rawcommand()
+     * @see ValkeyGlide::getAsync()
+     *
+     * @example $valkey_glide->sendAsync('incr', 'counter')->await();
+     */
+    public function sendAsync(string $command, mixed ...$args): ValkeyGlideFuture|false;
+
     /**
      * Unconditionally rename a key from $old_name to $new_name
      *
@@ -2264,6 +2582,15 @@ class ValkeyGlide
      */
     public function renameNx(string $key_src, string $key_dst): ValkeyGlide|bool;
 
+    /**
+     * Clear the counters and latency histograms returned by getStats().
+     *
+     * @return bool True on success.
+     *
+     * @see ValkeyGlide::getStats()
+     */
+    public function resetStats(): bool;
+
     /**
      * Restore a key by the binary payload generated by the DUMP command.
      *
@@ -2636,7 +2963,7 @@ class ValkeyGlide
      * @example $valkey_glide->script('load', 'return 1');
      * @example $valkey_glide->script('exists', sha1('return 1'));
      */
-    /* TODO public function script(string $command, mixed ...$args): mixed; */
+    public function script(string $command, mixed ...$args): mixed;
 
     /**
      * Select a specific ValkeyGlide database.
@@ -2922,12 +3249,16 @@ class ValkeyGlide
     /**
      * Subscribe to one or more ValkeyGlide pubsub channels.
      *
-     * @param array    $channels One or more channel names.
-     * @param callable $cb       The callback PhpValkeyGlide will invoke when we receive a message
-     *                           from one of the subscribed channels.
+     * Subscriptions are held by a separate connection, so the client keeps running commands
+     * while subscribed.
      *
-     * @return bool True on success, false on faiilure.  Note that this command will block the
-     *              client in a subscribe loop, waiting for messages to arrive.
+     * @param array     $channels One or more channel names.
+     * @param ?callable $cb       The callback PhpValkeyGlide will invoke when we receive a message
+     *                            from one of the subscribed channels. Without one the channels
+     *                            are added and messages are read with ValkeyGlide::poll().
+     *
+     * @return bool True on success, false on faiilure.  With a callback this command will block
+     *              the client in a subscribe loop, waiting for messages to arrive.
      *
      * @see https://valkey.io/commands/subscribe
      *
@@ -2948,7 +3279,7 @@ class ValkeyGlide
      * // broken and this command will execute.
      * echo "Subscribe loop ended\n";
      */
-    /* TODO public function subscribe(array $channels, callable $cb): bool; */
+    public function subscribe(array $channels, ?callable $cb = null): bool;
 
     /**
      * Unsubscribes the client from the given shard channels,
@@ -3049,8 +3380,8 @@ class ValkeyGlide
     /**
      * Unsubscribe from one or more subscribed channels.
      *
-     * @param array $channels One or more channels to unsubscribe from.
-     * @return ValkeyGlide|array|bool The array of unsubscribed channels.
+     * @param array $channels One or more channels to unsubscribe from, or none for all of them.
+     * @return array|false An array of channel => whether it was subscribed, or false on failure.
      *
      * @see https://valkey.io/commands/unsubscribe
      * @see ValkeyGlide::subscribe()
@@ -3067,7 +3398,7 @@ class ValkeyGlide
      *
      * echo "We've unsubscribed from both channels, exiting\n";
      */
-    /* TODO public function unsubscribe(array $channels): ValkeyGlide|array|bool; */
+    public function unsubscribe(array $channels = []): array|false;
 
     /**
      * Remove any previously WATCH'ed keys in a transaction.
@@ -3712,6 +4043,29 @@ class ValkeyGlide
      */
     public function zRange(string $key, string|int $start, string|int $end, array|bool|null $options = null): ValkeyGlide|array|false;
 
+    /**
+     * Walk a sorted set by rank, one chunk per call, without building the whole range at once.
+     *
+     * @param string    $key        The sorted set to walk.
+     * @param int|null  $iterator   The offset of the next chunk, pass null to start.  It is
+     *                              set to 0 once the last chunk has been returned.
+     * @param int       $count      How many members to fetch per call.
+     * @param bool      $withscores Return member => score instead of a list of members.
+     *
+     * @return array|false The next chunk, or false when there are no members left.
+     *
+     * @category zset
+     *
+     * @example
+     * $it = null;
+     * while (($chunk = $valkey_glide->zRangeIterator('leaderboard', $it, 500, true)) !== false) {
+     *     foreach ($chunk as $member => $score) {
+     *         echo "$member => $score\n";
+     *     }
+     * }
+     */
+    public function zRangeIterator(string $key, ?int &$iterator, int $count = 1000, bool $withscores = false): array|false;
+
     /**
      * Retrieve a range of elements from a sorted set by legographical range.
      *
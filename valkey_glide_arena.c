@@ -0,0 +1,174 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_arena.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "logger.h"
+#include "valkey_glide_numeric.h"
+
+#define VALKEY_GLIDE_ARENA_CHUNK_HEADER ZEND_MM_ALIGNED_SIZE(sizeof(valkey_glide_arena_chunk_t))
+
+/**
+ * Prepare an arena for use. No memory is allocated until the inline buffer overflows.
+ */
+void valkey_glide_arena_init(valkey_glide_arena_t* arena) {
+    arena->chunks      = NULL;
+    arena->strings     = NULL;
+    arena->inline_used = 0;
+}
+
+/**
+ * Release every kept string and overflow chunk and rewind the inline buffer.
+ * All pointers previously handed out by the arena become invalid.
+ */
+void valkey_glide_arena_reset(valkey_glide_arena_t* arena) {
+    valkey_glide_arena_string_t* kept  = arena->strings;
+    valkey_glide_arena_chunk_t*  chunk = arena->chunks;
+
+    /* The list nodes live in the chunks, so strings go first */
+    while (kept) {
+        zend_string_release(kept->str);
+        kept = kept->next;
+    }
+    arena->strings = NULL;
+
+    while (chunk) {
+        valkey_glide_arena_chunk_t* next = chunk->next;
+        efree(chunk);
+        chunk = next;
+    }
+    arena->chunks      = NULL;
+    arena->inline_used = 0;
+}
+
+/**
+ * Bump-allocate size bytes, aligned for any argument type we store.
+ */
+void* valkey_glide_arena_alloc(valkey_glide_arena_t* arena, size_t size) {
+    size = ZEND_MM_ALIGNED_SIZE(size);
+
+    if (size <= VALKEY_GLIDE_ARENA_INLINE_SIZE - arena->inline_used) {
+        void* ptr = arena->inline_buf.bytes + arena->inline_used;
+        arena->inline_used += size;
+        return ptr;
+    }
+
+    valkey_glide_arena_chunk_t* chunk = arena->chunks;
+    if (chunk && size <= chunk->size - chunk->used) {
+        void* ptr = (char*) chunk + VALKEY_GLIDE_ARENA_CHUNK_HEADER + chunk->used;
+        chunk->used += size;
+        return ptr;
+    }
+
+    size_t chunk_size = size > VALKEY_GLIDE_ARENA_CHUNK_SIZE ? size : VALKEY_GLIDE_ARENA_CHUNK_SIZE;
+    chunk             = emalloc(VALKEY_GLIDE_ARENA_CHUNK_HEADER + chunk_size);
+    chunk->size       = chunk_size;
+    chunk->used       = size;
+    chunk->next       = arena->chunks;
+    arena->chunks     = chunk;
+
+    VALKEY_LOG_DEBUG("arena", "Command arena overflowed inline buffer, allocated chunk");
+
+    return (char*) chunk + VALKEY_GLIDE_ARENA_CHUNK_HEADER;
+}
+
+/**
+ * Copy len bytes into the arena and NUL-terminate them.
+ */
+char* valkey_glide_arena_strndup(valkey_glide_arena_t* arena, const char* str, size_t len) {
+    char* copy = valkey_glide_arena_alloc(arena, len + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+/**
+ * Convert long to string
+ */
+char* valkey_glide_arena_long_to_string(valkey_glide_arena_t* arena, long value, size_t* len) {
+    char* str = valkey_glide_arena_alloc(arena, VALKEY_GLIDE_LONG_MAX_LEN + 1);
+
+    *len = valkey_glide_format_long(str, value);
+    return str;
+}
+
+/**
+ * Store a long converted into the arena as argument idx
+ */
+void valkey_glide_arena_add_long_arg(valkey_glide_arena_t* arena,
+                                     long                  value,
+                                     uintptr_t*            args,
+                                     unsigned long*        args_len,
+                                     size_t                idx) {
+    size_t len;
+
+    args[idx]     = (uintptr_t) valkey_glide_arena_long_to_string(arena, value, &len);
+    args_len[idx] = len;
+}
+
+/**
+ * Convert double to string
+ */
+char* valkey_glide_arena_double_to_string(valkey_glide_arena_t* arena, double value, size_t* len) {
+    char* str = valkey_glide_arena_alloc(arena, VALKEY_GLIDE_DOUBLE_MAX_LEN + 1);
+
+    *len = valkey_glide_format_double(str, value);
+    return str;
+}
+
+/**
+ * Argument bytes of a zval, to be read only. Strings are used in place,
+ * anything else is converted into the arena.
+ */
+char* valkey_glide_arena_zval_to_string(valkey_glide_arena_t* arena, zval* value, size_t* len) {
+    switch (Z_TYPE_P(value)) {
+        case IS_STRING:
+            *len = Z_STRLEN_P(value);
+            return Z_STRVAL_P(value);
+        case IS_LONG:
+            return valkey_glide_arena_long_to_string(arena, Z_LVAL_P(value), len);
+        case IS_DOUBLE:
+            return valkey_glide_arena_double_to_string(arena, Z_DVAL_P(value), len);
+        case IS_TRUE:
+            *len = 1;
+            return "1";
+        case IS_FALSE:
+            *len = 1;
+            return "0";
+        default:
+            return valkey_glide_arena_keep_string(arena, zval_get_string(value), len);
+    }
+}
+
+/**
+ * Take ownership of str until the arena is reset and return its bytes, so
+ * strings built elsewhere are sent without another copy.
+ */
+char* valkey_glide_arena_keep_string(valkey_glide_arena_t* arena, zend_string* str, size_t* len) {
+    valkey_glide_arena_string_t* kept = valkey_glide_arena_alloc(arena, sizeof(*kept));
+
+    kept->str      = str;
+    kept->next     = arena->strings;
+    arena->strings = kept;
+
+    *len = ZSTR_LEN(str);
+    return ZSTR_VAL(str);
+}
+
+/**
+ * Allocate the FFI argument pointer and length arrays for count arguments.
+ */
+int valkey_glide_arena_alloc_arg_arrays(valkey_glide_arena_t* arena,
+                                        int                   count,
+                                        uintptr_t**           args_out,
+                                        unsigned long**       args_len_out) {
+    if (count < 0) {
+        return 0;
+    }
+
+    *args_out     = valkey_glide_arena_alloc(arena, count * sizeof(uintptr_t));
+    *args_len_out = valkey_glide_arena_alloc(arena, count * sizeof(unsigned long));
+    return 1;
+}
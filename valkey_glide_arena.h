@@ -0,0 +1,72 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_ARENA_H
+#define VALKEY_GLIDE_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "php.h"
+
+/* ====================================================================
+ * PER-COMMAND BUMP ARENA
+ * ==================================================================== */
+
+/*
+ * Inline capacity covers the argument/length arrays for the common
+ * <= 8 argument command (matching core_command_args_t.args[8]) plus the
+ * stringified numeric arguments, so typical GET/SET calls never touch
+ * the Zend allocator while marshalling.
+ */
+#define VALKEY_GLIDE_ARENA_INLINE_SIZE 512
+
+/* Minimum size of an overflow chunk once the inline buffer is exhausted */
+#define VALKEY_GLIDE_ARENA_CHUNK_SIZE 4096
+
+typedef struct valkey_glide_arena_chunk {
+    struct valkey_glide_arena_chunk* next;
+    size_t                           size;
+    size_t                           used;
+} valkey_glide_arena_chunk_t;
+
+/* A zend_string handed to the arena, released with it */
+typedef struct valkey_glide_arena_string {
+    struct valkey_glide_arena_string* next;
+    zend_string*                      str;
+} valkey_glide_arena_string_t;
+
+/**
+ * Bump allocator for the lifetime of a single command.
+ * Declare it on the stack, initialize it, allocate from it while preparing
+ * the FFI arguments and release everything with one valkey_glide_arena_reset().
+ */
+typedef struct {
+    valkey_glide_arena_chunk_t*  chunks;
+    valkey_glide_arena_string_t* strings;
+    size_t                       inline_used;
+    union {
+        char      bytes[VALKEY_GLIDE_ARENA_INLINE_SIZE];
+        uintptr_t align_ptr;
+        double    align_double;
+    } inline_buf;
+} valkey_glide_arena_t;
+
+void  valkey_glide_arena_init(valkey_glide_arena_t* arena);
+void  valkey_glide_arena_reset(valkey_glide_arena_t* arena);
+void* valkey_glide_arena_alloc(valkey_glide_arena_t* arena, size_t size);
+char* valkey_glide_arena_strndup(valkey_glide_arena_t* arena, const char* str, size_t len);
+char* valkey_glide_arena_long_to_string(valkey_glide_arena_t* arena, long value, size_t* len);
+void  valkey_glide_arena_add_long_arg(valkey_glide_arena_t* arena,
+                                      long                  value,
+                                      uintptr_t*            args,
+                                      unsigned long*        args_len,
+                                      size_t                idx);
+char* valkey_glide_arena_double_to_string(valkey_glide_arena_t* arena, double value, size_t* len);
+char* valkey_glide_arena_zval_to_string(valkey_glide_arena_t* arena, zval* value, size_t* len);
+char* valkey_glide_arena_keep_string(valkey_glide_arena_t* arena, zend_string* str, size_t* len);
+int   valkey_glide_arena_alloc_arg_arrays(valkey_glide_arena_t* arena,
+                                          int                   count,
+                                          uintptr_t**           args_out,
+                                          unsigned long**       args_len_out);
+
+#endif /* VALKEY_GLIDE_ARENA_H */
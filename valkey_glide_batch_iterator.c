@@ -0,0 +1,192 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_batch_iterator.h"
+
+#include <zend_interfaces.h>
+
+#include "valkey_glide_batch_iterator_arginfo.h"
+#include "valkey_glide_commands_common.h"
+
+/* Global variables */
+zend_class_entry*           valkey_glide_batch_iterator_ce;
+static zend_object_handlers valkey_glide_batch_iterator_object_handlers;
+
+/* Object creation and destruction */
+static zend_object* create_valkey_glide_batch_iterator_object(zend_class_entry* ce) {
+    valkey_glide_batch_iterator_object* iterator =
+        ecalloc(1, sizeof(valkey_glide_batch_iterator_object) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&iterator->std, ce);
+    object_properties_init(&iterator->std, ce);
+
+    ZVAL_UNDEF(&iterator->client);
+    ZVAL_UNDEF(&iterator->chunk);
+    iterator->std.handlers = &valkey_glide_batch_iterator_object_handlers;
+
+    return &iterator->std;
+}
+
+static void free_valkey_glide_batch_iterator_object(zend_object* object) {
+    valkey_glide_batch_iterator_object* iterator =
+        VALKEY_GLIDE_PHP_GET_OBJECT(valkey_glide_batch_iterator_object, object);
+
+    zval_ptr_dtor(&iterator->chunk);
+    zval_ptr_dtor(&iterator->client);
+    valkey_glide_batch_buffer_free(&iterator->batch);
+
+    /* Clean up the standard object */
+    zend_object_std_dtor(&iterator->std);
+}
+
+void valkey_glide_batch_iterator_create(zval*                        return_value,
+                                        zval*                        client,
+                                        valkey_glide_batch_buffer_t* batch,
+                                        zval*                        flushed_results,
+                                        bool                         is_atomic,
+                                        size_t                       chunk_size) {
+    valkey_glide_batch_iterator_object* iterator;
+
+    object_init_ex(return_value, valkey_glide_batch_iterator_ce);
+    iterator = VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(return_value);
+
+    ZVAL_COPY(&iterator->client, client);
+    iterator->batch      = *batch;
+    iterator->is_atomic  = is_atomic;
+    iterator->chunk_size = chunk_size;
+
+    /* Replies of auto-flushed sub-batches are served first */
+    ZVAL_COPY_VALUE(&iterator->chunk, flushed_results);
+}
+
+/* Send the next group of commands and replace the current chunk with their replies */
+static void load_next_chunk(valkey_glide_batch_iterator_object* iterator) {
+    valkey_glide_batch_buffer_t* batch     = &iterator->batch;
+    size_t                       remaining = batch->command_count - iterator->next_command;
+    size_t count = iterator->is_atomic || remaining < iterator->chunk_size ? remaining
+                                                                           : iterator->chunk_size;
+    valkey_glide_object* valkey_glide =
+        VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, &iterator->client);
+
+    zval_ptr_dtor(&iterator->chunk);
+    array_init_size(&iterator->chunk, (uint32_t) count);
+    iterator->chunk_pos = 0;
+
+    if (!valkey_glide->glide_client ||
+        !valkey_glide_batch_buffer_send(valkey_glide->glide_client,
+                                        batch,
+                                        iterator->next_command,
+                                        count,
+                                        iterator->is_atomic,
+                                        &iterator->chunk)) {
+        /* Keep one entry per command so keys line up with the queued commands */
+        for (size_t i = 0; i < count; i++) {
+            add_next_index_bool(&iterator->chunk, 0);
+        }
+    }
+
+    iterator->next_command += count;
+
+    /* Nothing left to send, so the request arguments can go */
+    if (iterator->next_command >= batch->command_count) {
+        valkey_glide_batch_buffer_free(batch);
+        iterator->next_command = 0;
+    }
+}
+
+/* Position on a reply, sending more commands when the current chunk is exhausted */
+static bool batch_iterator_fetch(valkey_glide_batch_iterator_object* iterator) {
+    if (!iterator->started) {
+        iterator->started = true;
+        if (Z_ISUNDEF(iterator->chunk)) {
+            load_next_chunk(iterator);
+        }
+    }
+
+    while (iterator->chunk_pos >= zend_hash_num_elements(Z_ARRVAL(iterator->chunk))) {
+        if (iterator->next_command >= iterator->batch.command_count) {
+            return false;
+        }
+        load_next_chunk(iterator);
+    }
+
+    return true;
+}
+
+/* Class methods implementation */
+
+PHP_METHOD(ValkeyGlideBatchIterator, __construct) {
+    /* Instances are only created by execIterator() */
+    ZEND_PARSE_PARAMETERS_NONE();
+}
+
+/**
+ * current(): The reply of the command at the current position
+ */
+PHP_METHOD(ValkeyGlideBatchIterator, current) {
+    valkey_glide_batch_iterator_object* iterator;
+    zval*                               value;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    iterator = VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(getThis());
+    if (!batch_iterator_fetch(iterator)) {
+        RETURN_NULL();
+    }
+
+    value = zend_hash_index_find(Z_ARRVAL(iterator->chunk), iterator->chunk_pos);
+    if (!value) {
+        RETURN_NULL();
+    }
+    RETURN_COPY(value);
+}
+
+/**
+ * key(): Index of the queued command the current reply belongs to
+ */
+PHP_METHOD(ValkeyGlideBatchIterator, key) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG(VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(getThis())->position);
+}
+
+PHP_METHOD(ValkeyGlideBatchIterator, next) {
+    valkey_glide_batch_iterator_object* iterator;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    iterator = VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(getThis());
+    if (batch_iterator_fetch(iterator)) {
+        iterator->chunk_pos++;
+        iterator->position++;
+    }
+}
+
+/**
+ * rewind(): Starts the iteration. Replies are consumed as they are read,
+ * so rewinding an iterator that has already advanced does nothing.
+ */
+PHP_METHOD(ValkeyGlideBatchIterator, rewind) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    batch_iterator_fetch(VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(getThis()));
+}
+
+PHP_METHOD(ValkeyGlideBatchIterator, valid) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_BOOL(batch_iterator_fetch(VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(getThis())));
+}
+
+/* Class registration function using generated arginfo */
+void register_valkey_glide_batch_iterator_class(void) {
+    valkey_glide_batch_iterator_ce = register_class_ValkeyGlideBatchIterator(zend_ce_iterator);
+    valkey_glide_batch_iterator_ce->create_object = create_valkey_glide_batch_iterator_object;
+
+    memcpy(&valkey_glide_batch_iterator_object_handlers,
+           zend_get_std_object_handlers(),
+           sizeof(valkey_glide_batch_iterator_object_handlers));
+    valkey_glide_batch_iterator_object_handlers.offset =
+        XtOffsetOf(valkey_glide_batch_iterator_object, std);
+    valkey_glide_batch_iterator_object_handlers.free_obj = free_valkey_glide_batch_iterator_object;
+    valkey_glide_batch_iterator_object_handlers.clone_obj = NULL;
+}
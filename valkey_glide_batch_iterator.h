@@ -0,0 +1,56 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_BATCH_ITERATOR_H
+#define VALKEY_GLIDE_BATCH_ITERATOR_H
+
+#include "common.h"
+#include "php.h"
+
+/* Number of pipelined commands sent per round trip when execIterator() gets no argument */
+#define VALKEY_GLIDE_BATCH_ITERATOR_DEFAULT_CHUNK 1000
+
+/* ValkeyGlideBatchIterator object structure */
+typedef struct {
+    zval                        client;       /* Owning client, kept alive while iterating */
+    valkey_glide_batch_buffer_t batch;        /* Commands detached from the client */
+    bool                        is_atomic;    /* MULTI: send everything in one batch */
+    size_t                      chunk_size;   /* Commands sent per round trip */
+    size_t                      next_command; /* First command not yet sent */
+    zval                        chunk;        /* Replies of the current round trip */
+    size_t                      chunk_pos;    /* Position inside chunk */
+    zend_long                   position;     /* Position across the whole batch */
+    bool                        started;      /* First chunk has been requested */
+    zend_object                 std;          /* Standard PHP object */
+} valkey_glide_batch_iterator_object;
+
+/* Class entry */
+extern zend_class_entry* valkey_glide_batch_iterator_ce;
+
+/* Class methods */
+PHP_METHOD(ValkeyGlideBatchIterator, __construct);
+PHP_METHOD(ValkeyGlideBatchIterator, current);
+PHP_METHOD(ValkeyGlideBatchIterator, key);
+PHP_METHOD(ValkeyGlideBatchIterator, next);
+PHP_METHOD(ValkeyGlideBatchIterator, rewind);
+PHP_METHOD(ValkeyGlideBatchIterator, valid);
+
+/* Helper macros */
+#define VALKEY_GLIDE_BATCH_ITERATOR_ZVAL_GET_OBJECT(zv) \
+    VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_batch_iterator_object, zv)
+
+/**
+ * Create an iterator over the replies of a detached batch.
+ * Ownership of the buffer and of the already flushed replies (may be UNDEF)
+ * moves to the iterator; the caller must not free them afterwards.
+ */
+void valkey_glide_batch_iterator_create(zval*                        return_value,
+                                        zval*                        client,
+                                        valkey_glide_batch_buffer_t* batch,
+                                        zval*                        flushed_results,
+                                        bool                         is_atomic,
+                                        size_t                       chunk_size);
+
+/* Class registration function */
+void register_valkey_glide_batch_iterator_class(void);
+
+#endif /* VALKEY_GLIDE_BATCH_ITERATOR_H */
@@ -0,0 +1,53 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * ValkeyGlideBatchIterator yields the replies of a pipeline or transaction one at a time.
+ *
+ * Instances are returned by ValkeyGlide::execIterator() and ValkeyGlideCluster::execIterator().
+ * Pipelined commands are sent lazily in chunks as the iterator advances, so only one chunk
+ * of replies is held in memory at a time. Keys are the positions of the queued commands.
+ * The iterator is forward-only.
+ */
+final class ValkeyGlideBatchIterator implements Iterator
+{
+    private function __construct()
+    {
+    }
+
+    /**
+     * Get the reply at the current position.
+     *
+     * @return mixed The reply, or false if the chunk containing it failed.
+     */
+    public function current(): mixed
+    {
+    }
+
+    /**
+     * Get the index of the queued command the current reply belongs to.
+     */
+    public function key(): int
+    {
+    }
+
+    public function next(): void
+    {
+    }
+
+    /**
+     * Start the iteration. Does nothing once the iterator has advanced.
+     */
+    public function rewind(): void
+    {
+    }
+
+    public function valid(): bool
+    {
+    }
+}
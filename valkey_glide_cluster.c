@@ -18,6 +18,8 @@
 #include "valkey_glide_geo_common.h"
 #include "valkey_glide_hash_common.h" /* Include hash command framework */
 #include "valkey_glide_list_common.h"
+#include "valkey_glide_pubsub.h"
+#include "valkey_glide_script.h"
 #include "valkey_glide_s_common.h"
 #include "valkey_glide_x_common.h"
 #include "valkey_glide_z_common.h"
@@ -94,19 +96,16 @@ PHP_METHOD(ValkeyGlideCluster, __construct) {
     }
 
     /* Issue the connection request. */
-    const ConnectionResponse* conn_resp = create_glide_cluster_client(&client_config);
+    char* error_message = valkey_glide_connect_cluster_client(valkey_glide, &client_config);
 
-    if (conn_resp->connection_error_message) {
-        VALKEY_LOG_ERROR("cluster_construct", conn_resp->connection_error_message);
-        zend_throw_exception(
-            get_valkey_glide_cluster_exception_ce(), conn_resp->connection_error_message, 0);
+    if (error_message) {
+        VALKEY_LOG_ERROR("cluster_construct", error_message);
+        zend_throw_exception(get_valkey_glide_cluster_exception_ce(), error_message, 0);
+        efree(error_message);
     } else {
         VALKEY_LOG_INFO("cluster_construct", "ValkeyGlide cluster client created successfully");
-        valkey_glide->glide_client = conn_resp->conn_ptr;
     }
 
-    free_connection_response((ConnectionResponse*) conn_resp);
-
     /* Clean up temporary configuration structures */
     valkey_glide_cleanup_client_config(&client_config.base);
 }
@@ -126,6 +125,42 @@ PHP_METHOD(ValkeyGlideCluster, close) {
 GET_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto ValkeyGlideFuture ValkeyGlideCluster::getAsync(string key) */
+GET_ASYNC_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::getStats() */
+GET_STATS_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlideCluster::resetStats() */
+RESET_STATS_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array|false ValkeyGlideCluster::getNearCacheStats() */
+GET_NEAR_CACHE_STATS_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlideCluster::clearNearCache() */
+CLEAR_NEAR_CACHE_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto int ValkeyGlideCluster::keySlot(string key) */
+KEY_SLOT_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::mgetBySlot(array keys) */
+MGET_BY_SLOT_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlideCluster::msetBySlot(array key_values) */
+MSET_BY_SLOT_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto int ValkeyGlideCluster::delBySlot(array keys) */
+DEL_BY_SLOT_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto string ValkeyGlideCluster::getdel(string key) */
 GETDEL_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
@@ -462,6 +497,18 @@ HDEL_METHOD_IMPL(ValkeyGlideCluster)
 HMGET_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto array ValkeyGlideCluster::hGetAllMany(array keys) */
+HGETALL_MANY_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::hMgetMany(array keys, array fields) */
+HMGET_MANY_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::hMsetMany(array key_fields) */
+HMSET_MANY_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto array ValkeyGlideCluster::hstrlen(string key, string field) */
 HSTRLEN_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
@@ -574,8 +621,11 @@ ZREMRANGEBYRANK_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto long ValkeyGlideCluster::publish(string key, string msg) */
-PHP_METHOD(ValkeyGlideCluster, publish) {
-}
+PUBLISH_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto long ValkeyGlideCluster::spublish(string key, string msg) */
+SPUBLISH_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto bool ValkeyGlideCluster::rename(string key1, string key2) */
@@ -611,6 +661,11 @@ SETRANGE_METHOD_IMPL(ValkeyGlideCluster)
 ZRANGE_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto
+ *     array ValkeyGlideCluster::zRangeIterator(string k, int &it, long count, bool scores) */
+ZRANGE_ITERATOR_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto
  *     array ValkeyGlideCluster::zrange(string $dstkey, string $srckey, long s, long e, array|bool
  * $options = false) */
@@ -694,45 +749,53 @@ SORT_RO_METHOD_IMPL(ValkeyGlideCluster)
 /* {{{ proto ValkeyGlideCluster::object(string subcmd, string key) */
 OBJECT_METHOD_IMPL(ValkeyGlideCluster)
 
-/* {{{ proto null ValkeyGlideCluster::subscribe(array chans, callable cb) */
-PHP_METHOD(ValkeyGlideCluster, subscribe) {
-}
+/* {{{ proto bool ValkeyGlideCluster::subscribe(array chans, [callable cb]) */
+SUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
-/* {{{ proto null ValkeyGlideCluster::psubscribe(array pats, callable cb) */
-PHP_METHOD(ValkeyGlideCluster, psubscribe) {
-}
+/* {{{ proto bool ValkeyGlideCluster::psubscribe(array pats, [callable cb]) */
+PSUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
-/* {{{ proto array ValkeyGlideCluster::unsubscribe(array chans) */
-PHP_METHOD(ValkeyGlideCluster, unsubscribe) {
-}
+/* {{{ proto bool ValkeyGlideCluster::ssubscribe(array chans, [callable cb]) */
+SSUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
-/* {{{ proto array ValkeyGlideCluster::punsubscribe(array pats) */
-PHP_METHOD(ValkeyGlideCluster, punsubscribe) {
-}
+/* {{{ proto array ValkeyGlideCluster::unsubscribe([array chans]) */
+UNSUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::punsubscribe([array pats]) */
+PUNSUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::sunsubscribe([array chans]) */
+SUNSUBSCRIBE_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
+/* {{{ proto array ValkeyGlideCluster::poll([long max_messages, double timeout]) */
+POLL_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto mixed ValkeyGlideCluster::eval(string script, [array args, int numkeys) */
-PHP_METHOD(ValkeyGlideCluster, eval) {
-}
+EVAL_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto mixed ValkeyGlideCluster::eval_ro(string script, [array args, int numkeys) */
-PHP_METHOD(ValkeyGlideCluster, eval_ro) {
-}
+EVAL_RO_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto mixed ValkeyGlideCluster::evalsha(string sha, [array args, int numkeys]) */
-PHP_METHOD(ValkeyGlideCluster, evalsha) {
-}
+EVALSHA_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto mixed ValkeyGlideCluster::evalsha_ro(string sha, [array args, int numkeys]) */
-PHP_METHOD(ValkeyGlideCluster, evalsha_ro) {
-}
+EVALSHA_RO_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
 
+/* {{{ proto mixed ValkeyGlideCluster::invokeScript(ValkeyGlideScript script, [array keys,
+ *                                                  array args, bool read_only]) */
+INVOKE_SCRIPT_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 /* Commands that do not interact with ValkeyGlide, but just report stuff about
  * various options, etc */
@@ -756,6 +819,9 @@ UNWATCH_METHOD_IMPL(ValkeyGlideCluster)
 /* {{{ proto array ValkeyGlideCluster::exec() */
 EXEC_METHOD_IMPL(ValkeyGlideCluster)
 
+/* {{{ proto ValkeyGlideBatchIterator ValkeyGlideCluster::execIterator([int chunk_size]) */
+EXEC_ITERATOR_METHOD_IMPL(ValkeyGlideCluster)
+
 /* {{{ proto bool ValkeyGlideCluster::discard() */
 DISCARD_METHOD_IMPL(ValkeyGlideCluster)
 
@@ -763,6 +829,10 @@ DISCARD_METHOD_IMPL(ValkeyGlideCluster)
 SCAN_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto ClusterScanIterator ValkeyGlideCluster::scanIterator([pat, cnt, type, parallel]) */
+SCAN_ITERATOR_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto ValkeyGlideCluster::sscan(string key, long it [string pat, long cnt]) */
 SSCAN_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
@@ -795,6 +865,10 @@ DBSIZE_METHOD_IMPL(ValkeyGlideCluster)
 INFO_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto array ValkeyGlideCluster::infoAllNodes([string $section, ...]) */
+INFO_ALL_NODES_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto array ValkeyGlideCluster::client('list')
  *     proto bool ValkeyGlideCluster::client('kill', $ipport)
  *     proto bool ValkeyGlideCluster::client('setname', $name)
@@ -816,8 +890,7 @@ PHP_METHOD(ValkeyGlideCluster, pubsub) {
 
 /* {{{ proto mixed ValkeyGlideCluster::script(string key, ...)
  *     proto mixed ValkeyGlideCluster::script(array host_port, ...) */
-PHP_METHOD(ValkeyGlideCluster, script) {
-}
+SCRIPT_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
 /* {{{ proto array ValkeyGlideCluster::geohash(string key, string mem1, [string mem2...]) */
@@ -901,6 +974,10 @@ ECHO_METHOD_IMPL(ValkeyGlideCluster)
 RAWCOMMAND_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
 
+/* {{{ proto ValkeyGlideFuture ValkeyGlideCluster::sendAsync(string cmd, ...) */
+SEND_ASYNC_METHOD_IMPL(ValkeyGlideCluster)
+/* }}} */
+
 /* {{{ proto boolean ValkeyGlideCluster::select(int dbindex) */
 SELECT_METHOD_IMPL(ValkeyGlideCluster)
 /* }}} */
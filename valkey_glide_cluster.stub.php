@@ -195,6 +195,16 @@ class ValkeyGlideCluster
      *                                          - 'tls_config' => ['use_insecure_tls' => false]
      *                                          - 'refresh_topology_from_initial_nodes' => false (default: false)
      *                                            When true, topology updates use only initial nodes instead of internal cluster view.
+     *                                          - 'persistent' => false (default: false)
+     *                                            When true, the client and its topology are kept across requests.
+     *                                            See ValkeyGlide::__construct().
+     *                                          - 'near_cache' => ['max_entries' => 10000, 'bcast' => false, ...]
+     *                                            Client-side cache of GET, HGETALL, SMEMBERS and ZRANGE replies.
+     *                                            See ValkeyGlide::__construct() and getNearCacheStats().
+     *                                          - 'serializer' => ValkeyGlide::SERIALIZER_PHP (default: SERIALIZER_NONE)
+     *                                            Serializes values written and read. See ValkeyGlide::__construct().
+     *                                          - 'compression' => ['algorithm' => ValkeyGlide::COMPRESSION_LZ4, 'min_size' => 1024]
+     *                                            Compresses large values written and read. See ValkeyGlide::__construct().
      *                                          - 'otel' => OpenTelemetryConfig::builder()
      *                                                        ->traces(TracesConfig::builder()
      *                                                          ->endpoint('grpc://localhost:4317')
@@ -323,6 +333,11 @@ class ValkeyGlideCluster
      */
     public function close(): bool;
 
+    /**
+     * @see ValkeyGlide::clearNearCache
+     */
+    public function clearNearCache(): bool;
+
     /**
      * @see ValkeyGlide::updateConnectionPassword
      */
@@ -405,28 +420,41 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::eval
      */
-   /* TODO public function eval(string $script, array $args = [], int $num_keys = 0): mixed; */
+    public function eval(string $script, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * @see ValkeyGlide::eval_ro
      */
-    /* TODOpublic function eval_ro(string $script, array $args = [], int $num_keys = 0): mixed; */
+    public function eval_ro(string $script, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * @see ValkeyGlide::evalsha
      */
-   /* TODO public function evalsha(string $script_sha, array $args = [], int $num_keys = 0): mixed;*/
+    public function evalsha(string $script_sha, array $args = [], int $num_keys = 0): mixed;
 
     /**
      * @see ValkeyGlide::evalsha_ro
      */
-    /* TODOpublic function evalsha_ro(string $script_sha, array $args = [], int $num_keys = 0): mixed;*/
+    public function evalsha_ro(string $script_sha, array $args = [], int $num_keys = 0): mixed;
+
+    /**
+     * @see ValkeyGlide::invokeScript
+     *
+     * The script runs on the node owning its keys. In batches, calls only carry the hash when
+     * an earlier call in the batch had the same first key.
+     */
+    public function invokeScript(ValkeyGlideScript $script, array $keys = [], array $args = [], bool $read_only = false): mixed;
 
     /**
      * @see ValkeyGlide::exec()
      */
     public function exec(): array|false;
 
+    /**
+     * @see ValkeyGlide::execIterator()
+     */
+    public function execIterator(int $chunk_size = 1000): ValkeyGlideBatchIterator|false;
+
     /**
      * @see ValkeyGlide::exists
      */
@@ -502,6 +530,11 @@ class ValkeyGlideCluster
      */
     public function get(string $key): mixed;
 
+    /**
+     * @see ValkeyGlide::getAsync
+     */
+    public function getAsync(string $key): ValkeyGlideFuture|false;
+
     /**
      * @see ValkeyGlide::getDel
      */
@@ -522,6 +555,16 @@ class ValkeyGlideCluster
      */
     public function getRange(string $key, int $start, int $end): ValkeyGlideCluster|string|false;
 
+    /**
+     * @see ValkeyGlide::getNearCacheStats
+     */
+    public function getNearCacheStats(): array|false;
+
+    /**
+     * @see ValkeyGlide::getStats
+     */
+    public function getStats(): array;
+
     /**
      * @see ValkeyGlide::lcs
      */
@@ -552,6 +595,11 @@ class ValkeyGlideCluster
      */
     public function hGetAll(string $key): ValkeyGlideCluster|array|false;
 
+    /**
+     * @see ValkeyGlide::hGetAllMany
+     */
+    public function hGetAllMany(array $keys): array|false;
+
     /**
      * @see ValkeyGlide::hincrby
      */
@@ -577,11 +625,21 @@ class ValkeyGlideCluster
      */
     public function hMget(string $key, array $keys): ValkeyGlideCluster|array|false;
 
+    /**
+     * @see ValkeyGlide::hMgetMany
+     */
+    public function hMgetMany(array $keys, array $fields): array|false;
+
     /**
      * @see ValkeyGlide::hmset
      */
     public function hMset(string $key, array $key_values): ValkeyGlideCluster|bool;
 
+    /**
+     * @see ValkeyGlide::hMsetMany
+     */
+    public function hMsetMany(array $key_fields): array|false;
+
     /**
      * @see ValkeyGlide::hscan
      */
@@ -712,6 +770,38 @@ class ValkeyGlideCluster
      */
     public function info(mixed $route, string ...$sections): ValkeyGlideCluster|array|false;
 
+    /**
+     * Run INFO on every node of the cluster, primaries and replicas alike.
+     *
+     * Numeric fields are returned as int or float, like ValkeyGlideCluster::info().
+     *
+     * @see https://valkey.io/commands/info/
+     *
+     * @param string $sections Optional section(s) each node should return.
+     *
+     * @return ValkeyGlideCluster|array|false The parsed INFO of each node, keyed by "host:port".
+     *
+     * @example
+     * foreach ($cluster->infoAllNodes('memory') as $node => $info) {
+     *     echo "$node: {$info['used_memory']}\n";
+     * }
+     */
+    public function infoAllNodes(string ...$sections): ValkeyGlideCluster|array|false;
+
+    /**
+     * Compute the hash slot of a key locally, the way the server does, honouring `{hashtag}`s.
+     *
+     * @param string $key The key.
+     *
+     * @return int The slot, between 0 and 16383.
+     *
+     * @see https://valkey.io/commands/cluster-keyslot
+     *
+     * @example
+     * $valkey_glide->keySlot('{user:1}:profile') === $valkey_glide->keySlot('{user:1}:settings'); // true
+     */
+    public function keySlot(string $key): int;
+
     /**
      * @see ValkeyGlide::lindex
      */
@@ -772,11 +862,57 @@ class ValkeyGlideCluster
      */
     public function mget(array $keys): ValkeyGlideCluster|array|false;
 
+    /**
+     * Get many keys that may live in different slots in one round trip per node.
+     *
+     * Keys are grouped by hash slot and sent as one MGET per slot in a single non-atomic
+     * batch, which the client sends to every node concurrently. Values come back in the
+     * order of `$keys`. Cannot be used inside MULTI or PIPELINE.
+     *
+     * @param array $keys The keys to fetch.
+     *
+     * @return array|false The values, false for missing keys, or false on failure.
+     *
+     * @see ValkeyGlideCluster::mget()
+     *
+     * @example
+     * $values = $valkey_glide->mgetBySlot(['user:1', 'user:2', 'user:3']);
+     */
+    public function mgetBySlot(array $keys): array|false;
+
     /**
      * @see ValkeyGlide::mset
      */
     public function mset(array $key_values): ValkeyGlideCluster|bool;
 
+    /**
+     * Set many keys that may live in different slots in one round trip per node.
+     *
+     * Pairs are grouped by hash slot and sent as one MSET per slot in a single non-atomic
+     * batch. The write is not atomic across slots. Cannot be used inside MULTI or PIPELINE.
+     *
+     * @param array $key_values An associative array of keys and values.
+     *
+     * @return bool True if every slot group was set.
+     *
+     * @see ValkeyGlideCluster::mset()
+     */
+    public function msetBySlot(array $key_values): bool;
+
+    /**
+     * Delete many keys that may live in different slots in one round trip per node.
+     *
+     * Keys are grouped by hash slot and sent as one DEL per slot in a single non-atomic
+     * batch. Cannot be used inside MULTI or PIPELINE.
+     *
+     * @param array $keys The keys to delete.
+     *
+     * @return int|false The number of keys deleted, or false on failure.
+     *
+     * @see ValkeyGlideCluster::del()
+     */
+    public function delBySlot(array $keys): int|false;
+
     /**
      * @see ValkeyGlide::msetnx
      */
@@ -785,12 +921,19 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::multi
      */
-    public function multi(int $value = ValkeyGlide::MULTI): ValkeyGlideCluster|bool;
+    public function multi(int $value = ValkeyGlide::MULTI, array $options = []): ValkeyGlideCluster|bool;
 
     /**
      * @see ValkeyGlide::pipeline
      */
-    public function pipeline(): bool|ValkeyGlideCluster;
+    public function pipeline(int $flush_commands = 0, int $flush_bytes = 0, array $options = []): bool|ValkeyGlideCluster;
+
+    /**
+     * @see ValkeyGlide::poll
+     *
+     * Shard channel messages are returned with the type 'smessage'.
+     */
+    public function poll(int $max_messages = 1000, float $timeout = 0.0): array|false;
 
     /**
      * @see ValkeyGlide::object
@@ -852,12 +995,12 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::psetex
      */
-    public function psetex(string $key, int $timeout, string $value): ValkeyGlideCluster|bool;
+    public function psetex(string $key, int $timeout, mixed $value): ValkeyGlideCluster|bool;
 
     /**
      * @see ValkeyGlide::psubscribe
      */
-    /* TODO public function psubscribe(array $patterns, callable $callback): void; */
+    public function psubscribe(array $patterns, ?callable $cb = null): bool;
 
     /**
      * @see ValkeyGlide::pttl
@@ -867,7 +1010,7 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::publish
      */
-    /* TODO public function publish(string $channel, string $message): ValkeyGlideCluster|bool|int;*/
+    public function publish(string $channel, string $message): ValkeyGlideCluster|int|false;
 
     /**
      * @see ValkeyGlide::pubsub
@@ -877,7 +1020,7 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::punsubscribe
      */
-    /* TODO public function punsubscribe(string $pattern, string ...$other_patterns): bool|array;*/
+    public function punsubscribe(array $patterns = []): array|false;
 
     /**
      * @see ValkeyGlide::randomkey
@@ -889,6 +1032,13 @@ class ValkeyGlideCluster
      */
     public function rawcommand(mixed $route, string $command, mixed ...$args): mixed;
 
+    /**
+     * Keys are routed by the command's key arguments, like a batch without explicit routing.
+     *
+     * @see ValkeyGlide::sendAsync
+     */
+    public function sendAsync(string $command, mixed ...$args): ValkeyGlideFuture|false;
+
     /**
      * @see ValkeyGlide::rename
      */
@@ -899,6 +1049,11 @@ class ValkeyGlideCluster
      */
     public function renameNx(string $key, string $newkey): ValkeyGlideCluster|bool;
 
+    /**
+     * @see ValkeyGlide::resetStats
+     */
+    public function resetStats(): bool;
+
     /**
      * @see ValkeyGlide::restore
      */
@@ -929,6 +1084,33 @@ class ValkeyGlideCluster
      */
     public function scan(ClusterScanCursor $iterator, ?string $pattern = null, int $count = 0, ?string $type = null): bool|array;
 
+    /**
+     * Iterate over every key of the cluster with SCAN, one key at a time.
+     *
+     * The next page of keys is requested while the current one is being consumed, so
+     * iterating overlaps with the round trips. With `$parallel` greater than 1 every primary
+     * is scanned with its own cursor and up to `$parallel` pages are in flight at once.
+     * Parallel scans address the primaries found when the iterator is created, so keys
+     * moved by a resharding during the scan may be missed; the default single cursor
+     * follows slot migrations. The iterator is forward-only and may return a key more than
+     * once, like SCAN.
+     *
+     * @param string|null $pattern  Only return keys matching this glob-style pattern.
+     * @param int         $count    COUNT hint for each page, 0 for the server default.
+     * @param string|null $type     Only return keys of this type.
+     * @param int         $parallel How many pages may be requested concurrently.
+     *
+     * @return ClusterScanIterator|false The iterator, or false on failure.
+     *
+     * @see ValkeyGlideCluster::scan()
+     *
+     * @example
+     * foreach ($valkey_glide->scanIterator('user:*', 1000, null, 4) as $key) {
+     *     echo "$key\n";
+     * }
+     */
+    public function scanIterator(?string $pattern = null, int $count = 0, ?string $type = null, int $parallel = 1): ClusterScanIterator|false;
+
     /**
      * @see ValkeyGlide::scard
      */
@@ -1039,6 +1221,23 @@ class ValkeyGlideCluster
      */
     public function sscan(string $key, null|string &$iterator, ?string $pattern = null, int $count = 0): array|false;
 
+    /**
+     * Publish a message to a shard channel, on the node owning the channel's slot.
+     *
+     * @see https://valkey.io/commands/spublish
+     *
+     * @param string $channel The shard channel to publish to.
+     * @param string $message The message itself.
+     *
+     * @return ValkeyGlideCluster|int|false The number of clients that received the message.
+     */
+    public function spublish(string $channel, string $message): ValkeyGlideCluster|int|false;
+
+    /**
+     * @see ValkeyGlide::ssubscribe
+     */
+    public function ssubscribe(array $channels, ?callable $cb = null): bool;
+
     /**
      * @see ValkeyGlide::strlen
      */
@@ -1047,7 +1246,12 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::subscribe
      */
-   /* TODO  public function subscribe(array $channels, callable $cb): void; */
+    public function subscribe(array $channels, ?callable $cb = null): bool;
+
+    /**
+     * @see ValkeyGlide::sunsubscribe
+     */
+    public function sunsubscribe(array $channels = []): array|false;
 
     /**
      * @see ValkeyGlide::sunion()
@@ -1077,7 +1281,7 @@ class ValkeyGlideCluster
     /**
      * @see ValkeyGlide::unsubscribe
      */
-   /* TODO  public function unsubscribe(array $channels): bool|array;*/
+    public function unsubscribe(array $channels = []): array|false;
 
     /**
      * @see ValkeyGlide::unlink
@@ -1221,6 +1425,11 @@ class ValkeyGlideCluster
      */
     public function zRange(string $key, mixed $start, mixed $end, array|bool|null $options = null): ValkeyGlideCluster|array|bool;
 
+    /**
+     * @see ValkeyGlide::zRangeIterator
+     */
+    public function zRangeIterator(string $key, ?int &$iterator, int $count = 1000, bool $withscores = false): array|false;
+
     /**
      * @see ValkeyGlide::zrangestore
      */
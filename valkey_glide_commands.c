@@ -44,6 +44,7 @@ int execute_mset_command(zval* object, int argc, zval* return_value, zend_class_
         core_command_args_t args = {0};
         args.glide_client        = valkey_glide->glide_client;
         args.cmd_type            = MSet;
+        args.codec               = valkey_glide->codec;
 
         /* Set up array argument for key-value pairs */
         args.args[0].type                 = CORE_ARG_TYPE_ARRAY;
@@ -84,6 +85,7 @@ int execute_msetnx_command(zval* object, int argc, zval* return_value, zend_clas
         core_command_args_t args = {0};
         args.glide_client        = valkey_glide->glide_client;
         args.cmd_type            = MSetNX;
+        args.codec               = valkey_glide->codec;
 
         /* Set up array argument for key-value pairs */
         args.args[0].type                 = CORE_ARG_TYPE_ARRAY;
@@ -119,10 +121,6 @@ int execute_flushdb_command(zval* object, int argc, zval* return_value, zend_cla
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* FLUSHDB cannot be used in batch mode */
-        return 0;
-    }
 
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
@@ -195,10 +193,6 @@ int execute_flushall_command(zval* object, int argc, zval* return_value, zend_cl
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* FLUSHALL cannot be used in batch mode */
-        return 0;
-    }
 
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
@@ -270,10 +264,6 @@ int execute_time_command(zval* object, int argc, zval* return_value, zend_class_
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* TIME cannot be used in batch mode */
-        return 0;
-    }
 
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
@@ -418,7 +408,7 @@ static int process_object_command_result(CommandResponse* response,
         /* ENCODING returns a string */
         if (response->response_type == String) {
             /* Success, set return value */
-            ZVAL_STRINGL(return_value, response->string_value, response->string_value_len);
+            ZVAL_STR(return_value, command_response_to_zend_string(response));
             return 1;
         } else if (response->response_type == Null) {
             /* Key doesn't exist */
@@ -837,6 +827,14 @@ int execute_select_command(zval* object, int argc, zval* return_value, zend_clas
         return 0;
     }
 
+    /* A pooled client is shared, so its database is fixed by database_id */
+    if (valkey_glide->persistent) {
+        zend_throw_exception(get_exception_ce_for_client_type(ce == get_valkey_glide_cluster_ce()),
+                             "SELECT is not allowed on a persistent client, use database_id",
+                             0);
+        return 0;
+    }
+
     /* Execute the SELECT command using the Glide client */
     if (execute_select_command_internal(valkey_glide, dbindex, return_value)) {
         return 1;
@@ -18,6 +18,7 @@
 #include "php.h"
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_core_common.h"
+#include "valkey_glide_serializer.h"
 
 #if PHP_VERSION_ID < 80400
 #include <ext/standard/php_random.h>
@@ -151,14 +152,17 @@ int execute_getdel_command(zval* object, int argc, zval* return_value, zend_clas
     args.key_len             = key_len;
 
 
-    int result =
-        execute_core_command(valkey_glide, &args, NULL, process_core_string_result, return_value);
+    int result = execute_core_command(valkey_glide,
+                                      &args,
+                                      valkey_glide_codec_context_new(valkey_glide->codec),
+                                      process_core_value_result,
+                                      return_value);
 
     /* Process the result */
     if (result == 1) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
-            /* Note: output will be freed later in process_core_string_result */
+            /* Note: context will be freed later in process_core_value_result */
             ZVAL_COPY(return_value, object);
             return 1;
         }
@@ -205,14 +209,17 @@ int execute_getex_command(zval* object, int argc, zval* return_value, zend_class
     }
 
 
-    int result =
-        execute_core_command(valkey_glide, &args, NULL, process_core_string_result, return_value);
+    int result = execute_core_command(valkey_glide,
+                                      &args,
+                                      valkey_glide_codec_context_new(valkey_glide->codec),
+                                      process_core_value_result,
+                                      return_value);
 
     /* Process the result */
     if (result == 1) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
-            /* Note: output will be freed later in process_core_string_result */
+            /* Note: context will be freed later in process_core_value_result */
             ZVAL_COPY(return_value, object);
             return 1;
         }
@@ -536,7 +543,11 @@ int execute_mget_command(zval* object, int argc, zval* return_value, zend_class_
     args.args[0].data.array_arg.count = zend_hash_num_elements(Z_ARRVAL_P(z_array));
     args.arg_count                    = 1;
 
-    if (execute_core_command(valkey_glide, &args, NULL, process_core_array_result, return_value)) {
+    if (execute_core_command(valkey_glide,
+                             &args,
+                             valkey_glide_codec_context_new(valkey_glide->codec),
+                             process_core_values_result,
+                             return_value)) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
             ZVAL_COPY(return_value, object);
@@ -19,16 +19,27 @@
 
 #include "command_response.h"
 #include "ext/standard/php_var.h"
+#include "include/glide/command_request.pb-c.h"
 #include "include/glide_bindings.h"
+#include "logger.h"
+#include "valkey_glide_batch_iterator.h"
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_core_common.h"
 #include "valkey_glide_hash_common.h"
+#include "valkey_glide_info.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_numeric.h"
+#include "valkey_glide_pool.h"
+#include "valkey_glide_stats.h"
 #include "valkey_glide_z_common.h"
+#include "zend_exceptions.h"
 
 /* Helper functions for batch state management */
 static void clear_batch_state(valkey_glide_object* valkey_glide);
 
-static void expand_command_buffer(valkey_glide_object* valkey_glide);
+static void expand_command_buffer(valkey_glide_batch_buffer_t* buffer);
+
+static void flush_pipeline(valkey_glide_object* valkey_glide);
 
 /* Helper function to process array arguments for FCALL commands */
 static void process_array_to_args(zval*          array,
@@ -107,64 +118,148 @@ static void clear_batch_state(valkey_glide_object* valkey_glide) {
         return;
     }
 
+    valkey_glide_batch_buffer_free(&valkey_glide->batch);
 
-    if (valkey_glide->buffered_commands) {
-        /* Free each buffered command */
-        size_t i, j;
-        for (i = 0; i < valkey_glide->command_count; i++) {
-            struct batch_command* cmd = &valkey_glide->buffered_commands[i];
+    /* The next batch sends every script with EVAL again */
+    if (valkey_glide->scripts) {
+        zend_hash_clean(valkey_glide->scripts);
+    }
 
-            /* Free argument arrays */
-            if (cmd->args) {
-                for (j = 0; j < cmd->arg_count; j++) {
-                    if (cmd->args[j]) {
-                        efree(cmd->args[j]);
-                    }
-                }
-                efree(cmd->args);
-            }
+    if (!Z_ISUNDEF(valkey_glide->flushed_results)) {
+        zval_ptr_dtor(&valkey_glide->flushed_results);
+        ZVAL_UNDEF(&valkey_glide->flushed_results);
+    }
 
-            if (cmd->arg_lengths) {
-                efree(cmd->arg_lengths);
-            }
-        }
+    valkey_glide->is_in_batch_mode   = false;
+    valkey_glide->batch_type         = MULTI;
+    valkey_glide->flush_max_commands = 0;
+    valkey_glide->flush_max_bytes    = 0;
+}
+
+/* Free all storage owned by a batch buffer */
+void valkey_glide_batch_buffer_free(valkey_glide_batch_buffer_t* buffer) {
+    valkey_glide_batch_slab_t* slab = &buffer->slab;
 
-        efree(valkey_glide->buffered_commands);
-        valkey_glide->buffered_commands = NULL;
-        valkey_glide->command_capacity  = 0;
+    if (slab->data) {
+        efree(slab->data);
+    }
+    if (slab->args) {
+        efree(slab->args);
+    }
+    if (slab->arg_lengths) {
+        efree(slab->arg_lengths);
     }
 
-    valkey_glide->is_in_batch_mode = false;
-    valkey_glide->batch_type       = MULTI;
-    valkey_glide->command_count    = 0;
+    if (buffer->commands) {
+        efree(buffer->commands);
+        efree(buffer->cmd_infos);
+        efree(buffer->cmd_info_ptrs);
+    }
+
+    memset(buffer, 0, sizeof(*buffer));
 }
 
-/* Expand command buffer capacity */
-static void expand_command_buffer(valkey_glide_object* valkey_glide) {
-    if (!valkey_glide) {
-        return;
-    }
+/* Forget the buffered commands but keep the storage for the next sub-batch */
+void valkey_glide_batch_buffer_reset(valkey_glide_batch_buffer_t* buffer) {
+    buffer->command_count  = 0;
+    buffer->slab.data_len  = 0;
+    buffer->slab.arg_count = 0;
+    buffer->frozen         = false;
+    buffer->routed_count   = 0;
+}
 
-    size_t new_capacity = valkey_glide->command_capacity * 2;
+/* Expand command buffer capacity */
+static void expand_command_buffer(valkey_glide_batch_buffer_t* buffer) {
+    size_t new_capacity = buffer->command_capacity * 2;
     if (new_capacity == 0) {
         new_capacity = 16;
     }
 
-    struct batch_command* new_buffer = (struct batch_command*) erealloc(
-        valkey_glide->buffered_commands, new_capacity * sizeof(struct batch_command));
+    /* The FFI CmdInfo array grows with the command buffer so exec() never allocates */
+    buffer->commands = (struct batch_command*) erealloc(
+        buffer->commands, new_capacity * sizeof(struct batch_command));
+    buffer->cmd_infos =
+        (struct CmdInfo*) erealloc(buffer->cmd_infos, new_capacity * sizeof(struct CmdInfo));
+    buffer->cmd_info_ptrs = (const struct CmdInfo**) erealloc(
+        buffer->cmd_info_ptrs, new_capacity * sizeof(struct CmdInfo*));
+    buffer->command_capacity = new_capacity;
+}
 
-    if (new_buffer) {
-        valkey_glide->buffered_commands = new_buffer;
-        valkey_glide->command_capacity  = new_capacity;
+/* Make room for `count` more arguments carrying `payload` bytes in the batch slab */
+static void reserve_batch_slab(valkey_glide_batch_slab_t* slab, size_t count, size_t payload) {
+    if (!slab->data || slab->data_capacity - slab->data_len < payload) {
+        size_t new_capacity = slab->data_capacity ? slab->data_capacity * 2 : 4096;
+        while (new_capacity - slab->data_len < payload) {
+            new_capacity *= 2;
+        }
+        slab->data          = (uint8_t*) erealloc(slab->data, new_capacity);
+        slab->data_capacity = new_capacity;
+    }
 
-        /* Initialize new slots */
-        size_t i;
-        for (i = valkey_glide->command_count; i < new_capacity; i++) {
-            memset(&valkey_glide->buffered_commands[i], 0, sizeof(struct batch_command));
+    if (slab->arg_capacity - slab->arg_count < count) {
+        size_t new_capacity = slab->arg_capacity ? slab->arg_capacity * 2 : 64;
+        while (new_capacity - slab->arg_count < count) {
+            new_capacity *= 2;
         }
+        slab->args = (uintptr_t*) erealloc(slab->args, new_capacity * sizeof(uintptr_t));
+        slab->arg_lengths =
+            (uintptr_t*) erealloc(slab->arg_lengths, new_capacity * sizeof(uintptr_t));
+        slab->arg_capacity = new_capacity;
     }
 }
 
+/* Copy a command and its arguments to the end of a batch buffer */
+void valkey_glide_batch_buffer_append(valkey_glide_batch_buffer_t* buffer,
+                                      enum RequestType             cmd_type,
+                                      const uintptr_t*             args,
+                                      const unsigned long*         arg_lengths,
+                                      uintptr_t                    arg_count,
+                                      void*                        result_ptr,
+                                      z_result_processor_t         process_result) {
+    valkey_glide_batch_slab_t* slab = &buffer->slab;
+
+    /* Expand buffer if needed */
+    if (buffer->command_count >= buffer->command_capacity) {
+        expand_command_buffer(buffer);
+    }
+
+    struct batch_command* cmd = &buffer->commands[buffer->command_count];
+
+    if (!args || !arg_lengths) {
+        arg_count = 0;
+    }
+
+    /* Store command details */
+    cmd->request_type   = cmd_type;
+    cmd->first_arg      = slab->arg_count;
+    cmd->arg_count      = arg_count;
+    cmd->route_offset   = 0;
+    cmd->route_len      = 0;
+    cmd->result_ptr     = result_ptr;
+    cmd->process_result = process_result;
+
+    /* Append the argument payloads to the slab, recording offsets since the slab may move */
+    size_t    payload = 0;
+    uintptr_t i;
+    for (i = 0; i < arg_count; i++) {
+        payload += args[i] ? arg_lengths[i] : 0;
+    }
+    reserve_batch_slab(slab, arg_count, payload);
+
+    for (i = 0; i < arg_count; i++) {
+        size_t len = args[i] ? arg_lengths[i] : 0;
+        if (len > 0) {
+            memcpy(slab->data + slab->data_len, (const void*) args[i], len);
+        }
+        slab->args[slab->arg_count]        = slab->data_len;
+        slab->arg_lengths[slab->arg_count] = len;
+        slab->data_len += len;
+        slab->arg_count++;
+    }
+
+    buffer->command_count++;
+}
+
 /* Buffer a command for batch execution */
 int buffer_command_for_batch(valkey_glide_object* valkey_glide,
                              enum RequestType     cmd_type,
@@ -173,57 +268,346 @@ int buffer_command_for_batch(valkey_glide_object* valkey_glide,
                              uintptr_t            arg_count,
                              void*                result_ptr,
                              z_result_processor_t process_result) {
+    return buffer_routed_command_for_batch(
+        valkey_glide, cmd_type, args, arg_lengths, arg_count, NULL, result_ptr, process_result);
+}
+
+/* Buffer a command for batch execution, sent to `route` when it is not NULL */
+int buffer_routed_command_for_batch(valkey_glide_object* valkey_glide,
+                                    enum RequestType     cmd_type,
+                                    const uintptr_t*     args,
+                                    const unsigned long* arg_lengths,
+                                    uintptr_t            arg_count,
+                                    zval*                route,
+                                    void*                result_ptr,
+                                    z_result_processor_t process_result) {
     if (!valkey_glide || !valkey_glide->is_in_batch_mode) {
         return 0;
     }
 
-    /* Expand buffer if needed */
-    if (valkey_glide->command_count >= valkey_glide->command_capacity) {
-        expand_command_buffer(valkey_glide);
-        if (valkey_glide->command_count >= valkey_glide->command_capacity) {
-            return 0; /* Failed to expand */
+    valkey_glide_batch_buffer_t* buffer      = &valkey_glide->batch;
+    uint8_t*                     route_bytes = NULL;
+    size_t                       route_len   = 0;
+
+    /* A transaction runs on the node owning its keys, so only pipelines keep their routes */
+    if (route && valkey_glide->batch_type == PIPELINE) {
+        route_bytes = pack_cluster_route(route, &route_len);
+        if (!route_bytes) {
+            return 0;
         }
     }
 
-    struct batch_command* cmd = &valkey_glide->buffered_commands[valkey_glide->command_count];
+    valkey_glide_batch_buffer_append(
+        buffer, cmd_type, args, arg_lengths, arg_count, result_ptr, process_result);
 
-    /* Store command details */
-    cmd->request_type   = cmd_type;
-    cmd->arg_count      = arg_count;
-    cmd->result_ptr     = result_ptr;
-    cmd->process_result = process_result;
+    /* The route is serialized once and kept in the slab next to the arguments */
+    if (route_bytes) {
+        valkey_glide_batch_slab_t* slab = &buffer->slab;
+        struct batch_command*      cmd  = &buffer->commands[buffer->command_count - 1];
 
+        reserve_batch_slab(slab, 0, route_len);
+        memcpy(slab->data + slab->data_len, route_bytes, route_len);
+        cmd->route_offset = slab->data_len;
+        cmd->route_len    = route_len;
+        slab->data_len += route_len;
+        buffer->routed_count++;
+        efree(route_bytes);
+    }
 
-    /* Copy arguments */
-    if (arg_count > 0 && args && arg_lengths) {
-        cmd->args        = (uint8_t**) emalloc(arg_count * sizeof(uint8_t*));
-        cmd->arg_lengths = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-
-        uintptr_t i;
-        for (i = 0; i < arg_count; i++) {
-            if (args[i] && arg_lengths[i] > 0) {
-                cmd->args[i] = (uint8_t*) emalloc(arg_lengths[i] + 1);
-                if (cmd->args[i]) {
-                    memcpy(cmd->args[i], ((uint8_t**) args)[i], arg_lengths[i]);
-                    cmd->args[i][arg_lengths[i]] = '\0';
-                    cmd->arg_lengths[i]          = arg_lengths[i];
-                } else {
-                    cmd->arg_lengths[i] = 0;
-                }
-            } else {
-                cmd->args[i]        = NULL;
-                cmd->arg_lengths[i] = 0;
+    /* Pipelines with a threshold send what they have so far instead of growing unbounded */
+    if (valkey_glide->batch_type == PIPELINE &&
+        ((valkey_glide->flush_max_commands &&
+          buffer->command_count >= valkey_glide->flush_max_commands) ||
+         (valkey_glide->flush_max_bytes &&
+          buffer->slab.data_len >= valkey_glide->flush_max_bytes))) {
+        flush_pipeline(valkey_glide);
+    }
+
+    return 1;
+}
+
+/*
+ * Send buffered commands [start, start + count) as one FFI batch and append their replies.
+ * A route_info sends the whole batch to that node, still under the batch options.
+ */
+static int send_batch_range(const void*                  glide_client,
+                            valkey_glide_batch_buffer_t* buffer,
+                            size_t                       start,
+                            size_t                       count,
+                            bool                         is_atomic,
+                            struct RouteInfo*            route_info,
+                            zval*                        results) {
+    valkey_glide_batch_slab_t* slab    = &buffer->slab;
+    struct BatchOptionsInfo*   options = buffer->has_options ? &buffer->options : NULL;
+    struct BatchOptionsInfo    routed_options;
+    size_t                     i;
+
+    if (route_info) {
+        if (options) {
+            routed_options = *options;
+        } else {
+            memset(&routed_options, 0, sizeof(routed_options));
+        }
+        routed_options.route_info = route_info;
+        options                   = &routed_options;
+    }
+
+    for (i = 0; i < count; i++) {
+        struct batch_command* buffered = &buffer->commands[start + i];
+        struct CmdInfo*       cmd_info = &buffer->cmd_infos[start + i];
+
+        cmd_info->request_type = buffered->request_type;
+        cmd_info->args         = (const uint8_t* const*) (slab->args + buffered->first_arg);
+        cmd_info->arg_count    = buffered->arg_count;
+        cmd_info->args_len     = (const uintptr_t*) (slab->arg_lengths + buffered->first_arg);
+
+        buffer->cmd_info_ptrs[i] = cmd_info;
+    }
+
+    /* Create BatchInfo structure */
+    struct BatchInfo batch_info = {
+        .cmd_count = count,
+        .cmds      = (const struct CmdInfo* const*) buffer->cmd_info_ptrs,
+        .is_atomic = is_atomic};
+
+    uint64_t bytes_sent = 0;
+    for (i = 0; i < count; i++) {
+        struct batch_command* buffered = &buffer->commands[start + i];
+        for (uintptr_t arg = 0; arg < buffered->arg_count; arg++) {
+            bytes_sent += slab->arg_lengths[buffered->first_arg + arg];
+        }
+    }
+    uint64_t start_ns = valkey_glide_stats_now();
+
+    /* Execute via FFI batch() function */
+    struct CommandResult* result = batch(glide_client,
+                                         0, /* callback_index (not used for sync) */
+                                         &batch_info,
+                                         false, /* raise_on_error */
+                                         options,
+                                         0 /* span_ptr */
+    );
+
+    valkey_glide_stats_record_batch(glide_client, start_ns, count, bytes_sent, result);
+    for (i = 0; i < count; i++) {
+        const struct CmdInfo* cmd_info = buffer->cmd_info_ptrs[i];
+
+        valkey_glide_near_cache_invalidate_args(glide_client,
+                                                cmd_info->request_type,
+                                                (const uintptr_t*) cmd_info->args,
+                                                (const unsigned long*) cmd_info->args_len,
+                                                cmd_info->arg_count);
+    }
+
+    int status = 0;
+    if (result && !result->command_error && result->response &&
+        result->response->response_type == Array &&
+        (size_t) result->response->array_value_len == count) {
+        for (i = 0; i < count; i++) {
+            struct batch_command* buffered = &buffer->commands[start + i];
+            zval                  value;
+
+            if (!buffered->process_result(
+                    &result->response->array_value[i], buffered->result_ptr, &value)) {
+                /* Process_result failed */
+                ZVAL_FALSE(&value);
             }
+            add_next_index_zval(results, &value);
         }
+        status = 1;
+    }
+
+    free_command_result(result);
+    return status;
+}
+
+/* Send one command that carries its own route and append its reply */
+static void send_routed_command(const void*                  glide_client,
+                                valkey_glide_batch_buffer_t* buffer,
+                                struct batch_command*        buffered,
+                                zval*                        results) {
+    valkey_glide_batch_slab_t* slab = &buffer->slab;
+    zval                       value;
+
+    CommandResult* result =
+        execute_command_with_route_bytes(glide_client,
+                                         buffered->request_type,
+                                         buffered->arg_count,
+                                         slab->args + buffered->first_arg,
+                                         (const unsigned long*) (slab->arg_lengths +
+                                                                 buffered->first_arg),
+                                         slab->data + buffered->route_offset,
+                                         buffered->route_len);
+
+    ZVAL_FALSE(&value);
+    if (result && !result->command_error && result->response &&
+        !buffered->process_result(result->response, buffered->result_ptr, &value)) {
+        ZVAL_FALSE(&value);
+    }
+    add_next_index_zval(results, &value);
+
+    free_command_result(result);
+}
+
+/*
+ * Describe a serialized route as a batch route. Only single-node routes can carry a batch;
+ * returns false for the others.
+ */
+static bool route_info_from_routes(const CommandRequest__Routes* routes, struct RouteInfo* info) {
+    memset(info, 0, sizeof(*info));
+
+    switch (routes->value_case) {
+        case COMMAND_REQUEST__ROUTES__VALUE_SIMPLE_ROUTES:
+            info->route_type = Random;
+            return routes->simple_routes == COMMAND_REQUEST__SIMPLE_ROUTES__Random;
+        case COMMAND_REQUEST__ROUTES__VALUE_SLOT_KEY_ROUTE:
+            info->route_type = SlotKey;
+            info->slot_key   = routes->slot_key_route->slot_key;
+            info->slot_type  = Primary;
+            if (routes->slot_key_route->slot_type == COMMAND_REQUEST__SLOT_TYPES__Replica) {
+                info->slot_type = Replica;
+            }
+            return true;
+        case COMMAND_REQUEST__ROUTES__VALUE_SLOT_ID_ROUTE:
+            info->route_type = SlotId;
+            info->slot_id    = routes->slot_id_route->slot_id;
+            info->slot_type  = Primary;
+            if (routes->slot_id_route->slot_type == COMMAND_REQUEST__SLOT_TYPES__Replica) {
+                info->slot_type = Replica;
+            }
+            return true;
+        case COMMAND_REQUEST__ROUTES__VALUE_BY_ADDRESS_ROUTE:
+            info->route_type = ByAddress;
+            info->hostname   = routes->by_address_route->host;
+            info->port       = routes->by_address_route->port;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Send commands [start, start + count), which share one route, and append their replies */
+static int send_routed_run(const void*                  glide_client,
+                           valkey_glide_batch_buffer_t* buffer,
+                           size_t                       start,
+                           size_t                       count,
+                           zval*                        results) {
+    struct batch_command*   first = &buffer->commands[start];
+    CommandRequest__Routes* routes;
+    struct RouteInfo        route_info;
+    int                     status = 1;
+
+    routes = command_request__routes__unpack(
+        NULL, first->route_len, buffer->slab.data + first->route_offset);
+
+    if (routes && route_info_from_routes(routes, &route_info)) {
+        status = send_batch_range(glide_client, buffer, start, count, false, &route_info, results);
     } else {
-        cmd->args        = NULL;
-        cmd->arg_lengths = NULL;
+        /* Multi-node routes fan each command out on their own */
+        for (size_t i = start; i < start + count; i++) {
+            send_routed_command(glide_client, buffer, &buffer->commands[i], results);
+        }
+    }
+
+    if (routes) {
+        command_request__routes__free_unpacked(routes, NULL);
+    }
+    return status;
+}
+
+/* Whether two buffered commands go to the same route, or both to none */
+static bool same_batch_route(valkey_glide_batch_slab_t*  slab,
+                             const struct batch_command* a,
+                             const struct batch_command* b) {
+    return a->route_len == b->route_len &&
+           (a->route_len == 0 ||
+            memcmp(slab->data + a->route_offset, slab->data + b->route_offset, a->route_len) == 0);
+}
+
+/*
+ * Send buffered commands [start, start + count) and append their replies in queued order.
+ * The core splits a pipeline by slot owner and runs the parts concurrently. Consecutive
+ * commands with the same route are sent as one batch to that route.
+ */
+int valkey_glide_batch_buffer_send(const void*                  glide_client,
+                                   valkey_glide_batch_buffer_t* buffer,
+                                   size_t                       start,
+                                   size_t                       count,
+                                   bool                         is_atomic,
+                                   zval*                        results) {
+    valkey_glide_batch_slab_t* slab = &buffer->slab;
+    size_t                     end  = start + count;
+    size_t                     run_start, run_end, i;
+
+    /* Once nothing more is appended the slab cannot move, so offsets can become pointers */
+    if (!buffer->frozen) {
+        for (i = 0; i < slab->arg_count; i++) {
+            slab->args[i] += (uintptr_t) slab->data;
+        }
+        buffer->frozen = true;
+    }
+
+    if (is_atomic || buffer->routed_count == 0) {
+        return send_batch_range(glide_client, buffer, start, count, is_atomic, NULL, results);
+    }
+
+    /* A failed run only fails its own replies, as a failed command does in a pipeline */
+    for (run_start = start; run_start < end; run_start = run_end) {
+        struct batch_command* first = &buffer->commands[run_start];
+        int                   status;
+
+        run_end = run_start + 1;
+        while (run_end < end && same_batch_route(slab, first, &buffer->commands[run_end])) {
+            run_end++;
+        }
+
+        if (first->route_len) {
+            status = send_routed_run(glide_client, buffer, run_start, run_end - run_start, results);
+        } else {
+            status = send_batch_range(
+                glide_client, buffer, run_start, run_end - run_start, false, NULL, results);
+        }
+        if (!status) {
+            for (i = run_start; i < run_end; i++) {
+                add_next_index_bool(results, 0);
+            }
+        }
     }
 
-    valkey_glide->command_count++;
     return 1;
 }
 
+/* Send everything buffered so far and keep the replies until exec() */
+static void flush_pipeline(valkey_glide_object* valkey_glide) {
+    valkey_glide_batch_buffer_t* buffer = &valkey_glide->batch;
+
+    VALKEY_LOG_DEBUG_FMT(
+        "batch_execution", "Auto-flushing %zu pipelined commands", buffer->command_count);
+
+    if (Z_ISUNDEF(valkey_glide->flushed_results)) {
+        array_init(&valkey_glide->flushed_results);
+    }
+
+    if (!valkey_glide_batch_buffer_send(valkey_glide->glide_client,
+                                        buffer,
+                                        0,
+                                        buffer->command_count,
+                                        false,
+                                        &valkey_glide->flushed_results)) {
+        /* Keep reply positions aligned with the commands that were queued */
+        for (size_t i = 0; i < buffer->command_count; i++) {
+            add_next_index_bool(&valkey_glide->flushed_results, 0);
+        }
+    }
+
+    valkey_glide_batch_buffer_reset(buffer);
+
+    /* Those replies are in, later sub-batches do not count on what the server cached */
+    if (valkey_glide->scripts) {
+        zend_hash_clean(valkey_glide->scripts);
+    }
+}
+
 
 /* Helper function to process array arguments for FCALL commands */
 static void process_array_to_args(zval*          array,
@@ -366,104 +750,6 @@ static void cleanup_allocated_strings(char** allocated_strings, int allocated_co
 }
 
 
-/* Helper function to parse CLIENT LIST response into array of associative arrays */
-static int parse_client_list_response(const char* response_str,
-                                      size_t      response_len,
-                                      zval*       return_value) {
-    if (!response_str || response_len == 0) {
-        array_init(return_value);
-        return 1;
-    }
-
-    array_init(return_value);
-
-    /* Split response by newlines to get individual client entries */
-    const char* line_start   = response_str;
-    const char* line_end     = response_str;
-    const char* response_end = response_str + response_len;
-
-    while (line_start < response_end) {
-        /* Find end of current line */
-        while (line_end < response_end && *line_end != '\n' && *line_end != '\r') {
-            line_end++;
-        }
-
-        /* Skip empty lines */
-        if (line_end > line_start) {
-            size_t line_length = line_end - line_start;
-
-            /* Create associative array for this client */
-            zval client_array;
-            array_init(&client_array);
-
-            /* Parse key=value pairs in this line */
-            const char* token_start = line_start;
-            const char* token_end   = line_start;
-
-            while (token_start < line_start + line_length) {
-                /* Find end of current token (space-separated) */
-                while (token_end < line_start + line_length && *token_end != ' ') {
-                    token_end++;
-                }
-
-                if (token_end > token_start) {
-                    /* Look for '=' in token to split key and value */
-                    const char* equals_pos = token_start;
-                    while (equals_pos < token_end && *equals_pos != '=') {
-                        equals_pos++;
-                    }
-
-                    if (equals_pos < token_end && *equals_pos == '=') {
-                        /* Extract key and value */
-                        size_t key_len   = equals_pos - token_start;
-                        size_t value_len = token_end - equals_pos - 1;
-
-                        if (key_len > 0) {
-                            /* Create null-terminated key string */
-                            char* key = emalloc(key_len + 1);
-                            memcpy(key, token_start, key_len);
-                            key[key_len] = '\0';
-
-                            /* Create null-terminated value string */
-                            char* value = emalloc(value_len + 1);
-                            if (value_len > 0) {
-                                memcpy(value, equals_pos + 1, value_len);
-                            }
-                            value[value_len] = '\0';
-
-                            /* Add to client array */
-                            add_assoc_string(&client_array, key, value);
-
-                            /* Free temporary strings */
-                            efree(key);
-                            efree(value);
-                        }
-                    }
-                }
-
-                /* Move to next token */
-                token_start = token_end;
-                /* Skip spaces */
-                while (token_start < line_start + line_length && *token_start == ' ') {
-                    token_start++;
-                }
-                token_end = token_start;
-            }
-
-            /* Add client array to main result array */
-            add_next_index_zval(return_value, &client_array);
-        }
-
-        /* Move to next line */
-        while (line_end < response_end && (*line_end == '\n' || *line_end == '\r')) {
-            line_end++;
-        }
-        line_start = line_end;
-    }
-
-    return 1;
-}
-
 /* Wrapper function to match z_result_processor_t signature */
 static int command_response_to_zval_wrapper(CommandResponse* response,
                                             void*            output,
@@ -471,8 +757,9 @@ static int command_response_to_zval_wrapper(CommandResponse* response,
     enum RequestType command_type = *((enum RequestType*) output);
     efree(output);
     if (command_type == ClientList && response->response_type == String) {
-        return parse_client_list_response(
+        valkey_glide_parse_client_list(
             response->string_value, response->string_value_len, return_value);
+        return 1;
     } else {
         return command_response_to_zval(
             response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
@@ -545,26 +832,11 @@ int execute_function_command(zval* object, int argc, zval* return_value, zend_cl
 
         /* Check if we're in batch mode */
         if (valkey_glide->is_in_batch_mode) {
-            /* Convert arguments to uint8_t** format for batch processing */
-            uintptr_t*     batch_args  = NULL;
-            unsigned long* arg_lengths = NULL;
-
-            if (final_arg_count > 0) {
-                batch_args  = (uintptr_t*) emalloc(final_arg_count * sizeof(uintptr_t*));
-                arg_lengths = (uintptr_t*) emalloc(final_arg_count * sizeof(unsigned long));
-
-                /* Copy arguments to batch format */
-                for (unsigned long i = 0; i < final_arg_count; i++) {
-                    batch_args[i]  = cmd_args[i];
-                    arg_lengths[i] = args_len[i];
-                }
-            }
-
-            /* Buffer the command for batch execution */
+            /* Buffer the command for batch execution; the batch slab copies the arguments */
             int buffer_result = buffer_command_for_batch(valkey_glide,
                                                          function_command_type,
-                                                         batch_args,
-                                                         arg_lengths,
+                                                         cmd_args,
+                                                         args_len,
                                                          final_arg_count,
                                                          NULL,
                                                          process_function_command_reposonse);
@@ -575,10 +847,6 @@ int execute_function_command(zval* object, int argc, zval* return_value, zend_cl
                 efree(cmd_args);
             if (args_len)
                 efree(args_len);
-            if (batch_args)
-                efree(batch_args);
-            if (arg_lengths)
-                efree(arg_lengths);
 
             if (buffer_result) {
                 /* In batch mode, return $this for method chaining */
@@ -625,6 +893,50 @@ int execute_function_command(zval* object, int argc, zval* return_value, zend_cl
     return 0;
 }
 
+/*
+ * Read the options array of multi()/pipeline(): 'timeout' in milliseconds and the
+ * 'retry_server_error'/'retry_connection_error' flags, which only cluster pipelines accept.
+ */
+static int parse_batch_options(zval*                    z_options,
+                               zend_bool                is_cluster,
+                               int                      batch_type,
+                               struct BatchOptionsInfo* options) {
+    HashTable* ht = Z_ARRVAL_P(z_options);
+    zval*      z_value;
+
+    memset(options, 0, sizeof(*options));
+
+    if ((z_value = zend_hash_str_find(ht, "timeout", sizeof("timeout") - 1)) != NULL) {
+        zend_long timeout = zval_get_long(z_value);
+        if (timeout < 0 || (zend_ulong) timeout > UINT32_MAX) {
+            php_error_docref(NULL, E_WARNING, "Batch timeout must be between 0 and %u", UINT32_MAX);
+            return 0;
+        }
+        options->has_timeout = true;
+        options->timeout     = (uint32_t) timeout;
+    }
+
+    if ((z_value = zend_hash_str_find(
+             ht, "retry_server_error", sizeof("retry_server_error") - 1)) != NULL) {
+        options->retry_server_error = zend_is_true(z_value);
+    }
+    if ((z_value = zend_hash_str_find(
+             ht, "retry_connection_error", sizeof("retry_connection_error") - 1)) != NULL) {
+        options->retry_connection_error = zend_is_true(z_value);
+    }
+
+    /* Retrying could run a command twice, which a transaction must never do */
+    if ((options->retry_server_error || options->retry_connection_error) &&
+        (!is_cluster || batch_type != PIPELINE)) {
+        php_error_docref(
+            NULL, E_WARNING, "Batch retry strategies are only supported by cluster pipelines");
+        return 0;
+    }
+
+    options->route_info = NULL;
+    return 1;
+}
+
 /* Common function to initialize batch mode */
 static int initialize_batch_mode(valkey_glide_object* valkey_glide,
                                  int                  batch_type,
@@ -641,13 +953,11 @@ static int initialize_batch_mode(valkey_glide_object* valkey_glide,
     /* Initialize batch mode */
     valkey_glide->is_in_batch_mode = true;
     valkey_glide->batch_type       = batch_type;
-    valkey_glide->command_count    = 0;
+    valkey_glide_batch_buffer_reset(&valkey_glide->batch);
 
     /* Initialize buffer if needed */
-    if (!valkey_glide->buffered_commands) {
-        valkey_glide->command_capacity  = 16; /* Initial capacity */
-        valkey_glide->buffered_commands = (struct batch_command*) ecalloc(
-            valkey_glide->command_capacity, sizeof(struct batch_command));
+    if (!valkey_glide->batch.commands) {
+        expand_command_buffer(&valkey_glide->batch);
     }
 
     /* Return $this for method chaining */
@@ -657,11 +967,14 @@ static int initialize_batch_mode(valkey_glide_object* valkey_glide,
 
 /* Execute a MULTI command using the Valkey Glide client - UPDATED FOR BUFFERING */
 int execute_multi_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
-    valkey_glide_object* valkey_glide;
-    long                 batch_type = MULTI; /* Default to MULTI */
+    valkey_glide_object*    valkey_glide;
+    long                    batch_type = MULTI; /* Default to MULTI */
+    zval*                   z_options  = NULL;
+    struct BatchOptionsInfo options;
 
-    /* Parse optional batch type parameter */
-    if (zend_parse_method_parameters(argc, object, "O|l", &object, ce, &batch_type) == FAILURE) {
+    /* Parse optional batch type and options parameters */
+    if (zend_parse_method_parameters(
+            argc, object, "O|la", &object, ce, &batch_type, &z_options) == FAILURE) {
         return 0;
     }
 
@@ -671,24 +984,74 @@ int execute_multi_command(zval* object, int argc, zval* return_value, zend_class
         return 0;
     }
 
+    if (z_options && !parse_batch_options(z_options,
+                                          ce == get_valkey_glide_cluster_ce(),
+                                          (int) batch_type,
+                                          &options)) {
+        return 0;
+    }
+
     /* Get ValkeyGlide object */
     valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
 
-    return initialize_batch_mode(valkey_glide, (int) batch_type, object, return_value);
+    if (!initialize_batch_mode(valkey_glide, (int) batch_type, object, return_value)) {
+        return 0;
+    }
+
+    if (z_options) {
+        valkey_glide->batch.options     = options;
+        valkey_glide->batch.has_options = true;
+    }
+    return 1;
 }
 
 /* Execute a PIPELINE command using the Valkey Glide client - wrapper using common function */
 int execute_pipeline_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
-    valkey_glide_object* valkey_glide;
-    /* Parse parameters - pipeline takes no additional parameters */
-    if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
+    valkey_glide_object*    valkey_glide;
+    zend_long               flush_commands = 0;
+    zend_long               flush_bytes    = 0;
+    zval*                   z_options      = NULL;
+    struct BatchOptionsInfo options;
+
+    /* Parse parameters - optional auto-flush thresholds (0 disables each) and options */
+    if (zend_parse_method_parameters(argc,
+                                     object,
+                                     "O|lla",
+                                     &object,
+                                     ce,
+                                     &flush_commands,
+                                     &flush_bytes,
+                                     &z_options) == FAILURE) {
+        return 0;
+    }
+
+    if (flush_commands < 0 || flush_bytes < 0) {
+        php_error_docref(NULL, E_WARNING, "Pipeline flush thresholds must not be negative");
+        return 0;
+    }
+
+    if (z_options &&
+        !parse_batch_options(z_options, ce == get_valkey_glide_cluster_ce(), PIPELINE, &options)) {
         return 0;
     }
 
     /* Get ValkeyGlide object */
     valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
 
-    return initialize_batch_mode(valkey_glide, PIPELINE, object, return_value);
+    if (!initialize_batch_mode(valkey_glide, PIPELINE, object, return_value)) {
+        return 0;
+    }
+
+    /* Only a pipeline can be split; a transaction must reach the server whole */
+    if (valkey_glide->batch_type == PIPELINE) {
+        valkey_glide->flush_max_commands = (size_t) flush_commands;
+        valkey_glide->flush_max_bytes    = (size_t) flush_bytes;
+        if (z_options) {
+            valkey_glide->batch.options     = options;
+            valkey_glide->batch.has_options = true;
+        }
+    }
+    return 1;
 }
 
 /* Execute a DISCARD command using the Valkey Glide client - UPDATED FOR BUFFERING */
@@ -734,115 +1097,93 @@ int execute_exec_command(zval* object, int argc, zval* return_value, zend_class_
         return 0;
     }
 
-    /* Check if we're in batch mode and have buffered commands */
-    if (!valkey_glide->is_in_batch_mode || valkey_glide->command_count == 0) {
-        ZVAL_FALSE(return_value);
-        return 0;
-    }
+    valkey_glide_batch_buffer_t* buffer = &valkey_glide->batch;
+    bool has_flushed = !Z_ISUNDEF(valkey_glide->flushed_results);
 
-    /* Convert buffered commands to FFI BatchInfo structure */
-    struct CmdInfo** cmd_infos =
-        (struct CmdInfo**) emalloc(valkey_glide->command_count * sizeof(struct CmdInfo*));
-    if (!cmd_infos) {
-        clear_batch_state(valkey_glide);
+    /* Check if we're in batch mode and have buffered commands */
+    if (!valkey_glide->is_in_batch_mode || (buffer->command_count == 0 && !has_flushed)) {
         ZVAL_FALSE(return_value);
         return 0;
     }
 
-    /* Create CmdInfo structures for each buffered command */
-    size_t i;
-    for (i = 0; i < valkey_glide->command_count; i++) {
-        struct batch_command* buffered = &valkey_glide->buffered_commands[i];
-        struct CmdInfo*       cmd_info = (struct CmdInfo*) emalloc(sizeof(struct CmdInfo));
-
-        if (!cmd_info) {
-            /* Cleanup on error */
-            for (size_t j = 0; j < i; j++) {
-                efree(cmd_infos[j]);
-            }
-            efree(cmd_infos);
-            clear_batch_state(valkey_glide);
+    int status = 1;
+    if (!has_flushed) {
+        array_init(return_value);
+        if (!valkey_glide_batch_buffer_send(valkey_glide->glide_client,
+                                            buffer,
+                                            0,
+                                            buffer->command_count,
+                                            valkey_glide->batch_type == MULTI,
+                                            return_value)) {
+            zval_ptr_dtor(return_value);
             ZVAL_FALSE(return_value);
-            return 0;
+            status = 0;
+        }
+    } else {
+        /* Earlier sub-batches already ran, so only the tail is left to send */
+        ZVAL_COPY_VALUE(return_value, &valkey_glide->flushed_results);
+        ZVAL_UNDEF(&valkey_glide->flushed_results);
+
+        if (buffer->command_count > 0 &&
+            !valkey_glide_batch_buffer_send(valkey_glide->glide_client,
+                                            buffer,
+                                            0,
+                                            buffer->command_count,
+                                            false,
+                                            return_value)) {
+            for (size_t i = 0; i < buffer->command_count; i++) {
+                add_next_index_bool(return_value, 0);
+            }
         }
+    }
 
-        cmd_info->request_type = buffered->request_type;
-        cmd_info->args         = (const uint8_t* const*) buffered->args;
-        cmd_info->arg_count    = buffered->arg_count;
-        cmd_info->args_len     = (const uintptr_t*) buffered->arg_lengths;
+    clear_batch_state(valkey_glide);
+    return status;
+}
+
+/* Execute an EXEC that hands the replies back through a ValkeyGlideBatchIterator */
+int execute_exec_iterator_command(zval*             object,
+                                  int               argc,
+                                  zval*             return_value,
+                                  zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zend_long            chunk_size = VALKEY_GLIDE_BATCH_ITERATOR_DEFAULT_CHUNK;
 
-        cmd_infos[i] = cmd_info;
+    /* Parse parameters */
+    if (zend_parse_method_parameters(argc, object, "O|l", &object, ce, &chunk_size) == FAILURE) {
+        return 0;
     }
 
-    /* Create BatchInfo structure */
-    struct BatchInfo batch_info = {.cmd_count = valkey_glide->command_count,
-                                   .cmds      = (const struct CmdInfo* const*) cmd_infos,
-                                   .is_atomic = (valkey_glide->batch_type == MULTI)};
+    if (chunk_size <= 0) {
+        php_error_docref(NULL, E_WARNING, "Chunk size must be greater than zero");
+        return 0;
+    }
 
-    /* Execute via FFI batch() function */
-    struct CommandResult* result = batch(valkey_glide->glide_client,
-                                         0, /* callback_index (not used for sync) */
-                                         &batch_info,
-                                         false, /* raise_on_error */
-                                         NULL,  /* options */
-                                         0      /* span_ptr */
-    );
+    /* Get ValkeyGlide object */
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
 
-    /* Free CmdInfo structures */
-    for (i = 0; i < valkey_glide->command_count; i++) {
-        efree(cmd_infos[i]);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
     }
-    efree(cmd_infos);
 
-    /* Process results and clear batch state */
-    int status = 0;
-    if (result) {
-        if (result->command_error) {
-            /* Command failed */
-            free_command_result(result);
-            clear_batch_state(valkey_glide);
-            ZVAL_FALSE(return_value);
-            return 0;
-        }
-        status = 1; /* Assume success unless we find issues */
-        if (result->response) {
-            if (result->response->response_type != Array ||
-                result->response->array_value_len != valkey_glide->command_count) {
-                ZVAL_FALSE(return_value);
-                status = 0;
-                free_command_result(result);
-                clear_batch_state(valkey_glide);
-                return status;
-            }
-            array_init(return_value);
-            for (int64_t idx = 0; idx < result->response->array_value_len; idx++) {
-                zval value;
-                int  process_status = valkey_glide->buffered_commands[idx].process_result(
-                    &result->response->array_value[idx],
-                    valkey_glide->buffered_commands[idx].result_ptr,
-                    &value);
-
-                if (process_status) {
-                    /* Add the processed result to return array */
-                    add_next_index_zval(return_value, &value);
-
-                } else {
-                    /* Process_result failed, use raw response */
-
-                    ZVAL_FALSE(&value);
-                    add_next_index_zval(return_value, &value);
-                }
-            }
-        } else {
-            /* Failed to get responses array, return false */
-            ZVAL_FALSE(return_value);
-            status = 0;
-        }
+    if (!valkey_glide->is_in_batch_mode ||
+        (valkey_glide->batch.command_count == 0 && Z_ISUNDEF(valkey_glide->flushed_results))) {
+        ZVAL_FALSE(return_value);
+        return 0;
     }
 
-    free_command_result(result);
+    /* The iterator takes over the buffer and any auto-flushed replies */
+    valkey_glide_batch_iterator_create(return_value,
+                                       object,
+                                       &valkey_glide->batch,
+                                       &valkey_glide->flushed_results,
+                                       valkey_glide->batch_type == MULTI,
+                                       (size_t) chunk_size);
+
+    memset(&valkey_glide->batch, 0, sizeof(valkey_glide->batch));
+    ZVAL_UNDEF(&valkey_glide->flushed_results);
     clear_batch_state(valkey_glide);
-    return status;
+    return 1;
 }
 
 /* Internal function to execute FCALL/FCALL_RO commands using the Valkey Glide client */
@@ -873,7 +1214,7 @@ static int execute_fcall_command_internal(zval*                object,
 
     /* Prepare numkeys as string */
     char numkeys_str[32];
-    snprintf(numkeys_str, sizeof(numkeys_str), "%ld", numkeys);
+    valkey_glide_format_long(numkeys_str, numkeys);
 
     /* Calculate total arguments: function_name + numkeys + keys + args */
     unsigned long  arg_count = 2 + numkeys + args_count;
@@ -1084,7 +1425,7 @@ int execute_restore_command(zval* object, int argc, zval* return_value, zend_cla
 
         /* Convert TTL to string */
         char ttl_str[32];
-        snprintf(ttl_str, sizeof(ttl_str), "%ld", ttl);
+        valkey_glide_format_long(ttl_str, ttl);
 
         /* Start with basic arguments: key + ttl + serialized */
         unsigned long  base_arg_count = 3;
@@ -1167,7 +1508,7 @@ int execute_restore_command(zval* object, int argc, zval* return_value, zend_cla
 
                 /* Convert idletime to string */
                 char* idletime_val = (char*) emalloc(32);
-                snprintf(idletime_val, 32, "%ld", idletime);
+                valkey_glide_format_long(idletime_val, idletime);
                 args[arg_count]     = (uintptr_t) idletime_val;
                 args_len[arg_count] = strlen(idletime_val);
                 arg_count++;
@@ -1182,7 +1523,7 @@ int execute_restore_command(zval* object, int argc, zval* return_value, zend_cla
 
                 /* Convert freq to string */
                 char* freq_val = (char*) emalloc(32);
-                snprintf(freq_val, 32, "%ld", freq);
+                valkey_glide_format_long(freq_val, freq);
                 args[arg_count]     = (uintptr_t) freq_val;
                 args_len[arg_count] = strlen(freq_val);
                 arg_count++;
@@ -1594,11 +1935,21 @@ int execute_client_command_internal(
     return status;
 }
 
-/* Execute a RAWCOMMAND command using the Valkey Glide client */
-int execute_rawcommand_command_internal(
-    const void* glide_client, zval* args, int args_count, zval* return_value, zval* route) {
+/* Batch result processor for RAWCOMMAND, converting the reply as a direct call does */
+static int process_rawcommand_result(CommandResponse* response, void* output, zval* return_value) {
+    return command_response_to_zval(
+        response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+}
+
+/* Execute a RAWCOMMAND command using the Valkey Glide client, or queue it in batch mode */
+int execute_rawcommand_command_internal(valkey_glide_object* valkey_glide,
+                                        zval*                args,
+                                        int                  args_count,
+                                        zval*                return_value,
+                                        zval*                route) {
     /* Check if client and args are valid */
-    if (!glide_client || !args || args_count <= 0 || !return_value) {
+    if (!valkey_glide || !valkey_glide->glide_client || !args || args_count <= 0 ||
+        !return_value) {
         return 0;
     }
 
@@ -1645,10 +1996,21 @@ int execute_rawcommand_command_internal(
     }
 
     /* Execute the command with or without routing */
-    CommandResult* result;
-    if (route) {
+    CommandResult* result   = NULL;
+    int            buffered = 0;
+    if (valkey_glide->is_in_batch_mode) {
+        /* Queued like any other command, the batch slab copies the arguments */
+        buffered = buffer_routed_command_for_batch(valkey_glide,
+                                                   CustomCommand,
+                                                   cmd_args,
+                                                   args_len,
+                                                   arg_count,
+                                                   route,
+                                                   NULL,
+                                                   process_rawcommand_result);
+    } else if (route) {
         /* Use cluster routing */
-        result = execute_command_with_route(glide_client,
+        result = execute_command_with_route(valkey_glide->glide_client,
                                             CustomCommand, /* command type for raw commands */
                                             arg_count,     /* number of arguments */
                                             cmd_args,      /* arguments */
@@ -1657,7 +2019,7 @@ int execute_rawcommand_command_internal(
         );
     } else {
         /* No routing (standalone mode) */
-        result = execute_command(glide_client,
+        result = execute_command(valkey_glide->glide_client,
                                  CustomCommand, /* command type for raw commands */
                                  arg_count,     /* number of arguments */
                                  cmd_args,      /* arguments */
@@ -1672,6 +2034,10 @@ int execute_rawcommand_command_internal(
     efree(cmd_args);
     efree(args_len);
 
+    if (valkey_glide->is_in_batch_mode) {
+        return buffered;
+    }
+
     /* Process the result */
     int status = 0;
 
@@ -1712,14 +2078,25 @@ int execute_client_command(zval* object, int argc, zval* return_value, zend_clas
         return 0;
     }
 
-    /* Check if we're in batch mode */
-    if (valkey_glide->is_in_batch_mode) {
-        /* In batch mode, ignore routing and treat all arguments as command arguments */
+    if (is_cluster) {
         if (arg_count == 0) {
-            /* Need at least one command argument */
+            /* Need at least the route parameter */
             return 0;
         }
 
+        /* First argument is route, rest are command arguments */
+        route     = &z_args[0];
+        z_args    = &z_args[1];    /* Skip route parameter */
+        arg_count = arg_count - 1; /* Reduce count by 1 */
+    }
+
+    if (arg_count == 0) {
+        /* Need at least one command argument */
+        return 0;
+    }
+
+    /* Check if we're in batch mode */
+    if (valkey_glide->is_in_batch_mode) {
         /* Use helper function to determine command type */
         enum RequestType command_type = determine_client_command_type(z_args, arg_count);
         if (command_type == InvalidRequest) {
@@ -1744,13 +2121,14 @@ int execute_client_command(zval* object, int argc, zval* return_value, zend_clas
         enum RequestType* output = emalloc(sizeof(enum RequestType));
         *output                  = command_type;
         /* Buffer the command for batch execution */
-        int buffer_result = buffer_command_for_batch(valkey_glide,
-                                                     command_type,
-                                                     cmd_args,
-                                                     args_len,
-                                                     arg_count - 1, /* number of args */
-                                                     output,        /* result_ptr */
-                                                     command_response_to_zval_wrapper);
+        int buffer_result = buffer_routed_command_for_batch(valkey_glide,
+                                                            command_type,
+                                                            cmd_args,
+                                                            args_len,
+                                                            arg_count - 1, /* number of args */
+                                                            route,
+                                                            output, /* result_ptr */
+                                                            command_response_to_zval_wrapper);
 
         /* Free the argument arrays */
         if (cmd_args)
@@ -1766,29 +2144,6 @@ int execute_client_command(zval* object, int argc, zval* return_value, zend_clas
         return 0;
     }
 
-    /* Non-batch mode execution - preserve existing logic */
-    if (is_cluster) {
-        if (arg_count == 0) {
-            /* Need at least the route parameter */
-            return 0;
-        }
-
-        /* First argument is route, rest are command arguments */
-        route     = &z_args[0];
-        z_args    = &z_args[1];    /* Skip route parameter */
-        arg_count = arg_count - 1; /* Reduce count by 1 */
-
-        if (arg_count == 0) {
-            /* Need at least one command argument after route */
-            return 0;
-        }
-    } else {
-        /* For non-cluster, we already have all arguments parsed */
-        if (arg_count == 0) {
-            return 0;
-        }
-    }
-
     /* Execute the client command using the Glide client */
     if (execute_client_command_internal(
             valkey_glide->glide_client, z_args, arg_count, return_value, route)) {
@@ -1842,9 +2197,20 @@ int execute_rawcommand_command(zval* object, int argc, zval* return_value, zend_
         }
     }
 
+    /* A pooled client is shared, so connection state must not be changed through it */
+    if (valkey_glide->persistent && valkey_glide_pool_command_is_stateful(z_args, arg_count)) {
+        zend_throw_exception(get_exception_ce_for_client_type(is_cluster),
+                             "SELECT and CLIENT SETNAME are not allowed on a persistent client",
+                             0);
+        return 0;
+    }
+
     /* Execute the raw command using the Glide client */
-    if (execute_rawcommand_command_internal(
-            valkey_glide->glide_client, z_args, arg_count, return_value, route)) {
+    if (execute_rawcommand_command_internal(valkey_glide, z_args, arg_count, return_value, route)) {
+        if (valkey_glide->is_in_batch_mode) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
         /* Return value already set in execute_rawcommand_command */
         return 1;
     }
@@ -1865,10 +2231,6 @@ int execute_dbsize_command(zval* object, int argc, zval* return_value, zend_clas
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* DBSIZE cannot be used in batch mode */
-        return 0;
-    }
 
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
@@ -1910,3 +2272,79 @@ int execute_dbsize_command(zval* object, int argc, zval* return_value, zend_clas
 
     return 0;
 }
+
+/* Return the in-process statistics of the client */
+int execute_get_stats_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+
+    if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    valkey_glide_stats_to_zval(valkey_glide->glide_client, return_value);
+    return 1;
+}
+
+/* Clear the in-process statistics of the client */
+int execute_reset_stats_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+
+    if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    valkey_glide_stats_reset(valkey_glide->glide_client);
+    ZVAL_TRUE(return_value);
+    return 1;
+}
+
+/* Report the near cache counters; false if the client was built without a near cache */
+int execute_near_cache_stats_command(zval*             object,
+                                     int               argc,
+                                     zval*             return_value,
+                                     zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+
+    if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->near_cache) {
+        return 0;
+    }
+
+    valkey_glide_near_cache_stats_to_zval(valkey_glide->near_cache, return_value);
+    return 1;
+}
+
+/* Drop every reply held by the near cache */
+int execute_clear_near_cache_command(zval*             object,
+                                     int               argc,
+                                     zval*             return_value,
+                                     zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+
+    if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->near_cache) {
+        return 0;
+    }
+
+    valkey_glide_near_cache_clear(valkey_glide->near_cache);
+    ZVAL_TRUE(return_value);
+    return 1;
+}
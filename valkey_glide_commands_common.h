@@ -57,11 +57,14 @@ void close_glide_client(const void* glide_client);
 void free_command_response(CommandResponse* command_response_ptr);
 void free_command_result(CommandResult* command_result_ptr);
 
-/* Helper functions for Valkey Glide integration */
-const ConnectionResponse* create_glide_client(valkey_glide_base_client_configuration_t* config);
+/* Helper functions for Valkey Glide integration.
+ * Connect the object's native client, reusing a pooled one for persistent configurations.
+ * Return NULL on success, otherwise an error message the caller must efree(). */
+char* valkey_glide_connect_client(valkey_glide_object*                      valkey_glide,
+                                  valkey_glide_base_client_configuration_t* config);
 
-const ConnectionResponse* create_glide_cluster_client(
-    valkey_glide_cluster_client_configuration_t* config);
+char* valkey_glide_connect_cluster_client(valkey_glide_object*                         valkey_glide,
+                                          valkey_glide_cluster_client_configuration_t* config);
 
 /* Return the protobuf message representing the connection request. Caller must free the result with
  * efree() */
@@ -101,6 +104,10 @@ int execute_echo_command(zval* object, int argc, zval* return_value, zend_class_
 int execute_ping_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_reset_command(const void* glide_client);
 int execute_info_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_info_all_nodes_command(zval*             object,
+                                   int               argc,
+                                   zval*             return_value,
+                                   zend_class_entry* ce);
 
 /* Additional operations */
 int execute_getbit_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
@@ -156,6 +163,10 @@ int execute_cluster_scan_command(const void* glide_client,
                                  size_t      type_len,
                                  int         has_type,
                                  zval*       return_value);
+int execute_scan_iterator_command(zval*             object,
+                                  int               argc,
+                                  zval*             return_value,
+                                  zend_class_entry* ce);
 int execute_sscan_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_copy_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_hscan_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
@@ -181,6 +192,53 @@ int execute_multi_command(zval* object, int argc, zval* return_value, zend_class
 int execute_pipeline_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_discard_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_exec_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_exec_iterator_command(zval*             object,
+                                  int               argc,
+                                  zval*             return_value,
+                                  zend_class_entry* ce);
+int execute_get_async_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_send_async_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_get_stats_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_reset_stats_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_near_cache_stats_command(zval*             object,
+                                     int               argc,
+                                     zval*             return_value,
+                                     zend_class_entry* ce);
+int execute_clear_near_cache_command(zval*             object,
+                                     int               argc,
+                                     zval*             return_value,
+                                     zend_class_entry* ce);
+int execute_key_slot_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_mget_by_slot_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce);
+int execute_mset_by_slot_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce);
+int execute_del_by_slot_command(zval*             object,
+                                int               argc,
+                                zval*             return_value,
+                                zend_class_entry* ce);
+
+/* Batch buffer shared by exec(), auto-flushing pipelines and ValkeyGlideBatchIterator */
+void valkey_glide_batch_buffer_free(valkey_glide_batch_buffer_t* buffer);
+void valkey_glide_batch_buffer_reset(valkey_glide_batch_buffer_t* buffer);
+void valkey_glide_batch_buffer_append(valkey_glide_batch_buffer_t* buffer,
+                                      enum RequestType             cmd_type,
+                                      const uintptr_t*             args,
+                                      const unsigned long*         arg_lengths,
+                                      uintptr_t                    arg_count,
+                                      void*                        result_ptr,
+                                      z_result_processor_t         process_result);
+int  valkey_glide_batch_buffer_send(const void*                  glide_client,
+                                    valkey_glide_batch_buffer_t* buffer,
+                                    size_t                       start,
+                                    size_t                       count,
+                                    bool                         is_atomic,
+                                    zval*                        results);
+
 int execute_fcall_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_fcall_ro_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_dump_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
@@ -432,6 +490,20 @@ int execute_unlink_command(zval* object, int argc, zval* return_value, zend_clas
         RETURN_FALSE;                                                           \
     }
 
+#define INFO_ALL_NODES_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, infoAllNodes) {                                                \
+        if (execute_info_all_nodes_command(getThis(),                                     \
+                                           ZEND_NUM_ARGS(),                               \
+                                           return_value,                                  \
+                                           strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                               ? get_valkey_glide_cluster_ce()            \
+                                               : get_valkey_glide_ce())) {                \
+            return;                                                                       \
+        }                                                                                 \
+        zval_dtor(return_value);                                                          \
+        RETURN_FALSE;                                                                     \
+    }
+
 /* Additional SET family macros */
 #define SETEX_METHOD_IMPL(class_name)                                            \
     PHP_METHOD(class_name, setex) {                                              \
@@ -616,6 +688,20 @@ int execute_unlink_command(zval* object, int argc, zval* return_value, zend_clas
         RETURN_FALSE;                                                           \
     }
 
+#define SCAN_ITERATOR_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, scanIterator) {                                               \
+        if (execute_scan_iterator_command(getThis(),                                     \
+                                          ZEND_NUM_ARGS(),                               \
+                                          return_value,                                  \
+                                          strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                              ? get_valkey_glide_cluster_ce()            \
+                                              : get_valkey_glide_ce())) {                \
+            return;                                                                      \
+        }                                                                                \
+        zval_dtor(return_value);                                                         \
+        RETURN_FALSE;                                                                    \
+    }
+
 #define SSCAN_METHOD_IMPL(class_name)                                            \
     PHP_METHOD(class_name, sscan) {                                              \
         if (execute_sscan_command(getThis(),                                     \
@@ -1050,6 +1136,160 @@ int execute_unlink_command(zval* object, int argc, zval* return_value, zend_clas
         RETURN_FALSE;                                                           \
     }
 
+#define EXEC_ITERATOR_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, execIterator) {                                               \
+        if (execute_exec_iterator_command(getThis(),                                     \
+                                          ZEND_NUM_ARGS(),                               \
+                                          return_value,                                  \
+                                          strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                              ? get_valkey_glide_cluster_ce()            \
+                                              : get_valkey_glide_ce())) {                \
+            return;                                                                      \
+        }                                                                                \
+        zval_dtor(return_value);                                                         \
+        RETURN_FALSE;                                                                    \
+    }
+
+#define GET_ASYNC_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, getAsync) {                                               \
+        if (execute_get_async_command(getThis(),                                     \
+                                      ZEND_NUM_ARGS(),                               \
+                                      return_value,                                  \
+                                      strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                          ? get_valkey_glide_cluster_ce()            \
+                                          : get_valkey_glide_ce())) {                \
+            return;                                                                  \
+        }                                                                            \
+        zval_dtor(return_value);                                                     \
+        RETURN_FALSE;                                                                \
+    }
+
+#define SEND_ASYNC_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, sendAsync) {                                               \
+        if (execute_send_async_command(getThis(),                                     \
+                                       ZEND_NUM_ARGS(),                               \
+                                       return_value,                                  \
+                                       strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                           ? get_valkey_glide_cluster_ce()            \
+                                           : get_valkey_glide_ce())) {                \
+            return;                                                                   \
+        }                                                                             \
+        zval_dtor(return_value);                                                      \
+        RETURN_FALSE;                                                                 \
+    }
+
+#define GET_STATS_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, getStats) {                                               \
+        if (execute_get_stats_command(getThis(),                                     \
+                                      ZEND_NUM_ARGS(),                               \
+                                      return_value,                                  \
+                                      strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                          ? get_valkey_glide_cluster_ce()            \
+                                          : get_valkey_glide_ce())) {                \
+            return;                                                                  \
+        }                                                                            \
+        zval_dtor(return_value);                                                     \
+        RETURN_FALSE;                                                                \
+    }
+
+#define RESET_STATS_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, resetStats) {                                               \
+        if (execute_reset_stats_command(getThis(),                                     \
+                                        ZEND_NUM_ARGS(),                               \
+                                        return_value,                                  \
+                                        strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                            ? get_valkey_glide_cluster_ce()            \
+                                            : get_valkey_glide_ce())) {                \
+            return;                                                                    \
+        }                                                                              \
+        zval_dtor(return_value);                                                       \
+        RETURN_FALSE;                                                                  \
+    }
+
+#define GET_NEAR_CACHE_STATS_METHOD_IMPL(class_name)                                        \
+    PHP_METHOD(class_name, getNearCacheStats) {                                             \
+        if (execute_near_cache_stats_command(getThis(),                                     \
+                                             ZEND_NUM_ARGS(),                               \
+                                             return_value,                                  \
+                                             strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                                 ? get_valkey_glide_cluster_ce()            \
+                                                 : get_valkey_glide_ce())) {                \
+            return;                                                                         \
+        }                                                                                   \
+        zval_dtor(return_value);                                                            \
+        RETURN_FALSE;                                                                       \
+    }
+
+#define CLEAR_NEAR_CACHE_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, clearNearCache) {                                                \
+        if (execute_clear_near_cache_command(getThis(),                                     \
+                                             ZEND_NUM_ARGS(),                               \
+                                             return_value,                                  \
+                                             strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                                 ? get_valkey_glide_cluster_ce()            \
+                                                 : get_valkey_glide_ce())) {                \
+            return;                                                                         \
+        }                                                                                   \
+        zval_dtor(return_value);                                                            \
+        RETURN_FALSE;                                                                       \
+    }
+
+#define KEY_SLOT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, keySlot) {                                               \
+        if (execute_key_slot_command(getThis(),                                     \
+                                     ZEND_NUM_ARGS(),                               \
+                                     return_value,                                  \
+                                     strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                         ? get_valkey_glide_cluster_ce()            \
+                                         : get_valkey_glide_ce())) {                \
+            return;                                                                 \
+        }                                                                           \
+        zval_dtor(return_value);                                                    \
+        RETURN_FALSE;                                                               \
+    }
+
+#define MGET_BY_SLOT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, mgetBySlot) {                                                \
+        if (execute_mget_by_slot_command(getThis(),                                     \
+                                         ZEND_NUM_ARGS(),                               \
+                                         return_value,                                  \
+                                         strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                             ? get_valkey_glide_cluster_ce()            \
+                                             : get_valkey_glide_ce())) {                \
+            return;                                                                     \
+        }                                                                               \
+        zval_dtor(return_value);                                                        \
+        RETURN_FALSE;                                                                   \
+    }
+
+#define MSET_BY_SLOT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, msetBySlot) {                                                \
+        if (execute_mset_by_slot_command(getThis(),                                     \
+                                         ZEND_NUM_ARGS(),                               \
+                                         return_value,                                  \
+                                         strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                             ? get_valkey_glide_cluster_ce()            \
+                                             : get_valkey_glide_ce())) {                \
+            return;                                                                     \
+        }                                                                               \
+        zval_dtor(return_value);                                                        \
+        RETURN_FALSE;                                                                   \
+    }
+
+#define DEL_BY_SLOT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, delBySlot) {                                                \
+        if (execute_del_by_slot_command(getThis(),                                     \
+                                        ZEND_NUM_ARGS(),                               \
+                                        return_value,                                  \
+                                        strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                            ? get_valkey_glide_cluster_ce()            \
+                                            : get_valkey_glide_ce())) {                \
+            return;                                                                    \
+        }                                                                              \
+        zval_dtor(return_value);                                                       \
+        RETURN_FALSE;                                                                  \
+    }
+
 #define FCALL_METHOD_IMPL(class_name)                                            \
     PHP_METHOD(class_name, fcall) {                                              \
         if (execute_fcall_command(getThis(),                                     \
@@ -1317,5 +1557,229 @@ int execute_unlink_command(zval* object, int argc, zval* return_value, zend_clas
         RETURN_FALSE;                                                             \
     }
 
+/* Pub/Sub, implemented in valkey_glide_pubsub.c */
+#define SUBSCRIBE_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, subscribe) {                                              \
+        if (execute_subscribe_command(getThis(),                                     \
+                                      ZEND_NUM_ARGS(),                               \
+                                      return_value,                                  \
+                                      strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                          ? get_valkey_glide_cluster_ce()            \
+                                          : get_valkey_glide_ce(),                   \
+                                      VALKEY_GLIDE_PUBSUB_EXACT)) {                  \
+            return;                                                                  \
+        }                                                                            \
+        zval_dtor(return_value);                                                     \
+        RETURN_FALSE;                                                                \
+    }
+
+#define PSUBSCRIBE_METHOD_IMPL(class_name)                                           \
+    PHP_METHOD(class_name, psubscribe) {                                             \
+        if (execute_subscribe_command(getThis(),                                     \
+                                      ZEND_NUM_ARGS(),                               \
+                                      return_value,                                  \
+                                      strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                          ? get_valkey_glide_cluster_ce()            \
+                                          : get_valkey_glide_ce(),                   \
+                                      VALKEY_GLIDE_PUBSUB_PATTERN)) {                \
+            return;                                                                  \
+        }                                                                            \
+        zval_dtor(return_value);                                                     \
+        RETURN_FALSE;                                                                \
+    }
+
+#define SSUBSCRIBE_METHOD_IMPL(class_name)                                           \
+    PHP_METHOD(class_name, ssubscribe) {                                             \
+        if (execute_subscribe_command(getThis(),                                     \
+                                      ZEND_NUM_ARGS(),                               \
+                                      return_value,                                  \
+                                      strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                          ? get_valkey_glide_cluster_ce()            \
+                                          : get_valkey_glide_ce(),                   \
+                                      VALKEY_GLIDE_PUBSUB_SHARDED)) {                \
+            return;                                                                  \
+        }                                                                            \
+        zval_dtor(return_value);                                                     \
+        RETURN_FALSE;                                                                \
+    }
+
+#define UNSUBSCRIBE_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, unsubscribe) {                                              \
+        if (execute_unsubscribe_command(getThis(),                                     \
+                                        ZEND_NUM_ARGS(),                               \
+                                        return_value,                                  \
+                                        strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                            ? get_valkey_glide_cluster_ce()            \
+                                            : get_valkey_glide_ce(),                   \
+                                        VALKEY_GLIDE_PUBSUB_EXACT)) {                  \
+            return;                                                                    \
+        }                                                                              \
+        zval_dtor(return_value);                                                       \
+        RETURN_FALSE;                                                                  \
+    }
+
+#define PUNSUBSCRIBE_METHOD_IMPL(class_name)                                           \
+    PHP_METHOD(class_name, punsubscribe) {                                             \
+        if (execute_unsubscribe_command(getThis(),                                     \
+                                        ZEND_NUM_ARGS(),                               \
+                                        return_value,                                  \
+                                        strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                            ? get_valkey_glide_cluster_ce()            \
+                                            : get_valkey_glide_ce(),                   \
+                                        VALKEY_GLIDE_PUBSUB_PATTERN)) {                \
+            return;                                                                    \
+        }                                                                              \
+        zval_dtor(return_value);                                                       \
+        RETURN_FALSE;                                                                  \
+    }
+
+#define SUNSUBSCRIBE_METHOD_IMPL(class_name)                                           \
+    PHP_METHOD(class_name, sunsubscribe) {                                             \
+        if (execute_unsubscribe_command(getThis(),                                     \
+                                        ZEND_NUM_ARGS(),                               \
+                                        return_value,                                  \
+                                        strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                            ? get_valkey_glide_cluster_ce()            \
+                                            : get_valkey_glide_ce(),                   \
+                                        VALKEY_GLIDE_PUBSUB_SHARDED)) {                \
+            return;                                                                    \
+        }                                                                              \
+        zval_dtor(return_value);                                                       \
+        RETURN_FALSE;                                                                  \
+    }
+
+#define PUBLISH_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, publish) {                                              \
+        if (execute_publish_command(getThis(),                                     \
+                                    ZEND_NUM_ARGS(),                               \
+                                    return_value,                                  \
+                                    strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                        ? get_valkey_glide_cluster_ce()            \
+                                        : get_valkey_glide_ce(),                   \
+                                    Publish)) {                                    \
+            return;                                                                \
+        }                                                                          \
+        zval_dtor(return_value);                                                   \
+        RETURN_FALSE;                                                              \
+    }
+
+#define SPUBLISH_METHOD_IMPL(class_name)                                           \
+    PHP_METHOD(class_name, spublish) {                                             \
+        if (execute_publish_command(getThis(),                                     \
+                                    ZEND_NUM_ARGS(),                               \
+                                    return_value,                                  \
+                                    strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                        ? get_valkey_glide_cluster_ce()            \
+                                        : get_valkey_glide_ce(),                   \
+                                    SPublish)) {                                   \
+            return;                                                                \
+        }                                                                          \
+        zval_dtor(return_value);                                                   \
+        RETURN_FALSE;                                                              \
+    }
+
+#define POLL_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, poll) {                                              \
+        if (execute_poll_command(getThis(),                                     \
+                                 ZEND_NUM_ARGS(),                               \
+                                 return_value,                                  \
+                                 strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                     ? get_valkey_glide_cluster_ce()            \
+                                     : get_valkey_glide_ce())) {                \
+            return;                                                             \
+        }                                                                       \
+        zval_dtor(return_value);                                                \
+        RETURN_FALSE;                                                           \
+    }
+
+/* Lua scripts, implemented in valkey_glide_script.c */
+#define EVAL_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, eval) {                                              \
+        if (execute_eval_command(getThis(),                                     \
+                                 ZEND_NUM_ARGS(),                               \
+                                 return_value,                                  \
+                                 strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                     ? get_valkey_glide_cluster_ce()            \
+                                     : get_valkey_glide_ce(),                   \
+                                 Eval)) {                                       \
+            return;                                                             \
+        }                                                                       \
+        zval_dtor(return_value);                                                \
+        RETURN_FALSE;                                                           \
+    }
+
+#define EVAL_RO_METHOD_IMPL(class_name)                                         \
+    PHP_METHOD(class_name, eval_ro) {                                           \
+        if (execute_eval_command(getThis(),                                     \
+                                 ZEND_NUM_ARGS(),                               \
+                                 return_value,                                  \
+                                 strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                     ? get_valkey_glide_cluster_ce()            \
+                                     : get_valkey_glide_ce(),                   \
+                                 EvalReadOnly)) {                               \
+            return;                                                             \
+        }                                                                       \
+        zval_dtor(return_value);                                                \
+        RETURN_FALSE;                                                           \
+    }
+
+#define EVALSHA_METHOD_IMPL(class_name)                                         \
+    PHP_METHOD(class_name, evalsha) {                                           \
+        if (execute_eval_command(getThis(),                                     \
+                                 ZEND_NUM_ARGS(),                               \
+                                 return_value,                                  \
+                                 strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                     ? get_valkey_glide_cluster_ce()            \
+                                     : get_valkey_glide_ce(),                   \
+                                 EvalSha)) {                                    \
+            return;                                                             \
+        }                                                                       \
+        zval_dtor(return_value);                                                \
+        RETURN_FALSE;                                                           \
+    }
+
+#define EVALSHA_RO_METHOD_IMPL(class_name)                                      \
+    PHP_METHOD(class_name, evalsha_ro) {                                        \
+        if (execute_eval_command(getThis(),                                     \
+                                 ZEND_NUM_ARGS(),                               \
+                                 return_value,                                  \
+                                 strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                     ? get_valkey_glide_cluster_ce()            \
+                                     : get_valkey_glide_ce(),                   \
+                                 EvalShaReadOnly)) {                            \
+            return;                                                             \
+        }                                                                       \
+        zval_dtor(return_value);                                                \
+        RETURN_FALSE;                                                           \
+    }
+
+#define SCRIPT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, script) {                                              \
+        if (execute_script_command(getThis(),                                     \
+                                   ZEND_NUM_ARGS(),                               \
+                                   return_value,                                  \
+                                   strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                       ? get_valkey_glide_cluster_ce()            \
+                                       : get_valkey_glide_ce())) {                \
+            return;                                                               \
+        }                                                                         \
+        zval_dtor(return_value);                                                  \
+        RETURN_FALSE;                                                             \
+    }
+
+#define INVOKE_SCRIPT_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, invokeScript) {                                               \
+        if (execute_invoke_script_command(getThis(),                                     \
+                                          ZEND_NUM_ARGS(),                               \
+                                          return_value,                                  \
+                                          strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                              ? get_valkey_glide_cluster_ce()            \
+                                              : get_valkey_glide_ce())) {                \
+            return;                                                                      \
+        }                                                                                \
+        zval_dtor(return_value);                                                         \
+        RETURN_FALSE;                                                                    \
+    }
+
 
 #endif /* VALKEY_GLIDE_COMMANDS_COMMON_H */
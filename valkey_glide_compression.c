@@ -0,0 +1,274 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "valkey_glide_compression.h"
+
+#ifdef VALKEY_GLIDE_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+#ifdef VALKEY_GLIDE_ZSTD
+#include <zstd.h>
+#endif
+
+#define COMPRESSION_MAGIC 0xC1
+#define COMPRESSION_HEADER_LEN 6
+
+/* The header length is untrusted, nothing larger is allocated for a reply */
+#define COMPRESSION_MAX_ORIGINAL_LEN ((size_t) 512 * 1024 * 1024)
+
+/* LZ4 cannot expand a block by more than this factor */
+#define LZ4_MAX_RATIO 255
+
+#ifdef VALKEY_GLIDE_ZSTD
+/* Contexts are reused by every call in a thread, they keep their buffers warm */
+static ZEND_TLS ZSTD_CCtx* zstd_cctx = NULL;
+static ZEND_TLS ZSTD_DCtx* zstd_dctx = NULL;
+#endif
+
+bool valkey_glide_compression_available(valkey_glide_compression_t algorithm) {
+    switch (algorithm) {
+        case VALKEY_GLIDE_COMPRESSION_NONE:
+            return true;
+        case VALKEY_GLIDE_COMPRESSION_LZ4:
+#ifdef VALKEY_GLIDE_LZ4
+            return true;
+#else
+            return false;
+#endif
+        case VALKEY_GLIDE_COMPRESSION_ZSTD:
+#ifdef VALKEY_GLIDE_ZSTD
+            return true;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool valkey_glide_compressor_init(valkey_glide_compressor_t*                compressor,
+                                  const valkey_glide_compression_config_t* config) {
+    memset(compressor, 0, sizeof(*compressor));
+    if (!config) {
+        return true;
+    }
+    if (!valkey_glide_compression_available(config->algorithm)) {
+        return false;
+    }
+
+    compressor->algorithm = config->algorithm;
+    compressor->level     = config->level;
+    compressor->min_size  = config->min_size;
+
+#ifdef VALKEY_GLIDE_ZSTD
+    if (config->algorithm == VALKEY_GLIDE_COMPRESSION_ZSTD && config->dictionary) {
+        int level = config->level ? config->level : ZSTD_CLEVEL_DEFAULT;
+
+        compressor->zstd_cdict =
+            ZSTD_createCDict(config->dictionary, config->dictionary_len, level);
+        compressor->zstd_ddict = ZSTD_createDDict(config->dictionary, config->dictionary_len);
+        if (!compressor->zstd_cdict || !compressor->zstd_ddict) {
+            valkey_glide_compressor_destroy(compressor);
+            return false;
+        }
+    }
+#endif
+    return true;
+}
+
+void valkey_glide_compressor_destroy(valkey_glide_compressor_t* compressor) {
+#ifdef VALKEY_GLIDE_ZSTD
+    ZSTD_freeCDict((ZSTD_CDict*) compressor->zstd_cdict);
+    ZSTD_freeDDict((ZSTD_DDict*) compressor->zstd_ddict);
+#endif
+    compressor->zstd_cdict = NULL;
+    compressor->zstd_ddict = NULL;
+}
+
+zend_string* valkey_glide_compress(const valkey_glide_compressor_t* compressor,
+                                   const char*                      data,
+                                   size_t                           len) {
+    zend_string*   result = NULL;
+    unsigned char* header;
+    size_t         written = 0;
+
+    /* Values the reader would refuse to inflate are stored as they are */
+    if (!compressor || compressor->algorithm == VALKEY_GLIDE_COMPRESSION_NONE ||
+        len < compressor->min_size || len <= COMPRESSION_HEADER_LEN ||
+        len > COMPRESSION_MAX_ORIGINAL_LEN) {
+        return NULL;
+    }
+
+    switch (compressor->algorithm) {
+#ifdef VALKEY_GLIDE_LZ4
+        case VALKEY_GLIDE_COMPRESSION_LZ4: {
+            int bound = LZ4_compressBound((int) len);
+            int n;
+
+            if (bound <= 0) {
+                return NULL;
+            }
+            result = zend_string_alloc(COMPRESSION_HEADER_LEN + bound, 0);
+            if (compressor->level > 0) {
+                n = LZ4_compress_HC(data,
+                                    ZSTR_VAL(result) + COMPRESSION_HEADER_LEN,
+                                    (int) len,
+                                    bound,
+                                    compressor->level);
+            } else {
+                n = LZ4_compress_default(
+                    data, ZSTR_VAL(result) + COMPRESSION_HEADER_LEN, (int) len, bound);
+            }
+            written = n > 0 ? (size_t) n : 0;
+            break;
+        }
+#endif
+#ifdef VALKEY_GLIDE_ZSTD
+        case VALKEY_GLIDE_COMPRESSION_ZSTD: {
+            size_t bound = ZSTD_compressBound(len);
+            size_t n;
+
+            if (!zstd_cctx && !(zstd_cctx = ZSTD_createCCtx())) {
+                return NULL;
+            }
+            result = zend_string_alloc(COMPRESSION_HEADER_LEN + bound, 0);
+            if (compressor->zstd_cdict) {
+                n = ZSTD_compress_usingCDict(zstd_cctx,
+                                             ZSTR_VAL(result) + COMPRESSION_HEADER_LEN,
+                                             bound,
+                                             data,
+                                             len,
+                                             (const ZSTD_CDict*) compressor->zstd_cdict);
+            } else {
+                n = ZSTD_compressCCtx(zstd_cctx,
+                                      ZSTR_VAL(result) + COMPRESSION_HEADER_LEN,
+                                      bound,
+                                      data,
+                                      len,
+                                      compressor->level ? compressor->level : ZSTD_CLEVEL_DEFAULT);
+            }
+            written = ZSTD_isError(n) ? 0 : n;
+            break;
+        }
+#endif
+        default:
+            return NULL;
+    }
+
+    /* Incompressible data is cheaper to send as is */
+    if (written == 0 || COMPRESSION_HEADER_LEN + written >= len) {
+        zend_string_efree(result);
+        return NULL;
+    }
+
+    header    = (unsigned char*) ZSTR_VAL(result);
+    header[0] = COMPRESSION_MAGIC;
+    header[1] = (unsigned char) compressor->algorithm;
+    header[2] = (unsigned char) (len & 0xFF);
+    header[3] = (unsigned char) ((len >> 8) & 0xFF);
+    header[4] = (unsigned char) ((len >> 16) & 0xFF);
+    header[5] = (unsigned char) ((len >> 24) & 0xFF);
+
+    result = zend_string_truncate(result, COMPRESSION_HEADER_LEN + written, 0);
+    ZSTR_VAL(result)[ZSTR_LEN(result)] = '\0';
+    return result;
+}
+
+bool valkey_glide_is_compressed(const char* data, size_t len) {
+    const unsigned char* header = (const unsigned char*) data;
+
+    return len > COMPRESSION_HEADER_LEN && header[0] == COMPRESSION_MAGIC &&
+           (header[1] == VALKEY_GLIDE_COMPRESSION_LZ4 ||
+            header[1] == VALKEY_GLIDE_COMPRESSION_ZSTD);
+}
+
+zend_string* valkey_glide_decompress(const valkey_glide_compressor_t* compressor,
+                                     const char*                      data,
+                                     size_t                           len) {
+    const unsigned char* header = (const unsigned char*) data;
+    const char*          src    = data + COMPRESSION_HEADER_LEN;
+    size_t               src_len;
+    size_t               original_len;
+    zend_string*         result = NULL;
+    bool                 ok     = false;
+
+    if (!valkey_glide_is_compressed(data, len)) {
+        return NULL;
+    }
+
+    src_len      = len - COMPRESSION_HEADER_LEN;
+    original_len = (size_t) header[2] | ((size_t) header[3] << 8) | ((size_t) header[4] << 16) |
+                   ((size_t) header[5] << 24);
+    if (original_len > COMPRESSION_MAX_ORIGINAL_LEN) {
+        return NULL;
+    }
+
+    switch (header[1]) {
+#ifdef VALKEY_GLIDE_LZ4
+        case VALKEY_GLIDE_COMPRESSION_LZ4: {
+            int n;
+
+            if (original_len > (size_t) LZ4_MAX_INPUT_SIZE || src_len > (size_t) INT_MAX ||
+                original_len > src_len * LZ4_MAX_RATIO) {
+                return NULL;
+            }
+            result = zend_string_alloc(original_len, 0);
+            n      = LZ4_decompress_safe(src, ZSTR_VAL(result), (int) src_len, (int) original_len);
+            ok     = n >= 0 && (size_t) n == original_len;
+            break;
+        }
+#endif
+#ifdef VALKEY_GLIDE_ZSTD
+        case VALKEY_GLIDE_COMPRESSION_ZSTD: {
+            size_t             n;
+            unsigned long long frame_len = ZSTD_getFrameContentSize(src, src_len);
+
+            /* The frame records its own size, both must agree before allocating */
+            if (frame_len == ZSTD_CONTENTSIZE_UNKNOWN || frame_len == ZSTD_CONTENTSIZE_ERROR ||
+                frame_len != (unsigned long long) original_len) {
+                return NULL;
+            }
+            if (!zstd_dctx && !(zstd_dctx = ZSTD_createDCtx())) {
+                return NULL;
+            }
+            result = zend_string_alloc(original_len, 0);
+            if (compressor && compressor->zstd_ddict) {
+                n = ZSTD_decompress_usingDDict(zstd_dctx,
+                                               ZSTR_VAL(result),
+                                               original_len,
+                                               src,
+                                               src_len,
+                                               (const ZSTD_DDict*) compressor->zstd_ddict);
+            } else {
+                n = ZSTD_decompressDCtx(zstd_dctx, ZSTR_VAL(result), original_len, src, src_len);
+            }
+            ok = !ZSTD_isError(n) && n == original_len;
+            break;
+        }
+#endif
+        default:
+            /* Written by a build with an algorithm this one lacks */
+            return NULL;
+    }
+
+    if (!ok) {
+        zend_string_efree(result);
+        return NULL;
+    }
+
+    ZSTR_VAL(result)[original_len] = '\0';
+    return result;
+}
+
+void valkey_glide_compression_shutdown(void) {
+#ifdef VALKEY_GLIDE_ZSTD
+    ZSTD_freeCCtx(zstd_cctx);
+    ZSTD_freeDCtx(zstd_dctx);
+    zstd_cctx = NULL;
+    zstd_dctx = NULL;
+#endif
+}
@@ -0,0 +1,69 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_COMPRESSION_H
+#define VALKEY_GLIDE_COMPRESSION_H
+
+#include <stdbool.h>
+
+#include "common.h"
+
+/* ====================================================================
+ * VALUE COMPRESSION
+ * ==================================================================== */
+
+/*
+ * A compressed value is stored as a 6 byte header followed by the compressed
+ * payload: 0xC1, the ValkeyGlide::COMPRESSION_* algorithm and the original
+ * length as a little-endian uint32. 0xC1 starts no UTF-8, serialize() or
+ * msgpack data, so values that were stored uncompressed are read back as is.
+ * LZ4 and Zstd are compiled in with --enable-valkey-glide-lz4 and
+ * --enable-valkey-glide-zstd.
+ */
+
+#define VALKEY_GLIDE_COMPRESSION_DEFAULT_MIN_SIZE 1024
+
+typedef struct {
+    valkey_glide_compression_t algorithm;
+    int                        level;
+    size_t                     min_size;
+    void*                      zstd_cdict; /* ZSTD_CDict*, NULL without a dictionary */
+    void*                      zstd_ddict; /* ZSTD_DDict*, NULL without a dictionary */
+} valkey_glide_compressor_t;
+
+/* Whether an algorithm can be used by this build */
+bool valkey_glide_compression_available(valkey_glide_compression_t algorithm);
+
+/**
+ * Set up a compressor from its configuration. Returns false if the algorithm is
+ * not available or the dictionary cannot be loaded.
+ */
+bool valkey_glide_compressor_init(valkey_glide_compressor_t*                compressor,
+                                  const valkey_glide_compression_config_t* config);
+
+/* Release what valkey_glide_compressor_init() allocated */
+void valkey_glide_compressor_destroy(valkey_glide_compressor_t* compressor);
+
+/**
+ * Compress a value. Returns NULL when it should be sent as is: compression is
+ * off, the value is shorter than min_size or it would not get smaller.
+ */
+zend_string* valkey_glide_compress(const valkey_glide_compressor_t* compressor,
+                                   const char*                      data,
+                                   size_t                           len);
+
+/* Whether data starts with a compressed value header */
+bool valkey_glide_is_compressed(const char* data, size_t len);
+
+/**
+ * Decompress a value carrying the header. The compressor may be NULL unless the
+ * value needs its Zstd dictionary. Returns NULL if the data cannot be decoded or
+ * its header claims an implausible length, callers then keep the raw value.
+ */
+zend_string* valkey_glide_decompress(const valkey_glide_compressor_t* compressor,
+                                     const char*                      data,
+                                     size_t                           len);
+
+/* Free the compression contexts kept between calls, at module shutdown */
+void valkey_glide_compression_shutdown(void);
+
+#endif /* VALKEY_GLIDE_COMPRESSION_H */
@@ -30,7 +30,13 @@
 #include "logger.h"
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_core_common.h"
+#include "valkey_glide_info.h"
 #include "valkey_glide_list_common.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_numeric.h"
+#include "valkey_glide_pool.h"
+#include "valkey_glide_serializer.h"
+#include "valkey_glide_stats.h"
 #include "valkey_glide_z_common.h"
 
 extern zend_class_entry* ce;
@@ -206,56 +212,102 @@ uint8_t* create_connection_request(size_t*                                   len
     return buffer;
 }
 
-/* Create a Valkey Glide client or Cluster client using shared properties. */
-static const ConnectionResponse* create_base_glide_client(
-    valkey_glide_base_client_configuration_t* config,
-    valkey_glide_periodic_checks_status_t     periodic_checks,
-    bool                                      is_cluster,
-    bool                                      refresh_topology_from_initial_nodes) {
+/* Set up the per-client state kept outside the core once glide_client is connected */
+static void attach_client_state(valkey_glide_object*                      valkey_glide,
+                                valkey_glide_base_client_configuration_t* config,
+                                bool                                      is_cluster) {
+    valkey_glide_stats_attach(valkey_glide->glide_client);
+
+    /* Without tracking the cache could serve stale data, so the client just runs without it */
+    if (config->advanced_config && config->advanced_config->near_cache) {
+        valkey_glide->near_cache = valkey_glide_near_cache_attach(
+            valkey_glide->glide_client, config->advanced_config->near_cache, is_cluster);
+    }
+}
+
+/* Connect a Valkey Glide client or Cluster client using shared properties.
+ * Persistent clients are taken from, or added to, the process-wide pool.
+ * Returns NULL on success, otherwise an error message the caller must efree(). */
+static char* connect_base_glide_client(valkey_glide_object*                      valkey_glide,
+                                       valkey_glide_base_client_configuration_t* config,
+                                       valkey_glide_periodic_checks_status_t     periodic_checks,
+                                       bool                                      is_cluster,
+                                       bool refresh_topology_from_initial_nodes) {
     size_t   len;
     uint8_t* request_bytes = create_connection_request(
         &len, config, periodic_checks, is_cluster, refresh_topology_from_initial_nodes);
+    bool persistent = config->advanced_config && config->advanced_config->persistent;
 
     if (!request_bytes) {
-        return NULL;
+        return estrdup("Failed to create connection request");
+    }
+
+    const char* codec_error = NULL;
+
+    valkey_glide->codec = valkey_glide_codec_new(config->advanced_config, &codec_error);
+    if (codec_error) {
+        efree(request_bytes);
+        return estrdup(codec_error);
+    }
+
+    /* The request is kept on the object so the async connection can reuse it */
+    valkey_glide->connection_request     = request_bytes;
+    valkey_glide->connection_request_len = len;
+
+    if (persistent) {
+        valkey_glide->glide_client = valkey_glide_pool_checkout(request_bytes, len);
+        if (valkey_glide->glide_client) {
+            VALKEY_LOG_DEBUG("client_creation", "Reusing persistent client");
+            valkey_glide->persistent = true;
+            attach_client_state(valkey_glide, config, is_cluster);
+            return NULL;
+        }
     }
 
     /* Set up client type for synchronous operation */
     ClientType client_type;
     client_type.tag = SyncClient;
 
-    /* Create the client */
+    /* Create the client; push notifications feed the near cache */
     const ConnectionResponse* conn_resp =
-        create_client(request_bytes, len, &client_type, NULL /* No PubSub callback */
-        );
-
-    /* Free the request bytes as they're no longer needed */
-    efree(request_bytes);
+        create_client(request_bytes, len, &client_type, valkey_glide_push_callback);
 
     /* Check if there was an error */
+    char* error_message = NULL;
     if (conn_resp->connection_error_message) {
         VALKEY_LOG_ERROR("client_creation", conn_resp->connection_error_message);
+        error_message = estrdup(conn_resp->connection_error_message);
+    } else {
+        valkey_glide->glide_client = conn_resp->conn_ptr;
+        valkey_glide->persistent =
+            persistent && valkey_glide_pool_add(request_bytes, len, valkey_glide->glide_client);
+        attach_client_state(valkey_glide, config, is_cluster);
     }
 
-    return conn_resp;
+    free_connection_response((ConnectionResponse*) conn_resp);
+    return error_message;
 }
 
-/* Create a Valkey Glide client */
-const ConnectionResponse* create_glide_client(valkey_glide_base_client_configuration_t* config) {
-    return create_base_glide_client(config, VALKEY_GLIDE_PERIODIC_CHECKS_DISABLED, false, false);
+/* Connect a Valkey Glide client */
+char* valkey_glide_connect_client(valkey_glide_object*                      valkey_glide,
+                                  valkey_glide_base_client_configuration_t* config) {
+    return connect_base_glide_client(
+        valkey_glide, config, VALKEY_GLIDE_PERIODIC_CHECKS_DISABLED, false, false);
 }
 
-const ConnectionResponse* create_glide_cluster_client(
-    valkey_glide_cluster_client_configuration_t* config) {
-    return create_base_glide_client(&config->base,
-                                    config->periodic_checks_status,
-                                    true,
-                                    config->refresh_topology_from_initial_nodes);
+char* valkey_glide_connect_cluster_client(valkey_glide_object*                         valkey_glide,
+                                          valkey_glide_cluster_client_configuration_t* config) {
+    return connect_base_glide_client(valkey_glide,
+                                     &config->base,
+                                     config->periodic_checks_status,
+                                     true,
+                                     config->refresh_topology_from_initial_nodes);
 }
 
 /* Custom result processor for SET commands with GET option support */
 struct set_result_data {
-    int has_get;
+    int                         has_get;
+    const valkey_glide_codec_t* codec; /* Applied to the value returned by GET */
 };
 
 static int process_set_result(CommandResponse* response, void* output, zval* return_value) {
@@ -277,16 +329,12 @@ static int process_set_result(CommandResponse* response, void* output, zval* ret
             return 0; /* Not set (NX/XX condition not met) */
         case String:
             /* GET option returned a value */
-            if (data->has_get && response->string_value) {
-                char*  old_val     = emalloc(response->string_value_len + 1);
-                size_t old_val_len = response->string_value_len;
-                if (old_val) {
-                    memcpy(old_val, response->string_value, response->string_value_len);
-                    (old_val)[response->string_value_len] = '\0';
-                }
-
-                ZVAL_STRINGL(return_value, old_val, old_val_len);
-                efree(old_val);
+            if (data->has_get) {
+                valkey_glide_response_to_zval(data->codec,
+                                              response,
+                                              return_value,
+                                              COMMAND_RESPONSE_NOT_ASSOSIATIVE,
+                                              false);
             }
             efree(output);
             return 2; /* GET option returned a value */
@@ -546,6 +594,8 @@ int execute_set_command(zval* object, int argc, zval* return_value, zend_class_e
     char*  old_val     = NULL; /* For storing GET response */
     size_t old_val_len = 0;
 
+    zend_string* packed = NULL; /* Value encoded by the client's codec */
+
     /* Parse parameters */
     if (zend_parse_method_parameters(
             argc, object, "Osz|za", &object, ce, &key, &key_len, &z_value, &z_expire, &z_opts) ==
@@ -590,44 +640,54 @@ int execute_set_command(zval* object, int argc, zval* return_value, zend_class_e
         z_set_opts = z_opts;
     }
 
-    /* Convert value based on its type */
-    switch (Z_TYPE_P(z_value)) {
-        case IS_STRING:
-            /* It's already a string, use directly */
-            val     = Z_STRVAL_P(z_value);
-            val_len = Z_STRLEN_P(z_value);
-            break;
-        case IS_LONG:
-            /* Convert integer to string */
-            val      = long_to_string(Z_LVAL_P(z_value), &val_len);
-            free_val = 1;  // We'll need to free this
-            break;
-        case IS_DOUBLE:
-            /* Convert float to string */
-            val      = double_to_string(Z_DVAL_P(z_value), &val_len);
-            free_val = 1;  // We'll need to free this
-            break;
-        case IS_TRUE:
-            /* Convert boolean TRUE to "1" */
-            val      = estrdup("1");
-            val_len  = 1;
-            free_val = 1;
-            break;
-        case IS_FALSE:
-            /* Convert boolean FALSE to "0" */
-            val      = estrdup("0");
-            val_len  = 1;
-            free_val = 1;
-            break;
-        case IS_NULL:
-            /* Convert NULL to empty string */
-            val      = estrdup("");
-            val_len  = 0;
-            free_val = 1;
-            break;
-        default:
-            /* Unsupported type */
+    /* With a serializer every type is sent serialized */
+    if (valkey_glide->codec && valkey_glide->codec->serializer != VALKEY_GLIDE_SERIALIZER_NONE) {
+        packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+        if (!packed) {
             return 0;
+        }
+        val     = ZSTR_VAL(packed);
+        val_len = ZSTR_LEN(packed);
+    } else {
+        /* Convert value based on its type */
+        switch (Z_TYPE_P(z_value)) {
+            case IS_STRING:
+                /* It's already a string, use directly */
+                val     = Z_STRVAL_P(z_value);
+                val_len = Z_STRLEN_P(z_value);
+                break;
+            case IS_LONG:
+                /* Convert integer to string */
+                val      = long_to_string(Z_LVAL_P(z_value), &val_len);
+                free_val = 1;  // We'll need to free this
+                break;
+            case IS_DOUBLE:
+                /* Convert float to string */
+                val      = double_to_string(Z_DVAL_P(z_value), &val_len);
+                free_val = 1;  // We'll need to free this
+                break;
+            case IS_TRUE:
+                /* Convert boolean TRUE to "1" */
+                val      = estrdup("1");
+                val_len  = 1;
+                free_val = 1;
+                break;
+            case IS_FALSE:
+                /* Convert boolean FALSE to "0" */
+                val      = estrdup("0");
+                val_len  = 1;
+                free_val = 1;
+                break;
+            case IS_NULL:
+                /* Convert NULL to empty string */
+                val      = estrdup("");
+                val_len  = 0;
+                free_val = 1;
+                break;
+            default:
+                /* Unsupported type */
+                return 0;
+        }
     }
 
     /* Check if conversion succeeded */
@@ -635,6 +695,19 @@ int execute_set_command(zval* object, int argc, zval* return_value, zend_class_e
         return 0;
     }
 
+    /* Large values are compressed once converted */
+    if (!packed && valkey_glide->codec) {
+        packed = valkey_glide_compress_value(valkey_glide->codec, val, val_len);
+        if (packed) {
+            if (free_val) {
+                efree(val);
+                free_val = 0;
+            }
+            val     = ZSTR_VAL(packed);
+            val_len = ZSTR_LEN(packed);
+        }
+    }
+
     /* Execute the SET command using the internal helper function */
     int result = execute_set_command_internal(valkey_glide,
                                               key,
@@ -651,6 +724,9 @@ int execute_set_command(zval* object, int argc, zval* return_value, zend_class_e
     if (free_val) {
         efree(val);
     }
+    if (packed) {
+        zend_string_release(packed);
+    }
 
     /* Check for batch mode after successful execution */
     if (result) {
@@ -710,6 +786,7 @@ int execute_set_command_internal(valkey_glide_object* valkey_glide,
     /* Prepare result data for GET option */
     struct set_result_data* result_data = emalloc(sizeof(struct set_result_data));
     result_data->has_get                = args.options.get_old_value;
+    result_data->codec                  = valkey_glide->codec;
 
     return execute_core_command(valkey_glide, &args, result_data, process_set_result, return_value);
 }
@@ -717,14 +794,15 @@ int execute_set_command_internal(valkey_glide_object* valkey_glide,
 /* Execute a SETEX command using the Valkey Glide client - UNIFIED IMPLEMENTATION */
 int execute_setex_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
-    char *               key = NULL, *val = NULL;
-    size_t               key_len, val_len;
+    char*                key = NULL;
+    size_t               key_len;
+    zval*                z_value;
+    zend_string*         packed;
     zend_long            expire;
 
     /* Parse parameters */
     if (zend_parse_method_parameters(
-            argc, object, "Osls", &object, ce, &key, &key_len, &expire, &val, &val_len) ==
-        FAILURE) {
+            argc, object, "Oslz", &object, ce, &key, &key_len, &expire, &z_value) == FAILURE) {
         return 0;
     }
 
@@ -734,9 +812,23 @@ int execute_setex_command(zval* object, int argc, zval* return_value, zend_class
         return 0;
     }
 
+    packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+    if (!packed) {
+        return 0;
+    }
+
     /* Call execute_set_command_internal with expire in seconds (EX) and no special options */
-    int result = execute_set_command_internal(
-        valkey_glide, key, key_len, val, val_len, expire, NULL, NULL, NULL, return_value);
+    int result = execute_set_command_internal(valkey_glide,
+                                              key,
+                                              key_len,
+                                              ZSTR_VAL(packed),
+                                              ZSTR_LEN(packed),
+                                              expire,
+                                              NULL,
+                                              NULL,
+                                              NULL,
+                                              return_value);
+    zend_string_release(packed);
 
     if (result == 1) {
         if (valkey_glide->is_in_batch_mode) {
@@ -753,14 +845,15 @@ int execute_setex_command(zval* object, int argc, zval* return_value, zend_class
 /* Execute a PSETEX command using the Valkey Glide client - UNIFIED IMPLEMENTATION */
 int execute_psetex_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
-    char *               key = NULL, *val = NULL;
-    size_t               key_len, val_len;
+    char*                key = NULL;
+    size_t               key_len;
+    zval*                z_value;
+    zend_string*         packed;
     zend_long            expire;
 
     /* Parse parameters */
     if (zend_parse_method_parameters(
-            argc, object, "Osls", &object, ce, &key, &key_len, &expire, &val, &val_len) ==
-        FAILURE) {
+            argc, object, "Oslz", &object, ce, &key, &key_len, &expire, &z_value) == FAILURE) {
         return 0;
     }
 
@@ -770,6 +863,11 @@ int execute_psetex_command(zval* object, int argc, zval* return_value, zend_clas
         return 0;
     }
 
+    packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+    if (!packed) {
+        return 0;
+    }
+
     /* Create options array for PX option */
     zval options;
     array_init(&options);
@@ -778,8 +876,17 @@ int execute_psetex_command(zval* object, int argc, zval* return_value, zend_clas
     add_assoc_long_ex(&options, "PX", sizeof("PX") - 1, expire);
 
     /* Call execute_set_command_internal with the PX option */
-    int result = execute_set_command_internal(
-        valkey_glide, key, key_len, val, val_len, 0, &options, NULL, NULL, return_value);
+    int result = execute_set_command_internal(valkey_glide,
+                                              key,
+                                              key_len,
+                                              ZSTR_VAL(packed),
+                                              ZSTR_LEN(packed),
+                                              0,
+                                              &options,
+                                              NULL,
+                                              NULL,
+                                              return_value);
+    zend_string_release(packed);
 
     /* Clean up options array */
     zval_dtor(&options);
@@ -799,12 +906,14 @@ int execute_psetex_command(zval* object, int argc, zval* return_value, zend_clas
 /* Execute a SETNX command using the Valkey Glide client - UNIFIED IMPLEMENTATION */
 int execute_setnx_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
-    char *               key = NULL, *val = NULL;
-    size_t               key_len, val_len;
+    char*                key = NULL;
+    size_t               key_len;
+    zval*                z_value;
+    zend_string*         packed;
 
     /* Parse parameters */
-    if (zend_parse_method_parameters(
-            argc, object, "Oss", &object, ce, &key, &key_len, &val, &val_len) == FAILURE) {
+    if (zend_parse_method_parameters(argc, object, "Osz", &object, ce, &key, &key_len, &z_value) ==
+        FAILURE) {
         return 0;
     }
 
@@ -814,6 +923,11 @@ int execute_setnx_command(zval* object, int argc, zval* return_value, zend_class
         return 0;
     }
 
+    packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+    if (!packed) {
+        return 0;
+    }
+
     /* Create options array for NX option */
     zval options;
     array_init(&options);
@@ -824,8 +938,17 @@ int execute_setnx_command(zval* object, int argc, zval* return_value, zend_class
     add_next_index_zval(&options, &nx_option);
 
     /* Call execute_set_command_internal with the NX option and no expiration */
-    int result = execute_set_command_internal(
-        valkey_glide, key, key_len, val, val_len, 0, &options, NULL, NULL, return_value);
+    int result = execute_set_command_internal(valkey_glide,
+                                              key,
+                                              key_len,
+                                              ZSTR_VAL(packed),
+                                              ZSTR_LEN(packed),
+                                              0,
+                                              &options,
+                                              NULL,
+                                              NULL,
+                                              return_value);
+    zend_string_release(packed);
 
     /* Clean up options array */
     zval_dtor(&options);
@@ -866,11 +989,6 @@ int execute_echo_command(zval* object, int argc, zval* return_value, zend_class_
         return 0;
     }
 
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* ECHO cannot be used in batch mode */
-        return 0;
-    }
-
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
     core_args.glide_client        = valkey_glide->glide_client;
@@ -951,12 +1069,6 @@ int execute_ping_command(zval* object, int argc, zval* return_value, zend_class_
         return 0;
     }
 
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* Ping cannot be used in batch mode */
-        return 0;
-    }
-
-
     /* Setup core command arguments */
     core_command_args_t core_args = {0};
     core_args.glide_client        = valkey_glide->glide_client;
@@ -1032,83 +1144,6 @@ int execute_ping_command(zval* object, int argc, zval* return_value, zend_class_
     return 0;
 }
 
-#define _NL "\r\n"
-
-
-static void valkey_glide_parse_info_response(char* response, size_t response_len, zval* z_ret) {
-    ZVAL_FALSE(z_ret);
-
-    if (!response || response_len == 0) {
-        return;
-    }
-
-    /* Create a null-terminated copy of the response to ensure safe string operations */
-    char* safe_response = emalloc(response_len + 1);
-    if (!safe_response) {
-        return;
-    }
-
-    memcpy(safe_response, response, response_len);
-    safe_response[response_len] = '\0';
-
-    char* p1;
-    char* s1 = NULL;
-
-    if ((p1 = php_strtok_r(safe_response, _NL, &s1)) != NULL) {
-        array_init(z_ret);
-        do {
-            /* Skip comment lines */
-            if (*p1 == '#') {
-                continue;
-            }
-
-            /* Find the colon separator */
-            char* p = strchr(p1, ':');
-            if (p != NULL) {
-                char* value_start = p + 1;
-
-                /* Calculate the key length */
-                size_t key_len = p - p1;
-
-                /* Skip if key is empty */
-                if (key_len == 0) {
-                    continue;
-                }
-
-                /* Calculate value length safely */
-                size_t value_len = strlen(value_start);
-
-                /* Process the value */
-                if (value_len > 0) {
-                    zend_uchar type;
-                    zend_long  lval;
-                    double     dval;
-
-                    type = is_numeric_string(value_start, value_len, &lval, &dval, 0);
-                    switch (type) {
-                        case IS_LONG:
-                            add_assoc_long_ex(z_ret, p1, key_len, lval);
-                            break;
-                        case IS_DOUBLE:
-                            add_assoc_double_ex(z_ret, p1, key_len, dval);
-                            break;
-                        default:
-                            add_assoc_stringl_ex(z_ret, p1, key_len, value_start, value_len);
-                            break;
-                    }
-                } else {
-                    /* Empty value - add as empty string */
-                    add_assoc_stringl_ex(z_ret, p1, key_len, "", 0);
-                }
-            }
-        } while ((p1 = php_strtok_r(NULL, _NL, &s1)) != NULL);
-    }
-
-    /* Free the safe copy */
-    efree(safe_response);
-}
-
-
 /* Helper function to process INFO command sections into argument arrays */
 static int process_info_sections(
     zval* args, int start_idx, int count, uintptr_t** cmd_args, unsigned long** cmd_args_len) {
@@ -1145,8 +1180,7 @@ int process_info_result(CommandResponse* response, void* output, zval* return_va
 
     if (response->response_type == String) {
         /* Single node response - parse INFO string into associative array */
-        valkey_glide_parse_info_response(
-            response->string_value, response->string_value_len, return_value);
+        valkey_glide_parse_info(response->string_value, response->string_value_len, return_value);
         return 1;
     } else {
         /* Multi-node response (cluster with AllNodes routing) */
@@ -1163,8 +1197,7 @@ int process_info_result(CommandResponse* response, void* output, zval* return_va
         ZEND_HASH_FOREACH_VAL(ht, entry) {
             if (Z_TYPE_P(entry) == IS_STRING) {
                 zval parsed_info;
-                valkey_glide_parse_info_response(
-                    Z_STRVAL_P(entry), Z_STRLEN_P(entry), &parsed_info);
+                valkey_glide_parse_info(Z_STRVAL_P(entry), Z_STRLEN_P(entry), &parsed_info);
                 add_next_index_zval(return_value, &parsed_info);
             }
         }
@@ -1191,10 +1224,6 @@ int execute_info_command(zval* object, int argc, zval* return_value, zend_class_
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* INFO cannot be used in batch mode with cluster */
-        return 0;
-    }
 
     /* Parse parameters */
     if (zend_parse_method_parameters(argc, object, "O*", &object, ce, &args, &args_count) ==
@@ -1204,6 +1233,11 @@ int execute_info_command(zval* object, int argc, zval* return_value, zend_class_
 
     /* Check if we're in batch mode */
     if (valkey_glide->is_in_batch_mode) {
+        if (is_cluster && args_count == 0) {
+            /* Need at least the route parameter */
+            return 0;
+        }
+
         /* In batch mode, buffer the command instead of executing it */
         int section_count = is_cluster ? (args_count - 1) : args_count;
         int start_idx     = is_cluster ? 1 : 0;
@@ -1219,13 +1253,14 @@ int execute_info_command(zval* object, int argc, zval* return_value, zend_class_
 
 
         /* Buffer the command for batch execution */
-        int buffer_result = buffer_command_for_batch(valkey_glide,
-                                                     Info,
-                                                     cmd_args,
-                                                     cmd_args_len,
-                                                     processed_args,
-                                                     NULL, /* result_ptr */
-                                                     process_info_result);
+        int buffer_result = buffer_routed_command_for_batch(valkey_glide,
+                                                            Info,
+                                                            cmd_args,
+                                                            cmd_args_len,
+                                                            processed_args,
+                                                            is_cluster ? &args[0] : NULL,
+                                                            NULL, /* result_ptr */
+                                                            process_info_result);
 
         /* Free the argument arrays */
         for (int i = 0; i < section_count; i++) {
@@ -1316,6 +1351,86 @@ int execute_info_command(zval* object, int argc, zval* return_value, zend_class_
     return 0;
 }
 
+/* Result processor for infoAllNodes(), keyed by node address */
+static int process_info_by_node_result(CommandResponse* response,
+                                       void*            output,
+                                       zval*            return_value) {
+    if (valkey_glide_parse_info_by_node(response, return_value)) {
+        return 1;
+    }
+    return process_info_result(response, output, return_value);
+}
+
+/* Execute INFO on every node of a cluster and return the replies keyed by "host:port" */
+int execute_info_all_nodes_command(zval*             object,
+                                   int               argc,
+                                   zval*             return_value,
+                                   zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                args         = NULL;
+    int                  args_count   = 0;
+    uintptr_t*           cmd_args     = NULL;
+    unsigned long*       cmd_args_len = NULL;
+    CommandResult*       cmd_result   = NULL;
+    zval                 route;
+    int                  status = 0;
+
+    /* Parse parameters */
+    if (zend_parse_method_parameters(argc, object, "O*", &object, ce, &args, &args_count) ==
+        FAILURE) {
+        return 0;
+    }
+
+    /* Get ValkeyGlide object */
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    /* The sections go to the servers, which only send those back */
+    int processed_args = process_info_sections(args, 0, args_count, &cmd_args, &cmd_args_len);
+    if (processed_args < 0) {
+        return 0;
+    }
+
+    ZVAL_STRINGL(&route, "allNodes", sizeof("allNodes") - 1);
+
+    if (valkey_glide->is_in_batch_mode) {
+        status = buffer_routed_command_for_batch(valkey_glide,
+                                                 Info,
+                                                 cmd_args,
+                                                 cmd_args_len,
+                                                 processed_args,
+                                                 &route,
+                                                 NULL, /* result_ptr */
+                                                 process_info_by_node_result);
+        if (status) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
+    } else {
+        cmd_result = execute_command_with_route(
+            valkey_glide->glide_client, Info, processed_args, cmd_args, cmd_args_len, &route);
+        if (cmd_result && !cmd_result->command_error && cmd_result->response) {
+            status = process_info_by_node_result(cmd_result->response, NULL, return_value);
+        }
+        if (cmd_result) {
+            free_command_result(cmd_result);
+        }
+    }
+
+    for (int i = 0; i < processed_args; i++) {
+        efree((char*) (cmd_args[i]));
+    }
+    if (cmd_args)
+        efree(cmd_args);
+    if (cmd_args_len)
+        efree(cmd_args_len);
+    zval_ptr_dtor(&route);
+
+    return status;
+}
+
 /* Execute a GET command using the Valkey Glide client - UNIFIED IMPLEMENTATION */
 int execute_get_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
@@ -1340,13 +1455,14 @@ int execute_get_command(zval* object, int argc, zval* return_value, zend_class_e
     args.key                 = key;
     args.key_len             = key_len;
 
-    /* Allocate string result processor on heap for batch support */
-
+    /* The codec context is heap allocated for batch support */
+    void* context = valkey_glide_codec_context_new(valkey_glide->codec);
 
-    if (execute_core_command(valkey_glide, &args, NULL, process_core_string_result, return_value)) {
+    if (execute_core_command(
+            valkey_glide, &args, context, process_core_value_result, return_value)) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
-            /* Note: output will be freed later in process_core_string_result */
+            /* Note: context will be freed later in process_core_value_result */
             ZVAL_COPY(return_value, object);
             return 1;
         }
@@ -1370,10 +1486,6 @@ int execute_randomkey_command(zval* object, int argc, zval* return_value, zend_c
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
-    if (is_cluster && valkey_glide->is_in_batch_mode) {
-        /* RANDOMKEY cannot be used in batch mode */
-        return 0;
-    }
 
     if (is_cluster) {
         /* Parse parameters for cluster - route parameter required */
@@ -1387,52 +1499,49 @@ int execute_randomkey_command(zval* object, int argc, zval* return_value, zend_c
             return 0;
         }
 
-        /* Execute the command with the route bytes */
-        CommandResult* cmd_result = execute_command_with_route(
-            valkey_glide->glide_client, RandomKey, 0, NULL, NULL, &args[0]);
-
-        /* Use the generic handler to process the result */
-        char*  response     = NULL;
-        size_t response_len = 0;
-        result              = handle_string_response(cmd_result, &response, &response_len);
-        if (result == 1) {
-            if (response != NULL) {
-                ZVAL_STRINGL(return_value, response, response_len);
-                efree(response);
-                return 1;
-            } else {
-                ZVAL_NULL(return_value);
+        if (!valkey_glide->is_in_batch_mode) {
+            /* Execute the command with the route bytes */
+            CommandResult* cmd_result = execute_command_with_route(
+                valkey_glide->glide_client, RandomKey, 0, NULL, NULL, &args[0]);
+
+            /* Use the generic handler to process the result */
+            zend_string* response = NULL;
+            result                = handle_string_response(cmd_result, &response);
+            if (result == 1) {
+                if (response != NULL) {
+                    ZVAL_STR(return_value, response);
+                } else {
+                    ZVAL_NULL(return_value);
+                }
                 return 1;
             }
-            return 1;
+            return 0;
         }
     } else {
         /* Non-cluster case - parse parameters as before */
         if (zend_parse_method_parameters(argc, object, "O", &object, ce) == FAILURE) {
             return 0;
         }
+    }
 
-        /* Execute using core framework */
-        core_command_args_t core_args = {0};
-        core_args.glide_client        = valkey_glide->glide_client;
-        core_args.cmd_type            = RandomKey;
-
-
-        if (execute_core_command(
-                valkey_glide, &core_args, NULL, process_core_string_result, return_value)) {
-            if (valkey_glide->is_in_batch_mode) {
-                /* In batch mode, return $this for method chaining */
-                /* Note: output will be freed later in process_core_string_result */
-                ZVAL_COPY(return_value, object);
-                return 1;
-            }
+    /* Execute using core framework, which queues the command in batch mode */
+    core_command_args_t core_args = {0};
+    core_args.glide_client        = valkey_glide->glide_client;
+    core_args.cmd_type            = RandomKey;
+    if (is_cluster) {
+        core_args.has_route   = 1;
+        core_args.route_param = &args[0];
+    }
 
+    if (execute_core_command(
+            valkey_glide, &core_args, NULL, process_core_string_result, return_value)) {
+        if (valkey_glide->is_in_batch_mode) {
+            /* In batch mode, return $this for method chaining */
+            /* Note: output will be freed later in process_core_string_result */
+            ZVAL_COPY(return_value, object);
             return 1;
         }
-    }
 
-    /* Process the result */
-    if (result == 1) {
         return 1;
     }
 
@@ -1563,15 +1672,16 @@ int execute_del_array(const void* glide_client,
     args.arg_count                    = 1;
 
     /* Use direct command execution for legacy function */
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* cmd_args_len      = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            result            = 0;
-
-    arg_count =
-        prepare_core_args(&args, &cmd_args, &cmd_args_len, &allocated_strings, &allocated_count);
+    uintptr_t*           cmd_args     = NULL;
+    unsigned long*       cmd_args_len = NULL;
+    int                  arg_count    = 0;
+    int                  result       = 0;
+    valkey_glide_arena_t arena;
+
+    valkey_glide_arena_init(&arena);
+    args.arena = &arena;
+
+    arg_count = prepare_core_args(&args, &cmd_args, &cmd_args_len);
     if (arg_count >= 0) {
         CommandResult* cmd_result =
             execute_command(args.glide_client, args.cmd_type, arg_count, cmd_args, cmd_args_len);
@@ -1581,7 +1691,7 @@ int execute_del_array(const void* glide_client,
         }
     }
     zval_ptr_dtor(&keys_array);
-    free_core_args(cmd_args, cmd_args_len, allocated_strings, allocated_count);
+    free_core_args(&args);
     return result;
 }
 
@@ -1650,15 +1760,16 @@ int execute_unlink_array(const void* glide_client,
     args.arg_count                    = 1;
 
     /* Use direct command execution for legacy function */
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* cmd_args_len      = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            result            = 0;
-
-    arg_count =
-        prepare_core_args(&args, &cmd_args, &cmd_args_len, &allocated_strings, &allocated_count);
+    uintptr_t*           cmd_args     = NULL;
+    unsigned long*       cmd_args_len = NULL;
+    int                  arg_count    = 0;
+    int                  result       = 0;
+    valkey_glide_arena_t arena;
+
+    valkey_glide_arena_init(&arena);
+    args.arena = &arena;
+
+    arg_count = prepare_core_args(&args, &cmd_args, &cmd_args_len);
     if (arg_count >= 0) {
         CommandResult* cmd_result =
             execute_command(args.glide_client, args.cmd_type, arg_count, cmd_args, cmd_args_len);
@@ -1668,7 +1779,7 @@ int execute_unlink_array(const void* glide_client,
         }
     }
     zval_ptr_dtor(&keys_array);
-    free_core_args(cmd_args, cmd_args_len, allocated_strings, allocated_count);
+    free_core_args(&args);
     return result;
 }
 
@@ -1875,14 +1986,16 @@ int execute_pttl_command(zval* object, int argc, zval* return_value, zend_class_
 /* Execute a GETSET command using the Valkey Glide client - UNIFIED IMPLEMENTATION */
 int execute_getset_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
-    char *               key = NULL, *val = NULL;
-    size_t               key_len, val_len;
+    char*                key = NULL;
+    size_t               key_len;
+    zval*                z_value;
+    zend_string*         packed;
     char*                response     = NULL;
     size_t               response_len = 0;
 
     /* Parse parameters */
-    if (zend_parse_method_parameters(
-            argc, object, "Oss", &object, ce, &key, &key_len, &val, &val_len) == FAILURE) {
+    if (zend_parse_method_parameters(argc, object, "Osz", &object, ce, &key, &key_len, &z_value) ==
+        FAILURE) {
         return 0;
     }
 
@@ -1892,6 +2005,11 @@ int execute_getset_command(zval* object, int argc, zval* return_value, zend_clas
         return 0;
     }
 
+    packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+    if (!packed) {
+        return 0;
+    }
+
     /* Create a zval array for the GET option */
     zval z_opts;
     array_init(&z_opts);
@@ -1901,13 +2019,14 @@ int execute_getset_command(zval* object, int argc, zval* return_value, zend_clas
     int result = execute_set_command_internal(valkey_glide,
                                               key,
                                               key_len,
-                                              val,
-                                              val_len,
+                                              ZSTR_VAL(packed),
+                                              ZSTR_LEN(packed),
                                               0,       /* No expiry */
                                               &z_opts, /* Use GET option */
                                               &response,
                                               &response_len,
                                               return_value);
+    zend_string_release(packed);
 
     /* Free the zval array */
     zval_dtor(&z_opts);
@@ -2091,12 +2210,9 @@ int execute_lcs_command(zval* object, int argc, zval* return_value, zend_class_e
         arg_count++;
 
         /* Add the minmatchlen value */
-        size_t minmatchlen_len;
-        minmatchlen_len =
-            snprintf(minmatchlen_str, sizeof(minmatchlen_str), "%ld", minmatchlen_value);
-        minmatchlen_str[minmatchlen_len] = '\0';
-        args[arg_count]                  = (uintptr_t) minmatchlen_str;
-        args_len[arg_count]              = minmatchlen_len;
+        size_t minmatchlen_len = valkey_glide_format_long(minmatchlen_str, minmatchlen_value);
+        args[arg_count]        = (uintptr_t) minmatchlen_str;
+        args_len[arg_count]    = minmatchlen_len;
         arg_count++;
     }
 
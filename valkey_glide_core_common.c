@@ -21,7 +21,10 @@
 #include <string.h>
 
 #include "logger.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_numeric.h"
 #include "valkey_glide_otel.h"
+#include "valkey_glide_serializer.h"
 #include "valkey_glide_z_common.h"
 
 /* ====================================================================
@@ -57,23 +60,27 @@ int execute_core_command(valkey_glide_object* valkey_glide,
                          args->cmd_type,
                          valkey_glide->is_in_batch_mode ? "yes" : "no");
 
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* cmd_args_len      = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            res               = 0;
-    CommandResult* result            = NULL;
+    uintptr_t*           cmd_args     = NULL;
+    unsigned long*       cmd_args_len = NULL;
+    int                  arg_count    = 0;
+    int                  res          = 0;
+    CommandResult*       result       = NULL;
+    valkey_glide_arena_t arena;
 
-    debug_print_core_args(args);
+    if (VALKEY_LOG_ENABLED(VALKEY_LOG_LEVEL_DEBUG)) {
+        debug_print_core_args(args);
+    }
+
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
 
     /* Prepare command arguments based on command type */
     VALKEY_LOG_DEBUG("command_execution", "Preparing command arguments");
-    arg_count =
-        prepare_core_args(args, &cmd_args, &cmd_args_len, &allocated_strings, &allocated_count);
+    arg_count = prepare_core_args(args, &cmd_args, &cmd_args_len);
 
     if (arg_count < 0) {
         VALKEY_LOG_ERROR("execute_core_command", "Failed to prepare command arguments");
+        free_core_args(args);
         efree(result_ptr);
         return 0;
     }
@@ -85,16 +92,16 @@ int execute_core_command(valkey_glide_object* valkey_glide,
         /* Create batch-compatible processor wrapper */
         VALKEY_LOG_DEBUG("command_execution", "Entering batch mode execution");
 
-        res = buffer_command_for_batch(valkey_glide,
-                                       args->cmd_type,
-                                       cmd_args,
-                                       cmd_args_len,
-                                       arg_count,
-
-                                       result_ptr,
-                                       processor);
+        res = buffer_routed_command_for_batch(valkey_glide,
+                                              args->cmd_type,
+                                              cmd_args,
+                                              cmd_args_len,
+                                              arg_count,
+                                              args->has_route ? args->route_param : NULL,
+                                              result_ptr,
+                                              processor);
 
-        free_core_args(cmd_args, cmd_args_len, allocated_strings, allocated_count);
+        free_core_args(args);
         if (res == 0) {
             VALKEY_LOG_WARN_FMT("batch_execution",
                                 "Failed to buffer command for batch - command type: %d",
@@ -118,12 +125,29 @@ int execute_core_command(valkey_glide_object* valkey_glide,
                                             cmd_args_len,
                                             args->route_param);
     } else {
-        /* Non-cluster mode or no routing */
+        /* Non-cluster mode or no routing; repeated reads may be answered by the near cache */
+        if (valkey_glide_near_cache_fetch(valkey_glide->near_cache,
+                                          args->cmd_type,
+                                          cmd_args,
+                                          cmd_args_len,
+                                          arg_count,
+                                          result_ptr,
+                                          processor,
+                                          return_value,
+                                          &res)) {
+            free_core_args(args);
+            return res;
+        }
+
         result =
             execute_command(args->glide_client, args->cmd_type, arg_count, cmd_args, cmd_args_len);
+        valkey_glide_near_cache_store(
+            valkey_glide->near_cache, args->cmd_type, cmd_args, cmd_args_len, arg_count, result);
     }
 
-    debug_print_command_result(result);
+    if (VALKEY_LOG_ENABLED(VALKEY_LOG_LEVEL_DEBUG)) {
+        debug_print_command_result(result);
+    }
 
     /* Process result using appropriate handler */
     VALKEY_LOG_DEBUG("command_execution", "Processing command result");
@@ -146,7 +170,7 @@ int execute_core_command(valkey_glide_object* valkey_glide,
     }
 
     /* Cleanup */
-    free_core_args(cmd_args, cmd_args_len, allocated_strings, allocated_count);
+    free_core_args(args);
 
     return res;
 }
@@ -156,9 +180,7 @@ int execute_core_command(valkey_glide_object* valkey_glide,
  */
 int prepare_core_args(core_command_args_t* args,
                       uintptr_t**          cmd_args,
-                      unsigned long**      cmd_args_len,
-                      char***              allocated_strings,
-                      int*                 allocated_count) {
+                      unsigned long**      cmd_args_len) {
     if (!args) {
         return 0;
     }
@@ -189,8 +211,7 @@ int prepare_core_args(core_command_args_t* args,
 
         /* Pattern-based operations */
         case Keys:
-            return prepare_message_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_message_args(args, cmd_args, cmd_args_len);
 
         /* Zero-argument operations */
         case UnWatch:
@@ -215,8 +236,9 @@ int prepare_core_args(core_command_args_t* args,
         case IncrByFloat:
         case Move:
         case Copy:
-            return prepare_key_value_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+        case Publish:
+        case SPublish:
+            return prepare_key_value_args(args, cmd_args, cmd_args_len);
 
         /* DEL and UNLINK: Support both single-key and multi-key operations */
         case Del:
@@ -252,8 +274,7 @@ int prepare_core_args(core_command_args_t* args,
         /* HyperLogLog operations */
         case PfAdd:
         case PfMerge:
-            return prepare_key_value_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_key_value_args(args, cmd_args, cmd_args_len);
 
         /* Bit operations */
         case BitCount:
@@ -261,22 +282,19 @@ int prepare_core_args(core_command_args_t* args,
         case GetBit:
         case SetBit:
         case BitOp:
-            return prepare_bit_operation_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_bit_operation_args(args, cmd_args, cmd_args_len);
 
         /* Expire operations */
         case Expire:
         case ExpireAt:
         case PExpire:
         case PExpireAt:
-            return prepare_expire_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_expire_args(args, cmd_args, cmd_args_len);
 
         /* Range operations */
         case GetRange:
         case SetRange:
-            return prepare_range_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_range_args(args, cmd_args, cmd_args_len);
 
         /* Message operations (no key, just arguments) */
         case Ping:
@@ -286,14 +304,12 @@ int prepare_core_args(core_command_args_t* args,
         case FlushAll:
         case Select:
         case SwapDb:
-            return prepare_message_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_message_args(args, cmd_args, cmd_args_len);
 
         /* Key-value pair operations */
         case MSet:
         case MSetNX:
-            return prepare_key_value_pairs_args(
-                args, cmd_args, cmd_args_len, allocated_strings, allocated_count);
+            return prepare_key_value_pairs_args(args, cmd_args, cmd_args_len);
 
         default:
             return 0;
@@ -301,21 +317,12 @@ int prepare_core_args(core_command_args_t* args,
 }
 
 /**
- * Free all allocated command arguments and strings
+ * Release everything prepare_core_args() placed in the command arena
  */
-void free_core_args(uintptr_t*     cmd_args,
-                    unsigned long* cmd_args_len,
-                    char**         allocated_strings,
-                    int            allocated_count) {
-    if (cmd_args) {
-        efree(cmd_args);
-    }
-    if (cmd_args_len) {
-        efree(cmd_args_len);
-    }
-    if (allocated_strings) {
-        free_tracked_strings(allocated_strings, allocated_count);
-        efree(allocated_strings);
+void free_core_args(core_command_args_t* args) {
+    if (args && args->arena) {
+        valkey_glide_arena_reset(args->arena);
+        args->arena = NULL;
     }
 }
 
@@ -345,7 +352,7 @@ int prepare_key_only_args(core_command_args_t* args,
         return 0;
     }
 
-    if (!allocate_core_arg_arrays(1, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 1, cmd_args, cmd_args_len)) {
         return 0;
     }
 
@@ -360,9 +367,7 @@ int prepare_key_only_args(core_command_args_t* args,
  */
 int prepare_key_value_args(core_command_args_t* args,
                            uintptr_t**          cmd_args,
-                           unsigned long**      cmd_args_len,
-                           char***              allocated_strings,
-                           int*                 allocated_count) {
+                           unsigned long**      cmd_args_len) {
     if (!args->key || args->key_len == 0) {
         return 0;
     }
@@ -409,14 +414,10 @@ int prepare_key_value_args(core_command_args_t* args,
         total_args++; /* PERSIST */
     }
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    /* Initialize string tracking */
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int arg_idx = 0;
 
     /* Add key */
@@ -435,11 +436,11 @@ int prepare_key_value_args(core_command_args_t* args,
 
             case CORE_ARG_TYPE_LONG: {
                 size_t len;
-                char*  str = core_long_to_string(args->args[i].data.long_arg.value, &len);
+                char*  str = valkey_glide_arena_long_to_string(
+                    args->arena, args->args[i].data.long_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -447,11 +448,11 @@ int prepare_key_value_args(core_command_args_t* args,
 
             case CORE_ARG_TYPE_DOUBLE: {
                 size_t len;
-                char*  str = core_double_to_string(args->args[i].data.double_arg.value, &len);
+                char*  str = valkey_glide_arena_double_to_string(
+                    args->arena, args->args[i].data.double_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -473,17 +474,10 @@ int prepare_key_value_args(core_command_args_t* args,
                             /* Convert non-string to string */
                             zend_string* str = zval_get_string(element);
                             if (str) {
-                                size_t len      = ZSTR_LEN(str);
-                                char*  str_copy = emalloc(len + 1);
-                                if (str_copy) {
-                                    memcpy(str_copy, ZSTR_VAL(str), len);
-                                    str_copy[len]            = '\0';
-                                    (*cmd_args)[arg_idx]     = (uintptr_t) str_copy;
-                                    (*cmd_args_len)[arg_idx] = len;
-                                    add_tracked_string(
-                                        *allocated_strings, allocated_count, str_copy);
-                                    arg_idx++;
-                                }
+                                (*cmd_args)[arg_idx] = (uintptr_t) valkey_glide_arena_strndup(
+                                    args->arena, ZSTR_VAL(str), ZSTR_LEN(str));
+                                (*cmd_args_len)[arg_idx] = ZSTR_LEN(str);
+                                arg_idx++;
                                 zend_string_release(str);
                             }
                         }
@@ -506,11 +500,11 @@ int prepare_key_value_args(core_command_args_t* args,
             arg_idx++;
 
             size_t len;
-            char*  str = core_long_to_string(args->options.expire_at_milliseconds, &len);
+            char*  str = valkey_glide_arena_long_to_string(
+                args->arena, args->options.expire_at_milliseconds, &len);
             if (str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, str);
                 arg_idx++;
             }
         } else if (args->options.has_exat) {
@@ -519,11 +513,11 @@ int prepare_key_value_args(core_command_args_t* args,
             arg_idx++;
 
             size_t len;
-            char*  str = core_long_to_string(args->options.expire_at_seconds, &len);
+            char*  str = valkey_glide_arena_long_to_string(
+                args->arena, args->options.expire_at_seconds, &len);
             if (str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, str);
                 arg_idx++;
             }
         } else if (args->options.has_pexpire) {
@@ -532,11 +526,11 @@ int prepare_key_value_args(core_command_args_t* args,
             arg_idx++;
 
             size_t len;
-            char*  str = core_long_to_string(args->options.expire_milliseconds, &len);
+            char*  str = valkey_glide_arena_long_to_string(
+                args->arena, args->options.expire_milliseconds, &len);
             if (str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, str);
                 arg_idx++;
             }
         } else {
@@ -545,11 +539,11 @@ int prepare_key_value_args(core_command_args_t* args,
             arg_idx++;
 
             size_t len;
-            char*  str = core_long_to_string(args->options.expire_seconds, &len);
+            char*  str = valkey_glide_arena_long_to_string(
+                args->arena, args->options.expire_seconds, &len);
             if (str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, str);
                 arg_idx++;
             }
         }
@@ -603,9 +597,7 @@ int prepare_key_value_args(core_command_args_t* args,
  */
 int prepare_message_args(core_command_args_t* args,
                          uintptr_t**          cmd_args,
-                         unsigned long**      cmd_args_len,
-                         char***              allocated_strings,
-                         int*                 allocated_count) {
+                         unsigned long**      cmd_args_len) {
     if (args->arg_count == 0) {
         return 0;
     }
@@ -625,14 +617,10 @@ int prepare_message_args(core_command_args_t* args,
         }
     }
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    /* Initialize string tracking */
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int arg_idx = 0;
 
     /* Add all arguments */
@@ -646,11 +634,11 @@ int prepare_message_args(core_command_args_t* args,
 
             case CORE_ARG_TYPE_LONG: {
                 size_t len;
-                char*  str = core_long_to_string(args->args[i].data.long_arg.value, &len);
+                char*  str = valkey_glide_arena_long_to_string(
+                    args->arena, args->args[i].data.long_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -658,11 +646,11 @@ int prepare_message_args(core_command_args_t* args,
 
             case CORE_ARG_TYPE_DOUBLE: {
                 size_t len;
-                char*  str = core_double_to_string(args->args[i].data.double_arg.value, &len);
+                char*  str = valkey_glide_arena_double_to_string(
+                    args->arena, args->args[i].data.double_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -681,9 +669,7 @@ int prepare_message_args(core_command_args_t* args,
  */
 int prepare_key_value_pairs_args(core_command_args_t* args,
                                  uintptr_t**          cmd_args,
-                                 unsigned long**      cmd_args_len,
-                                 char***              allocated_strings,
-                                 int*                 allocated_count) {
+                                 unsigned long**      cmd_args_len) {
     if (args->arg_count == 0 || args->args[0].type != CORE_ARG_TYPE_ARRAY) {
         return 0;
     }
@@ -703,14 +689,10 @@ int prepare_key_value_pairs_args(core_command_args_t* args,
     /* Each key-value pair requires 2 arguments */
     int total_args = key_count * 2;
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    /* Initialize string tracking */
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int          arg_idx = 0;
     zval*        data;
     zend_string* key;
@@ -721,11 +703,11 @@ int prepare_key_value_pairs_args(core_command_args_t* args,
         if (!key) {
             /* Numeric key - convert to string */
             size_t key_len;
-            char*  key_str = core_long_to_string((long) num_key, &key_len);
+            char*  key_str = valkey_glide_arena_long_to_string(
+                args->arena, (long) num_key, &key_len);
             if (key_str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) key_str;
                 (*cmd_args_len)[arg_idx] = key_len;
-                add_tracked_string(*allocated_strings, allocated_count, key_str);
                 arg_idx++;
             }
         } else {
@@ -735,19 +717,31 @@ int prepare_key_value_pairs_args(core_command_args_t* args,
             arg_idx++;
         }
 
-        /* Add value */
-        if (Z_TYPE_P(data) == IS_STRING) {
-            (*cmd_args)[arg_idx]     = (uintptr_t) Z_STRVAL_P(data);
-            (*cmd_args_len)[arg_idx] = Z_STRLEN_P(data);
+        /* Add value; encoded strings are sent as is and released with the arena */
+        if (args->codec && args->codec->serializer != VALKEY_GLIDE_SERIALIZER_NONE) {
+            zend_string* packed = valkey_glide_pack_value(args->codec, data);
+            size_t       packed_len;
+
+            if (!packed) {
+                return -1;
+            }
+            (*cmd_args)[arg_idx] =
+                (uintptr_t) valkey_glide_arena_keep_string(args->arena, packed, &packed_len);
+            (*cmd_args_len)[arg_idx] = packed_len;
             arg_idx++;
         } else {
-            /* Convert non-string value to string using safe method */
-            zend_string* str = zval_get_string(data);
-            if (str) {
-                (*cmd_args)[arg_idx]     = (uintptr_t) ZSTR_VAL(str);
-                (*cmd_args_len)[arg_idx] = ZSTR_LEN(str);
-                arg_idx++;
+            size_t       value_len;
+            char*        value;
+            zend_string* compressed;
+
+            value      = valkey_glide_arena_zval_to_string(args->arena, data, &value_len);
+            compressed = valkey_glide_compress_value(args->codec, value, value_len);
+            if (compressed) {
+                value = valkey_glide_arena_keep_string(args->arena, compressed, &value_len);
             }
+            (*cmd_args)[arg_idx]     = (uintptr_t) value;
+            (*cmd_args_len)[arg_idx] = value_len;
+            arg_idx++;
         }
     }
     ZEND_HASH_FOREACH_END();
@@ -768,7 +762,7 @@ int prepare_multi_key_args(core_command_args_t* args,
     zval* keys      = args->args[0].data.array_arg.array;
     int   key_count = args->args[0].data.array_arg.count;
 
-    if (!allocate_core_arg_arrays(key_count, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, key_count, cmd_args, cmd_args_len)) {
         return 0;
     }
 
@@ -794,9 +788,7 @@ int prepare_multi_key_args(core_command_args_t* args,
  */
 int prepare_bit_operation_args(core_command_args_t* args,
                                uintptr_t**          cmd_args,
-                               unsigned long**      cmd_args_len,
-                               char***              allocated_strings,
-                               int*                 allocated_count) {
+                               unsigned long**      cmd_args_len) {
     if (!args->key || args->key_len == 0) {
         return 0;
     }
@@ -831,13 +823,10 @@ int prepare_bit_operation_args(core_command_args_t* args,
             return 0;
     }
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int arg_idx = 0;
 
     /* Handle BitOp differently - operation comes first */
@@ -868,16 +857,10 @@ int prepare_bit_operation_args(core_command_args_t* args,
                         /* Convert non-string to string */
                         zend_string* str = zval_get_string(element);
                         if (str) {
-                            size_t len      = ZSTR_LEN(str);
-                            char*  str_copy = emalloc(len + 1);
-                            if (str_copy) {
-                                memcpy(str_copy, ZSTR_VAL(str), len);
-                                str_copy[len]            = '\0';
-                                (*cmd_args)[arg_idx]     = (uintptr_t) str_copy;
-                                (*cmd_args_len)[arg_idx] = len;
-                                add_tracked_string(*allocated_strings, allocated_count, str_copy);
-                                arg_idx++;
-                            }
+                            (*cmd_args)[arg_idx] = (uintptr_t) valkey_glide_arena_strndup(
+                                args->arena, ZSTR_VAL(str), ZSTR_LEN(str));
+                            (*cmd_args_len)[arg_idx] = ZSTR_LEN(str);
+                            arg_idx++;
                             zend_string_release(str);
                         }
                     }
@@ -896,11 +879,11 @@ int prepare_bit_operation_args(core_command_args_t* args,
             switch (args->args[i].type) {
                 case CORE_ARG_TYPE_LONG: {
                     size_t len;
-                    char*  str = core_long_to_string(args->args[i].data.long_arg.value, &len);
+                    char*  str = valkey_glide_arena_long_to_string(
+                        args->arena, args->args[i].data.long_arg.value, &len);
                     if (str) {
                         (*cmd_args)[arg_idx]     = (uintptr_t) str;
                         (*cmd_args_len)[arg_idx] = len;
-                        add_tracked_string(*allocated_strings, allocated_count, str);
                         arg_idx++;
                     }
                     break;
@@ -913,19 +896,18 @@ int prepare_bit_operation_args(core_command_args_t* args,
         /* Add range arguments if present */
         if (args->options.has_range) {
             size_t len;
-            char*  start_str = core_long_to_string(args->options.start, &len);
+            char*  start_str = valkey_glide_arena_long_to_string(
+                args->arena, args->options.start, &len);
             if (start_str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) start_str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, start_str);
                 arg_idx++;
             }
 
-            char* end_str = core_long_to_string(args->options.end, &len);
+            char* end_str = valkey_glide_arena_long_to_string(args->arena, args->options.end, &len);
             if (end_str) {
                 (*cmd_args)[arg_idx]     = (uintptr_t) end_str;
                 (*cmd_args_len)[arg_idx] = len;
-                add_tracked_string(*allocated_strings, allocated_count, end_str);
                 arg_idx++;
             }
         }
@@ -946,9 +928,7 @@ int prepare_bit_operation_args(core_command_args_t* args,
  */
 int prepare_expire_args(core_command_args_t* args,
                         uintptr_t**          cmd_args,
-                        unsigned long**      cmd_args_len,
-                        char***              allocated_strings,
-                        int*                 allocated_count) {
+                        unsigned long**      cmd_args_len) {
     if (!args->key || args->key_len == 0 || args->arg_count == 0) {
         return 0;
     }
@@ -956,13 +936,10 @@ int prepare_expire_args(core_command_args_t* args,
     /* Calculate total arguments: key + time + optional mode */
     int total_args = 1 + args->arg_count; /* key + all provided arguments */
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int arg_idx = 0;
 
     /* Add key */
@@ -975,11 +952,11 @@ int prepare_expire_args(core_command_args_t* args,
         switch (args->args[i].type) {
             case CORE_ARG_TYPE_LONG: {
                 size_t len;
-                char*  str = core_long_to_string(args->args[i].data.long_arg.value, &len);
+                char*  str = valkey_glide_arena_long_to_string(
+                    args->arena, args->args[i].data.long_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -1002,9 +979,7 @@ int prepare_expire_args(core_command_args_t* args,
  */
 int prepare_range_args(core_command_args_t* args,
                        uintptr_t**          cmd_args,
-                       unsigned long**      cmd_args_len,
-                       char***              allocated_strings,
-                       int*                 allocated_count) {
+                       unsigned long**      cmd_args_len) {
     if (!args->key || args->key_len == 0) {
         return 0;
     }
@@ -1023,13 +998,10 @@ int prepare_range_args(core_command_args_t* args,
             return 0;
     }
 
-    if (!allocate_core_arg_arrays(total_args, cmd_args, cmd_args_len)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, cmd_args, cmd_args_len)) {
         return 0;
     }
 
-    *allocated_strings = create_string_tracker(total_args);
-    *allocated_count   = 0;
-
     int arg_idx = 0;
 
     /* Add key */
@@ -1042,11 +1014,11 @@ int prepare_range_args(core_command_args_t* args,
         switch (args->args[i].type) {
             case CORE_ARG_TYPE_LONG: {
                 size_t len;
-                char*  str = core_long_to_string(args->args[i].data.long_arg.value, &len);
+                char*  str = valkey_glide_arena_long_to_string(
+                    args->arena, args->args[i].data.long_arg.value, &len);
                 if (str) {
                     (*cmd_args)[arg_idx]     = (uintptr_t) str;
                     (*cmd_args_len)[arg_idx] = len;
-                    add_tracked_string(*allocated_strings, allocated_count, str);
                     arg_idx++;
                 }
                 break;
@@ -1077,7 +1049,8 @@ int process_core_array_result(CommandResponse* response, void* output, zval* ret
         return 0;
     }
 
-    return command_response_to_zval(response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, true);
+    return command_response_to_string_list(
+        NULL, response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, true);
 }
 
 /**
@@ -1155,90 +1128,18 @@ int process_core_type_result(CommandResponse* response, void* output, zval* retu
  * MEMORY MANAGEMENT UTILITIES
  * ==================================================================== */
 
-/**
- * Allocate command argument arrays
- */
-int allocate_core_arg_arrays(int count, uintptr_t** args_out, unsigned long** args_len_out) {
-    *args_out = (uintptr_t*) emalloc(count * sizeof(uintptr_t));
-    if (!*args_out) {
-        VALKEY_LOG_ERROR("memory_allocation",
-                         "Failed to allocate memory for command arguments array");
-        return 0;
-    }
-
-    *args_len_out = (unsigned long*) emalloc(count * sizeof(unsigned long));
-    if (!*args_len_out) {
-        VALKEY_LOG_ERROR("memory_allocation",
-                         "Failed to allocate memory for command arguments length array");
-        efree(*args_out);
-        return 0;
-    }
-
-    return 1;
-}
-
-
-/**
- * Create string tracker for memory management
- */
-char** create_string_tracker(int max_strings) {
-    char** tracker = (char**) ecalloc(max_strings, sizeof(char*));
-    if (!tracker) {
-        VALKEY_LOG_ERROR("memory_allocation", "Failed to allocate memory for string tracker");
-    }
-    return tracker;
-}
-
-/**
- * Add string to tracker
- */
-void add_tracked_string(char** tracker, int* count, char* str) {
-    if (tracker && str) {
-        tracker[*count] = str;
-        (*count)++;
-    }
-}
-
-/**
- * Free all tracked strings
- */
-void free_tracked_strings(char** tracker, int count) {
-    if (!tracker)
-        return;
-
-    for (int i = 0; i < count; i++) {
-        if (tracker[i]) {
-            efree(tracker[i]);
-        }
-    }
-}
-
 /**
  * Convert long to string
  */
 char* core_long_to_string(long value, size_t* len) {
-    char buffer[32];
-    *len      = snprintf(buffer, sizeof(buffer), "%ld", value);
-    char* str = (char*) emalloc(*len + 1);
-    if (str) {
-        memcpy(str, buffer, *len);
-        str[*len] = '\0';
-    }
-    return str;
+    return valkey_glide_long_estrdup(value, len);
 }
 
 /**
  * Convert double to string
  */
 char* core_double_to_string(double value, size_t* len) {
-    char buffer[64];
-    *len      = snprintf(buffer, sizeof(buffer), "%.6g", value);
-    char* str = (char*) emalloc(*len + 1);
-    if (str) {
-        memcpy(str, buffer, *len);
-        str[*len] = '\0';
-    }
-    return str;
+    return valkey_glide_double_estrdup(value, len);
 }
 
 /* ====================================================================
@@ -1521,45 +1422,14 @@ int process_core_int_result(CommandResponse* response, void* output, zval* retur
  * Batch-compatible wrapper for string results
  */
 int process_core_string_result(CommandResponse* response, void* output, zval* return_value) {
-    char*  result = NULL;
-    size_t result_len;
-
-
     if (!response) {
         ZVAL_NULL(return_value);
         return 0;
     }
 
     if (response->response_type == String) {
-        if (response->string_value_len == 0) {
-            result = emalloc(1);
-            if (!result) {
-                VALKEY_LOG_ERROR("memory_allocation",
-                                 "Failed to allocate memory for empty string result");
-                ZVAL_NULL(return_value);
-                return 0;
-            }
-            result[0]  = '\0';
-            result_len = 0;
-        } else {
-            result = emalloc(response->string_value_len + 1);
-            if (!result) {
-                VALKEY_LOG_ERROR("memory_allocation",
-                                 "Failed to allocate memory for string result");
-                ZVAL_NULL(return_value);
-                return 0;
-            }
-            memcpy(result, response->string_value, response->string_value_len);
-            result[response->string_value_len] = '\0';
-            result_len                         = response->string_value_len;
-        }
-        if (result) {
-            ZVAL_STRINGL(return_value, result, result_len);
-            efree(result);
-        } else {
-            ZVAL_NULL(return_value);
-        }
-
+        /* Single copy from the FFI buffer straight into the returned zend_string */
+        ZVAL_STR(return_value, command_response_to_zend_string(response));
         return 1;
     } else if (response->response_type == Null) {
         ZVAL_FALSE(return_value);
@@ -1571,6 +1441,35 @@ int process_core_string_result(CommandResponse* response, void* output, zval* re
     return 0;
 }
 
+/**
+ * String result processor for values, decoded with the client's codec
+ */
+int process_core_value_result(CommandResponse* response, void* output, zval* return_value) {
+    const valkey_glide_codec_t* codec = valkey_glide_codec_context_take(output);
+
+    if (!codec || !response || response->response_type != String) {
+        return process_core_string_result(response, NULL, return_value);
+    }
+
+    valkey_glide_decode_value(
+        codec, response->string_value, response->string_value_len, return_value);
+    return 1;
+}
+
+/**
+ * Array result processor for values, decoded with the client's codec
+ */
+int process_core_values_result(CommandResponse* response, void* output, zval* return_value) {
+    const valkey_glide_codec_t* codec = valkey_glide_codec_context_take(output);
+
+    if (!response || !return_value) {
+        return 0;
+    }
+
+    return command_response_to_string_list(
+        codec, response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, true);
+}
+
 /**
  * Batch-compatible wrapper for boolean results
  */
@@ -1680,12 +1579,29 @@ int execute_multi_key_command(valkey_glide_object* valkey_glide,
     return result;
 }
 
+/**
+ * Fetch the object of a command that sends its own batch, refusing to run
+ * inside MULTI/PIPELINE. `what` names the commands in the warning.
+ */
+valkey_glide_object* get_unbatched_client(zval* object, const char* what) {
+    valkey_glide_object* valkey_glide =
+        VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return NULL;
+    }
+    if (valkey_glide->is_in_batch_mode) {
+        php_error_docref(NULL, E_WARNING, "%s cannot be used inside MULTI or PIPELINE", what);
+        return NULL;
+    }
+    return valkey_glide;
+}
+
 
 /* ====================================================================
- * DEBUG FUNCTIONS (only in debug builds)
+ * DEBUG FUNCTIONS (logged at debug level)
  * ==================================================================== */
 
-#ifdef DEBUG_VALKEY_GLIDE_PHP
 void debug_print_core_args(core_command_args_t* args) {
     if (!args) {
         VALKEY_LOG_ERROR("debug_core_args", "core_args is NULL");
@@ -1755,14 +1671,14 @@ void debug_print_command_result(CommandResult* result) {
         switch (result->response->response_type) {
             case Int:
                 VALKEY_LOG_DEBUG_FMT(
-                    "debug_command_result", "  int_value: %ld", result->response->int_value);
+                    "debug_command_result", "  int_value: %ld", (long) result->response->int_value);
                 break;
             case String:
                 VALKEY_LOG_DEBUG_FMT("debug_command_result",
                                      "  string_value: %.*s (len: %ld)",
                                      (int) result->response->string_value_len,
                                      result->response->string_value,
-                                     result->response->string_value_len);
+                                     (long) result->response->string_value_len);
                 break;
             case Bool:
                 VALKEY_LOG_DEBUG_FMT("debug_command_result",
@@ -1781,37 +1697,11 @@ void debug_print_command_result(CommandResult* result) {
         VALKEY_LOG_DEBUG("debug_command_result", "  response: NULL");
     }
 }
-#endif
 
 char* safe_format_int(int value, size_t* len_out) {
-    int   required_size = snprintf(NULL, 0, "%d", value) + 1;
-    char* str           = (char*) emalloc(required_size);
-    int   actual_len    = snprintf(str, required_size, "%d", value);
-    if (len_out)
-        *len_out = actual_len;
-    return str;
+    return valkey_glide_long_estrdup(value, len_out);
 }
 
 char* safe_format_long_long(long long value, size_t* len_out) {
-    int   required_size = snprintf(NULL, 0, "%lld", value) + 1;
-    char* str           = (char*) emalloc(required_size);
-    int   actual_len    = snprintf(str, required_size, "%lld", value);
-    if (len_out)
-        *len_out = actual_len;
-    return str;
-}
-
-void add_string_arg(char*           str,
-                    size_t          len,
-                    uintptr_t**     args_out,
-                    unsigned long** args_len_out,
-                    int*            arg_idx,
-                    char***         allocated_strings,
-                    int*            allocated_count) {
-    if (str && args_out && args_len_out && arg_idx) {
-        (*args_out)[*arg_idx]     = (uintptr_t) str;
-        (*args_len_out)[*arg_idx] = len;
-        add_tracked_string(*allocated_strings, allocated_count, str);
-        (*arg_idx)++;
-    }
+    return valkey_glide_long_estrdup((zend_long) value, len_out);
 }
@@ -18,6 +18,7 @@
 #define VALKEY_GLIDE_CORE_COMMON_H
 
 #include "command_response.h"
+#include "valkey_glide_arena.h"
 #include "valkey_glide_commands_common.h"
 
 /* ====================================================================
@@ -127,6 +128,12 @@ typedef struct {
     /* Options */
     core_options_t options;
     zval*          raw_options; /* Raw PHP options array for complex parsing */
+
+    /* Per-command allocations made while preparing FFI arguments */
+    valkey_glide_arena_t* arena;
+
+    /* Value encoding applied by prepare_key_value_pairs_args(), NULL for none */
+    const struct valkey_glide_codec* codec;
 } core_command_args_t;
 
 /* ====================================================================
@@ -143,14 +150,10 @@ int execute_core_command(valkey_glide_object* valkey_glide,
 /* Command argument preparation utilities */
 int prepare_core_args(core_command_args_t* args,
                       uintptr_t**          cmd_args,
-                      unsigned long**      cmd_args_len,
-                      char***              allocated_strings,
-                      int*                 allocated_count);
+                      unsigned long**      cmd_args_len);
 
-void free_core_args(uintptr_t*     cmd_args,
-                    unsigned long* cmd_args_len,
-                    char**         allocated_strings,
-                    int            allocated_count);
+/* Release the per-command arena used by prepare_core_args */
+void free_core_args(core_command_args_t* args);
 
 /* ====================================================================
  * ARGUMENT PREPARATION HELPERS
@@ -164,22 +167,16 @@ int prepare_key_only_args(core_command_args_t* args,
 /* Key-value operations */
 int prepare_key_value_args(core_command_args_t* args,
                            uintptr_t**          cmd_args,
-                           unsigned long**      cmd_args_len,
-                           char***              allocated_strings,
-                           int*                 allocated_count);
+                           unsigned long**      cmd_args_len);
 
 int prepare_key_value_pairs_args(core_command_args_t* args,
                                  uintptr_t**          cmd_args,
-                                 unsigned long**      cmd_args_len,
-                                 char***              allocated_strings,
-                                 int*                 allocated_count);
+                                 unsigned long**      cmd_args_len);
 
 /* Message operations (no key, just arguments) */
 int prepare_message_args(core_command_args_t* args,
                          uintptr_t**          cmd_args,
-                         unsigned long**      cmd_args_len,
-                         char***              allocated_strings,
-                         int*                 allocated_count);
+                         unsigned long**      cmd_args_len);
 
 /* Multi-key operations */
 int prepare_multi_key_args(core_command_args_t* args,
@@ -189,23 +186,17 @@ int prepare_multi_key_args(core_command_args_t* args,
 /* Bit operations */
 int prepare_bit_operation_args(core_command_args_t* args,
                                uintptr_t**          cmd_args,
-                               unsigned long**      cmd_args_len,
-                               char***              allocated_strings,
-                               int*                 allocated_count);
+                               unsigned long**      cmd_args_len);
 
 /* Expire operations */
 int prepare_expire_args(core_command_args_t* args,
                         uintptr_t**          cmd_args,
-                        unsigned long**      cmd_args_len,
-                        char***              allocated_strings,
-                        int*                 allocated_count);
+                        unsigned long**      cmd_args_len);
 
 /* Range operations */
 int prepare_range_args(core_command_args_t* args,
                        uintptr_t**          cmd_args,
-                       unsigned long**      cmd_args_len,
-                       char***              allocated_strings,
-                       int*                 allocated_count);
+                       unsigned long**      cmd_args_len);
 
 int prepare_zero_args(core_command_args_t* args,
                       uintptr_t**          cmd_args,
@@ -227,6 +218,11 @@ int process_core_bool_result(CommandResponse* response, void* output, zval* retu
 /* Array result processor */
 int process_core_array_result(CommandResponse* response, void* output, zval* return_value);
 
+/* Value result processors; output is a codec context or NULL, see
+ * valkey_glide_codec_context_new() */
+int process_core_value_result(CommandResponse* response, void* output, zval* return_value);
+int process_core_values_result(CommandResponse* response, void* output, zval* return_value);
+
 /* Double result processor */
 int process_core_double_result(CommandResponse* response, void* output, zval* return_value);
 
@@ -241,14 +237,6 @@ int process_info_result(CommandResponse* response, void* output, zval* return_va
  * MEMORY MANAGEMENT UTILITIES
  * ==================================================================== */
 
-/* Allocate command argument arrays */
-int allocate_core_arg_arrays(int count, uintptr_t** args_out, unsigned long** args_len_out);
-
-/* Track allocated strings for cleanup */
-char** create_string_tracker(int max_strings);
-void   add_tracked_string(char** tracker, int* count, char* str);
-void   free_tracked_strings(char** tracker, int count);
-
 /* Convert various types to string arguments */
 char* core_long_to_string(long value, size_t* len);
 char* core_double_to_string(double value, size_t* len);
@@ -277,22 +265,16 @@ int execute_multi_key_command(valkey_glide_object* valkey_glide,
                               zval*                object,
                               zval*                return_value);
 
+/* Object of a command that sends its own batch; warns and returns NULL inside MULTI/PIPELINE */
+valkey_glide_object* get_unbatched_client(zval* object, const char* what);
+
 /* ====================================================================
  * ERROR HANDLING AND DEBUGGING
  * ==================================================================== */
 
-/* Debug helpers (only active in debug builds) */
-#ifdef DEBUG
+/* Debug helpers; callers check VALKEY_LOG_ENABLED(VALKEY_LOG_LEVEL_DEBUG) first */
 void debug_print_core_args(core_command_args_t* args);
 void debug_print_command_result(CommandResult* result);
-#else
-#define debug_print_core_args(args) \
-    do {                            \
-    } while (0)
-#define debug_print_command_result(result) \
-    do {                                   \
-    } while (0)
-#endif
 
 /**
  * Safely allocate and format an integer as a string
@@ -306,18 +288,6 @@ char* safe_format_int(int value, size_t* len_out);
  */
 char* safe_format_long_long(long long value, size_t* len_out);
 
-/**
- * Add string to args array and track for cleanup
- * Combines add_tracked_string with argument array population
- */
-void add_string_arg(char*           str,
-                    size_t          len,
-                    uintptr_t**     args_out,
-                    unsigned long** args_len_out,
-                    int*            arg_idx,
-                    char***         allocated_strings,
-                    int*            allocated_count);
-
 /**
  * Execute update_connection_password command
  */
@@ -0,0 +1,448 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_future.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zend_exceptions.h>
+
+#include "command_response.h"
+#include "logger.h"
+#include "valkey_glide_arena.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_future_arginfo.h"
+
+/* Global variables */
+zend_class_entry*           valkey_glide_future_ce;
+static zend_object_handlers valkey_glide_future_object_handlers;
+
+/*
+ * Completion signalling between the core's callback threads and PHP.
+ * One mutex/condition pair serves every async connection in the process:
+ * waiters re-check their own request after each broadcast.
+ */
+static pthread_mutex_t async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  async_cond  = PTHREAD_COND_INITIALIZER;
+
+static void async_request_release(valkey_glide_async_request_t* request) {
+    if (request->response) {
+        free_command_response(request->response);
+    }
+    free(request->error_message);
+    free(request);
+}
+
+/* Store a completion; runs on a core thread, so it must not touch the Zend engine */
+static void async_request_complete(valkey_glide_async_request_t* request,
+                                   const CommandResponse*        response,
+                                   char*                         error_message) {
+    pthread_mutex_lock(&async_mutex);
+    request->response      = (CommandResponse*) response;
+    request->error_message = error_message;
+    request->done          = true;
+
+    if (request->abandoned) {
+        pthread_mutex_unlock(&async_mutex);
+        async_request_release(request);
+        return;
+    }
+
+    pthread_cond_broadcast(&async_cond);
+    pthread_mutex_unlock(&async_mutex);
+}
+
+static void async_success_callback(uintptr_t index_ptr, const CommandResponse* message) {
+    async_request_complete((valkey_glide_async_request_t*) index_ptr, message, NULL);
+}
+
+static void async_failure_callback(uintptr_t        index_ptr,
+                                   const char*      error_message,
+                                   RequestErrorType error_type) {
+    char* copy = strdup(error_message ? error_message : "Unknown error");
+
+    (void) error_type;
+    free_error_message((char*) error_message);
+    async_request_complete((valkey_glide_async_request_t*) index_ptr, NULL, copy);
+}
+
+valkey_glide_async_request_t* valkey_glide_async_request_new(void) {
+    return calloc(1, sizeof(valkey_glide_async_request_t));
+}
+
+void valkey_glide_async_request_wait(valkey_glide_async_request_t* request) {
+    pthread_mutex_lock(&async_mutex);
+    while (!request->done) {
+        pthread_cond_wait(&async_cond, &async_mutex);
+    }
+    pthread_mutex_unlock(&async_mutex);
+}
+
+size_t valkey_glide_async_request_wait_any(valkey_glide_async_request_t** requests, size_t count) {
+    size_t i;
+
+    pthread_mutex_lock(&async_mutex);
+    for (;;) {
+        for (i = 0; i < count; i++) {
+            if (requests[i]->done) {
+                pthread_mutex_unlock(&async_mutex);
+                return i;
+            }
+        }
+        pthread_cond_wait(&async_cond, &async_mutex);
+    }
+}
+
+void valkey_glide_async_request_drop(valkey_glide_async_request_t* request) {
+    pthread_mutex_lock(&async_mutex);
+    if (request->done) {
+        pthread_mutex_unlock(&async_mutex);
+        async_request_release(request);
+    } else {
+        /* The reply is still on its way, let the callback free it */
+        request->abandoned = true;
+        pthread_mutex_unlock(&async_mutex);
+    }
+}
+
+const void* valkey_glide_get_async_client(valkey_glide_object* valkey_glide) {
+    if (valkey_glide->async_client || !valkey_glide->connection_request) {
+        return valkey_glide->async_client;
+    }
+
+    ClientType client_type;
+    client_type.tag                           = AsyncClient;
+    client_type.async_client.success_callback = async_success_callback;
+    client_type.async_client.failure_callback = async_failure_callback;
+
+    const ConnectionResponse* conn_resp = create_client(valkey_glide->connection_request,
+                                                        valkey_glide->connection_request_len,
+                                                        &client_type,
+                                                        NULL /* No PubSub callback */
+    );
+
+    if (conn_resp->connection_error_message) {
+        VALKEY_LOG_ERROR("async_client", conn_resp->connection_error_message);
+    } else {
+        VALKEY_LOG_DEBUG("async_client", "Opened async connection");
+        valkey_glide->async_client = conn_resp->conn_ptr;
+    }
+
+    free_connection_response((ConnectionResponse*) conn_resp);
+    return valkey_glide->async_client;
+}
+
+/* Dispatch a command on the async connection and wrap it in a ValkeyGlideFuture */
+static int dispatch_async_command(zval*                        object,
+                                  enum RequestType             command_type,
+                                  unsigned long                arg_count,
+                                  const uintptr_t*             args,
+                                  const unsigned long*         args_len,
+                                  valkey_glide_future_result_t result_type,
+                                  zval*                        return_value) {
+    valkey_glide_object* valkey_glide =
+        VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    const void* async_client = valkey_glide_get_async_client(valkey_glide);
+    if (!async_client) {
+        return 0;
+    }
+
+    valkey_glide_async_request_t* request = valkey_glide_async_request_new();
+    if (!request) {
+        return 0;
+    }
+
+    /* The request address is the callback index handed back to the callbacks */
+    CommandResult* result = command(async_client,
+                                    (uintptr_t) request, /* callback index */
+                                    command_type,        /* command type */
+                                    arg_count,           /* number of arguments */
+                                    args,                /* arguments */
+                                    args_len,            /* argument lengths */
+                                    NULL,                /* route bytes */
+                                    0,                   /* route bytes length */
+                                    0                    /* span pointer */
+    );
+
+    /* Async connections report through the callbacks; a direct result means it was rejected */
+    if (result) {
+        VALKEY_LOG_ERROR("async_command", "Async command was rejected by the client");
+        free_command_result(result);
+        free(request);
+        return 0;
+    }
+
+    object_init_ex(return_value, valkey_glide_future_ce);
+    valkey_glide_future_object* future = VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(return_value);
+
+    future->request     = request;
+    future->result_type = result_type;
+    ZVAL_COPY(&future->client, object);
+    return 1;
+}
+
+/* Wait for the reply of a future and convert it, once */
+static zval* future_resolve(valkey_glide_future_object* future) {
+    valkey_glide_async_request_t* request = future->request;
+
+    if (!Z_ISUNDEF(future->value)) {
+        return &future->value;
+    }
+
+    valkey_glide_async_request_wait(request);
+
+    /* Once done, the callback never touches the request again */
+    CommandResponse* response = request->response;
+    if (request->error_message) {
+        VALKEY_LOG_ERROR("async_command", request->error_message);
+        ZVAL_FALSE(&future->value);
+    } else if (future->result_type == VALKEY_GLIDE_FUTURE_STRING) {
+        if (response && response->response_type == String) {
+            ZVAL_STR(&future->value, command_response_to_zend_string(response));
+        } else {
+            ZVAL_FALSE(&future->value);
+        }
+    } else {
+        ZVAL_NULL(&future->value);
+        if (!response || command_response_to_zval(response,
+                                                  &future->value,
+                                                  COMMAND_RESPONSE_NOT_ASSOSIATIVE,
+                                                  false) < 1) {
+            /* Same as rawcommand(): nil and error replies become false */
+            zval_ptr_dtor(&future->value);
+            ZVAL_FALSE(&future->value);
+        }
+    }
+
+    async_request_release(request);
+    future->request = NULL;
+    return &future->value;
+}
+
+static bool future_is_ready(valkey_glide_future_object* future) {
+    bool done;
+
+    if (!future->request) {
+        return true;
+    }
+
+    pthread_mutex_lock(&async_mutex);
+    done = future->request->done;
+    pthread_mutex_unlock(&async_mutex);
+    return done;
+}
+
+/* Check that every element of an awaitAll()/awaitAny() argument is a future */
+static bool validate_futures(HashTable* futures) {
+    zval* entry;
+
+    ZEND_HASH_FOREACH_VAL(futures, entry) {
+        if (Z_TYPE_P(entry) != IS_OBJECT || Z_OBJCE_P(entry) != valkey_glide_future_ce) {
+            zend_argument_type_error(1, "must contain only ValkeyGlideFuture objects");
+            return false;
+        }
+    }
+    ZEND_HASH_FOREACH_END();
+
+    return true;
+}
+
+/* Object creation and destruction */
+static zend_object* create_valkey_glide_future_object(zend_class_entry* ce) {
+    valkey_glide_future_object* future =
+        ecalloc(1, sizeof(valkey_glide_future_object) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&future->std, ce);
+    object_properties_init(&future->std, ce);
+
+    ZVAL_UNDEF(&future->client);
+    ZVAL_UNDEF(&future->value);
+    future->std.handlers = &valkey_glide_future_object_handlers;
+
+    return &future->std;
+}
+
+static void free_valkey_glide_future_object(zend_object* object) {
+    valkey_glide_future_object* future =
+        VALKEY_GLIDE_PHP_GET_OBJECT(valkey_glide_future_object, object);
+
+    if (future->request) {
+        valkey_glide_async_request_drop(future->request);
+        future->request = NULL;
+    }
+
+    zval_ptr_dtor(&future->value);
+    zval_ptr_dtor(&future->client);
+
+    /* Clean up the standard object */
+    zend_object_std_dtor(&future->std);
+}
+
+/* Client methods */
+
+int execute_get_async_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    char*  key;
+    size_t key_len;
+
+    /* Parse parameters */
+    if (zend_parse_method_parameters(argc, object, "Os", &object, ce, &key, &key_len) ==
+        FAILURE) {
+        return 0;
+    }
+
+    uintptr_t     args[1]     = {(uintptr_t) key};
+    unsigned long args_len[1] = {key_len};
+
+    return dispatch_async_command(
+        object, Get, 1, args, args_len, VALKEY_GLIDE_FUTURE_STRING, return_value);
+}
+
+int execute_send_async_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    zval*                z_args;
+    int                  arg_count;
+    uintptr_t*           args;
+    unsigned long*       args_len;
+    zend_string**        strings;
+    valkey_glide_arena_t arena;
+    int                  i, status;
+
+    /* Parse parameters - command name followed by its arguments */
+    if (zend_parse_method_parameters(argc, object, "O+", &object, ce, &z_args, &arg_count) ==
+        FAILURE) {
+        return 0;
+    }
+
+    valkey_glide_arena_init(&arena);
+    valkey_glide_arena_alloc_arg_arrays(&arena, arg_count, &args, &args_len);
+    strings = valkey_glide_arena_alloc(&arena, arg_count * sizeof(zend_string*));
+
+    for (i = 0; i < arg_count; i++) {
+        strings[i]  = zval_get_string(&z_args[i]);
+        args[i]     = (uintptr_t) ZSTR_VAL(strings[i]);
+        args_len[i] = ZSTR_LEN(strings[i]);
+    }
+
+    status = dispatch_async_command(object,
+                                    CustomCommand,
+                                    arg_count,
+                                    args,
+                                    args_len,
+                                    VALKEY_GLIDE_FUTURE_GENERIC,
+                                    return_value);
+
+    /* The core copies the arguments before command() returns */
+    for (i = 0; i < arg_count; i++) {
+        zend_string_release(strings[i]);
+    }
+    valkey_glide_arena_reset(&arena);
+
+    return status;
+}
+
+/* Class methods implementation */
+
+PHP_METHOD(ValkeyGlideFuture, __construct) {
+    /* Instances are only created by the *Async() client methods */
+    ZEND_PARSE_PARAMETERS_NONE();
+}
+
+/**
+ * await(): Block until the reply arrives and return it
+ */
+PHP_METHOD(ValkeyGlideFuture, await) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_COPY(future_resolve(VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(getThis())));
+}
+
+/**
+ * isReady(): Whether await() would return without blocking
+ */
+PHP_METHOD(ValkeyGlideFuture, isReady) {
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_BOOL(future_is_ready(VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(getThis())));
+}
+
+/**
+ * awaitAll(array $futures): Replies of all futures, keyed like the input
+ */
+PHP_METHOD(ValkeyGlideFuture, awaitAll) {
+    HashTable*   futures;
+    zend_string* key;
+    zend_ulong   index;
+    zval*        entry;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+    Z_PARAM_ARRAY_HT(futures)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (!validate_futures(futures)) {
+        RETURN_THROWS();
+    }
+
+    array_init_size(return_value, zend_hash_num_elements(futures));
+    ZEND_HASH_FOREACH_KEY_VAL(futures, index, key, entry) {
+        zval* value = future_resolve(VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(entry));
+
+        Z_TRY_ADDREF_P(value);
+        if (key) {
+            zend_hash_update(Z_ARRVAL_P(return_value), key, value);
+        } else {
+            zend_hash_index_update(Z_ARRVAL_P(return_value), index, value);
+        }
+    }
+    ZEND_HASH_FOREACH_END();
+}
+
+/**
+ * awaitAny(array $futures): Key of the first future whose reply is available
+ */
+PHP_METHOD(ValkeyGlideFuture, awaitAny) {
+    HashTable*   futures;
+    zend_string* key;
+    zend_ulong   index;
+    zval*        entry;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+    Z_PARAM_ARRAY_HT(futures)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (!validate_futures(futures) || zend_hash_num_elements(futures) == 0) {
+        if (EG(exception)) {
+            RETURN_THROWS();
+        }
+        RETURN_FALSE;
+    }
+
+    pthread_mutex_lock(&async_mutex);
+    for (;;) {
+        ZEND_HASH_FOREACH_KEY_VAL(futures, index, key, entry) {
+            valkey_glide_future_object* future = VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(entry);
+
+            if (!future->request || future->request->done) {
+                pthread_mutex_unlock(&async_mutex);
+                if (key) {
+                    RETURN_STR_COPY(key);
+                }
+                RETURN_LONG(index);
+            }
+        }
+        ZEND_HASH_FOREACH_END();
+
+        pthread_cond_wait(&async_cond, &async_mutex);
+    }
+}
+
+/* Class registration function using generated arginfo */
+void register_valkey_glide_future_class(void) {
+    valkey_glide_future_ce                = register_class_ValkeyGlideFuture();
+    valkey_glide_future_ce->create_object = create_valkey_glide_future_object;
+
+    memcpy(&valkey_glide_future_object_handlers,
+           zend_get_std_object_handlers(),
+           sizeof(valkey_glide_future_object_handlers));
+    valkey_glide_future_object_handlers.offset    = XtOffsetOf(valkey_glide_future_object, std);
+    valkey_glide_future_object_handlers.free_obj  = free_valkey_glide_future_object;
+    valkey_glide_future_object_handlers.clone_obj = NULL;
+}
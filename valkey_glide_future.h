@@ -0,0 +1,68 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_FUTURE_H
+#define VALKEY_GLIDE_FUTURE_H
+
+#include "common.h"
+#include "php.h"
+
+/* How a completed reply is turned into a PHP value */
+typedef enum {
+    VALKEY_GLIDE_FUTURE_GENERIC = 0, /* command_response_to_zval */
+    VALKEY_GLIDE_FUTURE_STRING,      /* string, false when the key does not exist */
+} valkey_glide_future_result_t;
+
+/**
+ * One in-flight request on the async connection.
+ * Written by the core's callback thread, so it lives in malloc() memory and
+ * every field is guarded by the module-wide completion mutex.
+ */
+typedef struct {
+    bool             done;
+    bool             abandoned;     /* Future freed first, callback releases the request */
+    CommandResponse* response;      /* Owned until free_command_response() */
+    char*            error_message; /* malloc() copy of the failure message */
+} valkey_glide_async_request_t;
+
+/* Open the client's async connection on first use; NULL if it cannot be opened */
+const void* valkey_glide_get_async_client(valkey_glide_object* valkey_glide);
+
+/* Allocate a request whose address is passed as the callback index of an async call */
+valkey_glide_async_request_t* valkey_glide_async_request_new(void);
+
+/* Block until a request is done */
+void valkey_glide_async_request_wait(valkey_glide_async_request_t* request);
+
+/* Block until one of the requests is done and return its position */
+size_t valkey_glide_async_request_wait_any(valkey_glide_async_request_t** requests, size_t count);
+
+/* Free a request, or leave it to the callback if the reply has not arrived yet */
+void valkey_glide_async_request_drop(valkey_glide_async_request_t* request);
+
+/* ValkeyGlideFuture object structure */
+typedef struct {
+    valkey_glide_async_request_t* request;     /* NULL once the reply has been consumed */
+    zval                          client;      /* Keeps the async connection open */
+    valkey_glide_future_result_t  result_type; /* Reply conversion */
+    zval                          value;       /* Resolved value, UNDEF until awaited */
+    zend_object                   std;         /* Standard PHP object */
+} valkey_glide_future_object;
+
+/* Class entry */
+extern zend_class_entry* valkey_glide_future_ce;
+
+/* Class methods */
+PHP_METHOD(ValkeyGlideFuture, __construct);
+PHP_METHOD(ValkeyGlideFuture, await);
+PHP_METHOD(ValkeyGlideFuture, isReady);
+PHP_METHOD(ValkeyGlideFuture, awaitAll);
+PHP_METHOD(ValkeyGlideFuture, awaitAny);
+
+/* Helper macros */
+#define VALKEY_GLIDE_FUTURE_ZVAL_GET_OBJECT(zv) \
+    VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_future_object, zv)
+
+/* Class registration function */
+void register_valkey_glide_future_class(void);
+
+#endif /* VALKEY_GLIDE_FUTURE_H */
@@ -0,0 +1,67 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * ValkeyGlideFuture is the pending reply of a command sent with one of the *Async() methods.
+ *
+ * Async commands are sent on a separate connection without waiting for the reply, so many of
+ * them can be in flight at once. Replies are converted on the PHP thread when awaited.
+ */
+final class ValkeyGlideFuture
+{
+    private function __construct()
+    {
+    }
+
+    /**
+     * Wait for the reply.
+     *
+     * @return mixed The reply, converted like the synchronous command would, or false on error.
+     */
+    public function await(): mixed
+    {
+    }
+
+    /**
+     * Check whether the reply has arrived, without blocking.
+     *
+     * @return bool True if await() would return immediately.
+     */
+    public function isReady(): bool
+    {
+    }
+
+    /**
+     * Wait for every future in the array.
+     *
+     * @param array $futures ValkeyGlideFuture objects.
+     *
+     * @return array The replies, with the same keys as $futures.
+     *
+     * @example
+     * $futures = [];
+     * foreach ($keys as $key) {
+     *     $futures[$key] = $valkey_glide->getAsync($key);
+     * }
+     * $values = ValkeyGlideFuture::awaitAll($futures);
+     */
+    public static function awaitAll(array $futures): array
+    {
+    }
+
+    /**
+     * Wait until at least one future in the array has its reply.
+     *
+     * @param array $futures ValkeyGlideFuture objects.
+     *
+     * @return int|string|false The key of a completed future, or false if $futures is empty.
+     */
+    public static function awaitAny(array $futures): int|string|false
+    {
+    }
+}
@@ -24,10 +24,6 @@
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_z_common.h"
 
-/* Import the string conversion functions from command_response.c */
-extern char* long_to_string(long value, size_t* len);
-extern char* double_to_string(double value, size_t* len);
-
 /* ====================================================================
  * OPTION PARSING HELPERS
  * ==================================================================== */
@@ -47,21 +43,18 @@ extern char* double_to_string(double value, size_t* len);
  */
 int prepare_geo_members_args(geo_command_args_t* args,
                              uintptr_t**         args_out,
-                             unsigned long**     args_len_out,
-                             char***             allocated_strings,
-                             int*                allocated_count) {
+                             unsigned long**     args_len_out) {
     if (!args || !args->key || !args->members || args->member_count <= 0 || !args_out ||
-        !args_len_out || !allocated_strings || !allocated_count) {
+        !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Prepare command arguments: key + members */
     unsigned long arg_count = 1 + args->member_count;
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
+        return 0;
+    }
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -69,20 +62,12 @@ int prepare_geo_members_args(geo_command_args_t* args,
 
     /* Add members as arguments */
     for (int i = 0; i < args->member_count; i++) {
-        zval*  member    = &args->members[i];
-        char*  str_val   = NULL;
-        size_t str_len   = 0;
-        int    need_free = 0;
-
-        str_val = zval_to_string_safe(member, &str_len, &need_free);
-
+        size_t str_len = 0;
+        char*  str_val =
+            valkey_glide_arena_zval_to_string(args->arena, &args->members[i], &str_len);
 
         (*args_out)[i + 1]     = (uintptr_t) str_val;
         (*args_len_out)[i + 1] = str_len;
-
-        if (need_free) {
-            (*allocated_strings)[(*allocated_count)++] = str_val;
-        }
     }
 
     return arg_count;
@@ -102,8 +87,9 @@ int prepare_geo_dist_args(geo_command_args_t* args,
 
     /* Prepare command arguments */
     unsigned long arg_count = args->unit ? 4 : 3;
-    *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
+        return 0;
+    }
 
     /* Set arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -129,23 +115,19 @@ int prepare_geo_dist_args(geo_command_args_t* args,
  */
 int prepare_geo_add_args(geo_command_args_t* args,
                          uintptr_t**         args_out,
-                         unsigned long**     args_len_out,
-                         char***             allocated_strings,
-                         int*                allocated_count) {
+                         unsigned long**     args_len_out) {
     /* Check if client, key, and args are valid */
     if (!args || !args->key || !args->geo_args || args->geo_args_count < 3 ||
-        args->geo_args_count % 3 != 0 || !args_out || !args_len_out || !allocated_strings ||
-        !allocated_count) {
+        args->geo_args_count % 3 != 0 || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Prepare command arguments */
     unsigned long arg_count =
         1 + args->geo_args_count; /* key + (longitude, latitude, member) triplets */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
+        return 0;
+    }
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -153,19 +135,12 @@ int prepare_geo_add_args(geo_command_args_t* args,
 
     /* Add arguments: lon, lat, member, lon, lat, member, ... */
     for (int i = 0; i < args->geo_args_count; i++) {
-        zval*  value     = &args->geo_args[i];
-        char*  str_val   = NULL;
-        size_t str_len   = 0;
-        int    need_free = 0;
-
-        str_val = zval_to_string_safe(value, &str_len, &need_free);
+        size_t str_len = 0;
+        char*  str_val =
+            valkey_glide_arena_zval_to_string(args->arena, &args->geo_args[i], &str_len);
 
         (*args_out)[i + 1]     = (uintptr_t) str_val;
         (*args_len_out)[i + 1] = str_len;
-
-        if (need_free) {
-            (*allocated_strings)[(*allocated_count)++] = str_val;
-        }
     }
 
     return arg_count;
@@ -425,22 +400,19 @@ int execute_geo_generic_command(valkey_glide_object*   valkey_glide,
         return 0;
     }
 
-    uintptr_t*     arg_values        = NULL;
-    unsigned long* arg_lens          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            success           = 0;
+    uintptr_t*           arg_values = NULL;
+    unsigned long*       arg_lens   = NULL;
+    int                  arg_count  = 0;
+    int                  success    = 0;
+    valkey_glide_arena_t arena;
+
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
 
     /* Determine argument preparation method based on command type */
     switch (cmd_type) {
         case GeoAdd:
-            allocated_strings = (char**) emalloc(args->geo_args_count * sizeof(char*));
-            if (!allocated_strings) {
-                return 0;
-            }
-            arg_count = prepare_geo_add_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_geo_add_args(args, &arg_values, &arg_lens);
             break;
 
         case GeoDist:
@@ -449,12 +421,7 @@ int execute_geo_generic_command(valkey_glide_object*   valkey_glide,
 
         case GeoHash:
         case GeoPos:
-            allocated_strings = (char**) emalloc(args->member_count * sizeof(char*));
-            if (!allocated_strings) {
-                return 0;
-            }
-            arg_count = prepare_geo_members_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_geo_members_args(args, &arg_values, &arg_lens);
             break;
 
         default:
@@ -474,20 +441,8 @@ int execute_geo_generic_command(valkey_glide_object*   valkey_glide,
                                               result_ptr,
                                               (z_result_processor_t) process_result);
 
-        /* Free allocated strings */
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-
-        if (allocated_strings)
-            efree(allocated_strings);
-        if (arg_values)
-            efree(arg_values);
-        if (arg_lens)
-            efree(arg_lens);
-
+        valkey_glide_arena_reset(&arena);
+        args->arena = NULL;
         return status;
     }
 
@@ -499,19 +454,8 @@ int execute_geo_generic_command(valkey_glide_object*   valkey_glide,
                                             arg_lens    /* argument lengths */
     );
 
-    /* Free allocated strings */
-    for (int i = 0; i < allocated_count; i++) {
-        if (allocated_strings[i]) {
-            efree(allocated_strings[i]);
-        }
-    }
-
-    if (allocated_strings)
-        efree(allocated_strings);
-    if (arg_values)
-        efree(arg_values);
-    if (arg_lens)
-        efree(arg_lens);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
 
     /* Check if the command was successful */
     if (!result) {
@@ -747,22 +691,20 @@ int parse_geosearch_parameters(int                  argc,
 /**
  * Prepare arguments for unified GEOSEARCH/GEOSEARCHSTORE commands
  */
-int prepare_geo_search_unified_args(geo_search_params_t* params,
-                                    uintptr_t**          args_out,
-                                    unsigned long**      args_len_out,
-                                    char***              allocated_strings,
-                                    int*                 allocated_count,
-                                    int                  is_store_variant) {
-    if (!params || !args_out || !args_len_out || !allocated_strings || !allocated_count) {
+int prepare_geo_search_unified_args(geo_search_params_t*  params,
+                                    valkey_glide_arena_t* arena,
+                                    uintptr_t**           args_out,
+                                    unsigned long**       args_len_out,
+                                    int                   is_store_variant) {
+    if (!params || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Calculate maximum arguments needed */
-    unsigned long max_args = VALKEY_GLIDE_MAX_OPTIONS;
-    *args_out              = (uintptr_t*) emalloc(max_args * sizeof(uintptr_t));
-    *args_len_out          = (unsigned long*) emalloc(max_args * sizeof(unsigned long));
+    if (!valkey_glide_arena_alloc_arg_arrays(
+            arena, VALKEY_GLIDE_MAX_OPTIONS, args_out, args_len_out)) {
+        return 0;
+    }
 
     unsigned long arg_idx = 0;
 
@@ -793,16 +735,15 @@ int prepare_geo_search_unified_args(geo_search_params_t* params,
 
         /* Convert coordinates to strings */
         size_t lon_str_len, lat_str_len;
-        char*  lon_str = double_to_string(params->longitude, &lon_str_len);
-        char*  lat_str = double_to_string(params->latitude, &lat_str_len);
+        char*  lon_str =
+            valkey_glide_arena_double_to_string(arena, params->longitude, &lon_str_len);
+        char*  lat_str = valkey_glide_arena_double_to_string(arena, params->latitude, &lat_str_len);
 
-        (*args_out)[arg_idx]                       = (uintptr_t) lon_str;
-        (*args_len_out)[arg_idx++]                 = lon_str_len;
-        (*allocated_strings)[(*allocated_count)++] = lon_str;
+        (*args_out)[arg_idx]       = (uintptr_t) lon_str;
+        (*args_len_out)[arg_idx++] = lon_str_len;
 
-        (*args_out)[arg_idx]                       = (uintptr_t) lat_str;
-        (*args_len_out)[arg_idx++]                 = lat_str_len;
-        (*allocated_strings)[(*allocated_count)++] = lat_str;
+        (*args_out)[arg_idx]       = (uintptr_t) lat_str;
+        (*args_len_out)[arg_idx++] = lat_str_len;
     }
 
     /* Add BY parameter */
@@ -812,27 +753,27 @@ int prepare_geo_search_unified_args(geo_search_params_t* params,
         (*args_len_out)[arg_idx++] = strlen("BYRADIUS");
 
         size_t radius_str_len;
-        char*  radius_str = double_to_string(params->radius, &radius_str_len);
+        char*  radius_str =
+            valkey_glide_arena_double_to_string(arena, params->radius, &radius_str_len);
 
-        (*args_out)[arg_idx]                       = (uintptr_t) radius_str;
-        (*args_len_out)[arg_idx++]                 = radius_str_len;
-        (*allocated_strings)[(*allocated_count)++] = radius_str;
+        (*args_out)[arg_idx]       = (uintptr_t) radius_str;
+        (*args_len_out)[arg_idx++] = radius_str_len;
     } else {
         /* BYBOX */
         (*args_out)[arg_idx]       = (uintptr_t) "BYBOX";
         (*args_len_out)[arg_idx++] = strlen("BYBOX");
 
         size_t width_str_len, height_str_len;
-        char*  width_str  = double_to_string(params->width, &width_str_len);
-        char*  height_str = double_to_string(params->height, &height_str_len);
+        char*  width_str  =
+            valkey_glide_arena_double_to_string(arena, params->width, &width_str_len);
+        char*  height_str =
+            valkey_glide_arena_double_to_string(arena, params->height, &height_str_len);
 
-        (*args_out)[arg_idx]                       = (uintptr_t) width_str;
-        (*args_len_out)[arg_idx++]                 = width_str_len;
-        (*allocated_strings)[(*allocated_count)++] = width_str;
+        (*args_out)[arg_idx]       = (uintptr_t) width_str;
+        (*args_len_out)[arg_idx++] = width_str_len;
 
-        (*args_out)[arg_idx]                       = (uintptr_t) height_str;
-        (*args_len_out)[arg_idx++]                 = height_str_len;
-        (*allocated_strings)[(*allocated_count)++] = height_str;
+        (*args_out)[arg_idx]       = (uintptr_t) height_str;
+        (*args_len_out)[arg_idx++] = height_str_len;
     }
 
     /* Add unit */
@@ -851,11 +792,11 @@ int prepare_geo_search_unified_args(geo_search_params_t* params,
         (*args_len_out)[arg_idx++] = strlen("COUNT");
 
         size_t count_str_len;
-        char*  count_str = long_to_string(params->options.count, &count_str_len);
+        char*  count_str =
+            valkey_glide_arena_long_to_string(arena, params->options.count, &count_str_len);
 
-        (*args_out)[arg_idx]                       = (uintptr_t) count_str;
-        (*args_len_out)[arg_idx++]                 = count_str_len;
-        (*allocated_strings)[(*allocated_count)++] = count_str;
+        (*args_out)[arg_idx]       = (uintptr_t) count_str;
+        (*args_len_out)[arg_idx++] = count_str_len;
 
         /* Add ANY if specified */
         if (params->options.any) {
@@ -913,23 +854,17 @@ int execute_geosearch_unified(
     }
 
     /* Prepare command arguments */
-    uintptr_t*     arg_values        = NULL;
-    unsigned long* arg_lens          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-
-    allocated_strings = (char**) emalloc(15 * sizeof(char*));
-    if (!allocated_strings) {
-        return 0;
-    }
+    uintptr_t*           arg_values = NULL;
+    unsigned long*       arg_lens   = NULL;
+    int                  arg_count  = 0;
+    valkey_glide_arena_t arena;
 
+    valkey_glide_arena_init(&arena);
     arg_count = prepare_geo_search_unified_args(
-        &params, &arg_values, &arg_lens, &allocated_strings, &allocated_count, is_store_variant);
+        &params, &arena, &arg_values, &arg_lens, is_store_variant);
 
     if (arg_count <= 0) {
-        if (allocated_strings)
-            efree(allocated_strings);
+        valkey_glide_arena_reset(&arena);
         return 0;
     }
 
@@ -964,15 +899,7 @@ int execute_geosearch_unified(
                                               result_ptr,
                                               (z_result_processor_t) processor);
 
-        /* Cleanup */
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        efree(allocated_strings);
-        efree(arg_values);
-        efree(arg_lens);
+        valkey_glide_arena_reset(&arena);
 
         if (status) {
             ZVAL_COPY(return_value, object);
@@ -986,15 +913,7 @@ int execute_geosearch_unified(
     CommandResult*   result =
         execute_command(glide_client, cmd_type, arg_count, arg_values, arg_lens);
 
-    /* Cleanup allocated strings */
-    for (int i = 0; i < allocated_count; i++) {
-        if (allocated_strings[i]) {
-            efree(allocated_strings[i]);
-        }
-    }
-    efree(allocated_strings);
-    efree(arg_values);
-    efree(arg_lens);
+    valkey_glide_arena_reset(&arena);
 
     if (!result || result->command_error) {
         if (result)
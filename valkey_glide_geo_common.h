@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include "command_response.h"
+#include "valkey_glide_arena.h"
 #include "valkey_glide_commands_common.h"
 
 /* ====================================================================
@@ -123,6 +124,9 @@ typedef struct _geo_command_args_t {
     /* Common options */
     zval*                options;     /* Options array or NULL */
     geo_radius_options_t radius_opts; /* Parsed radius options */
+
+    /* Per-command allocations, owned by execute_geo_generic_command */
+    valkey_glide_arena_t* arena;
 } geo_command_args_t;
 
 /* Function pointer type for result processors */
@@ -134,9 +138,7 @@ typedef int (*geo_result_processor_t)(CommandResponse* response, void* output, z
 
 int prepare_geo_members_args(geo_command_args_t* args,
                              uintptr_t**         args_out,
-                             unsigned long**     args_len_out,
-                             char***             allocated_strings,
-                             int*                allocated_count);
+                             unsigned long**     args_len_out);
 
 int prepare_geo_dist_args(geo_command_args_t* args,
                           uintptr_t**         args_out,
@@ -144,21 +146,7 @@ int prepare_geo_dist_args(geo_command_args_t* args,
 
 int prepare_geo_add_args(geo_command_args_t* args,
                          uintptr_t**         args_out,
-                         unsigned long**     args_len_out,
-                         char***             allocated_strings,
-                         int*                allocated_count);
-
-int prepare_geo_search_args(geo_command_args_t* args,
-                            uintptr_t**         args_out,
-                            unsigned long**     args_len_out,
-                            char***             allocated_strings,
-                            int*                allocated_count);
-
-int prepare_geo_search_store_args(geo_command_args_t* args,
-                                  uintptr_t**         args_out,
-                                  unsigned long**     args_len_out,
-                                  char***             allocated_strings,
-                                  int*                allocated_count);
+                         unsigned long**     args_len_out);
 
 
 /* Batch-compatible async result processors */
@@ -187,12 +175,11 @@ int parse_geosearch_parameters(int                  argc,
                                int                  is_store_variant);
 int execute_geosearch_unified(
     zval* object, int argc, zval* return_value, zend_class_entry* ce, int is_store_variant);
-int prepare_geo_search_unified_args(geo_search_params_t* params,
-                                    uintptr_t**          args_out,
-                                    unsigned long**      args_len_out,
-                                    char***              allocated_strings,
-                                    int*                 allocated_count,
-                                    int                  is_store_variant);
+int prepare_geo_search_unified_args(geo_search_params_t*  params,
+                                    valkey_glide_arena_t* arena,
+                                    uintptr_t**           args_out,
+                                    unsigned long**       args_len_out,
+                                    int                   is_store_variant);
 
 /* Execution framework */
 int execute_geo_generic_command(valkey_glide_object*   valkey_glide,
@@ -17,7 +17,10 @@
 
 #include "common.h"
 #include "ext/standard/php_var.h"
+#include "logger.h"
 #include "valkey_glide_core_common.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_serializer.h"
 #include "valkey_glide_z_common.h"
 
 extern zend_class_entry* ce;
@@ -27,100 +30,80 @@ extern zend_class_entry* get_valkey_glide_exception_ce();
  * ==================================================================== */
 
 /**
- * Generic hash command execution framework with batch support
+ * Prepare the arguments of a hash command; returns the argument count, or 0
+ * when the command is not a hash command or its arguments are invalid
  */
-int execute_h_generic_command(valkey_glide_object* valkey_glide,
-                              enum RequestType     cmd_type,
-                              h_command_args_t*    args,
-                              void*                result_ptr,
-                              z_result_processor_t process_result,
-                              zval*                return_value) {
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* args_len          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            status            = 0;
-
-    /* Validate basic arguments */
-    VALIDATE_HASH_ARGS(valkey_glide->glide_client, args->key);
-
-    /* Prepare arguments based on command type */
+int prepare_h_command_args(enum RequestType  cmd_type,
+                           h_command_args_t* args,
+                           uintptr_t**       args_out,
+                           unsigned long**   args_len_out) {
     switch (cmd_type) {
         case HLen:
-            arg_count = prepare_h_key_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+        case HKeys:
+        case HVals:
+        case HGetAll:
+            return prepare_h_key_only_args(args, args_out, args_len_out);
         case HGet:
         case HExists:
         case HStrlen:
-            arg_count = prepare_h_single_field_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_single_field_args(args, args_out, args_len_out);
         case HSetNX:
-            arg_count = prepare_h_field_value_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_field_value_args(args, args_out, args_len_out);
         case HDel:
         case HMGet:
-            arg_count = prepare_h_multi_field_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_multi_field_args(args, args_out, args_len_out);
         case HSet:
-            arg_count = prepare_h_set_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_set_args(args, args_out, args_len_out);
         case HMSet:
-            arg_count = prepare_h_mset_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_mset_args(args, args_out, args_len_out);
         case HIncrBy:
         case HIncrByFloat:
-            arg_count = prepare_h_incr_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count, cmd_type);
-            break;
+            return prepare_h_incr_args(args, args_out, args_len_out, cmd_type);
         case HRandField:
-            arg_count = prepare_h_randfield_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HKeys:
-        case HVals:
-        case HGetAll:
-            arg_count = prepare_h_key_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_randfield_args(args, args_out, args_len_out);
         case HSetEx:
-            arg_count = prepare_h_hfe_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_hfe_args(args, args_out, args_len_out);
         case HExpire:
         case HPExpire:
         case HExpireAt:
         case HPExpireAt:
-            arg_count = prepare_h_expire_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_expire_args(args, args_out, args_len_out);
         case HTtl:
         case HPTtl:
         case HExpireTime:
         case HPExpireTime:
         case HPersist:
-            arg_count = prepare_h_field_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_field_only_args(args, args_out, args_len_out);
         case HGetEx:
-            arg_count = prepare_h_getex_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
+            return prepare_h_getex_args(args, args_out, args_len_out);
         default:
-
-            if (result_ptr) {
-                efree(args->fields);
-                efree(result_ptr);
-            }
-
             return 0;
     }
+}
+
+/**
+ * Generic hash command execution framework with batch support
+ */
+int execute_h_generic_command(valkey_glide_object* valkey_glide,
+                              enum RequestType     cmd_type,
+                              h_command_args_t*    args,
+                              void*                result_ptr,
+                              z_result_processor_t process_result,
+                              zval*                return_value) {
+    uintptr_t*           cmd_args  = NULL;
+    unsigned long*       args_len  = NULL;
+    int                  arg_count = 0;
+    int                  status    = 0;
+    valkey_glide_arena_t arena;
+
+    /* Validate basic arguments */
+    VALIDATE_HASH_ARGS(valkey_glide->glide_client, args->key);
+
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
+
+    /* Prepare arguments based on command type */
+    arg_count = prepare_h_command_args(cmd_type, args, &cmd_args, &args_len);
 
     if (arg_count <= 0) {
         if (result_ptr) {
@@ -161,8 +144,8 @@ int execute_h_generic_command(valkey_glide_object* valkey_glide,
     }
 
 cleanup:
-    /* Clean up allocated resources */
-    cleanup_h_command_args(allocated_strings, allocated_count, cmd_args, args_len);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
 
     return status;
 }
@@ -179,77 +162,20 @@ int execute_h_simple_command(valkey_glide_object* valkey_glide,
                              void*                result_ptr,
                              int                  response_type,
                              zval*                return_value) {
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* args_len          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            status            = 0;
+    uintptr_t*           cmd_args  = NULL;
+    unsigned long*       args_len  = NULL;
+    int                  arg_count = 0;
+    int                  status    = 0;
+    valkey_glide_arena_t arena;
 
     /* Validate basic arguments */
     VALIDATE_HASH_ARGS(valkey_glide->glide_client, args->key);
 
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
+
     /* Prepare arguments based on command type */
-    switch (cmd_type) {
-        case HLen:
-        case HKeys:
-        case HVals:
-        case HGetAll:
-            arg_count = prepare_h_key_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HGet:
-        case HExists:
-        case HStrlen:
-            arg_count = prepare_h_single_field_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HSetNX:
-            arg_count = prepare_h_field_value_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HDel:
-            arg_count = prepare_h_multi_field_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HSet:
-            arg_count = prepare_h_set_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HMSet:
-            arg_count = prepare_h_mset_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HIncrBy:
-            arg_count = prepare_h_incr_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count, HIncrBy);
-            break;
-        case HSetEx:
-            arg_count = prepare_h_hfe_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HExpire:
-        case HPExpire:
-        case HExpireAt:
-        case HPExpireAt:
-            arg_count = prepare_h_expire_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HTtl:
-        case HPTtl:
-        case HExpireTime:
-        case HPExpireTime:
-        case HPersist:
-            arg_count = prepare_h_field_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        case HGetEx:
-            arg_count = prepare_h_getex_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
-            break;
-        default:
-            goto cleanup;
-    }
+    arg_count = prepare_h_command_args(cmd_type, args, &cmd_args, &args_len);
 
     if (arg_count <= 0) {
         goto cleanup;
@@ -267,10 +193,24 @@ int execute_h_simple_command(valkey_glide_object* valkey_glide,
         goto cleanup;
     }
 
+    /* Repeated reads may be answered by the near cache */
+    if (valkey_glide_near_cache_fetch(valkey_glide->near_cache,
+                                      cmd_type,
+                                      cmd_args,
+                                      args_len,
+                                      arg_count,
+                                      result_ptr,
+                                      processor,
+                                      return_value,
+                                      &status)) {
+        goto cleanup;
+    }
+
     /* Execute the command */
     CommandResult* result =
         execute_command(valkey_glide->glide_client, cmd_type, arg_count, cmd_args, args_len);
-
+    valkey_glide_near_cache_store(
+        valkey_glide->near_cache, cmd_type, cmd_args, args_len, arg_count, result);
 
     /* Process result using standard handlers */
     if (result && Z_TYPE_P(return_value) != IS_FALSE) {
@@ -283,8 +223,8 @@ int execute_h_simple_command(valkey_glide_object* valkey_glide,
     }
 
 cleanup:
-    /* Clean up allocated resources */
-    cleanup_h_command_args(allocated_strings, allocated_count, cmd_args, args_len);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
     return status;
 }
 
@@ -304,8 +244,6 @@ typedef struct {
 static int prepare_h_args_unified(h_command_args_t*     args,
                                   uintptr_t**           args_out,
                                   unsigned long**       args_len_out,
-                                  char***               allocated_strings,
-                                  int*                  allocated_count,
                                   const h_arg_config_t* config) {
     if (!args->key)
         return 0;
@@ -326,10 +264,7 @@ static int prepare_h_args_unified(h_command_args_t*     args,
     arg_count += args->fv_count;  // fields or field-value pairs
 
     // Allocate arrays
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc((2 + args->fv_count) * sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     int arg_idx = 0;
 
@@ -340,16 +275,20 @@ static int prepare_h_args_unified(h_command_args_t*     args,
 
     // Add condition
     if (config->needs_condition && args->mode) {
-        const char* condition = args->mode;
+        const char* condition     = args->mode;
+        size_t      condition_len = strlen(args->mode);
         if (config->condition_prefix) {
             // Convert NX/XX to FNX/FXX for HSETEX
-            static char condition_buf[4];
-            snprintf(
-                condition_buf, sizeof(condition_buf), "%s%s", config->condition_prefix, args->mode);
-            condition = condition_buf;
+            size_t prefix_len = strlen(config->condition_prefix);
+            char*  prefixed   = valkey_glide_arena_alloc(args->arena, prefix_len + condition_len);
+
+            memcpy(prefixed, config->condition_prefix, prefix_len);
+            memcpy(prefixed + prefix_len, args->mode, condition_len);
+            condition = prefixed;
+            condition_len += prefix_len;
         }
         (*args_out)[arg_idx]     = (uintptr_t) condition;
-        (*args_len_out)[arg_idx] = strlen(condition);
+        (*args_len_out)[arg_idx] = condition_len;
         arg_idx++;
     }
 
@@ -360,15 +299,8 @@ static int prepare_h_args_unified(h_command_args_t*     args,
         (*args_len_out)[arg_idx] = strlen(expiry_unit);
         arg_idx++;
 
-        size_t expiry_len;
-        char*  expiry_str = safe_format_long_long(args->expiry, &expiry_len);
-        add_string_arg(expiry_str,
-                       expiry_len,
-                       args_out,
-                       args_len_out,
-                       &arg_idx,
-                       allocated_strings,
-                       allocated_count);
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->expiry, *args_out, *args_len_out, arg_idx++);
     }
 
     // Add FIELDS keyword and count
@@ -377,25 +309,13 @@ static int prepare_h_args_unified(h_command_args_t*     args,
         (*args_len_out)[arg_idx] = 6;
         arg_idx++;
 
-        size_t field_count_len;
-        char*  field_count_str = safe_format_int(field_count, &field_count_len);
-        add_string_arg(field_count_str,
-                       field_count_len,
-                       args_out,
-                       args_len_out,
-                       &arg_idx,
-                       allocated_strings,
-                       allocated_count);
+        valkey_glide_arena_add_long_arg(
+            args->arena, field_count, *args_out, *args_len_out, arg_idx++);
     }
 
     // Add fields/field-value pairs
-    populate_field_args(args->field_values,
-                        args->fv_count,
-                        arg_idx,
-                        *args_out,
-                        *args_len_out,
-                        *allocated_strings,
-                        allocated_count);
+    populate_field_args(
+        args->arena, args->field_values, args->fv_count, arg_idx, *args_out, *args_len_out);
 
     return arg_count;
 }
@@ -403,13 +323,8 @@ static int prepare_h_args_unified(h_command_args_t*     args,
 // Simplified preparation functions using unified approach
 int prepare_h_key_only_args(h_command_args_t* args,
                             uintptr_t**       args_out,
-                            unsigned long**   args_len_out,
-                            char***           allocated_strings,
-                            int*              allocated_count) {
-    *args_out          = (uintptr_t*) emalloc(sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(sizeof(unsigned long));
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
+                            unsigned long**   args_len_out) {
+    valkey_glide_arena_alloc_arg_arrays(args->arena, 1, args_out, args_len_out);
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
     return 1;
@@ -417,24 +332,19 @@ int prepare_h_key_only_args(h_command_args_t* args,
 
 int prepare_h_hfe_args(h_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     h_arg_config_t config = {
         .needs_expiry         = true,
         .needs_condition      = true,
         .needs_fields_keyword = true,
         .field_value_pairs    = true,
         .condition_prefix     = "F"};  // Correct: F prefix for HSETEX (NX->FNX, XX->FXX)
-    return prepare_h_args_unified(
-        args, args_out, args_len_out, allocated_strings, allocated_count, &config);
+    return prepare_h_args_unified(args, args_out, args_len_out, &config);
 }
 
 int prepare_h_expire_args(h_command_args_t* args,
                           uintptr_t**       args_out,
-                          unsigned long**   args_len_out,
-                          char***           allocated_strings,
-                          int*              allocated_count) {
+                          unsigned long**   args_len_out) {
     if (!args->key)
         return 0;
 
@@ -451,10 +361,7 @@ int prepare_h_expire_args(h_command_args_t* args,
     arg_count += args->fv_count;  // fields
 
     // Allocate arrays
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc((2 + args->fv_count) * sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     int arg_idx = 0;
 
@@ -465,15 +372,8 @@ int prepare_h_expire_args(h_command_args_t* args,
 
     // Add expiry value directly (no EX keyword for HEXPIRE)
     if (args->expiry > 0) {
-        size_t expiry_len;
-        char*  expiry_str = safe_format_long_long(args->expiry, &expiry_len);
-        add_string_arg(expiry_str,
-                       expiry_len,
-                       args_out,
-                       args_len_out,
-                       &arg_idx,
-                       allocated_strings,
-                       allocated_count);
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->expiry, *args_out, *args_len_out, arg_idx++);
     }
 
     // Add condition (NX/XX directly, no prefix for HEXPIRE)
@@ -488,40 +388,24 @@ int prepare_h_expire_args(h_command_args_t* args,
     (*args_len_out)[arg_idx] = 6;
     arg_idx++;
 
-    size_t field_count_len;
-    char*  field_count_str = safe_format_int(field_count, &field_count_len);
-    add_string_arg(field_count_str,
-                   field_count_len,
-                   args_out,
-                   args_len_out,
-                   &arg_idx,
-                   allocated_strings,
-                   allocated_count);
+    valkey_glide_arena_add_long_arg(args->arena, field_count, *args_out, *args_len_out, arg_idx++);
 
     // Add fields (no values for HEXPIRE)
-    populate_field_args(args->field_values,
-                        args->fv_count,
-                        arg_idx,
-                        *args_out,
-                        *args_len_out,
-                        *allocated_strings,
-                        allocated_count);
+    populate_field_args(
+        args->arena, args->field_values, args->fv_count, arg_idx, *args_out, *args_len_out);
 
     return arg_count;
 }
 
 int prepare_h_field_only_args(h_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count) {
+                              unsigned long**   args_len_out) {
     h_arg_config_t config = {.needs_expiry         = false,
                              .needs_condition      = false,
                              .needs_fields_keyword = true,
                              .field_value_pairs    = false,
                              .condition_prefix     = NULL};
-    return prepare_h_args_unified(
-        args, args_out, args_len_out, allocated_strings, allocated_count, &config);
+    return prepare_h_args_unified(args, args_out, args_len_out, &config);
 }
 
 /**
@@ -529,18 +413,13 @@ int prepare_h_field_only_args(h_command_args_t* args,
  */
 int prepare_h_single_field_args(h_command_args_t* args,
                                 uintptr_t**       args_out,
-                                unsigned long**   args_len_out,
-                                char***           allocated_strings,
-                                int*              allocated_count) {
+                                unsigned long**   args_len_out) {
     if (!args->field) {
         return 0;
     }
 
     /* Allocate argument arrays */
-    *args_out          = (uintptr_t*) emalloc(2 * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(2 * sizeof(unsigned long));
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, 2, args_out, args_len_out);
 
     /* Set key and field arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -556,18 +435,13 @@ int prepare_h_single_field_args(h_command_args_t* args,
  */
 int prepare_h_field_value_args(h_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count) {
+                               unsigned long**   args_len_out) {
     if (!args->field || !args->value) {
         return 0;
     }
 
     /* Allocate argument arrays */
-    *args_out          = (uintptr_t*) emalloc(3 * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(3 * sizeof(unsigned long));
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out);
 
 
     /* Set key, field, and value arguments */
@@ -586,9 +460,7 @@ int prepare_h_field_value_args(h_command_args_t* args,
  */
 int prepare_h_multi_field_args(h_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count) {
+                               unsigned long**   args_len_out) {
     if (!args->fields || args->field_count <= 0) {
         return 0;
     }
@@ -597,23 +469,42 @@ int prepare_h_multi_field_args(h_command_args_t* args,
     unsigned long arg_count = 1 + args->field_count;
 
     /* Allocate argument arrays */
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc(args->field_count * sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key as first argument */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     /* Convert and add fields */
-    return convert_zval_array_to_args(args->fields,
-                                      1,
-                                      *args_out,
-                                      *args_len_out,
-                                      *allocated_strings,
-                                      allocated_count,
-                                      args->field_count);
+    return convert_zval_array_to_args(
+        args->arena, args->fields, 1, *args_out, *args_len_out, args->field_count);
+}
+
+/* Encode a hash value, owned by the command arena */
+static char* pack_h_value(valkey_glide_arena_t*       arena,
+                          const valkey_glide_codec_t* codec,
+                          zval*                       value,
+                          size_t*                     len) {
+    zend_string* packed;
+    char*        str;
+
+    if (codec->serializer != VALKEY_GLIDE_SERIALIZER_NONE) {
+        packed = valkey_glide_pack_value(codec, value);
+    } else {
+        /* Without a serializer values convert as usual and only get compressed */
+        str    = valkey_glide_arena_zval_to_string(arena, value, len);
+        packed = valkey_glide_compress_value(codec, str, *len);
+        if (!packed) {
+            return str;
+        }
+    }
+
+    if (!packed) {
+        return NULL;
+    }
+
+    /* The encoded string is sent as is and released with the arena */
+    return valkey_glide_arena_keep_string(arena, packed, len);
 }
 
 /**
@@ -621,9 +512,7 @@ int prepare_h_multi_field_args(h_command_args_t* args,
  */
 int prepare_h_set_args(h_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     if (!args->field_values) {
         return 0;
     }
@@ -644,10 +533,7 @@ int prepare_h_set_args(h_command_args_t* args,
 
         /* Prepare command arguments: key + field-value pairs */
         unsigned long arg_count = 1 + (pairs_count * 2);
-        *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-        *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-        *allocated_strings      = (char**) emalloc((pairs_count * 2) * sizeof(char*));
-        *allocated_count        = 0;
+        valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
         /* First argument: key */
         (*args_out)[0]     = (uintptr_t) args->key;
@@ -655,7 +541,7 @@ int prepare_h_set_args(h_command_args_t* args,
 
         /* Process field-value pairs */
         return process_field_value_pairs(
-            z_array, *args_out, *args_len_out, 1, *allocated_strings, allocated_count);
+            args->arena, z_array, *args_out, *args_len_out, 1, args->codec);
     } else {
         /* Original variadic usage */
         if (args->fv_count < 2 || args->fv_count % 2 != 0) {
@@ -664,23 +550,32 @@ int prepare_h_set_args(h_command_args_t* args,
 
         /* Prepare command arguments: key + field/value pairs */
         unsigned long arg_count = 1 + args->fv_count;
-        *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-        *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-        *allocated_strings      = (char**) emalloc(args->fv_count * sizeof(char*));
-        *allocated_count        = 0;
+        valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
         /* First argument: key */
         (*args_out)[0]     = (uintptr_t) args->key;
         (*args_len_out)[0] = args->key_len;
 
+        /* Fields are sent as strings, values encoded */
+        if (args->codec) {
+            for (int i = 0; i < args->fv_count; i += 2) {
+                char* value;
+
+                convert_zval_array_to_args(
+                    args->arena, &args->field_values[i], 1 + i, *args_out, *args_len_out, 1);
+                value = pack_h_value(
+                    args->arena, args->codec, &args->field_values[i + 1], &(*args_len_out)[2 + i]);
+                if (!value) {
+                    return 0;
+                }
+                (*args_out)[2 + i] = (uintptr_t) value;
+            }
+            return 1 + args->fv_count;
+        }
+
         /* Convert field/value pairs */
-        return convert_zval_array_to_args(args->field_values,
-                                          1,
-                                          *args_out,
-                                          *args_len_out,
-                                          *allocated_strings,
-                                          allocated_count,
-                                          args->fv_count);
+        return convert_zval_array_to_args(
+            args->arena, args->field_values, 1, *args_out, *args_len_out, args->fv_count);
     }
 }
 
@@ -689,9 +584,7 @@ int prepare_h_set_args(h_command_args_t* args,
  */
 int prepare_h_mset_args(h_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     if (!args->field_values || args->fv_count <= 0) {
         return 0;
     }
@@ -701,10 +594,7 @@ int prepare_h_mset_args(h_command_args_t* args,
     int           pairs_count = zend_hash_num_elements(ht);
     unsigned long arg_count   = 1 + (pairs_count * 2);
 
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc((pairs_count * 2) * sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -712,7 +602,7 @@ int prepare_h_mset_args(h_command_args_t* args,
 
     /* Process field-value pairs */
     return process_field_value_pairs(
-        args->field_values, *args_out, *args_len_out, 1, *allocated_strings, allocated_count);
+        args->arena, args->field_values, *args_out, *args_len_out, 1, args->codec);
 }
 
 /**
@@ -721,18 +611,13 @@ int prepare_h_mset_args(h_command_args_t* args,
 int prepare_h_incr_args(h_command_args_t* args,
                         uintptr_t**       args_out,
                         unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count,
                         enum RequestType  cmd_type) {
     if (!args->field) {
         return 0;
     }
 
     /* Allocate argument arrays */
-    *args_out          = (uintptr_t*) emalloc(3 * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(3 * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc(sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out);
 
     /* Set key and field arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -746,15 +631,12 @@ int prepare_h_incr_args(h_command_args_t* args,
 
     if (args->float_incr != 0.0) {
         /* HINCRBYFLOAT */
-        incr_str = double_to_string(args->float_incr, &incr_len);
+        incr_str = valkey_glide_arena_double_to_string(args->arena, args->float_incr, &incr_len);
     } else {
         /* HINCRBY */
-        incr_str = long_to_string(args->increment, &incr_len);
+        incr_str = valkey_glide_arena_long_to_string(args->arena, args->increment, &incr_len);
     }
 
-    (*allocated_strings)[0] = incr_str;
-    *allocated_count        = 1;
-
     (*args_out)[2]     = (uintptr_t) incr_str;
     (*args_len_out)[2] = incr_len;
 
@@ -766,9 +648,7 @@ int prepare_h_incr_args(h_command_args_t* args,
  */
 int prepare_h_randfield_args(h_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
+                             unsigned long**   args_len_out) {
     /* Calculate argument count */
     unsigned long arg_count      = 1; /* key */
     int           need_count_str = 0;
@@ -785,10 +665,7 @@ int prepare_h_randfield_args(h_command_args_t* args,
         }
     }
 
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = need_count_str ? (char**) emalloc(sizeof(char*)) : NULL;
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* First argument: key */
     int arg_idx              = 0;
@@ -798,13 +675,8 @@ int prepare_h_randfield_args(h_command_args_t* args,
 
     /* Add count if needed */
     if (need_count_str) {
-        char* count_str = long_to_string(args->count, &(*args_len_out)[arg_idx]);
-
-        (*allocated_strings)[0] = count_str;
-        *allocated_count        = 1;
-
-        (*args_out)[arg_idx] = (uintptr_t) count_str;
-        arg_idx++;
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->count, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add WITHVALUES if specified */
@@ -819,39 +691,23 @@ int prepare_h_randfield_args(h_command_args_t* args,
 }
 
 /**
- * Safely populate field arguments from zval array
- * Handles string conversion and memory management correctly
- * NOTE: Always creates copies because cleanup code expects to efree() all allocated_strings
+ * Populate field arguments from a zval array
+ * Strings are referenced in place, other types are converted into the arena
  */
-int populate_field_args(zval*          field_values,
-                        int            fv_count,
-                        int            start_idx,
-                        uintptr_t*     args_out,
-                        unsigned long* args_len_out,
-                        char**         allocated_strings,
-                        int*           allocated_count) {
+int populate_field_args(valkey_glide_arena_t* arena,
+                        zval*                 field_values,
+                        int                   fv_count,
+                        int                   start_idx,
+                        uintptr_t*            args_out,
+                        unsigned long*        args_len_out) {
     int arg_idx = start_idx;
 
     for (int i = 0; i < fv_count; i++) {
-        zval* field = &field_values[i];
-        char* field_str;
+        size_t field_len;
+        char*  field_str = valkey_glide_arena_zval_to_string(arena, &field_values[i], &field_len);
 
-        if (Z_TYPE_P(field) == IS_STRING) {
-            /* Create copy of original string - required for cleanup compatibility */
-            field_str = estrdup(Z_STRVAL_P(field));
-        } else {
-            /* Convert to string and create copy */
-            zval temp;
-            ZVAL_COPY(&temp, field);
-            convert_to_string(&temp);
-            field_str = estrdup(Z_STRVAL(temp));
-            zval_dtor(&temp);
-        }
-
-        /* Store copy in allocated_strings for cleanup */
-        allocated_strings[(*allocated_count)++] = field_str;
-        args_out[arg_idx]                       = (uintptr_t) field_str;
-        args_len_out[arg_idx]                   = strlen(field_str);
+        args_out[arg_idx]     = (uintptr_t) field_str;
+        args_len_out[arg_idx] = field_len;
         arg_idx++;
     }
 
@@ -865,9 +721,7 @@ int populate_field_args(zval*          field_values,
  */
 int prepare_h_getex_args(h_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
+                         unsigned long**   args_len_out) {
     if (!args->key || !args->fields || args->field_count == 0) {
         return 0;
     }
@@ -883,11 +737,7 @@ int prepare_h_getex_args(h_command_args_t* args,
         }
     }
 
-    *args_out          = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out      = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-    *allocated_strings = (char**) emalloc(
-        (2 + args->field_count) * sizeof(char*));  // expiry + field_count + field conversions
-    *allocated_count = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     int arg_idx = 0;
 
@@ -904,15 +754,8 @@ int prepare_h_getex_args(h_command_args_t* args,
         arg_idx++;
 
         if (strcmp(expiry_unit, "PERSIST") != 0) {
-            size_t expiry_len;
-            char*  expiry_str = safe_format_long_long(args->expiry, &expiry_len);
-            add_string_arg(expiry_str,
-                           expiry_len,
-                           args_out,
-                           args_len_out,
-                           &arg_idx,
-                           allocated_strings,
-                           allocated_count);
+            valkey_glide_arena_add_long_arg(
+                args->arena, args->expiry, *args_out, *args_len_out, arg_idx++);
         }
     }
 
@@ -922,24 +765,11 @@ int prepare_h_getex_args(h_command_args_t* args,
     arg_idx++;
 
     /* Add field count */
-    size_t field_count_len;
-    char*  field_count_str = safe_format_int(field_count, &field_count_len);
-    add_string_arg(field_count_str,
-                   field_count_len,
-                   args_out,
-                   args_len_out,
-                   &arg_idx,
-                   allocated_strings,
-                   allocated_count);
+    valkey_glide_arena_add_long_arg(args->arena, field_count, *args_out, *args_len_out, arg_idx++);
 
     /* Add fields only */
-    populate_field_args(args->fields,
-                        args->field_count,
-                        arg_idx,
-                        *args_out,
-                        *args_len_out,
-                        *allocated_strings,
-                        allocated_count);
+    populate_field_args(
+        args->arena, args->fields, args->field_count, arg_idx, *args_out, *args_len_out);
 
     return arg_count;
 }
@@ -976,6 +806,11 @@ int process_h_bool_result_async(CommandResponse* response, void* output, zval* r
     return ret_val;
 }
 
+/* Codec of the values in a reply, passed as output; NULL to leave them as is */
+static inline const valkey_glide_codec_t* h_output_codec(void* output) {
+    return (const valkey_glide_codec_t*) output;
+}
+
 /**
  * Batch-compatible wrapper for string responses
  */
@@ -983,8 +818,11 @@ int process_h_string_result_async(CommandResponse* response, void* output, zval*
     if (!response)
         return 0;
 
-    return command_response_to_zval(
-        response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+    return valkey_glide_response_to_zval(h_output_codec(output),
+                                         response,
+                                         return_value,
+                                         COMMAND_RESPONSE_NOT_ASSOSIATIVE,
+                                         false);
 }
 
 /**
@@ -992,15 +830,21 @@ int process_h_string_result_async(CommandResponse* response, void* output, zval*
  */
 int process_h_array_result_async(CommandResponse* response, void* output, zval* return_value) {
     /* Initialize return array */
-    return command_response_to_zval(
-        response, (zval*) return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+    return valkey_glide_response_to_zval(h_output_codec(output),
+                                         response,
+                                         (zval*) return_value,
+                                         COMMAND_RESPONSE_NOT_ASSOSIATIVE,
+                                         false);
 }
 /**
  * Batch-compatible wrapper for map responses
  */
 int process_h_map_result_async(CommandResponse* response, void* output, zval* return_value) {
-    return command_response_to_zval(
-        response, (zval*) return_value, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, false);
+    return command_response_to_string_map(h_output_codec(output),
+                                          response,
+                                          (zval*) return_value,
+                                          COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP,
+                                          false);
 }
 
 /**
@@ -1132,7 +976,10 @@ int process_h_mget_result(CommandResponse* response, void* output, zval* return_
             struct CommandResponse* element = &response->array_value[i];
 
             if (element->response_type == String) {
-                ZVAL_STRINGL(&field_value, element->string_value, element->string_value_len);
+                valkey_glide_decode_value(args->codec,
+                                          element->string_value,
+                                          element->string_value_len,
+                                          &field_value);
             } else if (element->response_type == Null) {
                 ZVAL_FALSE(&field_value);
             } else {
@@ -1226,30 +1073,20 @@ int process_h_incrbyfloat_result(CommandResponse* response, void* output, zval*
 /**
  * Convert zval array to command arguments with proper string conversion
  */
-int convert_zval_array_to_args(zval*          z_array,
-                               int            start_index,
-                               uintptr_t*     args,
-                               unsigned long* args_len,
-                               char**         allocated_strings,
-                               int*           allocated_count,
-                               int            max_allocations) {
+int convert_zval_array_to_args(valkey_glide_arena_t* arena,
+                               zval*                 z_array,
+                               int                   start_index,
+                               uintptr_t*            args,
+                               unsigned long*        args_len,
+                               int                   count) {
     int current_arg = start_index;
 
-    for (int i = 0; i < max_allocations; i++) {
-        zval*  value = &z_array[i];
+    for (int i = 0; i < count; i++) {
         size_t str_len;
-        int    need_free;
-
-        char* str_val = zval_to_string_safe(value, &str_len, &need_free);
+        char*  str_val = valkey_glide_arena_zval_to_string(arena, &z_array[i], &str_len);
 
         args[current_arg]     = (uintptr_t) str_val;
         args_len[current_arg] = str_len;
-
-        if (need_free) {
-            allocated_strings[*allocated_count] = str_val;
-            (*allocated_count)++;
-        }
-
         current_arg++;
     }
 
@@ -1259,12 +1096,12 @@ int convert_zval_array_to_args(zval*          z_array,
 /**
  * Process field-value pairs from associative array
  */
-int process_field_value_pairs(zval*          field_values,
-                              uintptr_t*     args,
-                              unsigned long* args_len,
-                              int            start_index,
-                              char**         allocated_strings,
-                              int*           allocated_count) {
+int process_field_value_pairs(valkey_glide_arena_t*       arena,
+                              zval*                       field_values,
+                              uintptr_t*                  args,
+                              unsigned long*              args_len,
+                              int                         start_index,
+                              const valkey_glide_codec_t* codec) {
     HashTable*   ht = Z_ARRVAL_P(field_values);
     zval*        data;
     zend_string* hash_key;
@@ -1272,6 +1109,9 @@ int process_field_value_pairs(zval*          field_values,
     int          arg_idx = start_index;
 
     ZEND_HASH_FOREACH_KEY_VAL(ht, num_idx, hash_key, data) {
+        size_t str_len;
+        char*  str_val = NULL;
+
         /* Add field */
         if (hash_key) {
             /* Associative array: key is the field */
@@ -1279,58 +1119,36 @@ int process_field_value_pairs(zval*          field_values,
             args_len[arg_idx] = ZSTR_LEN(hash_key);
         } else {
             /* Numeric index - convert to string */
-            char* field_str = long_to_string(num_idx, &args_len[arg_idx]);
-            if (!field_str) {
-                return 0;
-            }
-            args[arg_idx]                       = (uintptr_t) field_str;
-            allocated_strings[*allocated_count] = field_str;
-            (*allocated_count)++;
+            str_val           = valkey_glide_arena_long_to_string(arena, num_idx, &str_len);
+            args[arg_idx]     = (uintptr_t) str_val;
+            args_len[arg_idx] = str_len;
         }
         arg_idx++;
 
-        /* Add value with enhanced type handling */
-        size_t str_len;
-        int    need_free;
-        char*  str_val = NULL;
+        /* With a codec values are serialized and/or compressed */
+        if (codec) {
+            str_val = pack_h_value(arena, codec, data, &str_len);
+            if (!str_val) {
+                return 0;
+            }
+            args[arg_idx]     = (uintptr_t) str_val;
+            args_len[arg_idx] = str_len;
+            arg_idx++;
+            continue;
+        }
 
         /* Handle different zval types appropriately */
         switch (Z_TYPE_P(data)) {
             case IS_NULL:
                 /* Convert NULL to empty string */
-                str_val   = estrdup("");
-                str_len   = 0;
-                need_free = 1;
-                break;
-
-            case IS_FALSE:
-                /* Convert false to "0" */
-                str_val   = estrdup("0");
-                str_len   = 1;
-                need_free = 1;
-                break;
-
-            case IS_TRUE:
-                /* Convert true to "1" */
-                str_val   = estrdup("1");
-                str_len   = 1;
-                need_free = 1;
+                str_val = "";
+                str_len = 0;
                 break;
 
             case IS_ARRAY:
-                /* Convert array to JSON representation */
-                {
-                    smart_str json_str = {0};
-
-                    {
-                        /* Fallback to "Array" if JSON encoding fails */
-                        str_val   = estrdup("Array");
-                        str_len   = 5;
-                        need_free = 1;
-                        if (json_str.s)
-                            smart_str_free(&json_str);
-                    }
-                }
+                /* Arrays are sent as their type name */
+                str_val = "Array";
+                str_len = 5;
                 break;
 
             case IS_OBJECT:
@@ -1338,54 +1156,31 @@ int process_field_value_pairs(zval*          field_values,
                 if (Z_OBJ_HT_P(data)->cast_object) {
                     zval tmp;
                     if (Z_OBJ_HT_P(data)->cast_object(Z_OBJ_P(data), &tmp, IS_STRING) == SUCCESS) {
-                        str_val   = estrndup(Z_STRVAL(tmp), Z_STRLEN(tmp));
-                        str_len   = Z_STRLEN(tmp);
-                        need_free = 1;
+                        str_val = valkey_glide_arena_strndup(arena, Z_STRVAL(tmp), Z_STRLEN(tmp));
+                        str_len = Z_STRLEN(tmp);
                         zval_ptr_dtor(&tmp);
-                    } else {
-                        /* Fallback to object class name */
-                        zend_string* class_name = Z_OBJCE_P(data)->name;
-                        str_val   = estrndup(ZSTR_VAL(class_name), ZSTR_LEN(class_name));
-                        str_len   = ZSTR_LEN(class_name);
-                        need_free = 1;
+                        break;
                     }
-                } else {
-                    /* No cast_object handler, use class name */
-                    zend_string* class_name = Z_OBJCE_P(data)->name;
-                    str_val                 = estrndup(ZSTR_VAL(class_name), ZSTR_LEN(class_name));
-                    str_len                 = ZSTR_LEN(class_name);
-                    need_free               = 1;
                 }
+                /* Fallback to object class name, which outlives the command */
+                str_val = ZSTR_VAL(Z_OBJCE_P(data)->name);
+                str_len = ZSTR_LEN(Z_OBJCE_P(data)->name);
                 break;
 
             case IS_RESOURCE:
                 /* Convert resource to string representation */
-                str_val   = estrdup("Resource");
-                str_len   = 8;
-                need_free = 1;
+                str_val = "Resource";
+                str_len = 8;
                 break;
 
             default:
-                /* Use standard conversion for strings, numbers, etc. */
-                str_val = zval_to_string_safe(data, &str_len, &need_free);
+                /* Strings are used in place, numbers and booleans formatted */
+                str_val = valkey_glide_arena_zval_to_string(arena, data, &str_len);
                 break;
         }
 
-        if (!str_val) {
-            /* Final fallback - should not happen with above handling */
-            str_val   = estrdup("unknown");
-            str_len   = 7;
-            need_free = 1;
-        }
-
         args[arg_idx]     = (uintptr_t) str_val;
         args_len[arg_idx] = str_len;
-
-        if (need_free) {
-            allocated_strings[*allocated_count] = str_val;
-            (*allocated_count)++;
-        }
-
         arg_idx++;
     }
     ZEND_HASH_FOREACH_END();
@@ -1393,32 +1188,6 @@ int process_field_value_pairs(zval*          field_values,
     return arg_idx;
 }
 
-/**
- * Safe cleanup for allocated argument strings
- */
-void cleanup_h_command_args(char**         allocated_strings,
-                            int            allocated_count,
-                            uintptr_t*     args,
-                            unsigned long* args_len) {
-    /* Free allocated strings */
-    if (allocated_strings) {
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        efree(allocated_strings);
-    }
-
-    /* Free argument arrays */
-    if (args) {
-        efree(args);
-    }
-    if (args_len) {
-        efree(args_len);
-    }
-}
-
 /* ====================================================================
  * HASH COMMAND EXECUTION FUNCTIONS
  * ==================================================================== */
@@ -1439,6 +1208,7 @@ int execute_h_mset_command(valkey_glide_object* valkey_glide,
     args.key_len          = key_len;
     args.field_values     = keyvals;
     args.fv_count         = keyvals_count;
+    args.codec            = valkey_glide->codec;
 
     return execute_h_simple_command(valkey_glide, HMSet, &args, NULL, H_RESPONSE_OK, return_value);
 }
@@ -1481,6 +1251,7 @@ int execute_h_mget_command(valkey_glide_object* valkey_glide,
     args->key_len          = key_len;
     args->fields           = fields;
     args->field_count      = fields_count;
+    args->codec            = valkey_glide->codec;
 
     return execute_h_generic_command(
         valkey_glide, HMGet, args, args, process_h_mget_result, return_value);
@@ -1545,8 +1316,12 @@ int execute_hget_command(zval* object, int argc, zval* return_value, zend_class_
 
 
     /* Execute with batch support */
-    if (execute_h_simple_command(
-            valkey_glide, HGet, &args, NULL, H_RESPONSE_STRING, return_value)) {
+    if (execute_h_simple_command(valkey_glide,
+                                 HGet,
+                                 &args,
+                                 (void*) valkey_glide->codec,
+                                 H_RESPONSE_STRING,
+                                 return_value)) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
             ZVAL_COPY(return_value, object);
@@ -1724,6 +1499,7 @@ int execute_hset_command(zval* object, int argc, zval* return_value, zend_class_
     args.field_values     = z_args;
     args.fv_count         = arg_count;
     args.is_array_arg     = is_array_arg;
+    args.codec            = valkey_glide->codec;
 
     /* Execute with batch support */
     if (execute_h_simple_command(valkey_glide, HSet, &args, NULL, H_RESPONSE_INT, return_value)) {
@@ -1744,22 +1520,23 @@ int execute_hset_command(zval* object, int argc, zval* return_value, zend_class_
  */
 int execute_hsetnx_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     valkey_glide_object* valkey_glide;
-    char *               key = NULL, *field = NULL, *val = NULL;
-    size_t               key_len, field_len, val_len;
+    char *               key = NULL, *field = NULL;
+    size_t               key_len, field_len;
+    zval*                z_value;
+    zend_string*         packed;
     int                  result;
 
     /* Parse parameters */
     if (zend_parse_method_parameters(argc,
                                      object,
-                                     "Osss",
+                                     "Ossz",
                                      &object,
                                      ce,
                                      &key,
                                      &key_len,
                                      &field,
                                      &field_len,
-                                     &val,
-                                     &val_len) == FAILURE) {
+                                     &z_value) == FAILURE) {
         return 0;
     }
 
@@ -1768,19 +1545,27 @@ int execute_hsetnx_command(zval* object, int argc, zval* return_value, zend_clas
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
+
+    packed = valkey_glide_pack_value(valkey_glide->codec, z_value);
+    if (!packed) {
+        return 0;
+    }
+
     h_command_args_t args = {0};
     args.glide_client     = valkey_glide->glide_client;
     args.key              = key;
     args.key_len          = key_len;
     args.field            = field;
     args.field_len        = field_len;
-    args.value            = val;
-    args.value_len        = val_len;
-
+    args.value            = ZSTR_VAL(packed);
+    args.value_len        = ZSTR_LEN(packed);
 
     /* Execute the HSETNX command */
-    if (execute_h_simple_command(
-            valkey_glide, HSetNX, &args, NULL, H_RESPONSE_BOOL, return_value)) {
+    result = execute_h_simple_command(
+        valkey_glide, HSetNX, &args, NULL, H_RESPONSE_BOOL, return_value);
+    zend_string_release(packed);
+
+    if (result) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
             ZVAL_COPY(return_value, object);
@@ -2066,8 +1851,12 @@ int execute_hvals_command(zval* object, int argc, zval* return_value, zend_class
     args.key_len          = key_len;
 
     /* Execute with batch support */
-    if (execute_h_simple_command(
-            valkey_glide, HVals, &args, NULL, H_RESPONSE_ARRAY, return_value)) {
+    if (execute_h_simple_command(valkey_glide,
+                                 HVals,
+                                 &args,
+                                 (void*) valkey_glide->codec,
+                                 H_RESPONSE_ARRAY,
+                                 return_value)) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
             ZVAL_COPY(return_value, object);
@@ -2107,8 +1896,12 @@ int execute_hgetall_command(zval* object, int argc, zval* return_value, zend_cla
 
 
     /* Execute with batch support */
-    if (execute_h_simple_command(
-            valkey_glide, HGetAll, &args, NULL, H_RESPONSE_MAP, return_value)) {
+    if (execute_h_simple_command(valkey_glide,
+                                 HGetAll,
+                                 &args,
+                                 (void*) valkey_glide->codec,
+                                 H_RESPONSE_MAP,
+                                 return_value)) {
         if (valkey_glide->is_in_batch_mode) {
             /* In batch mode, return $this for method chaining */
             ZVAL_COPY(return_value, object);
@@ -3127,3 +2920,254 @@ int execute_hgetex_command(zval* object, int argc, zval* return_value, zend_clas
     }
     return 0;
 }
+
+/* ====================================================================
+ * MULTI-KEY HASH COMMANDS
+ * ==================================================================== */
+
+/* Fields requested by hMgetMany(), shared by the HMGET of every key */
+typedef struct {
+    zval*                       fields;
+    int                         field_count;
+    const valkey_glide_codec_t* codec;
+} h_many_fields_t;
+
+/**
+ * Map one HMGET reply of hMgetMany() back to its field names; the fields are
+ * shared between commands so, unlike process_h_mget_result, nothing is freed
+ */
+static int process_h_mget_many_result(CommandResponse* response, void* output, zval* return_value) {
+    h_many_fields_t* many = (h_many_fields_t*) output;
+
+    if (!response || response->response_type != Array) {
+        ZVAL_FALSE(return_value);
+        return 0;
+    }
+
+    array_init_size(return_value, many->field_count);
+    for (int i = 0; i < many->field_count && i < response->array_value_len; i++) {
+        struct CommandResponse* element = &response->array_value[i];
+        zend_string*            field   = Z_STR(many->fields[i]);
+        zval                    value;
+
+        if (element->response_type == String) {
+            valkey_glide_decode_value(
+                many->codec, element->string_value, element->string_value_len, &value);
+        } else if (element->response_type == Null) {
+            ZVAL_FALSE(&value);
+        } else {
+            ZVAL_NULL(&value);
+        }
+        add_assoc_zval_ex(return_value, ZSTR_VAL(field), ZSTR_LEN(field), &value);
+    }
+
+    return 1;
+}
+
+/*
+ * Queue one hash command per key in a non-atomic batch and send it with a
+ * single FFI call. Every command touches one key, so in cluster mode the core
+ * routes it to the node owning the key's slot and sends each node its share
+ * concurrently. Returns an array keyed by hash key.
+ *
+ * For HMSET `ht` maps keys to field/value arrays, otherwise it lists the keys.
+ */
+static int execute_h_many_command(valkey_glide_object* valkey_glide,
+                                  enum RequestType     cmd_type,
+                                  HashTable*           ht,
+                                  h_many_fields_t*     many,
+                                  z_result_processor_t process_result,
+                                  zval*                return_value) {
+    uint32_t                    count = zend_hash_num_elements(ht);
+    zend_string**               keys;
+    valkey_glide_batch_buffer_t buffer;
+    zval                        results;
+    zend_string*                str_key;
+    zend_ulong                  num_key;
+    zval*                       value;
+    uint32_t                    i = 0, queued = 0;
+    int                         status = 0;
+    void*                       output;
+    valkey_glide_arena_t        arena;
+
+    if (count == 0) {
+        array_init(return_value);
+        return 1;
+    }
+
+    /* HGETALL replies are decoded like those of hGetAll() */
+    output = many ? (void*) many : (void*) valkey_glide->codec;
+    keys   = safe_emalloc(count, sizeof(zend_string*), 0);
+    memset(&buffer, 0, sizeof(buffer));
+    valkey_glide_arena_init(&arena);
+
+    ZEND_HASH_FOREACH_KEY_VAL(ht, num_key, str_key, value) {
+        h_command_args_t args     = {0};
+        uintptr_t*       cmd_args = NULL;
+        unsigned long*   args_len = NULL;
+        int              arg_count;
+
+        ZVAL_DEREF(value);
+        if (cmd_type == HMSet) {
+            if (Z_TYPE_P(value) != IS_ARRAY || zend_hash_num_elements(Z_ARRVAL_P(value)) == 0) {
+                zend_argument_value_error(1, "must map every key to a non-empty array of fields");
+                goto cleanup;
+            }
+            keys[i]           = str_key ? zend_string_copy(str_key) : zend_long_to_str(num_key);
+            args.field_values = value;
+            args.fv_count     = zend_hash_num_elements(Z_ARRVAL_P(value));
+        } else {
+            keys[i]          = zval_get_string(value);
+            args.fields      = many ? many->fields : NULL;
+            args.field_count = many ? many->field_count : 0;
+        }
+        i++;
+
+        args.glide_client = valkey_glide->glide_client;
+        args.key          = ZSTR_VAL(keys[i - 1]);
+        args.key_len      = ZSTR_LEN(keys[i - 1]);
+        args.codec        = valkey_glide->codec;
+        args.arena        = &arena;
+
+        /* The batch buffer copies the arguments, so the arena is reset right away */
+        arg_count = prepare_h_command_args(cmd_type, &args, &cmd_args, &args_len);
+        if (arg_count > 0) {
+            valkey_glide_batch_buffer_append(
+                &buffer, cmd_type, cmd_args, args_len, arg_count, output, process_result);
+        }
+        valkey_glide_arena_reset(&arena);
+
+        if (arg_count <= 0) {
+            goto cleanup;
+        }
+        queued++;
+    }
+    ZEND_HASH_FOREACH_END();
+
+    VALKEY_LOG_DEBUG_FMT("hash_many", "Sending %u hash commands as one batch", queued);
+
+    array_init_size(&results, queued);
+    if (valkey_glide_batch_buffer_send(
+            valkey_glide->glide_client, &buffer, 0, queued, false, &results)) {
+        array_init_size(return_value, queued);
+        for (i = 0; i < queued; i++) {
+            zval* reply = zend_hash_index_find(Z_ARRVAL(results), i);
+
+            Z_TRY_ADDREF_P(reply);
+            zend_symtable_update(Z_ARRVAL_P(return_value), keys[i], reply);
+        }
+        status = 1;
+    }
+    zval_ptr_dtor(&results);
+
+cleanup:
+    valkey_glide_batch_buffer_free(&buffer);
+    while (i > 0) {
+        zend_string_release(keys[--i]);
+    }
+    efree(keys);
+
+    return status;
+}
+
+/**
+ * Execute hGetAllMany(array $keys): HGETALL of many hashes in one round trip
+ */
+int execute_hgetall_many_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_keys;
+
+    if (zend_parse_method_parameters(argc, object, "Oa", &object, ce, &z_keys) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Multi-key hash commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    return execute_h_many_command(
+        valkey_glide, HGetAll, Z_ARRVAL_P(z_keys), NULL, process_h_map_result_async, return_value);
+}
+
+/**
+ * Execute hMgetMany(array $keys, array $fields): the same HMGET on many hashes
+ */
+int execute_hmget_many_command(zval*             object,
+                               int               argc,
+                               zval*             return_value,
+                               zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval *               z_keys, *z_fields, *field;
+    h_many_fields_t      many;
+    int                  status;
+
+    if (zend_parse_method_parameters(argc, object, "Oaa", &object, ce, &z_keys, &z_fields) ==
+        FAILURE) {
+        return 0;
+    }
+
+    if (zend_hash_num_elements(Z_ARRVAL_P(z_fields)) == 0) {
+        zend_argument_value_error(2, "must contain at least one field");
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Multi-key hash commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    /* Convert the fields once; every HMGET and reply mapping shares them */
+    many.fields      = safe_emalloc(zend_hash_num_elements(Z_ARRVAL_P(z_fields)), sizeof(zval), 0);
+    many.field_count = 0;
+    many.codec       = valkey_glide->codec;
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(z_fields), field) {
+        ZVAL_STR(&many.fields[many.field_count++], zval_get_string(field));
+    }
+    ZEND_HASH_FOREACH_END();
+
+    status = execute_h_many_command(valkey_glide,
+                                    HMGet,
+                                    Z_ARRVAL_P(z_keys),
+                                    &many,
+                                    process_h_mget_many_result,
+                                    return_value);
+
+    for (int i = 0; i < many.field_count; i++) {
+        zval_ptr_dtor(&many.fields[i]);
+    }
+    efree(many.fields);
+
+    return status;
+}
+
+/**
+ * Execute hMsetMany(array $keyToFields): HMSET of many hashes in one round trip
+ */
+int execute_hmset_many_command(zval*             object,
+                               int               argc,
+                               zval*             return_value,
+                               zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_key_fields;
+
+    if (zend_parse_method_parameters(argc, object, "Oa", &object, ce, &z_key_fields) ==
+        FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Multi-key hash commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    return execute_h_many_command(valkey_glide,
+                                  HMSet,
+                                  Z_ARRVAL_P(z_key_fields),
+                                  NULL,
+                                  process_h_ok_result_async,
+                                  return_value);
+}
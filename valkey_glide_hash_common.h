@@ -23,6 +23,7 @@
 
 #include "command_response.h"
 #include "include/glide_bindings.h"
+#include "valkey_glide_arena.h"
 #include "valkey_glide_commands_common.h"
 
 /* ====================================================================
@@ -76,6 +77,12 @@ typedef struct _h_command_args_t {
     expiry_type_t expiry_enum; /* Expiry type enum for fast comparison */
     const char*   expiry_type; /* Expiry type string: EX, PX, EXAT, PXAT, KEEPTTL, PERSIST */
     const char*   mode;        /* Mode: NX, XX, GT, LT */
+
+    /* Value encoding applied to HSET, HMSET and HMGET, NULL for none */
+    const struct valkey_glide_codec* codec;
+
+    /* Per-command allocations, owned by the executing framework function */
+    valkey_glide_arena_t* arena;
 } h_command_args_t;
 
 // Helper functions for expiry type conversion
@@ -114,9 +121,7 @@ static inline const char* expiry_type_to_string(expiry_type_t type) {
  */
 typedef int (*h_arg_preparer_t)(h_command_args_t* args,
                                 uintptr_t**       args_out,
-                                unsigned long**   args_len_out,
-                                char***           allocated_strings,
-                                int*              allocated_count);
+                                unsigned long**   args_len_out);
 
 /* ====================================================================
  * CORE FRAMEWORK FUNCTIONS
@@ -146,59 +151,55 @@ int execute_h_simple_command(valkey_glide_object* valkey_glide,
  * ARGUMENT PREPARATION FUNCTIONS
  * ==================================================================== */
 
+/**
+ * Prepare arguments for any hash command, dispatching on the request type
+ */
+int prepare_h_command_args(enum RequestType  cmd_type,
+                           h_command_args_t* args,
+                           uintptr_t**       args_out,
+                           unsigned long**   args_len_out);
+
 /**
  * Prepare arguments for single-key commands (HLEN)
  */
 int prepare_h_key_only_args(h_command_args_t* args,
                             uintptr_t**       args_out,
-                            unsigned long**   args_len_out,
-                            char***           allocated_strings,
-                            int*              allocated_count);
+                            unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for single-field commands (HGET, HEXISTS, HSTRLEN)
  */
 int prepare_h_single_field_args(h_command_args_t* args,
                                 uintptr_t**       args_out,
-                                unsigned long**   args_len_out,
-                                char***           allocated_strings,
-                                int*              allocated_count);
+                                unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for field-value commands (HSETNX)
  */
 int prepare_h_field_value_args(h_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count);
+                               unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for multi-field commands (HDEL, HMGET)
  */
 int prepare_h_multi_field_args(h_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count);
+                               unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for HSET command (handles both formats)
  */
 int prepare_h_set_args(h_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count);
+                       unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for HMSET command
  */
 int prepare_h_mset_args(h_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count);
+                        unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for increment commands (HINCRBY, HINCRBYFLOAT)
@@ -206,8 +207,6 @@ int prepare_h_mset_args(h_command_args_t* args,
 int prepare_h_incr_args(h_command_args_t* args,
                         uintptr_t**       args_out,
                         unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count,
                         enum RequestType  cmd_type);
 
 /**
@@ -215,49 +214,37 @@ int prepare_h_incr_args(h_command_args_t* args,
  */
 int prepare_h_randfield_args(h_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count);
+                             unsigned long**   args_len_out);
 
 /**
  * Prepare arguments for Hash Field Expiration commands
  */
 int prepare_h_hfe_args(h_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count);
+                       unsigned long**   args_len_out);
 
 int prepare_h_expire_args(h_command_args_t* args,
                           uintptr_t**       args_out,
-                          unsigned long**   args_len_out,
-                          char***           allocated_strings,
-                          int*              allocated_count);
+                          unsigned long**   args_len_out);
 
 int prepare_h_field_only_args(h_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count);
+                              unsigned long**   args_len_out);
 
 int prepare_h_getex_args(h_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count);
+                         unsigned long**   args_len_out);
 
 /**
- * Safely populate field arguments from zval array
- * Handles string conversion and memory management correctly
- * NOTE: Always creates copies because cleanup code expects to efree() all allocated_strings
+ * Populate field arguments from a zval array
+ * Strings are referenced in place, other types are converted into the arena
  */
-int populate_field_args(zval*          field_values,
-                        int            fv_count,
-                        int            start_idx,
-                        uintptr_t*     args_out,
-                        unsigned long* args_len_out,
-                        char**         allocated_strings,
-                        int*           allocated_count);
+int populate_field_args(valkey_glide_arena_t* arena,
+                        zval*                 field_values,
+                        int                   fv_count,
+                        int                   start_idx,
+                        uintptr_t*            args_out,
+                        unsigned long*        args_len_out);
 
 /* ====================================================================
  * RESULT PROCESSING FUNCTIONS
@@ -280,31 +267,22 @@ int process_h_incrbyfloat_result(CommandResponse* respone, void* output, zval* r
 /**
  * Convert zval array to command arguments with proper string conversion
  */
-int convert_zval_array_to_args(zval*          z_array,
-                               int            start_index,
-                               uintptr_t*     args,
-                               unsigned long* args_len,
-                               char**         allocated_strings,
-                               int*           allocated_count,
-                               int            max_allocations);
+int convert_zval_array_to_args(valkey_glide_arena_t* arena,
+                               zval*                 z_array,
+                               int                   start_index,
+                               uintptr_t*            args,
+                               unsigned long*        args_len,
+                               int                   count);
 
 /**
  * Process field-value pairs from associative array
  */
-int process_field_value_pairs(zval*          field_values,
-                              uintptr_t*     args,
-                              unsigned long* args_len,
-                              int            start_index,
-                              char**         allocated_strings,
-                              int*           allocated_count);
-
-/**
- * Safe cleanup for allocated argument strings
- */
-void cleanup_h_command_args(char**         allocated_strings,
-                            int            allocated_count,
-                            uintptr_t*     args,
-                            unsigned long* args_len);
+int process_field_value_pairs(valkey_glide_arena_t*            arena,
+                              zval*                            field_values,
+                              uintptr_t*                       args,
+                              unsigned long*                   args_len,
+                              int                              start_index,
+                              const struct valkey_glide_codec* codec);
 
 /* ====================================================================
  * RESPONSE TYPE CONSTANTS
@@ -340,6 +318,14 @@ int execute_hgetall_command(zval* object, int argc, zval* return_value, zend_cla
 int execute_hstrlen_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 int execute_hrandfield_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 
+/* Multi-key hash executors, sent as one non-atomic batch */
+int execute_hgetall_many_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce);
+int execute_hmget_many_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+int execute_hmset_many_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+
 
 int execute_h_mset_command(valkey_glide_object* valkey_glide,
                            const char*          key,
@@ -648,6 +634,48 @@ int process_h_getex_result_async(CommandResponse* response, void* output, zval*
         RETURN_FALSE;                                                                 \
     }
 
+#define HGETALL_MANY_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, hGetAllMany) {                                               \
+        if (execute_hgetall_many_command(getThis(),                                     \
+                                         ZEND_NUM_ARGS(),                               \
+                                         return_value,                                  \
+                                         strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                             ? get_valkey_glide_cluster_ce()            \
+                                             : get_valkey_glide_ce())) {                \
+            return;                                                                     \
+        }                                                                               \
+        zval_dtor(return_value);                                                        \
+        RETURN_FALSE;                                                                   \
+    }
+
+#define HMGET_MANY_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, hMgetMany) {                                               \
+        if (execute_hmget_many_command(getThis(),                                     \
+                                       ZEND_NUM_ARGS(),                               \
+                                       return_value,                                  \
+                                       strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                           ? get_valkey_glide_cluster_ce()            \
+                                           : get_valkey_glide_ce())) {                \
+            return;                                                                   \
+        }                                                                             \
+        zval_dtor(return_value);                                                      \
+        RETURN_FALSE;                                                                 \
+    }
+
+#define HMSET_MANY_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, hMsetMany) {                                               \
+        if (execute_hmset_many_command(getThis(),                                     \
+                                       ZEND_NUM_ARGS(),                               \
+                                       return_value,                                  \
+                                       strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                           ? get_valkey_glide_cluster_ce()            \
+                                           : get_valkey_glide_ce())) {                \
+            return;                                                                   \
+        }                                                                             \
+        zval_dtor(return_value);                                                      \
+        RETURN_FALSE;                                                                 \
+    }
+
 /* ====================================================================
  * CONVENIENCE MACROS
  * ==================================================================== */
@@ -0,0 +1,258 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "valkey_glide_info.h"
+
+/* CLIENT LIST fields whose keys are kept for the following rows */
+#define CLIENT_LIST_MAX_FIELDS 64
+
+/* Longer integers could overflow a zend_long and stay strings */
+#if SIZEOF_ZEND_LONG == 8
+#define CLIENT_LIST_MAX_DIGITS 18
+#else
+#define CLIENT_LIST_MAX_DIGITS 9
+#endif
+
+typedef struct {
+    zend_string* key;
+    bool         text; /* Chosen by the client, never converted to a number */
+} client_list_field_t;
+
+/* Empty and one-byte values reuse PHP's interned strings */
+static void token_to_string_zval(const char* token, size_t token_len, zval* out) {
+    if (token_len == 0) {
+        ZVAL_EMPTY_STRING(out);
+    } else if (token_len == 1) {
+        ZVAL_INTERNED_STR(out, ZSTR_CHAR((zend_uchar) token[0]));
+    } else {
+        ZVAL_STRINGL(out, token, token_len);
+    }
+}
+
+static bool info_key_ends_with(const char* key, size_t key_len, const char* suffix) {
+    size_t suffix_len = strlen(suffix);
+
+    return key_len >= suffix_len && memcmp(key + key_len - suffix_len, suffix, suffix_len) == 0;
+}
+
+/* Identifiers such as redis_git_sha1:00000000 or an all-digit run_id stay strings */
+static bool info_field_is_text(const char* key, size_t key_len) {
+    return info_key_ends_with(key, key_len, "_sha1") || info_key_ends_with(key, key_len, "_id") ||
+           info_key_ends_with(key, key_len, "_replid") ||
+           info_key_ends_with(key, key_len, "_replid2") ||
+           zend_memnstr(key, "_git_", sizeof("_git_") - 1, key + key_len) != NULL;
+}
+
+void valkey_glide_parse_info(const char* info, size_t info_len, zval* return_value) {
+    const char* p   = info;
+    const char* end = info + info_len;
+
+    if (!info || info_len == 0) {
+        ZVAL_FALSE(return_value);
+        return;
+    }
+
+    array_init(return_value);
+
+    while (p < end) {
+        const char* eol   = p;
+        const char* colon = NULL;
+
+        /* One pass finds both the end of the line and the first ':' */
+        while (eol < end && *eol != '\r' && *eol != '\n') {
+            if (!colon && *eol == ':') {
+                colon = eol;
+            }
+            eol++;
+        }
+
+        /* Section headers, empty lines and lines without a key are skipped */
+        if (*p != '#' && colon && colon > p) {
+            const char* value     = colon + 1;
+            size_t      value_len = (size_t) (eol - value);
+            bool        text      = info_field_is_text(p, (size_t) (colon - p));
+            zend_long   lval;
+            double      dval;
+            zval        z_value;
+
+            switch (value_len && !text ? is_numeric_string(value, value_len, &lval, &dval, 0) : 0) {
+                case IS_LONG:
+                    ZVAL_LONG(&z_value, lval);
+                    break;
+                case IS_DOUBLE:
+                    ZVAL_DOUBLE(&z_value, dval);
+                    break;
+                default:
+                    token_to_string_zval(value, value_len, &z_value);
+                    break;
+            }
+            zend_symtable_str_update(Z_ARRVAL_P(return_value), p, colon - p, &z_value);
+        }
+
+        p = eol + 1;
+    }
+}
+
+int valkey_glide_parse_info_by_node(const CommandResponse* response, zval* return_value) {
+    int64_t i;
+
+    if (!response || response->response_type != Map) {
+        return 0;
+    }
+
+    array_init_size(return_value, (uint32_t) response->array_value_len);
+    for (i = 0; i < response->array_value_len; i++) {
+        const CommandResponse* entry = &response->array_value[i];
+        zval                   node_info;
+
+        if (!entry->map_key || entry->map_key->response_type != String || !entry->map_value ||
+            entry->map_value->response_type != String) {
+            continue;
+        }
+
+        valkey_glide_parse_info(
+            entry->map_value->string_value, entry->map_value->string_value_len, &node_info);
+        zend_hash_str_update(Z_ARRVAL_P(return_value),
+                             entry->map_key->string_value,
+                             entry->map_key->string_value_len,
+                             &node_info);
+    }
+    return 1;
+}
+
+/* Fields a client sets itself stay strings even when they look like numbers */
+static bool client_list_field_is_text(const char* key, size_t key_len) {
+    switch (key_len) {
+        case sizeof("name") - 1:
+            return memcmp(key, "name", key_len) == 0 || memcmp(key, "user", key_len) == 0;
+        case sizeof("lib-ver") - 1:
+            return memcmp(key, "lib-ver", key_len) == 0;
+        case sizeof("lib-name") - 1:
+            return memcmp(key, "lib-name", key_len) == 0;
+        default:
+            return false;
+    }
+}
+
+/* Plain decimal integers only, so addresses, flags and versions stay strings */
+static bool client_list_value_to_long(const char* value, size_t value_len, zend_long* out) {
+    size_t     i        = value_len > 0 && value[0] == '-' ? 1 : 0;
+    zend_ulong magnitude = 0;
+
+    if (i == value_len || value_len - i > CLIENT_LIST_MAX_DIGITS) {
+        return false;
+    }
+    for (; i < value_len; i++) {
+        if (value[i] < '0' || value[i] > '9') {
+            return false;
+        }
+        magnitude = magnitude * 10 + (zend_ulong) (value[i] - '0');
+    }
+
+    *out = value[0] == '-' ? -(zend_long) magnitude : (zend_long) magnitude;
+    return true;
+}
+
+void valkey_glide_parse_client_list(const char* list, size_t list_len, zval* return_value) {
+    client_list_field_t fields[CLIENT_LIST_MAX_FIELDS];
+    size_t              field_count = 0;
+    uint32_t            row_size    = 0;
+    const char*         p           = list;
+    const char*         end         = list + list_len;
+    size_t              i;
+
+    array_init(return_value);
+    if (!list) {
+        return;
+    }
+
+    while (p < end) {
+        const char* eol = p;
+        zval        client;
+        size_t      position = 0;
+
+        while (eol < end && *eol != '\n' && *eol != '\r') {
+            eol++;
+        }
+        if (eol == p) {
+            p++;
+            continue;
+        }
+
+        /* Rows list the same fields, so the previous row sizes this one */
+        array_init_size(&client, row_size);
+
+        while (p < eol) {
+            const char* token  = p;
+            const char* equals = NULL;
+
+            while (p < eol && *p != ' ') {
+                if (!equals && *p == '=') {
+                    equals = p;
+                }
+                p++;
+            }
+
+            if (equals && equals > token) {
+                size_t               key_len   = (size_t) (equals - token);
+                const char*          value     = equals + 1;
+                size_t               value_len = (size_t) (p - value);
+                client_list_field_t* field     = NULL;
+                zend_string*         key;
+                bool                 text;
+                zend_long            lval;
+                zval                 z_value;
+
+                if (position < CLIENT_LIST_MAX_FIELDS) {
+                    field = &fields[position];
+                }
+
+                /* The key at this position is usually the one the previous row had */
+                if (field && position < field_count && ZSTR_LEN(field->key) == key_len &&
+                    memcmp(ZSTR_VAL(field->key), token, key_len) == 0) {
+                    key  = field->key;
+                    text = field->text;
+                } else {
+                    key  = zend_string_init(token, key_len, 0);
+                    text = client_list_field_is_text(token, key_len);
+                    if (field) {
+                        if (position < field_count) {
+                            zend_string_release(field->key);
+                        } else {
+                            field_count = position + 1;
+                        }
+                        field->key  = key;
+                        field->text = text;
+                    }
+                }
+
+                if (!text && client_list_value_to_long(value, value_len, &lval)) {
+                    ZVAL_LONG(&z_value, lval);
+                } else {
+                    token_to_string_zval(value, value_len, &z_value);
+                }
+                zend_symtable_update(Z_ARRVAL(client), key, &z_value);
+
+                if (!field) {
+                    zend_string_release(key);
+                }
+                position++;
+            }
+
+            while (p < eol && *p == ' ') {
+                p++;
+            }
+        }
+
+        row_size = zend_hash_num_elements(Z_ARRVAL(client));
+        add_next_index_zval(return_value, &client);
+        p = eol + 1;
+    }
+
+    for (i = 0; i < field_count; i++) {
+        zend_string_release(fields[i].key);
+    }
+}
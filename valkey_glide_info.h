@@ -0,0 +1,38 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_INFO_H
+#define VALKEY_GLIDE_INFO_H
+
+#include <stddef.h>
+
+#include "include/glide_bindings.h"
+#include "php.h"
+
+/* ====================================================================
+ * INFO AND CLIENT LIST PARSING
+ * ==================================================================== */
+
+/*
+ * Both replies are tokenized in place, straight out of the FFI buffer:
+ * keys and values become zend_strings or numbers without any temporary
+ * copy. Sections are chosen by the arguments sent with INFO, so the
+ * parser only skips the '#' header lines.
+ */
+
+/* INFO text to field => value, numeric values as int or float; false when empty */
+void valkey_glide_parse_info(const char* info, size_t info_len, zval* return_value);
+
+/*
+ * A multi-node INFO reply, a Map of "host:port" => INFO text, to
+ * "host:port" => parsed INFO. Returns 0 if the reply has another shape.
+ */
+int valkey_glide_parse_info_by_node(const CommandResponse* response, zval* return_value);
+
+/*
+ * CLIENT LIST text to one field => value array per client. Integer fields
+ * become ints, except those a client sets itself (name, user, lib-name,
+ * lib-ver). Every row lists the same fields, so their keys are shared.
+ */
+void valkey_glide_parse_client_list(const char* list, size_t list_len, zval* return_value);
+
+#endif /* VALKEY_GLIDE_INFO_H */
@@ -16,6 +16,7 @@
 #include "valkey_glide_list_common.h"
 
 #include "common.h"
+#include "valkey_glide_numeric.h"
 #include "valkey_glide_z_common.h"
 extern zend_class_entry* ce;
 extern zend_class_entry* get_valkey_glide_exception_ce();
@@ -24,26 +25,6 @@ extern zend_class_entry* get_valkey_glide_exception_ce();
  * UTILITY FUNCTIONS
  * ==================================================================== */
 
-/**
- * Allocate command arguments arrays
- */
-int allocate_list_command_args(int count, uintptr_t** args_out, unsigned long** args_len_out) {
-    *args_out     = (uintptr_t*) emalloc(count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(count * sizeof(unsigned long));
-
-    return 1;
-}
-
-/**
- * Free command arguments arrays
- */
-void free_list_command_args(uintptr_t* args, unsigned long* args_len) {
-    if (args)
-        efree(args);
-    if (args_len)
-        efree(args_len);
-}
-
 int process_list_ok_result_async(CommandResponse* response, void* output, zval* return_value) {
     if (!response) {
         ZVAL_FALSE(return_value);
@@ -83,7 +64,7 @@ int process_list_string_result_async(CommandResponse* response, void* output, zv
         return 0;
 
     if (response->response_type == String) {
-        ZVAL_STRINGL(return_value, response->string_value, response->string_value_len);
+        ZVAL_STR(return_value, command_response_to_zend_string(response));
         return 1;
     } else if (response->response_type == Null) {
         ZVAL_FALSE(return_value);
@@ -96,8 +77,8 @@ int process_list_string_result_async(CommandResponse* response, void* output, zv
  * Batch-compatible wrapper for array responses
  */
 int process_list_array_result_async(CommandResponse* response, void* output, zval* return_value) {
-    return command_response_to_zval(
-        response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+    return command_response_to_string_list(
+        NULL, response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
 }
 
 
@@ -111,7 +92,7 @@ int process_list_pop_result_async(CommandResponse* response, void* output, zval*
 
     if (response->response_type == String) {
         /* Single value returned */
-        ZVAL_STRINGL(return_value, response->string_value, response->string_value_len);
+        ZVAL_STR(return_value, command_response_to_zend_string(response));
         return 1;
     } else if (response->response_type == Array) {
         /* Multiple values returned (when count > 1) */
@@ -182,18 +163,20 @@ int execute_list_generic_command(valkey_glide_object* valkey_glide,
                                  void*                result_ptr,
                                  z_result_processor_t process_result,
                                  zval*                return_value) {
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* args_len          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
-    int            status            = 0;
+    uintptr_t*           cmd_args  = NULL;
+    unsigned long*       args_len  = NULL;
+    int                  arg_count = 0;
+    int                  status    = 0;
+    valkey_glide_arena_t arena;
 
     /* Validate basic arguments */
     if (!valkey_glide || !valkey_glide->glide_client) {
         return 0;
     }
 
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
+
     /* Prepare arguments based on command type */
     switch (cmd_type) {
         case LLen:
@@ -203,54 +186,44 @@ int execute_list_generic_command(valkey_glide_object* valkey_glide,
         case RPush:
         case LPushX:
         case RPushX:
-            arg_count = prepare_list_key_values_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_key_values_args(args, &cmd_args, &args_len);
             break;
         case LPop:
         case RPop:
-            arg_count = prepare_list_key_count_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_key_count_args(args, &cmd_args, &args_len);
             break;
         case BLPop:
         case BRPop:
-            arg_count = prepare_list_blocking_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_blocking_args(args, &cmd_args, &args_len);
             break;
         case LRange:
-            arg_count = prepare_list_range_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_range_args(args, &cmd_args, &args_len);
             break;
         case LPos:
-            arg_count = prepare_list_position_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_position_args(args, &cmd_args, &args_len);
             break;
         case LInsert:
             arg_count = prepare_list_insert_args(args, &cmd_args, &args_len);
             break;
         case LIndex:
         case LSet:
-            arg_count = prepare_list_index_set_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_index_set_args(args, &cmd_args, &args_len);
             break;
         case LRem:
-            arg_count = prepare_list_rem_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_rem_args(args, &cmd_args, &args_len);
             break;
         case LTrim:
-            arg_count = prepare_list_trim_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_trim_args(args, &cmd_args, &args_len);
             break;
         case LMove:
         case BLMove:
         case RPopLPush:
         case BRPopLPush:
-            arg_count = prepare_list_move_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_move_args(args, &cmd_args, &args_len);
             break;
         case LMPop:
         case BLMPop:
-            arg_count = prepare_list_mpop_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_list_mpop_args(args, &cmd_args, &args_len);
             break;
         default:
             return 0;
@@ -284,11 +257,8 @@ int execute_list_generic_command(valkey_glide_object* valkey_glide,
     }
 
 cleanup:
-    /* Free allocated strings */
-    FREE_LIST_ALLOCATED_STRINGS(allocated_strings, allocated_count);
-
-    /* Free command arguments */
-    free_list_command_args(cmd_args, args_len);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
 
     return status;
 }
@@ -297,32 +267,14 @@ cleanup:
  * Allocate a string representation of a long integer
  */
 char* alloc_list_number_string(long value, size_t* len_out) {
-    char   temp[32];
-    size_t len    = snprintf(temp, sizeof(temp), "%ld", value);
-    char*  result = emalloc(len + 1);
-    if (result) {
-        memcpy(result, temp, len);
-        result[len] = '\0';
-        if (len_out)
-            *len_out = len;
-    }
-    return result;
+    return valkey_glide_long_estrdup(value, len_out);
 }
 
 /**
  * Allocate a string representation of a double
  */
 char* alloc_list_double_string(double value, size_t* len_out) {
-    char   temp[64];
-    size_t len    = snprintf(temp, sizeof(temp), "%.6f", value);
-    char*  result = emalloc(len + 1);
-    if (result) {
-        memcpy(result, temp, len);
-        result[len] = '\0';
-        if (len_out)
-            *len_out = len;
-    }
-    return result;
+    return valkey_glide_double_estrdup(value, len_out);
 }
 
 /* ====================================================================
@@ -394,7 +346,7 @@ int prepare_list_key_only_args(list_command_args_t* args,
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
-    if (!allocate_list_command_args(1, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 1, args_out, args_len_out)) {
         return 0;
     }
 
@@ -409,9 +361,7 @@ int prepare_list_key_only_args(list_command_args_t* args,
  */
 int prepare_list_key_values_args(list_command_args_t* args,
                                  uintptr_t**          args_out,
-                                 unsigned long**      args_len_out,
-                                 char***              allocated_strings,
-                                 int*                 allocated_count) {
+                                 unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
     VALIDATE_LIST_VALUES(args->values, args->value_count);
@@ -434,17 +384,9 @@ int prepare_list_key_values_args(list_command_args_t* args,
         }
     }
 
-    if (!allocate_list_command_args(total_args, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(total_args * sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, total_args, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -463,10 +405,8 @@ int prepare_list_key_values_args(list_command_args_t* args,
         } else if (Z_TYPE_P(value) == IS_LONG) {
             /* Convert long to string */
             size_t str_len;
-            char*  str_val = alloc_list_number_string(Z_LVAL_P(value), &str_len);
-
-            (*allocated_strings)[*allocated_count] = str_val;
-            (*allocated_count)++;
+            char*  str_val =
+                valkey_glide_arena_long_to_string(args->arena, Z_LVAL_P(value), &str_len);
 
             (*args_out)[arg_idx]     = (uintptr_t) str_val;
             (*args_len_out)[arg_idx] = str_len;
@@ -474,10 +414,8 @@ int prepare_list_key_values_args(list_command_args_t* args,
         } else if (Z_TYPE_P(value) == IS_DOUBLE) {
             /* Convert double to string */
             size_t str_len;
-            char*  str_val = alloc_list_double_string(Z_DVAL_P(value), &str_len);
-
-            (*allocated_strings)[*allocated_count] = str_val;
-            (*allocated_count)++;
+            char*  str_val =
+                valkey_glide_arena_double_to_string(args->arena, Z_DVAL_P(value), &str_len);
 
             (*args_out)[arg_idx]     = (uintptr_t) str_val;
             (*args_len_out)[arg_idx] = str_len;
@@ -494,10 +432,8 @@ int prepare_list_key_values_args(list_command_args_t* args,
                 } else if (Z_TYPE_P(z_item) == IS_LONG) {
                     /* Convert long to string */
                     size_t str_len;
-                    char*  str_val = alloc_list_number_string(Z_LVAL_P(z_item), &str_len);
-
-                    (*allocated_strings)[*allocated_count] = str_val;
-                    (*allocated_count)++;
+                    char*  str_val =
+                        valkey_glide_arena_long_to_string(args->arena, Z_LVAL_P(z_item), &str_len);
 
                     (*args_out)[arg_idx]     = (uintptr_t) str_val;
                     (*args_len_out)[arg_idx] = str_len;
@@ -505,17 +441,13 @@ int prepare_list_key_values_args(list_command_args_t* args,
                 } else if (Z_TYPE_P(z_item) == IS_DOUBLE) {
                     /* Convert double to string */
                     size_t str_len;
-                    char*  str_val = alloc_list_double_string(Z_DVAL_P(z_item), &str_len);
-
-                    (*allocated_strings)[*allocated_count] = str_val;
-                    (*allocated_count)++;
+                    char*  str_val = valkey_glide_arena_double_to_string(
+                        args->arena, Z_DVAL_P(z_item), &str_len);
 
                     (*args_out)[arg_idx]     = (uintptr_t) str_val;
                     (*args_len_out)[arg_idx] = str_len;
                     arg_idx++;
                 } else {
-                    FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-                    free_list_command_args(*args_out, *args_len_out);
                     return 0;
                 }
             }
@@ -532,9 +464,7 @@ int prepare_list_key_values_args(list_command_args_t* args,
  */
 int prepare_list_key_count_args(list_command_args_t* args,
                                 uintptr_t**          args_out,
-                                unsigned long**      args_len_out,
-                                char***              allocated_strings,
-                                int*                 allocated_count) {
+                                unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
@@ -543,14 +473,10 @@ int prepare_list_key_count_args(list_command_args_t* args,
         arg_count = 2;
     }
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
@@ -558,18 +484,7 @@ int prepare_list_key_count_args(list_command_args_t* args,
     /* Add count if provided */
     if (args->count > 0) {
         size_t count_len;
-        char*  count_str = alloc_list_number_string(args->count, &count_len);
-
-        /* Track allocated string */
-        *allocated_strings = (char**) emalloc(sizeof(char*));
-        if (!*allocated_strings) {
-            efree(count_str);
-            free_list_command_args(*args_out, *args_len_out);
-            return 0;
-        }
-
-        (*allocated_strings)[0] = count_str;
-        *allocated_count        = 1;
+        char*  count_str = valkey_glide_arena_long_to_string(args->arena, args->count, &count_len);
 
         (*args_out)[1]     = (uintptr_t) count_str;
         (*args_len_out)[1] = count_len;
@@ -583,9 +498,7 @@ int prepare_list_key_count_args(list_command_args_t* args,
  */
 int prepare_list_blocking_args(list_command_args_t* args,
                                uintptr_t**          args_out,
-                               unsigned long**      args_len_out,
-                               char***              allocated_strings,
-                               int*                 allocated_count) {
+                               unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
 
     int keys_count = 0;
@@ -606,17 +519,9 @@ int prepare_list_blocking_args(list_command_args_t* args,
     /* Calculate the number of arguments: keys + timeout */
     unsigned long arg_count = keys_count + 1;
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     int arg_idx = 0;
 
@@ -626,8 +531,6 @@ int prepare_list_blocking_args(list_command_args_t* args,
         zval*      z_key;
         ZEND_HASH_FOREACH_VAL(ht, z_key) {
             if (Z_TYPE_P(z_key) != IS_STRING) {
-                FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-                free_list_command_args(*args_out, *args_len_out);
                 return 0;
             }
             (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_key);
@@ -647,15 +550,8 @@ int prepare_list_blocking_args(list_command_args_t* args,
 
     /* Add timeout */
     size_t timeout_len;
-    char*  timeout_str = alloc_list_double_string(args->blocking_opts.timeout, &timeout_len);
-    if (!timeout_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = timeout_str;
-    (*allocated_count)++;
+    char*  timeout_str =
+        valkey_glide_arena_double_to_string(args->arena, args->blocking_opts.timeout, &timeout_len);
 
     (*args_out)[arg_idx]     = (uintptr_t) timeout_str;
     (*args_len_out)[arg_idx] = timeout_len;
@@ -814,23 +710,13 @@ int execute_list_mpop_command(
  */
 int prepare_list_range_args(list_command_args_t* args,
                             uintptr_t**          args_out,
-                            unsigned long**      args_len_out,
-                            char***              allocated_strings,
-                            int*                 allocated_count) {
+                            unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
-    if (!allocate_list_command_args(3, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(2 * sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -838,30 +724,14 @@ int prepare_list_range_args(list_command_args_t* args,
 
     /* Second argument: start */
     size_t start_len;
-    char*  start_str = alloc_list_number_string(args->start, &start_len);
-    if (!start_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = start_str;
-    (*allocated_count)++;
+    char*  start_str = valkey_glide_arena_long_to_string(args->arena, args->start, &start_len);
 
     (*args_out)[1]     = (uintptr_t) start_str;
     (*args_len_out)[1] = start_len;
 
     /* Third argument: end */
     size_t end_len;
-    char*  end_str = alloc_list_number_string(args->end, &end_len);
-    if (!end_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = end_str;
-    (*allocated_count)++;
+    char*  end_str = valkey_glide_arena_long_to_string(args->arena, args->end, &end_len);
 
     (*args_out)[2]     = (uintptr_t) end_str;
     (*args_len_out)[2] = end_len;
@@ -874,9 +744,7 @@ int prepare_list_range_args(list_command_args_t* args,
  */
 int prepare_list_position_args(list_command_args_t* args,
                                uintptr_t**          args_out,
-                               unsigned long**      args_len_out,
-                               char***              allocated_strings,
-                               int*                 allocated_count) {
+                               unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
@@ -895,17 +763,9 @@ int prepare_list_position_args(list_command_args_t* args,
 
     unsigned long arg_count = 2 + opt_count; /* key + element + options */
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(3 * sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     /* Key and element are first two arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -922,15 +782,8 @@ int prepare_list_position_args(list_command_args_t* args,
         arg_idx++;
 
         size_t rank_len;
-        char*  rank_str = alloc_list_number_string(args->position_opts.rank, &rank_len);
-        if (!rank_str) {
-            FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-            free_list_command_args(*args_out, *args_len_out);
-            return 0;
-        }
-
-        (*allocated_strings)[*allocated_count] = rank_str;
-        (*allocated_count)++;
+        char*  rank_str =
+            valkey_glide_arena_long_to_string(args->arena, args->position_opts.rank, &rank_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) rank_str;
         (*args_len_out)[arg_idx] = rank_len;
@@ -943,10 +796,8 @@ int prepare_list_position_args(list_command_args_t* args,
         arg_idx++;
 
         size_t count_len;
-        char*  count_str = alloc_list_number_string(args->position_opts.count, &count_len);
-
-        (*allocated_strings)[*allocated_count] = count_str;
-        (*allocated_count)++;
+        char*  count_str =
+            valkey_glide_arena_long_to_string(args->arena, args->position_opts.count, &count_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) count_str;
         (*args_len_out)[arg_idx] = count_len;
@@ -959,15 +810,8 @@ int prepare_list_position_args(list_command_args_t* args,
         arg_idx++;
 
         size_t maxlen_len;
-        char*  maxlen_str = alloc_list_number_string(args->position_opts.maxlen, &maxlen_len);
-        if (!maxlen_str) {
-            FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-            free_list_command_args(*args_out, *args_len_out);
-            return 0;
-        }
-
-        (*allocated_strings)[*allocated_count] = maxlen_str;
-        (*allocated_count)++;
+        char*  maxlen_str =
+            valkey_glide_arena_long_to_string(args->arena, args->position_opts.maxlen, &maxlen_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) maxlen_str;
         (*args_len_out)[arg_idx] = maxlen_len;
@@ -992,7 +836,7 @@ int prepare_list_insert_args(list_command_args_t* args,
         return 0;
     }
 
-    if (!allocate_list_command_args(4, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 4, args_out, args_len_out)) {
         return 0;
     }
 
@@ -1013,42 +857,24 @@ int prepare_list_insert_args(list_command_args_t* args,
  */
 int prepare_list_index_set_args(list_command_args_t* args,
                                 uintptr_t**          args_out,
-                                unsigned long**      args_len_out,
-                                char***              allocated_strings,
-                                int*                 allocated_count) {
+                                unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
     /* For LSET, we need value as well */
     unsigned long arg_count = (args->value) ? 3 : 2;
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-    *allocated_count = 0;
-
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     /* Second argument: index */
     size_t index_len;
-    char*  index_str = alloc_list_number_string(args->index, &index_len);
-    if (!index_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = index_str;
-    (*allocated_count)++;
+    char*  index_str = valkey_glide_arena_long_to_string(args->arena, args->index, &index_len);
 
     (*args_out)[1]     = (uintptr_t) index_str;
     (*args_len_out)[1] = index_len;
@@ -1067,9 +893,7 @@ int prepare_list_index_set_args(list_command_args_t* args,
  */
 int prepare_list_rem_args(list_command_args_t* args,
                           uintptr_t**          args_out,
-                          unsigned long**      args_len_out,
-                          char***              allocated_strings,
-                          int*                 allocated_count) {
+                          unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
@@ -1077,28 +901,17 @@ int prepare_list_rem_args(list_command_args_t* args,
         return 0;
     }
 
-    if (!allocate_list_command_args(3, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out)) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-    *allocated_count = 0;
-
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     /* Second argument: count */
     size_t count_len;
-    char*  count_str = alloc_list_number_string(args->count, &count_len);
-
-    (*allocated_strings)[*allocated_count] = count_str;
-    (*allocated_count)++;
+    char*  count_str = valkey_glide_arena_long_to_string(args->arena, args->count, &count_len);
 
     (*args_out)[1]     = (uintptr_t) count_str;
     (*args_len_out)[1] = count_len;
@@ -1115,23 +928,13 @@ int prepare_list_rem_args(list_command_args_t* args,
  */
 int prepare_list_trim_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count) {
+                           unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
-    if (!allocate_list_command_args(3, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(2 * sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -1139,30 +942,14 @@ int prepare_list_trim_args(list_command_args_t* args,
 
     /* Second argument: start */
     size_t start_len;
-    char*  start_str = alloc_list_number_string(args->start, &start_len);
-    if (!start_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = start_str;
-    (*allocated_count)++;
+    char*  start_str = valkey_glide_arena_long_to_string(args->arena, args->start, &start_len);
 
     (*args_out)[1]     = (uintptr_t) start_str;
     (*args_len_out)[1] = start_len;
 
     /* Third argument: end */
     size_t end_len;
-    char*  end_str = alloc_list_number_string(args->end, &end_len);
-    if (!end_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = end_str;
-    (*allocated_count)++;
+    char*  end_str = valkey_glide_arena_long_to_string(args->arena, args->end, &end_len);
 
     (*args_out)[2]     = (uintptr_t) end_str;
     (*args_len_out)[2] = end_len;
@@ -1175,9 +962,7 @@ int prepare_list_trim_args(list_command_args_t* args,
  */
 int prepare_list_move_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count) {
+                           unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
     VALIDATE_LIST_KEY(args->key, args->key_len);
 
@@ -1199,17 +984,9 @@ int prepare_list_move_args(list_command_args_t* args,
         arg_count++;
     }
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(sizeof(char*));
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     unsigned int arg_idx = 0;
 
@@ -1237,15 +1014,8 @@ int prepare_list_move_args(list_command_args_t* args,
     /* Add timeout for blocking commands */
     if (args->move_opts.has_timeout) {
         size_t timeout_len;
-        char*  timeout_str = alloc_list_double_string(args->move_opts.timeout, &timeout_len);
-        if (!timeout_str) {
-            FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-            free_list_command_args(*args_out, *args_len_out);
-            return 0;
-        }
-
-        (*allocated_strings)[*allocated_count] = timeout_str;
-        (*allocated_count)++;
+        char*  timeout_str =
+            valkey_glide_arena_double_to_string(args->arena, args->move_opts.timeout, &timeout_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) timeout_str;
         (*args_len_out)[arg_idx] = timeout_len;
@@ -1260,9 +1030,7 @@ int prepare_list_move_args(list_command_args_t* args,
  */
 int prepare_list_mpop_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count) {
+                           unsigned long**      args_len_out) {
     VALIDATE_LIST_CLIENT(args->glide_client);
 
     if (!args->keys || !args->mpop_opts.direction || args->mpop_opts.direction_len <= 0) {
@@ -1286,32 +1054,17 @@ int prepare_list_mpop_args(list_command_args_t* args,
     if (args->mpop_opts.has_count)
         arg_count += 2; /* COUNT + value */
 
-    if (!allocate_list_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Initialize allocated strings tracking */
-    *allocated_strings = (char**) emalloc(3 * sizeof(char*)); /* timeout, numkeys, count */
-    if (!*allocated_strings) {
-        free_list_command_args(*args_out, *args_len_out);
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
-    *allocated_count = 0;
 
     unsigned int arg_idx = 0;
 
     /* Add timeout for blocking commands (first argument) */
     if (args->mpop_opts.has_timeout) {
         size_t timeout_len;
-        char*  timeout_str = alloc_list_double_string(args->mpop_opts.timeout, &timeout_len);
-        if (!timeout_str) {
-            FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-            free_list_command_args(*args_out, *args_len_out);
-            return 0;
-        }
-
-        (*allocated_strings)[*allocated_count] = timeout_str;
-        (*allocated_count)++;
+        char*  timeout_str =
+            valkey_glide_arena_double_to_string(args->arena, args->mpop_opts.timeout, &timeout_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) timeout_str;
         (*args_len_out)[arg_idx] = timeout_len;
@@ -1320,15 +1073,7 @@ int prepare_list_mpop_args(list_command_args_t* args,
 
     /* Add numkeys */
     size_t numkeys_len;
-    char*  numkeys_str = alloc_list_number_string(keys_count, &numkeys_len);
-    if (!numkeys_str) {
-        FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-        free_list_command_args(*args_out, *args_len_out);
-        return 0;
-    }
-
-    (*allocated_strings)[*allocated_count] = numkeys_str;
-    (*allocated_count)++;
+    char*  numkeys_str = valkey_glide_arena_long_to_string(args->arena, keys_count, &numkeys_len);
 
     (*args_out)[arg_idx]     = (uintptr_t) numkeys_str;
     (*args_len_out)[arg_idx] = numkeys_len;
@@ -1339,8 +1084,6 @@ int prepare_list_mpop_args(list_command_args_t* args,
     zval*      z_key;
     ZEND_HASH_FOREACH_VAL(ht, z_key) {
         if (Z_TYPE_P(z_key) != IS_STRING) {
-            FREE_LIST_ALLOCATED_STRINGS(*allocated_strings, *allocated_count);
-            free_list_command_args(*args_out, *args_len_out);
             return 0;
         }
         (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_key);
@@ -1361,10 +1104,8 @@ int prepare_list_mpop_args(list_command_args_t* args,
         arg_idx++;
 
         size_t count_len;
-        char*  count_str = alloc_list_number_string(args->mpop_opts.count, &count_len);
-
-        (*allocated_strings)[*allocated_count] = count_str;
-        (*allocated_count)++;
+        char*  count_str =
+            valkey_glide_arena_long_to_string(args->arena, args->mpop_opts.count, &count_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) count_str;
         (*args_len_out)[arg_idx] = count_len;
@@ -24,6 +24,7 @@
 #include "command_response.h"
 #include "common.h"
 #include "include/glide_bindings.h"
+#include "valkey_glide_arena.h"
 #include "valkey_glide_commands_common.h"
 
 /* ====================================================================
@@ -127,23 +128,22 @@ typedef struct _list_command_args_t {
 
     /* General options */
     zval* options; /* Raw options array from PHP */
+
+    /* Per-command allocations, owned by execute_list_generic_command */
+    valkey_glide_arena_t* arena;
 } list_command_args_t;
 
 /* Function pointer types */
 typedef int (*z_result_processor_t)(CommandResponse* response, void* output, zval* return_value);
 typedef int (*list_arg_preparation_func_t)(list_command_args_t* args,
                                            uintptr_t**          args_out,
-                                           unsigned long**      args_len_out,
-                                           char***              allocated_strings,
-                                           int*                 allocated_count);
+                                           unsigned long**      args_len_out);
 
 /* ====================================================================
  * FUNCTION DECLARATIONS
  * ==================================================================== */
 
 /* Utility functions */
-int   allocate_list_command_args(int count, uintptr_t** args_out, unsigned long** args_len_out);
-void  free_list_command_args(uintptr_t* args, unsigned long* args_len);
 char* alloc_list_number_string(long value, size_t* len_out);
 char* alloc_list_double_string(double value, size_t* len_out);
 
@@ -166,45 +166,31 @@ int prepare_list_key_only_args(list_command_args_t* args,
 
 int prepare_list_key_values_args(list_command_args_t* args,
                                  uintptr_t**          args_out,
-                                 unsigned long**      args_len_out,
-                                 char***              allocated_strings,
-                                 int*                 allocated_count);
+                                 unsigned long**      args_len_out);
 
 int prepare_list_key_count_args(list_command_args_t* args,
                                 uintptr_t**          args_out,
-                                unsigned long**      args_len_out,
-                                char***              allocated_strings,
-                                int*                 allocated_count);
+                                unsigned long**      args_len_out);
 
 int prepare_list_blocking_args(list_command_args_t* args,
                                uintptr_t**          args_out,
-                               unsigned long**      args_len_out,
-                               char***              allocated_strings,
-                               int*                 allocated_count);
+                               unsigned long**      args_len_out);
 
 int prepare_list_range_args(list_command_args_t* args,
                             uintptr_t**          args_out,
-                            unsigned long**      args_len_out,
-                            char***              allocated_strings,
-                            int*                 allocated_count);
+                            unsigned long**      args_len_out);
 
 int prepare_list_position_args(list_command_args_t* args,
                                uintptr_t**          args_out,
-                               unsigned long**      args_len_out,
-                               char***              allocated_strings,
-                               int*                 allocated_count);
+                               unsigned long**      args_len_out);
 
 int prepare_list_move_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count);
+                           unsigned long**      args_len_out);
 
 int prepare_list_mpop_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count);
+                           unsigned long**      args_len_out);
 
 int prepare_list_insert_args(list_command_args_t* args,
                              uintptr_t**          args_out,
@@ -212,21 +198,15 @@ int prepare_list_insert_args(list_command_args_t* args,
 
 int prepare_list_index_set_args(list_command_args_t* args,
                                 uintptr_t**          args_out,
-                                unsigned long**      args_len_out,
-                                char***              allocated_strings,
-                                int*                 allocated_count);
+                                unsigned long**      args_len_out);
 
 int prepare_list_rem_args(list_command_args_t* args,
                           uintptr_t**          args_out,
-                          unsigned long**      args_len_out,
-                          char***              allocated_strings,
-                          int*                 allocated_count);
+                          unsigned long**      args_len_out);
 
 int prepare_list_trim_args(list_command_args_t* args,
                            uintptr_t**          args_out,
-                           unsigned long**      args_len_out,
-                           char***              allocated_strings,
-                           int*                 allocated_count);
+                           unsigned long**      args_len_out);
 
 /* Result processing functions */
 int process_list_int_result_async(CommandResponse* response, void* output, zval* return_value);
@@ -311,25 +291,6 @@ int execute_list_mpop_command(
         return 0;                           \
     }
 
-/* Memory management macros */
-#define FREE_LIST_ALLOCATED_STRINGS(strings, count) \
-    do {                                            \
-        if (strings) {                              \
-            for (int _i = 0; _i < (count); _i++) {  \
-                if ((strings)[_i]) {                \
-                    efree((strings)[_i]);           \
-                }                                   \
-            }                                       \
-            efree(strings);                         \
-        }                                           \
-    } while (0)
-
-#define CLEANUP_LIST_COMMAND_ARGS(args, args_len, strings, str_count) \
-    do {                                                              \
-        free_list_command_args((args), (args_len));                   \
-        FREE_LIST_ALLOCATED_STRINGS((strings), (str_count));          \
-    } while (0)
-
 /* ====================================================================
  * LIST COMMAND MACROS
  * ==================================================================== */
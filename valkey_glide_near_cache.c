@@ -0,0 +1,774 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_near_cache.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_route.h"
+
+/* An entry id is the request type and every argument, each prefixed by its length */
+#define NEAR_CACHE_KEY_OFFSET (2 * sizeof(uint32_t))
+#define NEAR_CACHE_ID_STACK_SIZE 256
+
+/* Seconds between attempts to turn tracking back on after a disconnection */
+#define NEAR_CACHE_RETRACK_INTERVAL 1
+
+typedef struct near_cache_entry {
+    struct near_cache_entry* lru_prev; /* Toward the most recently used entry */
+    struct near_cache_entry* lru_next;
+    struct near_cache_entry* key_prev; /* Other replies that depend on the same key */
+    struct near_cache_entry* key_next;
+    zend_string*             id;
+    size_t                   key_len;    /* The key is the first argument in id */
+    time_t                   expires;    /* 0 if the entry does not expire */
+    size_t                   size;       /* Bytes charged against max_bytes */
+    CommandResponse          response[]; /* Copy of the reply, then its string payloads */
+} near_cache_entry_t;
+
+/* Invalidated key queued by the core thread */
+typedef struct near_cache_invalidation {
+    struct near_cache_invalidation* next;
+    size_t                          key_len;
+    char                            key[];
+} near_cache_invalidation_t;
+
+struct valkey_glide_near_cache {
+    const void*                     glide_client;
+    struct valkey_glide_near_cache* next; /* Registry link */
+    bool                            is_cluster;
+    valkey_glide_near_cache_config_t config;
+
+    /* Everything below up to pending_lock is only touched with lock held */
+    pthread_mutex_t     lock;
+    HashTable           entries; /* id => near_cache_entry_t* */
+    HashTable           keys;    /* Key => first entry of its chain */
+    near_cache_entry_t* lru_head;
+    near_cache_entry_t* lru_tail;
+    size_t              bytes;
+    size_t              max_key_len; /* Longest key cached, bounds the write path lookups */
+    bool                tracking;    /* Nothing is served or stored while tracking is off */
+    time_t              retrack_at;
+    uint64_t            hits;
+    uint64_t            misses;
+    uint64_t            evictions;
+    uint64_t            invalidations;
+
+    /* Filled by the core thread, drained by whichever PHP thread uses the cache next */
+    pthread_mutex_t            pending_lock;
+    near_cache_invalidation_t* pending;
+    bool                       pending_flush;
+    bool                       pending_retrack;
+    int                        has_pending; /* Checked without pending_lock */
+    uint64_t                   epoch;       /* Bumped by every push, see store() */
+};
+
+/* Process-wide, since pushes arrive on core threads that know nothing of PHP */
+static valkey_glide_near_cache_t* registry       = NULL;
+static int                        registry_count = 0; /* Checked without the mutex */
+static pthread_mutex_t            registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Invalidation epoch seen by this thread's last miss */
+static ZEND_TLS uint64_t miss_epoch = 0;
+
+static valkey_glide_near_cache_t* registry_find(uintptr_t glide_client) {
+    valkey_glide_near_cache_t* cache;
+
+    for (cache = registry; cache; cache = cache->next) {
+        if ((uintptr_t) cache->glide_client == glide_client) {
+            return cache;
+        }
+    }
+    return NULL;
+}
+
+static bool near_cache_cacheable(enum RequestType command_type) {
+    switch (command_type) {
+        case Get:
+        case HGetAll:
+        case SMembers:
+        case ZRange:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* Commands that cannot change a key, so the write path can skip them */
+static bool near_cache_read_only(enum RequestType command_type) {
+    switch (command_type) {
+        case Get:
+        case MGet:
+        case HGet:
+        case HGetAll:
+        case HMGet:
+        case HLen:
+        case HExists:
+        case SMembers:
+        case SCard:
+        case SIsMember:
+        case ZRange:
+        case ZCard:
+        case ZScore:
+        case LRange:
+        case LLen:
+        case Exists:
+        case TTL:
+        case PTTL:
+        case Type:
+        case Strlen:
+        case Ping:
+        case Echo:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static size_t near_cache_id_len(const unsigned long* args_len, unsigned long arg_count) {
+    size_t        len = sizeof(uint32_t);
+    unsigned long i;
+
+    for (i = 0; i < arg_count; i++) {
+        len += sizeof(uint32_t) + args_len[i];
+    }
+    return len;
+}
+
+static void near_cache_id_write(char*                id,
+                                enum RequestType     command_type,
+                                const uintptr_t*     args,
+                                const unsigned long* args_len,
+                                unsigned long        arg_count) {
+    uint32_t      value = (uint32_t) command_type;
+    unsigned long i;
+
+    memcpy(id, &value, sizeof(value));
+    id += sizeof(value);
+
+    for (i = 0; i < arg_count; i++) {
+        value = (uint32_t) args_len[i];
+        memcpy(id, &value, sizeof(value));
+        memcpy(id + sizeof(value), (const void*) args[i], args_len[i]);
+        id += sizeof(value) + args_len[i];
+    }
+}
+
+/* Count the nodes and string bytes of a reply; false if it cannot be cached */
+static bool response_measure(const CommandResponse* response, size_t* nodes, size_t* strings) {
+    int64_t i;
+
+    switch (response->response_type) {
+        case String:
+            *strings += response->string_value_len;
+            return true;
+        case Array:
+            *nodes += response->array_value_len;
+            for (i = 0; i < response->array_value_len; i++) {
+                if (!response_measure(&response->array_value[i], nodes, strings)) {
+                    return false;
+                }
+            }
+            return true;
+        case Map:
+            *nodes += response->array_value_len * 3;
+            for (i = 0; i < response->array_value_len; i++) {
+                const CommandResponse* element = &response->array_value[i];
+
+                if (!element->map_key || !element->map_value ||
+                    !response_measure(element->map_key, nodes, strings) ||
+                    !response_measure(element->map_value, nodes, strings)) {
+                    return false;
+                }
+            }
+            return true;
+        case Sets:
+            *nodes += response->sets_value_len;
+            for (i = 0; i < response->sets_value_len; i++) {
+                if (!response_measure(&response->sets_value[i], nodes, strings)) {
+                    return false;
+                }
+            }
+            return true;
+        case Error:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/* Deep copy a reply into the node and string regions measured above */
+static void response_copy(const CommandResponse* source,
+                          CommandResponse*       copy,
+                          CommandResponse**      nodes,
+                          char**                 strings) {
+    int64_t i;
+
+    *copy = *source;
+
+    switch (source->response_type) {
+        case String:
+            memcpy(*strings, source->string_value, source->string_value_len);
+            copy->string_value = *strings;
+            *strings += source->string_value_len;
+            break;
+        case Array:
+            copy->array_value = *nodes;
+            *nodes += source->array_value_len;
+            for (i = 0; i < source->array_value_len; i++) {
+                response_copy(&source->array_value[i], &copy->array_value[i], nodes, strings);
+            }
+            break;
+        case Map:
+            copy->array_value = *nodes;
+            *nodes += source->array_value_len;
+            for (i = 0; i < source->array_value_len; i++) {
+                CommandResponse* element = &copy->array_value[i];
+
+                *element           = source->array_value[i];
+                element->map_key   = (*nodes)++;
+                element->map_value = (*nodes)++;
+                response_copy(source->array_value[i].map_key, element->map_key, nodes, strings);
+                response_copy(
+                    source->array_value[i].map_value, element->map_value, nodes, strings);
+            }
+            break;
+        case Sets:
+            copy->sets_value = *nodes;
+            *nodes += source->sets_value_len;
+            for (i = 0; i < source->sets_value_len; i++) {
+                response_copy(&source->sets_value[i], &copy->sets_value[i], nodes, strings);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void near_cache_entry_remove(valkey_glide_near_cache_t* cache, near_cache_entry_t* entry) {
+    const char* key = ZSTR_VAL(entry->id) + NEAR_CACHE_KEY_OFFSET;
+
+    if (entry->lru_prev) {
+        entry->lru_prev->lru_next = entry->lru_next;
+    } else {
+        cache->lru_head = entry->lru_next;
+    }
+    if (entry->lru_next) {
+        entry->lru_next->lru_prev = entry->lru_prev;
+    } else {
+        cache->lru_tail = entry->lru_prev;
+    }
+
+    if (entry->key_prev) {
+        entry->key_prev->key_next = entry->key_next;
+    } else if (entry->key_next) {
+        zend_hash_str_update_ptr(&cache->keys, key, entry->key_len, entry->key_next);
+    } else {
+        zend_hash_str_del(&cache->keys, key, entry->key_len);
+    }
+    if (entry->key_next) {
+        entry->key_next->key_prev = entry->key_prev;
+    }
+
+    zend_hash_del(&cache->entries, entry->id);
+    cache->bytes -= entry->size;
+
+    zend_string_release(entry->id);
+    pefree(entry, 1);
+}
+
+static void near_cache_remove_all(valkey_glide_near_cache_t* cache) {
+    near_cache_entry_t* entry = cache->lru_head;
+
+    while (entry) {
+        near_cache_entry_t* next = entry->lru_next;
+
+        zend_string_release(entry->id);
+        pefree(entry, 1);
+        entry = next;
+    }
+
+    zend_hash_clean(&cache->entries);
+    zend_hash_clean(&cache->keys);
+    cache->lru_head = NULL;
+    cache->lru_tail = NULL;
+    cache->bytes    = 0;
+}
+
+static void near_cache_invalidate_key(valkey_glide_near_cache_t* cache,
+                                      const char*                key,
+                                      size_t                     key_len) {
+    near_cache_entry_t* entry;
+
+    while ((entry = zend_hash_str_find_ptr(&cache->keys, key, key_len)) != NULL) {
+        near_cache_entry_remove(cache, entry);
+        cache->invalidations++;
+    }
+}
+
+/* Turn tracking on for every connection of the client */
+static bool near_cache_enable_tracking(valkey_glide_near_cache_t* cache) {
+    const valkey_glide_near_cache_config_t* config = &cache->config;
+    unsigned long  prefixes  = config->bcast ? (unsigned long) config->prefix_count : 0;
+    unsigned long  arg_count = 3 + (config->bcast ? 1 : 0) + 2 * prefixes;
+    uintptr_t*     args      = emalloc(arg_count * sizeof(uintptr_t));
+    unsigned long* args_len  = emalloc(arg_count * sizeof(unsigned long));
+    unsigned long  i         = 0;
+    const uint8_t* route     = NULL;
+    size_t         route_len = 0;
+    int            prefix;
+
+#define NEAR_CACHE_ADD_ARG(value, len)       \
+    do {                                     \
+        args[i]       = (uintptr_t) (value); \
+        args_len[i++] = (len);               \
+    } while (0)
+
+    NEAR_CACHE_ADD_ARG("CLIENT", 6);
+    NEAR_CACHE_ADD_ARG("TRACKING", 8);
+    NEAR_CACHE_ADD_ARG("ON", 2);
+    if (config->bcast) {
+        NEAR_CACHE_ADD_ARG("BCAST", 5);
+        for (prefix = 0; prefix < config->prefix_count; prefix++) {
+            NEAR_CACHE_ADD_ARG("PREFIX", 6);
+            NEAR_CACHE_ADD_ARG(config->prefixes[prefix], config->prefix_lens[prefix]);
+        }
+    }
+
+#undef NEAR_CACHE_ADD_ARG
+
+    if (cache->is_cluster) {
+        zval all_nodes;
+
+        ZVAL_STRINGL(&all_nodes, "allNodes", sizeof("allNodes") - 1);
+        route = valkey_glide_route_get_packed(&all_nodes, &route_len);
+        zval_ptr_dtor(&all_nodes);
+    }
+
+    CommandResult* result = command(cache->glide_client,
+                                    0,             /* channel */
+                                    CustomCommand, /* command type */
+                                    arg_count,     /* number of arguments */
+                                    args,          /* arguments */
+                                    args_len,      /* argument lengths */
+                                    route,         /* route bytes */
+                                    route_len,     /* route bytes length */
+                                    0              /* span pointer */
+    );
+
+    cache->tracking = result && !result->command_error;
+    if (!cache->tracking) {
+        VALKEY_LOG_WARN_FMT("near_cache",
+                            "CLIENT TRACKING failed: %s",
+                            result && result->command_error &&
+                                    result->command_error->command_error_message
+                                ? result->command_error->command_error_message
+                                : "no response");
+        cache->retrack_at = time(NULL) + NEAR_CACHE_RETRACK_INTERVAL;
+    }
+
+    free_command_result(result);
+    efree(args);
+    efree(args_len);
+    return cache->tracking;
+}
+
+/* Apply the pushes queued by the core thread; lock must be held */
+static void near_cache_apply_pending(valkey_glide_near_cache_t* cache) {
+    near_cache_invalidation_t* pending;
+    bool                       flush, retrack;
+
+    if (__atomic_load_n(&cache->has_pending, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&cache->pending_lock);
+        pending                = cache->pending;
+        flush                  = cache->pending_flush;
+        retrack                = cache->pending_retrack;
+        cache->pending         = NULL;
+        cache->pending_flush   = false;
+        cache->pending_retrack = false;
+        __atomic_store_n(&cache->has_pending, 0, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&cache->pending_lock);
+
+        if (flush) {
+            cache->invalidations += zend_hash_num_elements(&cache->entries);
+            near_cache_remove_all(cache);
+        }
+        while (pending) {
+            near_cache_invalidation_t* next = pending->next;
+
+            if (!flush) {
+                near_cache_invalidate_key(cache, pending->key, pending->key_len);
+            }
+            free(pending);
+            pending = next;
+        }
+
+        /* The server forgets tracking state with the connection */
+        if (retrack) {
+            cache->tracking   = false;
+            cache->retrack_at = 0;
+        }
+    }
+
+    if (!cache->tracking && time(NULL) >= cache->retrack_at) {
+        near_cache_enable_tracking(cache);
+    }
+}
+
+void valkey_glide_push_callback(uintptr_t      client_ptr,
+                                enum PushKind  kind,
+                                const uint8_t* message,
+                                int64_t        message_len,
+                                const uint8_t* channel,
+                                int64_t        channel_len,
+                                const uint8_t* pattern,
+                                int64_t        pattern_len) {
+    valkey_glide_near_cache_t* cache;
+    near_cache_invalidation_t* invalidation = NULL;
+
+    (void) channel;
+    (void) channel_len;
+    (void) pattern;
+    (void) pattern_len;
+
+    /* Runs on a core thread: no Zend API, no PHP allocator */
+    if ((kind != PushInvalidate && kind != PushDisconnection) ||
+        !__atomic_load_n(&registry_count, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+
+    if (kind == PushInvalidate && message && message_len > 0) {
+        invalidation = malloc(sizeof(near_cache_invalidation_t) + (size_t) message_len);
+        if (invalidation) {
+            invalidation->key_len = (size_t) message_len;
+            memcpy(invalidation->key, message, (size_t) message_len);
+        }
+    }
+
+    pthread_mutex_lock(&registry_mutex);
+    cache = registry_find(client_ptr);
+    if (cache) {
+        pthread_mutex_lock(&cache->pending_lock);
+        if (kind == PushDisconnection) {
+            cache->pending_flush   = true;
+            cache->pending_retrack = true;
+        } else if (invalidation) {
+            invalidation->next = cache->pending;
+            cache->pending     = invalidation;
+            invalidation       = NULL;
+        } else {
+            /* Flush of the whole tracking table, or no memory to queue the key */
+            cache->pending_flush = true;
+        }
+        __atomic_add_fetch(&cache->epoch, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&cache->has_pending, 1, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&cache->pending_lock);
+    }
+    pthread_mutex_unlock(&registry_mutex);
+
+    free(invalidation);
+}
+
+valkey_glide_near_cache_t* valkey_glide_near_cache_attach(
+    const void* glide_client, const valkey_glide_near_cache_config_t* config, bool is_cluster) {
+    valkey_glide_near_cache_t* cache;
+    int                        i;
+
+    pthread_mutex_lock(&registry_mutex);
+    cache = registry_find((uintptr_t) glide_client);
+    pthread_mutex_unlock(&registry_mutex);
+    if (cache) {
+        return cache;
+    }
+
+    cache               = pecalloc(1, sizeof(valkey_glide_near_cache_t), 1);
+    cache->glide_client = glide_client;
+    cache->is_cluster   = is_cluster;
+    cache->config       = *config;
+    if (config->prefix_count > 0) {
+        cache->config.prefixes    = pemalloc(config->prefix_count * sizeof(char*), 1);
+        cache->config.prefix_lens = pemalloc(config->prefix_count * sizeof(size_t), 1);
+        for (i = 0; i < config->prefix_count; i++) {
+            cache->config.prefixes[i] =
+                pestrndup(config->prefixes[i], config->prefix_lens[i], 1);
+            cache->config.prefix_lens[i] = config->prefix_lens[i];
+        }
+    }
+
+    pthread_mutex_init(&cache->lock, NULL);
+    pthread_mutex_init(&cache->pending_lock, NULL);
+    zend_hash_init(&cache->entries, 64, NULL, NULL, 1);
+    zend_hash_init(&cache->keys, 64, NULL, NULL, 1);
+
+    /* Registered first so no invalidation for a key read right after is missed */
+    pthread_mutex_lock(&registry_mutex);
+    cache->next = registry;
+    registry    = cache;
+    __atomic_add_fetch(&registry_count, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&registry_mutex);
+
+    if (!near_cache_enable_tracking(cache)) {
+        valkey_glide_near_cache_destroy(glide_client);
+        return NULL;
+    }
+
+    VALKEY_LOG_DEBUG("near_cache", "Client-side caching enabled");
+    return cache;
+}
+
+void valkey_glide_near_cache_destroy(const void* glide_client) {
+    valkey_glide_near_cache_t** link;
+    valkey_glide_near_cache_t*  cache = NULL;
+    int                         i;
+
+    if (!__atomic_load_n(&registry_count, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry_mutex);
+    for (link = &registry; *link; link = &(*link)->next) {
+        if ((*link)->glide_client == glide_client) {
+            cache = *link;
+            *link = cache->next;
+            __atomic_sub_fetch(&registry_count, 1, __ATOMIC_RELEASE);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry_mutex);
+
+    if (!cache) {
+        return;
+    }
+
+    near_cache_remove_all(cache);
+    zend_hash_destroy(&cache->entries);
+    zend_hash_destroy(&cache->keys);
+
+    while (cache->pending) {
+        near_cache_invalidation_t* next = cache->pending->next;
+
+        free(cache->pending);
+        cache->pending = next;
+    }
+
+    for (i = 0; i < cache->config.prefix_count; i++) {
+        pefree(cache->config.prefixes[i], 1);
+    }
+    if (cache->config.prefix_count > 0) {
+        pefree(cache->config.prefixes, 1);
+        pefree(cache->config.prefix_lens, 1);
+    }
+
+    pthread_mutex_destroy(&cache->lock);
+    pthread_mutex_destroy(&cache->pending_lock);
+    pefree(cache, 1);
+}
+
+bool valkey_glide_near_cache_fetch(valkey_glide_near_cache_t* cache,
+                                   enum RequestType           command_type,
+                                   const uintptr_t*           args,
+                                   const unsigned long*       args_len,
+                                   unsigned long              arg_count,
+                                   void*                      result_ptr,
+                                   z_result_processor_t       process_result,
+                                   zval*                      return_value,
+                                   int*                       status) {
+    char                stack_id[NEAR_CACHE_ID_STACK_SIZE];
+    char*               id;
+    size_t              id_len;
+    near_cache_entry_t* entry = NULL;
+
+    if (!cache || arg_count == 0 || !near_cache_cacheable(command_type)) {
+        return false;
+    }
+
+    id_len = near_cache_id_len(args_len, arg_count);
+    id     = id_len <= sizeof(stack_id) ? stack_id : emalloc(id_len);
+    near_cache_id_write(id, command_type, args, args_len, arg_count);
+
+    pthread_mutex_lock(&cache->lock);
+    near_cache_apply_pending(cache);
+
+    if (cache->tracking) {
+        entry = zend_hash_str_find_ptr(&cache->entries, id, id_len);
+        if (entry && entry->expires && entry->expires <= time(NULL)) {
+            near_cache_entry_remove(cache, entry);
+            entry = NULL;
+        }
+    }
+
+    if (entry) {
+        /* Move to the front of the LRU list */
+        if (entry != cache->lru_head) {
+            entry->lru_prev->lru_next = entry->lru_next;
+            if (entry->lru_next) {
+                entry->lru_next->lru_prev = entry->lru_prev;
+            } else {
+                cache->lru_tail = entry->lru_prev;
+            }
+            entry->lru_prev           = NULL;
+            entry->lru_next           = cache->lru_head;
+            cache->lru_head->lru_prev = entry;
+            cache->lru_head           = entry;
+        }
+
+        cache->hits++;
+        *status = process_result(entry->response, result_ptr, return_value);
+    } else {
+        cache->misses++;
+        miss_epoch = __atomic_load_n(&cache->epoch, __ATOMIC_ACQUIRE);
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    if (id != stack_id) {
+        efree(id);
+    }
+    return entry != NULL;
+}
+
+void valkey_glide_near_cache_store(valkey_glide_near_cache_t* cache,
+                                   enum RequestType           command_type,
+                                   const uintptr_t*           args,
+                                   const unsigned long*       args_len,
+                                   unsigned long              arg_count,
+                                   const CommandResult*       result) {
+    near_cache_entry_t* entry;
+    near_cache_entry_t* existing;
+    near_cache_entry_t* chain;
+    CommandResponse*    nodes;
+    char*               strings;
+    const char*         key;
+    size_t              node_count = 1, string_bytes = 0, id_len, alloc_size;
+
+    if (!cache || !result || result->command_error || !result->response || arg_count == 0 ||
+        !near_cache_cacheable(command_type)) {
+        return;
+    }
+
+    /* A push since the miss may be for a write after this reply, so it is not kept */
+    if (__atomic_load_n(&cache->epoch, __ATOMIC_ACQUIRE) != miss_epoch ||
+        !response_measure(result->response, &node_count, &string_bytes)) {
+        return;
+    }
+
+    id_len     = near_cache_id_len(args_len, arg_count);
+    alloc_size = sizeof(near_cache_entry_t) + node_count * sizeof(CommandResponse) + string_bytes;
+    if (alloc_size + id_len > cache->config.max_bytes) {
+        return;
+    }
+
+    entry = pemalloc(alloc_size, 1);
+    memset(entry, 0, sizeof(near_cache_entry_t));
+    entry->id = zend_string_alloc(id_len, 1);
+    near_cache_id_write(ZSTR_VAL(entry->id), command_type, args, args_len, arg_count);
+    ZSTR_VAL(entry->id)[id_len] = '\0';
+    entry->key_len              = args_len[0];
+    entry->size                 = alloc_size + id_len;
+    entry->expires              = cache->config.ttl > 0 ? time(NULL) + cache->config.ttl : 0;
+
+    nodes   = entry->response + 1;
+    strings = (char*) (entry->response + node_count);
+    response_copy(result->response, entry->response, &nodes, &strings);
+
+    key = ZSTR_VAL(entry->id) + NEAR_CACHE_KEY_OFFSET;
+
+    pthread_mutex_lock(&cache->lock);
+    near_cache_apply_pending(cache);
+
+    if (!cache->tracking || __atomic_load_n(&cache->epoch, __ATOMIC_ACQUIRE) != miss_epoch) {
+        pthread_mutex_unlock(&cache->lock);
+        zend_string_release(entry->id);
+        pefree(entry, 1);
+        return;
+    }
+
+    existing = zend_hash_find_ptr(&cache->entries, entry->id);
+    if (existing) {
+        near_cache_entry_remove(cache, existing);
+    }
+    zend_hash_add_new_ptr(&cache->entries, entry->id, entry);
+
+    chain = zend_hash_str_find_ptr(&cache->keys, key, entry->key_len);
+    if (chain) {
+        chain->key_prev = entry;
+        entry->key_next = chain;
+    }
+    zend_hash_str_update_ptr(&cache->keys, key, entry->key_len, entry);
+
+    entry->lru_next = cache->lru_head;
+    if (cache->lru_head) {
+        cache->lru_head->lru_prev = entry;
+    } else {
+        cache->lru_tail = entry;
+    }
+    cache->lru_head = entry;
+    cache->bytes += entry->size;
+    if (entry->key_len > cache->max_key_len) {
+        cache->max_key_len = entry->key_len;
+    }
+
+    while (cache->lru_tail &&
+           (zend_hash_num_elements(&cache->entries) > cache->config.max_entries ||
+            cache->bytes > cache->config.max_bytes)) {
+        near_cache_entry_remove(cache, cache->lru_tail);
+        cache->evictions++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void valkey_glide_near_cache_invalidate_args(const void*          glide_client,
+                                             enum RequestType     command_type,
+                                             const uintptr_t*     args,
+                                             const unsigned long* args_len,
+                                             unsigned long        arg_count) {
+    valkey_glide_near_cache_t* cache;
+    unsigned long              i;
+
+    if (!__atomic_load_n(&registry_count, __ATOMIC_ACQUIRE) || arg_count == 0 ||
+        near_cache_read_only(command_type)) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry_mutex);
+    cache = registry_find((uintptr_t) glide_client);
+    pthread_mutex_unlock(&registry_mutex);
+    if (!cache) {
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    for (i = 0; i < arg_count && zend_hash_num_elements(&cache->keys) > 0; i++) {
+        if (args_len[i] <= cache->max_key_len) {
+            near_cache_invalidate_key(cache, (const char*) args[i], args_len[i]);
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void valkey_glide_near_cache_stats_to_zval(valkey_glide_near_cache_t* cache, zval* return_value) {
+    pthread_mutex_lock(&cache->lock);
+    near_cache_apply_pending(cache);
+
+    array_init_size(return_value, 9);
+    add_assoc_bool(return_value, "tracking", cache->tracking);
+    add_assoc_long(return_value, "hits", (zend_long) cache->hits);
+    add_assoc_long(return_value, "misses", (zend_long) cache->misses);
+    add_assoc_long(return_value, "evictions", (zend_long) cache->evictions);
+    add_assoc_long(return_value, "invalidations", (zend_long) cache->invalidations);
+    add_assoc_long(return_value, "entries", (zend_long) zend_hash_num_elements(&cache->entries));
+    add_assoc_long(return_value, "bytes", (zend_long) cache->bytes);
+    add_assoc_long(return_value, "max_entries", (zend_long) cache->config.max_entries);
+    add_assoc_long(return_value, "max_bytes", (zend_long) cache->config.max_bytes);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void valkey_glide_near_cache_clear(valkey_glide_near_cache_t* cache) {
+    pthread_mutex_lock(&cache->lock);
+    near_cache_apply_pending(cache);
+    near_cache_remove_all(cache);
+    pthread_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,96 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_NEAR_CACHE_H
+#define VALKEY_GLIDE_NEAR_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common.h"
+#include "include/glide_bindings.h"
+
+/* ====================================================================
+ * CLIENT-SIDE CACHING
+ * ==================================================================== */
+
+/*
+ * The near cache keeps the replies of GET, HGETALL, SMEMBERS and ZRANGE in
+ * process memory and answers repeated reads without a round trip. The server
+ * tracks what the client read (CLIENT TRACKING, or BCAST for key prefixes) and
+ * pushes an invalidation when a key changes. Pushes arrive on a core thread
+ * through valkey_glide_push_callback(); they are only queued there and applied
+ * by the next PHP thread that touches the cache.
+ *
+ * A cache belongs to a native client, so objects sharing a persistent client
+ * share its cache and it survives across requests.
+ */
+
+#define VALKEY_GLIDE_NEAR_CACHE_DEFAULT_MAX_ENTRIES 10000
+#define VALKEY_GLIDE_NEAR_CACHE_DEFAULT_MAX_BYTES (16 * 1024 * 1024)
+
+typedef struct valkey_glide_near_cache valkey_glide_near_cache_t;
+
+/**
+ * Push notification callback handed to create_client().
+ * For invalidations, message is the key or NULL when every key was dropped.
+ */
+void valkey_glide_push_callback(uintptr_t      client_ptr,
+                                enum PushKind  kind,
+                                const uint8_t* message,
+                                int64_t        message_len,
+                                const uint8_t* channel,
+                                int64_t        channel_len,
+                                const uint8_t* pattern,
+                                int64_t        pattern_len);
+
+/**
+ * Return the cache of a client, creating it and enabling tracking if needed.
+ * A client that already has a cache keeps its original settings.
+ * Returns NULL if tracking could not be enabled.
+ */
+valkey_glide_near_cache_t* valkey_glide_near_cache_attach(
+    const void* glide_client, const valkey_glide_near_cache_config_t* config, bool is_cluster);
+
+/* Free the cache of a client, if any; call right before the client is closed */
+void valkey_glide_near_cache_destroy(const void* glide_client);
+
+/**
+ * Answer a read from the cache. On a hit the cached reply goes through
+ * process_result exactly as a fresh one would, *status receives its return
+ * value and true is returned. Does nothing for a NULL cache.
+ */
+bool valkey_glide_near_cache_fetch(valkey_glide_near_cache_t* cache,
+                                   enum RequestType           command_type,
+                                   const uintptr_t*           args,
+                                   const unsigned long*       args_len,
+                                   unsigned long              arg_count,
+                                   void*                      result_ptr,
+                                   z_result_processor_t       process_result,
+                                   zval*                      return_value,
+                                   int*                       status);
+
+/* Keep a copy of the reply to a cacheable read that missed the cache */
+void valkey_glide_near_cache_store(valkey_glide_near_cache_t* cache,
+                                   enum RequestType           command_type,
+                                   const uintptr_t*           args,
+                                   const unsigned long*       args_len,
+                                   unsigned long              arg_count,
+                                   const CommandResult*       result);
+
+/**
+ * Drop the cached replies for any key among the arguments of a command that
+ * was just sent, so a client reads its own writes before the server's push.
+ */
+void valkey_glide_near_cache_invalidate_args(const void*          glide_client,
+                                             enum RequestType     command_type,
+                                             const uintptr_t*     args,
+                                             const unsigned long* args_len,
+                                             unsigned long        arg_count);
+
+/* Build the array returned by getNearCacheStats() */
+void valkey_glide_near_cache_stats_to_zval(valkey_glide_near_cache_t* cache, zval* return_value);
+
+/* Drop every entry of a cache */
+void valkey_glide_near_cache_clear(valkey_glide_near_cache_t* cache);
+
+#endif /* VALKEY_GLIDE_NEAR_CACHE_H */
@@ -0,0 +1,108 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "valkey_glide_numeric.h"
+
+#include <math.h>
+
+/* Doubles this close to zero that hold an integer are written by the integer routine */
+#if SIZEOF_ZEND_LONG == 8
+#define INTEGRAL_DOUBLE_LIMIT 1e15
+#else
+#define INTEGRAL_DOUBLE_LIMIT 1e9
+#endif
+
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+size_t valkey_glide_format_long(char* buf, zend_long value) {
+    char       digits[VALKEY_GLIDE_LONG_MAX_LEN];
+    char*      end = digits + sizeof(digits);
+    char*      p   = end;
+    zend_ulong n   = value < 0 ? (zend_ulong) 0 - (zend_ulong) value : (zend_ulong) value;
+    size_t     len;
+
+    /* Written backwards, two digits per division */
+    while (n >= 100) {
+        size_t pair = (size_t) (n % 100) * 2;
+
+        n /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    }
+    if (n >= 10) {
+        *--p = digit_pairs[n * 2 + 1];
+        *--p = digit_pairs[n * 2];
+    } else {
+        *--p = (char) ('0' + n);
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+
+    len = (size_t) (end - p);
+    memcpy(buf, p, len);
+    buf[len] = '\0';
+    return len;
+}
+
+size_t valkey_glide_format_double(char* buf, double value) {
+    if (zend_isnan(value)) {
+        memcpy(buf, "nan", sizeof("nan"));
+        return sizeof("nan") - 1;
+    }
+    if (zend_isinf(value)) {
+        if (value < 0) {
+            memcpy(buf, "-inf", sizeof("-inf"));
+            return sizeof("-inf") - 1;
+        }
+        memcpy(buf, "inf", sizeof("inf"));
+        return sizeof("inf") - 1;
+    }
+
+    /* Whole scores are the common case and need no digit generation; -0 keeps its sign */
+    if (value > -INTEGRAL_DOUBLE_LIMIT && value < INTEGRAL_DOUBLE_LIMIT &&
+        value == (double) (zend_long) value && !(value == 0 && signbit(value))) {
+        return valkey_glide_format_long(buf, (zend_long) value);
+    }
+
+    /* A negative precision selects the shortest digits that round-trip, as serialize_precision */
+    php_gcvt(value, -1, '.', 'e', buf);
+    return strlen(buf);
+}
+
+char* valkey_glide_long_estrdup(zend_long value, size_t* len) {
+    char   buf[VALKEY_GLIDE_LONG_MAX_LEN + 1];
+    size_t n   = valkey_glide_format_long(buf, value);
+    char*  str = emalloc(n + 1);
+
+    memcpy(str, buf, n + 1);
+    if (len) {
+        *len = n;
+    }
+    return str;
+}
+
+char* valkey_glide_double_estrdup(double value, size_t* len) {
+    char   buf[VALKEY_GLIDE_DOUBLE_MAX_LEN + 1];
+    size_t n   = valkey_glide_format_double(buf, value);
+    char*  str = emalloc(n + 1);
+
+    memcpy(str, buf, n + 1);
+    if (len) {
+        *len = n;
+    }
+    return str;
+}
@@ -0,0 +1,39 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_NUMERIC_H
+#define VALKEY_GLIDE_NUMERIC_H
+
+#include <stddef.h>
+
+#include "php.h"
+
+/* ====================================================================
+ * NUMERIC ARGUMENT ENCODING
+ * ==================================================================== */
+
+/*
+ * Every integer and floating point argument is written by these two
+ * routines, straight into the buffer that is handed to the core.
+ * Integers go two digits at a time from a lookup table. Doubles get the
+ * shortest form that parses back to the same value, so a score or a
+ * coordinate reaches the server exactly; integral values are written as
+ * integers.
+ */
+
+/* Longest integer, sign included; buffers need one more byte for the NUL */
+#define VALKEY_GLIDE_LONG_MAX_LEN 20
+
+/* Longest double in the shortest round-trip form; buffers need one more byte */
+#define VALKEY_GLIDE_DOUBLE_MAX_LEN 32
+
+/* Write value into buf, NUL terminated, and return its length */
+size_t valkey_glide_format_long(char* buf, zend_long value);
+
+/* Write value into buf in its shortest round-trip form, NUL terminated, and return its length */
+size_t valkey_glide_format_double(char* buf, double value);
+
+/* emalloc'd copies for the argument arrays that are released with efree() */
+char* valkey_glide_long_estrdup(zend_long value, size_t* len);
+char* valkey_glide_double_estrdup(double value, size_t* len);
+
+#endif /* VALKEY_GLIDE_NUMERIC_H */
@@ -0,0 +1,248 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_pool.h"
+
+#include <pthread.h>
+#include <time.h>
+
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_near_cache.h"
+
+typedef struct valkey_glide_pool_entry {
+    const void*                     glide_client;
+    uint32_t                        users;     /* Live PHP objects using the client */
+    time_t                          last_used; /* Last checkout or checkin */
+    struct valkey_glide_pool_entry* next;      /* Evicted entries waiting to be closed */
+} valkey_glide_pool_entry_t;
+
+/* Process-wide, shared by every request (and thread, under ZTS) */
+static HashTable       pool;
+static bool            pool_initialized = false;
+static pthread_mutex_t pool_mutex       = PTHREAD_MUTEX_INITIALIZER;
+
+/* Close the connections of unlinked entries; called without pool_mutex held */
+static void pool_close_entries(valkey_glide_pool_entry_t* entry) {
+    while (entry) {
+        valkey_glide_pool_entry_t* next = entry->next;
+
+        valkey_glide_near_cache_destroy(entry->glide_client);
+        close_glide_client(entry->glide_client);
+        pefree(entry, 1);
+        entry = next;
+    }
+}
+
+/* Entries are unlinked under pool_mutex and closed after it is released */
+static void pool_ensure_initialized(void) {
+    if (!pool_initialized) {
+        zend_hash_init(&pool, 8, NULL, NULL, 1);
+        pool_initialized = true;
+    }
+}
+
+typedef struct {
+    time_t                      cutoff;
+    valkey_glide_pool_entry_t** evicted;
+} pool_eviction_t;
+
+static int pool_entry_expired(zval* zv, void* arg) {
+    valkey_glide_pool_entry_t* entry    = Z_PTR_P(zv);
+    pool_eviction_t*           eviction = arg;
+
+    if (entry->users == 0 && entry->last_used < eviction->cutoff) {
+        VALKEY_LOG_DEBUG("persistent_pool", "Closing idle persistent client");
+        entry->next        = *eviction->evicted;
+        *eviction->evicted = entry;
+        return ZEND_HASH_APPLY_REMOVE;
+    }
+    return ZEND_HASH_APPLY_KEEP;
+}
+
+/* Unlink idle clients that have not been used for max_idle seconds; pool_mutex must be held */
+static valkey_glide_pool_entry_t* pool_evict_idle(time_t now) {
+    zend_long                  max_idle = INI_INT(VALKEY_GLIDE_POOL_MAX_IDLE_INI);
+    valkey_glide_pool_entry_t* evicted  = NULL;
+    pool_eviction_t            eviction = {now - (time_t) max_idle, &evicted};
+
+    if (max_idle > 0) {
+        zend_hash_apply_with_argument(&pool, pool_entry_expired, &eviction);
+    }
+    return evicted;
+}
+
+/* Whether a client that sat unused for a while must be pinged before reuse */
+static bool pool_entry_needs_check(valkey_glide_pool_entry_t* entry, time_t now) {
+    zend_long interval = INI_INT(VALKEY_GLIDE_POOL_HEALTH_CHECK_INI);
+
+    return entry->users == 0 && (interval <= 0 || now - entry->last_used >= interval);
+}
+
+/* Send an argument-less command to a pooled client; called without pool_mutex held */
+static bool pool_client_send(const void* glide_client, enum RequestType cmd_type) {
+    CommandResult* result = command(glide_client,
+                                    0,        /* channel */
+                                    cmd_type, /* command type */
+                                    0,        /* number of arguments */
+                                    NULL,     /* arguments */
+                                    NULL,     /* argument lengths */
+                                    NULL,     /* route bytes */
+                                    0,        /* route bytes length */
+                                    0         /* span pointer */
+    );
+
+    bool succeeded = result && !result->command_error;
+    free_command_result(result);
+    return succeeded;
+}
+
+/* Give back a client that failed its health check, closing it once nobody uses it */
+static void pool_discard(const uint8_t* request, size_t request_len, const void* glide_client) {
+    valkey_glide_pool_entry_t* discarded = NULL;
+
+    pthread_mutex_lock(&pool_mutex);
+
+    valkey_glide_pool_entry_t* entry =
+        zend_hash_str_find_ptr(&pool, (const char*) request, request_len);
+    if (entry && entry->glide_client == glide_client) {
+        if (entry->users > 0) {
+            entry->users--;
+        }
+        if (entry->users == 0) {
+            zend_hash_str_del(&pool, (const char*) request, request_len);
+            entry->next = NULL;
+            discarded   = entry;
+        }
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+    pool_close_entries(discarded);
+}
+
+const void* valkey_glide_pool_checkout(const uint8_t* request, size_t request_len) {
+    const void*                glide_client = NULL;
+    bool                       needs_check  = false;
+    time_t                     now          = time(NULL);
+    valkey_glide_pool_entry_t* evicted;
+
+    pthread_mutex_lock(&pool_mutex);
+    pool_ensure_initialized();
+    evicted = pool_evict_idle(now);
+
+    valkey_glide_pool_entry_t* entry =
+        zend_hash_str_find_ptr(&pool, (const char*) request, request_len);
+    if (entry) {
+        /* Taking the client before the check keeps it from being evicted meanwhile */
+        needs_check = pool_entry_needs_check(entry, now);
+        entry->users++;
+        entry->last_used = now;
+        glide_client     = entry->glide_client;
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+    pool_close_entries(evicted);
+
+    /* The PING runs unlocked so other checkouts do not wait on network I/O */
+    if (needs_check && !pool_client_send(glide_client, Ping)) {
+        VALKEY_LOG_WARN("persistent_pool", "Persistent client failed health check, reconnecting");
+        pool_discard(request, request_len, glide_client);
+        glide_client = NULL;
+    }
+    return glide_client;
+}
+
+bool valkey_glide_pool_add(const uint8_t* request, size_t request_len, const void* glide_client) {
+    bool added = false;
+
+    pthread_mutex_lock(&pool_mutex);
+    pool_ensure_initialized();
+
+    if (zend_hash_num_elements(&pool) < (uint32_t) INI_INT(VALKEY_GLIDE_POOL_MAX_CLIENTS_INI) &&
+        !zend_hash_str_exists(&pool, (const char*) request, request_len)) {
+        valkey_glide_pool_entry_t* entry = pemalloc(sizeof(valkey_glide_pool_entry_t), 1);
+
+        entry->glide_client = glide_client;
+        entry->users        = 1;
+        entry->last_used    = time(NULL);
+        entry->next         = NULL;
+
+        zend_hash_str_add_new_ptr(&pool, (const char*) request, request_len, entry);
+        added = true;
+    } else {
+        VALKEY_LOG_DEBUG("persistent_pool", "Persistent pool is full, using a private client");
+    }
+
+    pthread_mutex_unlock(&pool_mutex);
+    return added;
+}
+
+/* pool_mutex must be held */
+static valkey_glide_pool_entry_t* pool_find_client(const void* glide_client) {
+    valkey_glide_pool_entry_t* entry;
+
+    if (pool_initialized) {
+        ZEND_HASH_FOREACH_PTR(&pool, entry) {
+            if (entry->glide_client == glide_client) {
+                return entry;
+            }
+        }
+        ZEND_HASH_FOREACH_END();
+    }
+    return NULL;
+}
+
+void valkey_glide_pool_checkin(const void* glide_client) {
+    valkey_glide_pool_entry_t* entry;
+    bool                       last_user;
+
+    pthread_mutex_lock(&pool_mutex);
+    entry     = pool_find_client(glide_client);
+    last_user = entry && entry->users == 1;
+    pthread_mutex_unlock(&pool_mutex);
+
+    /*
+     * Keys left watched by a request that ended before EXEC would abort the
+     * next user's transaction. The entry still counts this user, so it cannot
+     * be evicted during the UNWATCH.
+     */
+    if (last_user && !pool_client_send(glide_client, UnWatch)) {
+        VALKEY_LOG_WARN("persistent_pool", "Failed to reset a persistent client on checkin");
+    }
+
+    pthread_mutex_lock(&pool_mutex);
+    entry = pool_find_client(glide_client);
+    if (entry) {
+        if (entry->users > 0) {
+            entry->users--;
+        }
+        entry->last_used = time(NULL);
+    }
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+bool valkey_glide_pool_command_is_stateful(zval* args, int args_count) {
+    if (args_count < 1 || Z_TYPE(args[0]) != IS_STRING) {
+        return false;
+    }
+    if (strcasecmp(Z_STRVAL(args[0]), "SELECT") == 0) {
+        return true;
+    }
+    return args_count > 1 && strcasecmp(Z_STRVAL(args[0]), "CLIENT") == 0 &&
+           Z_TYPE(args[1]) == IS_STRING && strcasecmp(Z_STRVAL(args[1]), "SETNAME") == 0;
+}
+
+void valkey_glide_pool_shutdown(void) {
+    valkey_glide_pool_entry_t* entry;
+
+    pthread_mutex_lock(&pool_mutex);
+    if (pool_initialized) {
+        ZEND_HASH_FOREACH_PTR(&pool, entry) {
+            entry->next = NULL;
+            pool_close_entries(entry);
+        }
+        ZEND_HASH_FOREACH_END();
+        zend_hash_destroy(&pool);
+        pool_initialized = false;
+    }
+    pthread_mutex_unlock(&pool_mutex);
+}
@@ -0,0 +1,52 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_POOL_H
+#define VALKEY_GLIDE_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "php.h"
+
+/* ====================================================================
+ * PERSISTENT CLIENT POOL
+ * ==================================================================== */
+
+/*
+ * Native clients created with advanced_config['persistent'] => true outlive
+ * the PHP request. They are keyed on the serialized connection request, which
+ * covers every connection setting (addresses, credentials, TLS, database_id,
+ * read_from, ...), and shared by all objects in the process using the same
+ * configuration. Since database_id is part of the key, commands that would
+ * change the database or the connection name for every other user of the
+ * client are rejected on pooled clients, and keys still watched when the last
+ * user checks the client in are unwatched.
+ */
+
+/* INI settings */
+#define VALKEY_GLIDE_POOL_MAX_CLIENTS_INI "valkey_glide.persistent_max_clients"
+#define VALKEY_GLIDE_POOL_MAX_IDLE_INI "valkey_glide.persistent_max_idle"
+#define VALKEY_GLIDE_POOL_HEALTH_CHECK_INI "valkey_glide.persistent_health_check_interval"
+
+/**
+ * Take a pooled client for the given connection request, or NULL if there is
+ * none or it failed its health check.
+ */
+const void* valkey_glide_pool_checkout(const uint8_t* request, size_t request_len);
+
+/**
+ * Put a freshly created client in the pool and check it out.
+ * Returns false when the per-process cap is reached; the caller then owns the client.
+ */
+bool valkey_glide_pool_add(const uint8_t* request, size_t request_len, const void* glide_client);
+
+/* Return a client obtained from the pool instead of closing it; the last user unwatches its keys */
+void valkey_glide_pool_checkin(const void* glide_client);
+
+/* Whether a raw command changes connection state shared by every user of a pooled client */
+bool valkey_glide_pool_command_is_stateful(zval* args, int args_count);
+
+/* Close every pooled client; called at module shutdown */
+void valkey_glide_pool_shutdown(void);
+
+#endif /* VALKEY_GLIDE_POOL_H */
@@ -0,0 +1,787 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "valkey_glide_pubsub.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <zend_exceptions.h>
+
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_core_common.h"
+
+/* Longest wait of the callback loop before it checks its subscriptions again */
+#define PUBSUB_LOOP_WAIT 0.1
+
+/* Message queued by the core thread: channel, message and pattern follow the header */
+typedef struct pubsub_message {
+    struct pubsub_message*     next;
+    valkey_glide_pubsub_kind_t kind;
+    size_t                     channel_len;
+    size_t                     message_len;
+    size_t                     pattern_len;
+    char                       data[];
+} pubsub_message_t;
+
+typedef ConnectionRequest__PubSubSubscriptions__ChannelsOrPatternsByTypeEntry pubsub_entry_t;
+
+/* Subscriber connection known to the push callback */
+typedef struct pubsub_registration {
+    struct pubsub_registration* next;
+    uintptr_t                   client;
+    valkey_glide_pubsub_t*      pubsub;
+} pubsub_registration_t;
+
+struct valkey_glide_pubsub {
+    const void* client; /* Subscriber connection, NULL without subscriptions */
+    HashTable   names[VALKEY_GLIDE_PUBSUB_KINDS]; /* Subscribed name => NULL */
+
+    /* Callbacks of the running subscribe() loop, per kind */
+    zend_fcall_info       callbacks[VALKEY_GLIDE_PUBSUB_KINDS];
+    zend_fcall_info_cache callback_caches[VALKEY_GLIDE_PUBSUB_KINDS];
+    bool                  has_callback[VALKEY_GLIDE_PUBSUB_KINDS];
+    bool                  in_loop;
+
+    /* Filled by the core thread, drained by poll() and the callback loop */
+    pthread_mutex_t   lock;
+    pthread_cond_t    ready;
+    pubsub_message_t* head;
+    pubsub_message_t* tail;
+    size_t            queued;
+    size_t            dropped; /* Pushed past VALKEY_GLIDE_PUBSUB_MAX_QUEUED since the last drain */
+};
+
+/* Process-wide, since pushes arrive on core threads that know nothing of PHP */
+static pubsub_registration_t* registry       = NULL;
+static pthread_mutex_t        registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * A subscriber can be sent messages before create_client() returns its
+ * pointer; those go to the subscriber being connected, one at a time.
+ */
+static pthread_mutex_t        connect_mutex = PTHREAD_MUTEX_INITIALIZER;
+static valkey_glide_pubsub_t* connecting    = NULL;
+
+static const char* pubsub_type_names[VALKEY_GLIDE_PUBSUB_KINDS] = {
+    "message", "pmessage", "smessage"};
+
+/* registry_mutex must be held */
+static valkey_glide_pubsub_t* registry_find(uintptr_t client) {
+    pubsub_registration_t* registration;
+
+    for (registration = registry; registration; registration = registration->next) {
+        if (registration->client == client) {
+            return registration->pubsub;
+        }
+    }
+    return NULL;
+}
+
+/* registry_mutex must be held */
+static void registry_remove(const void* client) {
+    pubsub_registration_t** link = &registry;
+
+    while (*link) {
+        if ((*link)->client == (uintptr_t) client) {
+            pubsub_registration_t* registration = *link;
+
+            *link = registration->next;
+            free(registration);
+            return;
+        }
+        link = &(*link)->next;
+    }
+}
+
+/* Stop delivering to a subscriber connection and close it */
+static void pubsub_close_client(const void* client) {
+    if (!client) {
+        return;
+    }
+
+    pthread_mutex_lock(&registry_mutex);
+    registry_remove(client);
+    pthread_mutex_unlock(&registry_mutex);
+    close_glide_client(client);
+}
+
+static void valkey_glide_pubsub_push_callback(uintptr_t      client_ptr,
+                                              enum PushKind  kind,
+                                              const uint8_t* message,
+                                              int64_t        message_len,
+                                              const uint8_t* channel,
+                                              int64_t        channel_len,
+                                              const uint8_t* pattern,
+                                              int64_t        pattern_len) {
+    valkey_glide_pubsub_t*     pubsub;
+    pubsub_message_t*          queued;
+    valkey_glide_pubsub_kind_t type;
+
+    /* Runs on a core thread: no Zend API, no PHP allocator */
+    switch (kind) {
+        case PushMessage:
+            type = VALKEY_GLIDE_PUBSUB_EXACT;
+            break;
+        case PushPMessage:
+            type = VALKEY_GLIDE_PUBSUB_PATTERN;
+            break;
+        case PushSMessage:
+            type = VALKEY_GLIDE_PUBSUB_SHARDED;
+            break;
+        default:
+            /* Subscriptions are restored by the core after a reconnection */
+            return;
+    }
+
+    message_len = message ? message_len : 0;
+    channel_len = channel ? channel_len : 0;
+    pattern_len = pattern ? pattern_len : 0;
+
+    queued = malloc(sizeof(pubsub_message_t) + (size_t) (channel_len + message_len + pattern_len));
+    if (!queued) {
+        return;
+    }
+    queued->next        = NULL;
+    queued->kind        = type;
+    queued->channel_len = (size_t) channel_len;
+    queued->message_len = (size_t) message_len;
+    queued->pattern_len = (size_t) pattern_len;
+    memcpy(queued->data, channel, queued->channel_len);
+    memcpy(queued->data + queued->channel_len, message, queued->message_len);
+    memcpy(queued->data + queued->channel_len + queued->message_len, pattern, queued->pattern_len);
+
+    pthread_mutex_lock(&registry_mutex);
+    pubsub = registry_find(client_ptr);
+    if (!pubsub) {
+        pubsub = connecting;
+    }
+    if (pubsub) {
+        pthread_mutex_lock(&pubsub->lock);
+        if (pubsub->queued >= VALKEY_GLIDE_PUBSUB_MAX_QUEUED) {
+            pubsub->dropped++;
+        } else {
+            if (pubsub->tail) {
+                pubsub->tail->next = queued;
+            } else {
+                pubsub->head = queued;
+            }
+            pubsub->tail = queued;
+            pubsub->queued++;
+            queued = NULL;
+            pthread_cond_signal(&pubsub->ready);
+        }
+        pthread_mutex_unlock(&pubsub->lock);
+    }
+    pthread_mutex_unlock(&registry_mutex);
+
+    free(queued);
+}
+
+static valkey_glide_pubsub_t* pubsub_get(valkey_glide_object* valkey_glide) {
+    valkey_glide_pubsub_t* pubsub = valkey_glide->pubsub;
+    int                    i;
+
+    if (pubsub) {
+        return pubsub;
+    }
+
+    pubsub = ecalloc(1, sizeof(valkey_glide_pubsub_t));
+    for (i = 0; i < VALKEY_GLIDE_PUBSUB_KINDS; i++) {
+        zend_hash_init(&pubsub->names[i], 8, NULL, NULL, 0);
+    }
+    pthread_mutex_init(&pubsub->lock, NULL);
+    pthread_cond_init(&pubsub->ready, NULL);
+
+    valkey_glide->pubsub = pubsub;
+    return pubsub;
+}
+
+static void pubsub_clear_callback(valkey_glide_pubsub_t* pubsub, int kind) {
+    if (pubsub->has_callback[kind]) {
+        zval_ptr_dtor(&pubsub->callbacks[kind].function_name);
+        pubsub->has_callback[kind] = false;
+    }
+}
+
+static void pubsub_free_messages(pubsub_message_t* message) {
+    while (message) {
+        pubsub_message_t* next = message->next;
+
+        free(message);
+        message = next;
+    }
+}
+
+void valkey_glide_pubsub_free(valkey_glide_pubsub_t* pubsub) {
+    int i;
+
+    if (!pubsub) {
+        return;
+    }
+
+    /* Unregistered first, so nothing is queued once the lock goes away */
+    pubsub_close_client(pubsub->client);
+    for (i = 0; i < VALKEY_GLIDE_PUBSUB_KINDS; i++) {
+        pubsub_clear_callback(pubsub, i);
+        zend_hash_destroy(&pubsub->names[i]);
+    }
+    pubsub_free_messages(pubsub->head);
+    pthread_cond_destroy(&pubsub->ready);
+    pthread_mutex_destroy(&pubsub->lock);
+    efree(pubsub);
+}
+
+/**
+ * Open a subscriber connection for the current names and swap it in, or close
+ * it when nothing is subscribed. Returns NULL on success, otherwise an error
+ * message the caller must efree().
+ */
+static char* pubsub_resubscribe(valkey_glide_object* valkey_glide, valkey_glide_pubsub_t* pubsub) {
+    ConnectionRequest__ConnectionRequest* request;
+    ConnectionRequest__PubSubSubscriptions subscriptions =
+        CONNECTION_REQUEST__PUB_SUB_SUBSCRIPTIONS__INIT;
+    pubsub_entry_t                              entries[VALKEY_GLIDE_PUBSUB_KINDS];
+    pubsub_entry_t*                             entry_list[VALKEY_GLIDE_PUBSUB_KINDS];
+    ConnectionRequest__PubSubChannelsOrPatterns names[VALKEY_GLIDE_PUBSUB_KINDS];
+    ProtobufCBinaryData*                        data[VALKEY_GLIDE_PUBSUB_KINDS] = {NULL};
+    ClientType                                  client_type;
+    uint8_t*                                    request_bytes;
+    size_t                                      request_len;
+    const void*                                 previous;
+    char*                                       error = NULL;
+    int                                         i;
+
+    for (i = 0; i < VALKEY_GLIDE_PUBSUB_KINDS; i++) {
+        uint32_t     count = zend_hash_num_elements(&pubsub->names[i]);
+        zend_string* name;
+        size_t       n = 0;
+
+        if (count == 0) {
+            continue;
+        }
+
+        data[i] = emalloc(count * sizeof(ProtobufCBinaryData));
+        ZEND_HASH_FOREACH_STR_KEY(&pubsub->names[i], name) {
+            data[i][n].data = (uint8_t*) ZSTR_VAL(name);
+            data[i][n].len  = ZSTR_LEN(name);
+            n++;
+        }
+        ZEND_HASH_FOREACH_END();
+
+        names[i] = (ConnectionRequest__PubSubChannelsOrPatterns)
+            CONNECTION_REQUEST__PUB_SUB_CHANNELS_OR_PATTERNS__INIT;
+        names[i].n_channels_or_patterns = n;
+        names[i].channels_or_patterns   = data[i];
+
+        entries[i] = (pubsub_entry_t)
+            CONNECTION_REQUEST__PUB_SUB_SUBSCRIPTIONS__CHANNELS_OR_PATTERNS_BY_TYPE_ENTRY__INIT;
+        entries[i].key   = (uint32_t) i;
+        entries[i].value = &names[i];
+
+        entry_list[subscriptions.n_channels_or_patterns_by_type++] = &entries[i];
+    }
+
+    /* Nothing left to listen to */
+    if (subscriptions.n_channels_or_patterns_by_type == 0) {
+        previous       = pubsub->client;
+        pubsub->client = NULL;
+        pubsub_close_client(previous);
+        return NULL;
+    }
+    subscriptions.channels_or_patterns_by_type = entry_list;
+
+    /* Same connection settings as the regular client, plus the subscriptions */
+    request = connection_request__connection_request__unpack(
+        NULL, valkey_glide->connection_request_len, valkey_glide->connection_request);
+    if (!request) {
+        error = estrdup("Failed to build the subscriber connection request");
+        goto cleanup;
+    }
+    request->pubsub_subscriptions = &subscriptions;
+    request_len   = connection_request__connection_request__get_packed_size(request);
+    request_bytes = emalloc(request_len);
+    connection_request__connection_request__pack(request, request_bytes);
+    request->pubsub_subscriptions = NULL;
+    connection_request__connection_request__free_unpacked(request, NULL);
+
+    client_type.tag = SyncClient;
+
+    pthread_mutex_lock(&connect_mutex);
+    pthread_mutex_lock(&registry_mutex);
+    connecting = pubsub;
+    pthread_mutex_unlock(&registry_mutex);
+
+    const ConnectionResponse* conn_resp = create_client(
+        request_bytes, request_len, &client_type, valkey_glide_pubsub_push_callback);
+
+    pthread_mutex_lock(&registry_mutex);
+    connecting = NULL;
+    if (!conn_resp->connection_error_message) {
+        pubsub_registration_t* registration = malloc(sizeof(pubsub_registration_t));
+
+        if (registration) {
+            registration->client = (uintptr_t) conn_resp->conn_ptr;
+            registration->pubsub = pubsub;
+            registration->next   = registry;
+            registry             = registration;
+        }
+    }
+    pthread_mutex_unlock(&registry_mutex);
+    pthread_mutex_unlock(&connect_mutex);
+
+    efree(request_bytes);
+
+    if (conn_resp->connection_error_message) {
+        VALKEY_LOG_ERROR("pubsub", conn_resp->connection_error_message);
+        error = estrdup(conn_resp->connection_error_message);
+    } else {
+        /* The old subscriber is closed only once the new one receives */
+        previous       = pubsub->client;
+        pubsub->client = conn_resp->conn_ptr;
+        pubsub_close_client(previous);
+        VALKEY_LOG_DEBUG("pubsub", "Subscriber connection updated");
+    }
+    free_connection_response((ConnectionResponse*) conn_resp);
+
+cleanup:
+    for (i = 0; i < VALKEY_GLIDE_PUBSUB_KINDS; i++) {
+        if (data[i]) {
+            efree(data[i]);
+        }
+    }
+    return error;
+}
+
+/**
+ * Detach up to max queued messages, waiting up to timeout seconds for the
+ * first one. Returns the list and its length in *count.
+ */
+static pubsub_message_t* pubsub_take(valkey_glide_pubsub_t* pubsub,
+                                     zend_long              max,
+                                     double                 timeout,
+                                     zend_long*             count) {
+    pubsub_message_t* first;
+    pubsub_message_t* last = NULL;
+    zend_long         n    = 0;
+    size_t            dropped;
+
+    pthread_mutex_lock(&pubsub->lock);
+    if (!pubsub->head && timeout > 0) {
+        struct timeval  now;
+        struct timespec deadline;
+        double          seconds;
+
+        gettimeofday(&now, NULL);
+        seconds          = (double) now.tv_sec + (double) now.tv_usec / 1e6 + timeout;
+        deadline.tv_sec  = (time_t) seconds;
+        deadline.tv_nsec = (long) ((seconds - (double) deadline.tv_sec) * 1e9);
+        while (!pubsub->head &&
+               pthread_cond_timedwait(&pubsub->ready, &pubsub->lock, &deadline) != ETIMEDOUT) {
+        }
+    }
+
+    first = pubsub->head;
+    for (pubsub_message_t* message = first; message && n < max; message = message->next) {
+        last = message;
+        n++;
+    }
+    if (last) {
+        pubsub->head = last->next;
+        if (!pubsub->head) {
+            pubsub->tail = NULL;
+        }
+        last->next = NULL;
+        pubsub->queued -= (size_t) n;
+    } else {
+        first = NULL;
+    }
+    dropped         = pubsub->dropped;
+    pubsub->dropped = 0;
+    pthread_mutex_unlock(&pubsub->lock);
+
+    if (dropped > 0) {
+        VALKEY_LOG_WARN_FMT(
+            "pubsub", "Dropped %zu messages received while the queue was full", dropped);
+    }
+
+    *count = n;
+    return first;
+}
+
+/* Put messages the loop could not deliver back at the front of the queue */
+static void pubsub_requeue(valkey_glide_pubsub_t* pubsub,
+                           pubsub_message_t*      first,
+                           pubsub_message_t*      last,
+                           size_t                 count) {
+    if (!first) {
+        return;
+    }
+
+    pthread_mutex_lock(&pubsub->lock);
+    last->next = pubsub->head;
+    if (!pubsub->head) {
+        pubsub->tail = last;
+    }
+    pubsub->head = first;
+    pubsub->queued += count;
+    pthread_mutex_unlock(&pubsub->lock);
+}
+
+static void pubsub_message_to_zval(const pubsub_message_t* message, zval* output) {
+    const char* channel = message->data;
+    const char* payload = message->data + message->channel_len;
+
+    array_init_size(output, message->pattern_len ? 4 : 3);
+    add_assoc_string(output, "type", (char*) pubsub_type_names[message->kind]);
+    add_assoc_stringl(output, "channel", channel, message->channel_len);
+    add_assoc_stringl(output, "message", payload, message->message_len);
+    if (message->kind == VALKEY_GLIDE_PUBSUB_PATTERN) {
+        add_assoc_stringl(
+            output, "pattern", payload + message->message_len, message->pattern_len);
+    }
+}
+
+/* Whether a subscribe() loop still has something to wait for */
+static bool pubsub_loop_active(valkey_glide_pubsub_t* pubsub) {
+    int i;
+
+    for (i = 0; i < VALKEY_GLIDE_PUBSUB_KINDS; i++) {
+        if (pubsub->has_callback[i] && zend_hash_num_elements(&pubsub->names[i]) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Call the callback of its kind for a message: ($client, [$pattern,] $channel, $message) */
+static void pubsub_dispatch(valkey_glide_pubsub_t*  pubsub,
+                            zval*                   object,
+                            const pubsub_message_t* message) {
+    zend_fcall_info       fci     = pubsub->callbacks[message->kind];
+    zend_fcall_info_cache fcc     = pubsub->callback_caches[message->kind];
+    const char*           payload = message->data + message->channel_len;
+    zval                  params[4];
+    zval                  retval;
+    uint32_t              n = 0;
+
+    /* The callback may unsubscribe, which releases it while it runs */
+    Z_TRY_ADDREF(fci.function_name);
+
+    ZVAL_COPY_VALUE(&params[n++], object);
+    if (message->kind == VALKEY_GLIDE_PUBSUB_PATTERN) {
+        ZVAL_STRINGL(&params[n++], payload + message->message_len, message->pattern_len);
+    }
+    ZVAL_STRINGL(&params[n++], message->data, message->channel_len);
+    ZVAL_STRINGL(&params[n++], payload, message->message_len);
+
+    fci.retval       = &retval;
+    fci.params       = params;
+    fci.param_count  = n;
+    fci.named_params = NULL;
+    if (zend_call_function(&fci, &fcc) == SUCCESS) {
+        zval_ptr_dtor(&retval);
+    }
+    zval_ptr_dtor(&fci.function_name);
+
+    /* The object is borrowed from the caller */
+    for (uint32_t i = 1; i < n; i++) {
+        zval_ptr_dtor(&params[i]);
+    }
+}
+
+/*
+ * Act on what the engine would check between opcodes. Signal handlers run
+ * here; a timeout makes the loop return so the engine raises it.
+ */
+static bool pubsub_interrupted(void) {
+#if PHP_VERSION_ID >= 80200
+    if (!zend_atomic_bool_load_ex(&EG(vm_interrupt))) {
+        return false;
+    }
+    if (zend_atomic_bool_load_ex(&EG(timed_out))) {
+        return true;
+    }
+    zend_atomic_bool_store_ex(&EG(vm_interrupt), false);
+#else
+    if (!EG(vm_interrupt)) {
+        return false;
+    }
+    if (EG(timed_out)) {
+        return true;
+    }
+    EG(vm_interrupt) = 0;
+#endif
+    if (zend_interrupt_function) {
+        zend_interrupt_function(EG(current_execute_data));
+    }
+    return EG(exception) != NULL;
+}
+
+/**
+ * Deliver messages to the subscribe() callbacks until every kind with a
+ * callback is unsubscribed, a callback throws or the request is interrupted.
+ * Messages of other kinds are left queued for poll().
+ */
+static void pubsub_run_loop(valkey_glide_pubsub_t* pubsub, zval* object) {
+    pubsub_message_t* kept_first = NULL;
+    pubsub_message_t* kept_last  = NULL;
+    size_t            kept_count = 0;
+
+    pubsub->in_loop = true;
+    while (pubsub_loop_active(pubsub) && !EG(exception) && !pubsub_interrupted()) {
+        zend_long         count;
+        pubsub_message_t* message = pubsub_take(
+            pubsub, VALKEY_GLIDE_PUBSUB_DEFAULT_POLL_MAX, PUBSUB_LOOP_WAIT, &count);
+
+        while (message) {
+            pubsub_message_t* next = message->next;
+
+            if (!pubsub->has_callback[message->kind] || EG(exception)) {
+                message->next = NULL;
+                if (kept_last) {
+                    kept_last->next = message;
+                } else {
+                    kept_first = message;
+                }
+                kept_last = message;
+                kept_count++;
+            } else {
+                pubsub_dispatch(pubsub, object, message);
+                free(message);
+            }
+            message = next;
+        }
+    }
+    pubsub->in_loop = false;
+
+    pubsub_requeue(pubsub, kept_first, kept_last, kept_count);
+}
+
+int execute_subscribe_command(zval*                      object,
+                              int                        argc,
+                              zval*                      return_value,
+                              zend_class_entry*          ce,
+                              valkey_glide_pubsub_kind_t kind) {
+    valkey_glide_object*   valkey_glide;
+    valkey_glide_pubsub_t* pubsub;
+    zval*                  z_names;
+    zval*                  z_name;
+    zend_fcall_info        fci         = empty_fcall_info;
+    zend_fcall_info_cache  fcc         = empty_fcall_info_cache;
+    zend_string**          added       = NULL;
+    uint32_t               added_count = 0;
+    char*                  error;
+
+    if (zend_parse_method_parameters(argc, object, "Oa|f!", &object, ce, &z_names, &fci, &fcc) ==
+        FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+    pubsub = pubsub_get(valkey_glide);
+
+    /* Remember what was added so a failed connection leaves the names as they were */
+    added = safe_emalloc(zend_hash_num_elements(Z_ARRVAL_P(z_names)), sizeof(zend_string*), 0);
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(z_names), z_name) {
+        zend_string* name = zval_get_string(z_name);
+
+        if (zend_hash_add_empty_element(&pubsub->names[kind], name)) {
+            added[added_count++] = zend_string_copy(name);
+        }
+        zend_string_release(name);
+    }
+    ZEND_HASH_FOREACH_END();
+
+    if (added_count > 0) {
+        error = pubsub_resubscribe(valkey_glide, pubsub);
+        if (error) {
+            for (uint32_t i = 0; i < added_count; i++) {
+                zend_hash_del(&pubsub->names[kind], added[i]);
+            }
+        }
+    } else {
+        error = NULL;
+    }
+    for (uint32_t i = 0; i < added_count; i++) {
+        zend_string_release(added[i]);
+    }
+    efree(added);
+
+    if (error) {
+        zend_throw_exception(
+            get_exception_ce_for_client_type(ce == get_valkey_glide_cluster_ce()), error, 0);
+        efree(error);
+        return 0;
+    }
+
+    if (ZEND_FCI_INITIALIZED(fci)) {
+        pubsub_clear_callback(pubsub, kind);
+        pubsub->callbacks[kind]       = fci;
+        pubsub->callback_caches[kind] = fcc;
+        pubsub->has_callback[kind]    = true;
+        Z_TRY_ADDREF(pubsub->callbacks[kind].function_name);
+
+        /* A callback subscribing to more names joins the loop already running */
+        if (!pubsub->in_loop) {
+            pubsub_run_loop(pubsub, object);
+        }
+        if (EG(exception)) {
+            return 0;
+        }
+    }
+
+    ZVAL_TRUE(return_value);
+    return 1;
+}
+
+int execute_unsubscribe_command(zval*                      object,
+                                int                        argc,
+                                zval*                      return_value,
+                                zend_class_entry*          ce,
+                                valkey_glide_pubsub_kind_t kind) {
+    valkey_glide_object*   valkey_glide;
+    valkey_glide_pubsub_t* pubsub;
+    zval*                  z_names = NULL;
+    zval*                  z_name;
+    zend_string*           name;
+    uint32_t               subscribed;
+    char*                  error;
+
+    if (zend_parse_method_parameters(argc, object, "O|a", &object, ce, &z_names) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+    pubsub = pubsub_get(valkey_glide);
+
+    /* name => whether it was subscribed */
+    subscribed = zend_hash_num_elements(&pubsub->names[kind]);
+    array_init(return_value);
+    if (!z_names || zend_hash_num_elements(Z_ARRVAL_P(z_names)) == 0) {
+        ZEND_HASH_FOREACH_STR_KEY(&pubsub->names[kind], name) {
+            add_assoc_bool_ex(return_value, ZSTR_VAL(name), ZSTR_LEN(name), 1);
+        }
+        ZEND_HASH_FOREACH_END();
+        zend_hash_clean(&pubsub->names[kind]);
+    } else {
+        ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(z_names), z_name) {
+            name = zval_get_string(z_name);
+            add_assoc_bool_ex(return_value,
+                              ZSTR_VAL(name),
+                              ZSTR_LEN(name),
+                              zend_hash_del(&pubsub->names[kind], name) == SUCCESS);
+            zend_string_release(name);
+        }
+        ZEND_HASH_FOREACH_END();
+    }
+
+    /* The loop of this kind ends with its last subscription */
+    if (zend_hash_num_elements(&pubsub->names[kind]) == 0) {
+        pubsub_clear_callback(pubsub, kind);
+    }
+
+    /* Nothing was removed, so the subscriber connection stays as it is */
+    if (zend_hash_num_elements(&pubsub->names[kind]) == subscribed) {
+        return 1;
+    }
+
+    error = pubsub_resubscribe(valkey_glide, pubsub);
+    if (error) {
+        zend_throw_exception(
+            get_exception_ce_for_client_type(ce == get_valkey_glide_cluster_ce()), error, 0);
+        efree(error);
+        return 0;
+    }
+    return 1;
+}
+
+int execute_poll_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    pubsub_message_t*    message;
+    zend_long            max_messages = VALKEY_GLIDE_PUBSUB_DEFAULT_POLL_MAX;
+    zend_long            count;
+    double               timeout = 0;
+
+    if (zend_parse_method_parameters(
+            argc, object, "O|ld", &object, ce, &max_messages, &timeout) == FAILURE) {
+        return 0;
+    }
+    if (max_messages <= 0) {
+        zend_argument_value_error(1, "must be greater than 0");
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->pubsub) {
+        return 0;
+    }
+
+    /* One lock for the whole batch; the arrays are built outside of it */
+    message = pubsub_take(valkey_glide->pubsub, max_messages, timeout, &count);
+    array_init_size(return_value, (uint32_t) count);
+    while (message) {
+        pubsub_message_t* next = message->next;
+        zval              entry;
+
+        pubsub_message_to_zval(message, &entry);
+        add_next_index_zval(return_value, &entry);
+        free(message);
+        message = next;
+    }
+    return 1;
+}
+
+int execute_publish_command(zval*             object,
+                            int               argc,
+                            zval*             return_value,
+                            zend_class_entry* ce,
+                            enum RequestType  cmd_type) {
+    valkey_glide_object* valkey_glide;
+    char *               channel = NULL, *message = NULL;
+    size_t               channel_len = 0, message_len = 0;
+
+    if (zend_parse_method_parameters(
+            argc, object, "Oss", &object, ce, &channel, &channel_len, &message, &message_len) ==
+        FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    /* PUBLISH channel message, with the channel in key position for SPUBLISH routing */
+    core_command_args_t args = {0};
+    args.glide_client        = valkey_glide->glide_client;
+    args.cmd_type            = cmd_type;
+    args.key                 = channel;
+    args.key_len             = channel_len;
+
+    args.args[0].type                  = CORE_ARG_TYPE_STRING;
+    args.args[0].data.string_arg.value = message;
+    args.args[0].data.string_arg.len   = message_len;
+    args.arg_count                     = 1;
+
+    if (execute_core_command(valkey_glide, &args, NULL, process_core_int_result, return_value)) {
+        if (valkey_glide->is_in_batch_mode) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
+        return 1;
+    }
+    return 0;
+}
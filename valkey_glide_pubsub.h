@@ -0,0 +1,67 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_PUBSUB_H
+#define VALKEY_GLIDE_PUBSUB_H
+
+#include <stdbool.h>
+
+#include "common.h"
+#include "include/glide_bindings.h"
+
+/* ====================================================================
+ * PUB/SUB
+ * ==================================================================== */
+
+/*
+ * Subscriptions are held by a dedicated subscriber client, opened from the
+ * object's connection request with the channels, patterns and shard channels
+ * added to it, so the regular client stays free for commands. The core
+ * delivers messages on one of its threads through the push callback; they are
+ * only queued there, then drained in batches by poll() or by the callback loop
+ * of subscribe(). Changing the subscriptions opens the new subscriber before
+ * the old one is closed, so a message may be seen twice but is not lost.
+ * A subscriber nobody drains stops queueing at VALKEY_GLIDE_PUBSUB_MAX_QUEUED
+ * messages; what arrives past it is dropped, counted and logged on the next drain.
+ */
+
+#define VALKEY_GLIDE_PUBSUB_DEFAULT_POLL_MAX 1000
+#define VALKEY_GLIDE_PUBSUB_MAX_QUEUED 100000
+
+/* Subscription kinds, numbered like the core's PubSubChannelType */
+typedef enum {
+    VALKEY_GLIDE_PUBSUB_EXACT   = 0,
+    VALKEY_GLIDE_PUBSUB_PATTERN = 1,
+    VALKEY_GLIDE_PUBSUB_SHARDED = 2,
+    VALKEY_GLIDE_PUBSUB_KINDS   = 3
+} valkey_glide_pubsub_kind_t;
+
+typedef struct valkey_glide_pubsub valkey_glide_pubsub_t;
+
+/* Free the subscriber of an object, if any, closing its connection */
+void valkey_glide_pubsub_free(valkey_glide_pubsub_t* pubsub);
+
+/* SUBSCRIBE, PSUBSCRIBE and SSUBSCRIBE, optionally running the callback loop */
+int execute_subscribe_command(zval*                      object,
+                              int                        argc,
+                              zval*                      return_value,
+                              zend_class_entry*          ce,
+                              valkey_glide_pubsub_kind_t kind);
+
+/* UNSUBSCRIBE, PUNSUBSCRIBE and SUNSUBSCRIBE; no names drops every one of the kind */
+int execute_unsubscribe_command(zval*                      object,
+                                int                        argc,
+                                zval*                      return_value,
+                                zend_class_entry*          ce,
+                                valkey_glide_pubsub_kind_t kind);
+
+/* Drain up to max_messages queued messages, waiting up to timeout seconds for the first */
+int execute_poll_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+
+/* PUBLISH and SPUBLISH, sent on the regular client */
+int execute_publish_command(zval*             object,
+                            int               argc,
+                            zval*             return_value,
+                            zend_class_entry* ce,
+                            enum RequestType  cmd_type);
+
+#endif /* VALKEY_GLIDE_PUBSUB_H */
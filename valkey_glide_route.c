@@ -0,0 +1,159 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_route.h"
+
+#include <string.h>
+
+#include "include/glide/command_request.pb-c.h"
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_route_arginfo.h"
+
+/* Enough for any serialized simple route (a one-byte tag and a varint) */
+#define VALKEY_GLIDE_SIMPLE_ROUTE_MAX_BYTES 16
+
+typedef struct {
+    const char* name;
+    size_t      name_len;
+    int         simple_route_type;
+    uint8_t     bytes[VALKEY_GLIDE_SIMPLE_ROUTE_MAX_BYTES];
+    size_t      bytes_len; /* Zero if packing failed at startup */
+} valkey_glide_simple_route_t;
+
+/* Packed once at MINIT and read-only afterwards */
+static valkey_glide_simple_route_t simple_routes[] = {
+    {"randomNode", sizeof("randomNode") - 1, COMMAND_REQUEST__SIMPLE_ROUTES__Random, {0}, 0},
+    {"allPrimaries",
+     sizeof("allPrimaries") - 1,
+     COMMAND_REQUEST__SIMPLE_ROUTES__AllPrimaries,
+     {0},
+     0},
+    {"allNodes", sizeof("allNodes") - 1, COMMAND_REQUEST__SIMPLE_ROUTES__AllNodes, {0}, 0},
+};
+
+/* Global variables */
+zend_class_entry*           valkey_glide_route_ce;
+static zend_object_handlers valkey_glide_route_object_handlers;
+
+/* Object creation and destruction */
+static zend_object* create_valkey_glide_route_object(zend_class_entry* ce) {
+    valkey_glide_route_object* route =
+        ecalloc(1, sizeof(valkey_glide_route_object) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&route->std, ce);
+    object_properties_init(&route->std, ce);
+    route->std.handlers = &valkey_glide_route_object_handlers;
+
+    return &route->std;
+}
+
+static void free_valkey_glide_route_object(zend_object* object) {
+    valkey_glide_route_object* route =
+        VALKEY_GLIDE_PHP_GET_OBJECT(valkey_glide_route_object, object);
+
+    if (route->route_bytes) {
+        efree(route->route_bytes);
+    }
+
+    /* Clean up the standard object */
+    zend_object_std_dtor(&route->std);
+}
+
+const uint8_t* valkey_glide_route_get_packed(zval* route, size_t* route_bytes_len) {
+    if (Z_TYPE_P(route) == IS_OBJECT && Z_OBJCE_P(route) == valkey_glide_route_ce) {
+        valkey_glide_route_object* object =
+            VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_route_object, route);
+
+        *route_bytes_len = object->route_bytes_len;
+        return object->route_bytes;
+    }
+
+    if (Z_TYPE_P(route) == IS_STRING) {
+        for (size_t i = 0; i < sizeof(simple_routes) / sizeof(simple_routes[0]); i++) {
+            valkey_glide_simple_route_t* simple = &simple_routes[i];
+
+            if (simple->bytes_len && Z_STRLEN_P(route) == simple->name_len &&
+                strncasecmp(Z_STRVAL_P(route), simple->name, simple->name_len) == 0) {
+                *route_bytes_len = simple->bytes_len;
+                return simple->bytes;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* {{{ proto ValkeyGlideRoute::__construct(string|array route) */
+PHP_METHOD(ValkeyGlideRoute, __construct) {
+    zval*                      route_zval;
+    cluster_route_t            route;
+    valkey_glide_route_object* object;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+    Z_PARAM_ZVAL(route_zval)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (Z_TYPE_P(route_zval) != IS_STRING && Z_TYPE_P(route_zval) != IS_ARRAY) {
+        zend_argument_type_error(
+            1, "must be of type string|array, %s given", zend_zval_type_name(route_zval));
+        RETURN_THROWS();
+    }
+
+    object = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_route_object, ZEND_THIS);
+    if (object->route_bytes) {
+        zend_throw_error(NULL, "ValkeyGlideRoute is immutable");
+        RETURN_THROWS();
+    }
+
+    memset(&route, 0, sizeof(route));
+    if (!parse_cluster_route(route_zval, &route)) {
+        zend_argument_value_error(1, "is not a valid cluster route");
+        RETURN_THROWS();
+    }
+
+    object->route_bytes = create_route_bytes_from_route(&route, &object->route_bytes_len);
+
+    if (route.type == ROUTE_TYPE_KEY && route.data.key_route.key_allocated) {
+        efree(route.data.key_route.key);
+    }
+
+    if (!object->route_bytes) {
+        zend_argument_value_error(1, "is not a valid cluster route");
+        RETURN_THROWS();
+    }
+}
+/* }}} */
+
+void register_valkey_glide_route_class(void) {
+    valkey_glide_route_ce                = register_class_ValkeyGlideRoute();
+    valkey_glide_route_ce->create_object = create_valkey_glide_route_object;
+
+    memcpy(&valkey_glide_route_object_handlers,
+           zend_get_std_object_handlers(),
+           sizeof(valkey_glide_route_object_handlers));
+    valkey_glide_route_object_handlers.offset    = XtOffsetOf(valkey_glide_route_object, std);
+    valkey_glide_route_object_handlers.free_obj  = free_valkey_glide_route_object;
+    valkey_glide_route_object_handlers.clone_obj = NULL;
+
+    for (size_t i = 0; i < sizeof(simple_routes) / sizeof(simple_routes[0]); i++) {
+        valkey_glide_simple_route_t* simple = &simple_routes[i];
+        cluster_route_t              route;
+        size_t                       len;
+        uint8_t*                     bytes;
+
+        memset(&route, 0, sizeof(route));
+        route.type                   = ROUTE_TYPE_SIMPLE;
+        route.data.simple_route_type = simple->simple_route_type;
+
+        bytes = create_route_bytes_from_route(&route, &len);
+        if (bytes && len <= sizeof(simple->bytes)) {
+            memcpy(simple->bytes, bytes, len);
+            simple->bytes_len = len;
+        } else {
+            VALKEY_LOG_WARN("route_processing", "Could not pre-pack a simple route");
+        }
+        if (bytes) {
+            efree(bytes);
+        }
+    }
+}
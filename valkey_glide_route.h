@@ -0,0 +1,62 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_ROUTE_H
+#define VALKEY_GLIDE_ROUTE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "php.h"
+
+/* Parse a cluster route from a zval parameter */
+typedef struct {
+    enum {
+        ROUTE_TYPE_KEY,       /* Route by key */
+        ROUTE_TYPE_HOST_PORT, /* Route by host:port */
+        ROUTE_TYPE_SIMPLE     /* Simple route: "randomNode", "allPrimaries", "allNodes" */
+    } type;
+
+    union {
+        struct {
+            char*  key;
+            size_t key_len;
+            int    key_allocated; /* Flag to indicate if key was dynamically allocated */
+        } key_route;
+
+        struct {
+            char* host;
+            int   port;
+        } host_port_route;
+
+        int simple_route_type; /* Using SimpleRoutes_C enum values */
+    } data;
+} cluster_route_t;
+
+/* Route parsing and serialization, implemented in command_response.c */
+int      parse_cluster_route(zval* route_zval, cluster_route_t* route);
+uint8_t* create_route_bytes_from_route(cluster_route_t* route, size_t* route_bytes_len);
+
+/* ValkeyGlideRoute object structure */
+typedef struct {
+    uint8_t*    route_bytes;     /* Serialized CommandRequest__Routes */
+    size_t      route_bytes_len; /* Length of route_bytes */
+    zend_object std;             /* Standard PHP object */
+} valkey_glide_route_object;
+
+/* Class entry */
+extern zend_class_entry* valkey_glide_route_ce;
+
+/* Class methods */
+PHP_METHOD(ValkeyGlideRoute, __construct);
+
+/**
+ * Return the serialized form of a route that never needs parsing: a
+ * ValkeyGlideRoute object or one of the simple-route keywords.
+ * Returns NULL for any other route; the bytes are owned by the callee.
+ */
+const uint8_t* valkey_glide_route_get_packed(zval* route, size_t* route_bytes_len);
+
+/* Class registration function, also packs the simple routes */
+void register_valkey_glide_route_class(void);
+
+#endif /* VALKEY_GLIDE_ROUTE_H */
@@ -0,0 +1,37 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * ValkeyGlideRoute is a cluster route that is parsed and serialized once.
+ *
+ * It can be passed anywhere a ValkeyGlideCluster method takes a `$route`. Reusing the same
+ * object for repeated admin or fan-out calls skips route parsing and serialization on every
+ * call. The "randomNode", "allPrimaries" and "allNodes" keywords are already cached internally.
+ *
+ * @example
+ * $primaries = new ValkeyGlideRoute('allPrimaries');
+ * $node      = new ValkeyGlideRoute(['type' => 'routeByAddress', 'host' => '127.0.0.1', 'port' => 7001]);
+ *
+ * $valkey_glide->dbsize($primaries);
+ * $valkey_glide->info($node, 'memory');
+ *
+ * @not-serializable
+ */
+final class ValkeyGlideRoute
+{
+    /**
+     * @param string|array $route "randomNode", "allPrimaries", "allNodes", a key routed to its
+     *                            primary, ['type' => 'primarySlotKey', 'key' => $key] or
+     *                            ['type' => 'routeByAddress', 'host' => $host, 'port' => $port].
+     *
+     * @throws ValueError If the route cannot be parsed.
+     */
+    public function __construct(string|array $route)
+    {
+    }
+}
@@ -19,6 +19,8 @@
 #include "command_response.h"
 #include "common.h"
 #include "logger.h"
+#include "valkey_glide_near_cache.h"
+#include "valkey_glide_numeric.h"
 #include "valkey_glide_z_common.h"
 
 /* Import the string conversion functions from command_response.c */
@@ -29,38 +31,16 @@ extern char* double_to_string(double value, size_t* len);
  * UTILITY FUNCTIONS
  * ==================================================================== */
 
-/**
- * Allocate command arguments arrays
- */
-int allocate_s_command_args(int count, uintptr_t** args_out, unsigned long** args_len_out) {
-    *args_out     = (uintptr_t*) emalloc(count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(count * sizeof(unsigned long));
-
-    return 1;
-}
-
-/**
- * Free command arguments arrays
- */
-void cleanup_s_command_args(uintptr_t* args, unsigned long* args_len) {
-    if (args)
-        efree(args);
-    if (args_len)
-        efree(args_len);
-}
-
 /**
  * Convert array of zvals to string arguments
  */
-int convert_zval_to_string_args(zval*           input,
-                                int             count,
-                                uintptr_t**     args_out,
-                                unsigned long** args_len_out,
-                                int             offset,
-                                char***         allocated_strings,
-                                int*            allocated_count) {
-    int  i;
-    zval temp;
+int convert_zval_to_string_args(valkey_glide_arena_t* arena,
+                                zval*                 input,
+                                int                   count,
+                                uintptr_t**           args_out,
+                                unsigned long**       args_len_out,
+                                int                   offset) {
+    int i;
 
     for (i = 0; i < count; i++) {
         zval* element = &input[i];
@@ -69,28 +49,13 @@ int convert_zval_to_string_args(zval*           input,
             (*args_out)[offset + i]     = (uintptr_t) Z_STRVAL_P(element);
             (*args_len_out)[offset + i] = Z_STRLEN_P(element);
         } else {
-            /* Convert other types to string */
-            ZVAL_COPY(&temp, element);
-            convert_to_string(&temp);
-
-            /* Create a permanent copy of the string before freeing the zval */
-            size_t str_len  = Z_STRLEN(temp);
-            char*  str_copy = emalloc(str_len + 1);
-            memcpy(str_copy, Z_STRVAL(temp), str_len);
-            str_copy[str_len] = '\0';
-
-            (*args_out)[offset + i]     = (uintptr_t) str_copy;
-            (*args_len_out)[offset + i] = str_len;
-            zval_dtor(&temp);
-
-            /* Track the allocated string */
-            if (allocated_strings && allocated_count) {
-                /* Expand the allocated_strings array */
-                *allocated_strings =
-                    erealloc(*allocated_strings, (*allocated_count + 1) * sizeof(char*));
-                (*allocated_strings)[*allocated_count] = str_copy;
-                (*allocated_count)++;
-            }
+            /* Convert other types to string; the arena copy lives until the command completes */
+            zend_string* str = zval_get_string(element);
+
+            (*args_out)[offset + i] =
+                (uintptr_t) valkey_glide_arena_strndup(arena, ZSTR_VAL(str), ZSTR_LEN(str));
+            (*args_len_out)[offset + i] = ZSTR_LEN(str);
+            zend_string_release(str);
         }
     }
 
@@ -101,16 +66,7 @@ int convert_zval_to_string_args(zval*           input,
  * Allocate a string representation of a long value
  */
 char* alloc_long_string(long value, size_t* len_out) {
-    char   temp[32];
-    size_t len    = snprintf(temp, sizeof(temp), "%ld", value);
-    char*  result = emalloc(len + 1);
-    if (result) {
-        memcpy(result, temp, len);
-        result[len] = '\0';
-        if (len_out)
-            *len_out = len;
-    }
-    return result;
+    return valkey_glide_long_estrdup(value, len_out);
 }
 
 /* ====================================================================
@@ -122,9 +78,7 @@ char* alloc_long_string(long value, size_t* len_out) {
  */
 int prepare_s_key_members_args(s_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count) {
+                               unsigned long**   args_len_out) {
     if (!args->glide_client || !args->key || args->key_len == 0 || !args->members ||
         args->members_count <= 0) {
         return 0;
@@ -132,7 +86,7 @@ int prepare_s_key_members_args(s_command_args_t* args,
 
     unsigned long arg_count = 1 + args->members_count; /* key + members */
 
-    if (!allocate_s_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
@@ -141,13 +95,8 @@ int prepare_s_key_members_args(s_command_args_t* args,
     (*args_len_out)[0] = args->key_len;
 
     /* Convert and set member arguments */
-    convert_zval_to_string_args(args->members,
-                                args->members_count,
-                                args_out,
-                                args_len_out,
-                                1,
-                                allocated_strings,
-                                allocated_count);
+    convert_zval_to_string_args(
+        args->arena, args->members, args->members_count, args_out, args_len_out, 1);
 
     return arg_count;
 }
@@ -157,14 +106,12 @@ int prepare_s_key_members_args(s_command_args_t* args,
  */
 int prepare_s_key_only_args(s_command_args_t* args,
                             uintptr_t**       args_out,
-                            unsigned long**   args_len_out,
-                            char***           allocated_strings,
-                            int*              allocated_count) {
+                            unsigned long**   args_len_out) {
     if (!args->glide_client || !args->key || args->key_len == 0) {
         return 0;
     }
 
-    if (!allocate_s_command_args(1, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 1, args_out, args_len_out)) {
         return 0;
     }
 
@@ -179,15 +126,13 @@ int prepare_s_key_only_args(s_command_args_t* args,
  */
 int prepare_s_key_member_args(s_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count) {
+                              unsigned long**   args_len_out) {
     if (!args->glide_client || !args->key || args->key_len == 0 || !args->member ||
         args->member_len == 0) {
         return 0;
     }
 
-    if (!allocate_s_command_args(2, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 2, args_out, args_len_out)) {
         return 0;
     }
 
@@ -204,16 +149,14 @@ int prepare_s_key_member_args(s_command_args_t* args,
  */
 int prepare_s_key_count_args(s_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
+                             unsigned long**   args_len_out) {
     if (!args->glide_client || !args->key || args->key_len == 0) {
         return 0;
     }
 
     unsigned long arg_count = args->has_count ? 2 : 1;
 
-    if (!allocate_s_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
@@ -221,18 +164,11 @@ int prepare_s_key_count_args(s_command_args_t* args,
     (*args_len_out)[0] = args->key_len;
 
     if (args->has_count) {
-        char* count_str = alloc_long_string(args->count, NULL);
+        size_t count_len;
+        char*  count_str = valkey_glide_arena_long_to_string(args->arena, args->count, &count_len);
 
         (*args_out)[1]     = (uintptr_t) count_str;
-        (*args_len_out)[1] = strlen(count_str);
-
-        /* Track the allocated string */
-        if (allocated_strings && allocated_count) {
-            *allocated_strings =
-                erealloc(*allocated_strings, (*allocated_count + 1) * sizeof(char*));
-            (*allocated_strings)[*allocated_count] = count_str;
-            (*allocated_count)++;
-        }
+        (*args_len_out)[1] = count_len;
     }
 
     return arg_count;
@@ -243,24 +179,18 @@ int prepare_s_key_count_args(s_command_args_t* args,
  */
 int prepare_s_multi_key_args(s_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
+                             unsigned long**   args_len_out) {
     if (!args->glide_client || !args->keys || args->keys_count <= 0) {
         return 0;
     }
 
-    if (!allocate_s_command_args(args->keys_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(
+            args->arena, args->keys_count, args_out, args_len_out)) {
         return 0;
     }
 
-    convert_zval_to_string_args(args->keys,
-                                args->keys_count,
-                                args_out,
-                                args_len_out,
-                                0,
-                                allocated_strings,
-                                allocated_count);
+    convert_zval_to_string_args(
+        args->arena, args->keys, args->keys_count, args_out, args_len_out, 0);
 
     return args->keys_count;
 }
@@ -270,9 +200,7 @@ int prepare_s_multi_key_args(s_command_args_t* args,
  */
 int prepare_s_multi_key_limit_args(s_command_args_t* args,
                                    uintptr_t**       args_out,
-                                   unsigned long**   args_len_out,
-                                   char***           allocated_strings,
-                                   int*              allocated_count) {
+                                   unsigned long**   args_len_out) {
     if (!args->glide_client || !args->keys || args->keys_count <= 0) {
         return 0;
     }
@@ -280,55 +208,30 @@ int prepare_s_multi_key_limit_args(s_command_args_t* args,
     unsigned long arg_count =
         1 + args->keys_count + (args->has_limit ? 2 : 0); /* numkeys + keys + [LIMIT value] */
 
-    if (!allocate_s_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
     /* First argument is the number of keys */
-    char* numkeys_str = alloc_long_string(args->keys_count, NULL);
-    if (!numkeys_str) {
-        cleanup_s_command_args(*args_out, *args_len_out);
-        return 0;
-    }
+    size_t numkeys_len;
+    char*  numkeys_str =
+        valkey_glide_arena_long_to_string(args->arena, args->keys_count, &numkeys_len);
     (*args_out)[0]     = (uintptr_t) numkeys_str;
-    (*args_len_out)[0] = strlen(numkeys_str);
-
-    /* Track the allocated numkeys string */
-    if (allocated_strings && allocated_count) {
-        *allocated_strings = erealloc(*allocated_strings, (*allocated_count + 1) * sizeof(char*));
-        (*allocated_strings)[*allocated_count] = numkeys_str;
-        (*allocated_count)++;
-    }
+    (*args_len_out)[0] = numkeys_len;
 
     /* Add keys */
-    convert_zval_to_string_args(args->keys,
-                                args->keys_count,
-                                args_out,
-                                args_len_out,
-                                1,
-                                allocated_strings,
-                                allocated_count);
+    convert_zval_to_string_args(
+        args->arena, args->keys, args->keys_count, args_out, args_len_out, 1);
 
     /* Add LIMIT if specified */
     if (args->has_limit) {
         (*args_out)[1 + args->keys_count]     = (uintptr_t) "LIMIT";
         (*args_len_out)[1 + args->keys_count] = 5;
 
-        char* limit_str = alloc_long_string(args->limit, NULL);
-        if (!limit_str) {
-            cleanup_s_command_args(*args_out, *args_len_out);
-            return 0;
-        }
+        size_t limit_len;
+        char*  limit_str = valkey_glide_arena_long_to_string(args->arena, args->limit, &limit_len);
         (*args_out)[2 + args->keys_count]     = (uintptr_t) limit_str;
-        (*args_len_out)[2 + args->keys_count] = strlen(limit_str);
-
-        /* Track the allocated limit string */
-        if (allocated_strings && allocated_count) {
-            *allocated_strings =
-                erealloc(*allocated_strings, (*allocated_count + 1) * sizeof(char*));
-            (*allocated_strings)[*allocated_count] = limit_str;
-            (*allocated_count)++;
-        }
+        (*args_len_out)[2 + args->keys_count] = limit_len;
     }
 
     return arg_count;
@@ -339,9 +242,7 @@ int prepare_s_multi_key_limit_args(s_command_args_t* args,
  */
 int prepare_s_dst_multi_key_args(s_command_args_t* args,
                                  uintptr_t**       args_out,
-                                 unsigned long**   args_len_out,
-                                 char***           allocated_strings,
-                                 int*              allocated_count) {
+                                 unsigned long**   args_len_out) {
     if (!args->glide_client || !args->dst_key || args->dst_key_len == 0 || !args->keys ||
         args->keys_count <= 0) {
         return 0;
@@ -349,7 +250,7 @@ int prepare_s_dst_multi_key_args(s_command_args_t* args,
 
     unsigned long arg_count = 1 + args->keys_count; /* destination + keys */
 
-    if (!allocate_s_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
@@ -358,13 +259,8 @@ int prepare_s_dst_multi_key_args(s_command_args_t* args,
     (*args_len_out)[0] = args->dst_key_len;
 
     /* Add source keys */
-    convert_zval_to_string_args(args->keys,
-                                args->keys_count,
-                                args_out,
-                                args_len_out,
-                                1,
-                                allocated_strings,
-                                allocated_count);
+    convert_zval_to_string_args(
+        args->arena, args->keys, args->keys_count, args_out, args_len_out, 1);
 
     return arg_count;
 }
@@ -374,15 +270,13 @@ int prepare_s_dst_multi_key_args(s_command_args_t* args,
  */
 int prepare_s_two_key_member_args(s_command_args_t* args,
                                   uintptr_t**       args_out,
-                                  unsigned long**   args_len_out,
-                                  char***           allocated_strings,
-                                  int*              allocated_count) {
+                                  unsigned long**   args_len_out) {
     if (!args->glide_client || !args->src_key || args->src_key_len == 0 || !args->dst_key ||
         args->dst_key_len == 0 || !args->member || args->member_len == 0) {
         return 0;
     }
 
-    if (!allocate_s_command_args(3, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, 3, args_out, args_len_out)) {
         return 0;
     }
 
@@ -401,9 +295,7 @@ int prepare_s_two_key_member_args(s_command_args_t* args,
  */
 int prepare_s_scan_args(s_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     if (!args->glide_client || !args->cursor) {
         return 0;
     }
@@ -416,7 +308,7 @@ int prepare_s_scan_args(s_command_args_t* args,
     unsigned long arg_count =
         (has_key ? 1 : 0) + 1 + (has_pattern ? 2 : 0) + (has_count ? 2 : 0) + (has_type ? 2 : 0);
 
-    if (!allocate_s_command_args(arg_count, args_out, args_len_out)) {
+    if (!valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out)) {
         return 0;
     }
 
@@ -453,19 +345,12 @@ int prepare_s_scan_args(s_command_args_t* args,
         (*args_len_out)[arg_idx] = 5;
         arg_idx++;
 
-        char* count_str = alloc_long_string(args->count, NULL);
+        size_t count_len;
+        char*  count_str = valkey_glide_arena_long_to_string(args->arena, args->count, &count_len);
 
         (*args_out)[arg_idx]     = (uintptr_t) count_str;
-        (*args_len_out)[arg_idx] = strlen(count_str);
+        (*args_len_out)[arg_idx] = count_len;
         arg_idx++;
-
-        /* Track the allocated count string */
-        if (allocated_strings && allocated_count) {
-            *allocated_strings =
-                erealloc(*allocated_strings, (*allocated_count + 1) * sizeof(char*));
-            (*allocated_strings)[*allocated_count] = count_str;
-            (*allocated_count)++;
-        }
     }
 
     /* Add TYPE if provided (SCAN only) */
@@ -537,8 +422,8 @@ int process_s_set_result_async(CommandResponse* response, void* output, zval* re
         ZVAL_NULL(return_value);
         return 1;
     } else if (response->response_type == Sets || response->response_type == Array) {
-        return command_response_to_zval(
-            response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
+        return command_response_to_string_list(
+            NULL, response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
     }
     ZVAL_NULL(return_value);
     return 0;
@@ -742,47 +627,38 @@ int execute_s_generic_command(valkey_glide_object* valkey_glide,
     }
 
 
-    /* Initialize string tracking arrays */
-    char** allocated_strings = NULL;
-    int    allocated_count   = 0;
+    valkey_glide_arena_t arena;
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
 
     /* Prepare arguments based on category */
     switch (category) {
         case S_CMD_KEY_MEMBERS:
-            arg_count = prepare_s_key_members_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_key_members_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_KEY_ONLY:
-            arg_count = prepare_s_key_only_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_key_only_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_KEY_MEMBER:
-            arg_count = prepare_s_key_member_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_key_member_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_KEY_COUNT:
-            arg_count = prepare_s_key_count_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_key_count_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_MULTI_KEY:
-            arg_count = prepare_s_multi_key_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_multi_key_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_MULTI_KEY_LIMIT:
-            arg_count = prepare_s_multi_key_limit_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_multi_key_limit_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_DST_MULTI_KEY:
-            arg_count = prepare_s_dst_multi_key_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_dst_multi_key_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_TWO_KEY_MEMBER:
-            arg_count = prepare_s_two_key_member_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_two_key_member_args(args, &cmd_args, &args_len);
             break;
         case S_CMD_SCAN:
-            arg_count = prepare_s_scan_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_s_scan_args(args, &cmd_args, &args_len);
             break;
         default:
             return 0;
@@ -831,8 +707,23 @@ int execute_s_generic_command(valkey_glide_object* valkey_glide,
         goto cleanup;
     }
 
+    /* Repeated reads may be answered by the near cache */
+    if (valkey_glide_near_cache_fetch(valkey_glide->near_cache,
+                                      cmd_type,
+                                      cmd_args,
+                                      args_len,
+                                      arg_count,
+                                      scan_data,
+                                      process_result,
+                                      return_value,
+                                      &status)) {
+        goto cleanup;
+    }
+
     /* Execute the command synchronously */
     result = execute_command(valkey_glide->glide_client, cmd_type, arg_count, cmd_args, args_len);
+    valkey_glide_near_cache_store(
+        valkey_glide->near_cache, cmd_type, cmd_args, args_len, arg_count, result);
     if (result) {
         status = process_result(result->response, scan_data, return_value);
     }
@@ -840,17 +731,8 @@ int execute_s_generic_command(valkey_glide_object* valkey_glide,
 
 
 cleanup:
-    /* Free all allocated strings tracked by the prepare functions */
-    if (allocated_strings && allocated_count > 0) {
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        efree(allocated_strings);
-    }
-
-    cleanup_s_command_args(cmd_args, args_len);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
     return status;
 }
 
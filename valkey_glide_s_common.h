@@ -23,6 +23,7 @@
 
 #include "command_response.h"
 #include "include/glide_bindings.h"
+#include "valkey_glide_arena.h"
 #include "valkey_glide_commands_common.h"
 
 /* ====================================================================
@@ -108,6 +109,9 @@ typedef struct _s_command_args_t {
     int*    output_int;        /* For boolean outputs */
     char**  output_string;     /* For string outputs */
     size_t* output_string_len; /* For string output length */
+
+    /* Per-command allocations, owned by execute_s_generic_command */
+    valkey_glide_arena_t* arena;
 } s_command_args_t;
 
 /**
@@ -134,61 +138,40 @@ int execute_s_generic_command(valkey_glide_object* valkey_glide,
 /* Argument preparation functions */
 int prepare_s_key_members_args(s_command_args_t* args,
                                uintptr_t**       args_out,
-                               unsigned long**   args_len_out,
-                               char***           allocated_strings,
-                               int*              allocated_count);
+                               unsigned long**   args_len_out);
 int prepare_s_key_only_args(s_command_args_t* args,
                             uintptr_t**       args_out,
-                            unsigned long**   args_len_out,
-                            char***           allocated_strings,
-                            int*              allocated_count);
+                            unsigned long**   args_len_out);
 int prepare_s_key_member_args(s_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count);
+                              unsigned long**   args_len_out);
 int prepare_s_key_count_args(s_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count);
+                             unsigned long**   args_len_out);
 int prepare_s_multi_key_args(s_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count);
+                             unsigned long**   args_len_out);
 int prepare_s_multi_key_limit_args(s_command_args_t* args,
                                    uintptr_t**       args_out,
-                                   unsigned long**   args_len_out,
-                                   char***           allocated_strings,
-                                   int*              allocated_count);
+                                   unsigned long**   args_len_out);
 int prepare_s_dst_multi_key_args(s_command_args_t* args,
                                  uintptr_t**       args_out,
-                                 unsigned long**   args_len_out,
-                                 char***           allocated_strings,
-                                 int*              allocated_count);
+                                 unsigned long**   args_len_out);
 int prepare_s_two_key_member_args(s_command_args_t* args,
                                   uintptr_t**       args_out,
-                                  unsigned long**   args_len_out,
-                                  char***           allocated_strings,
-                                  int*              allocated_count);
+                                  unsigned long**   args_len_out);
 int prepare_s_scan_args(s_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count);
+                        unsigned long**   args_len_out);
 
 
 /* Utility functions */
-int  allocate_s_command_args(int count, uintptr_t** args_out, unsigned long** args_len_out);
-void cleanup_s_command_args(uintptr_t* args, unsigned long* args_len);
-int  convert_zval_to_string_args(zval*           input,
-                                 int             count,
-                                 uintptr_t**     args_out,
-                                 unsigned long** args_len_out,
-                                 int             offset,
-                                 char***         allocated_strings,
-                                 int*            allocated_count);
+int convert_zval_to_string_args(valkey_glide_arena_t* arena,
+                                zval*                 input,
+                                int                   count,
+                                uintptr_t**           args_out,
+                                unsigned long**       args_len_out,
+                                int                   offset);
 
 char* alloc_long_string(long value, size_t* len_out);
 
@@ -0,0 +1,509 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_script.h"
+
+#include <ext/standard/sha1.h>
+#include <string.h>
+
+#include "command_response.h"
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_script_arginfo.h"
+#include "valkey_glide_z_common.h"
+
+/* Global variables */
+zend_class_entry*           valkey_glide_script_ce;
+static zend_object_handlers valkey_glide_script_object_handlers;
+
+/* Arguments of one command; strings holds the conversions to release afterwards */
+typedef struct {
+    uintptr_t*     args;
+    unsigned long* args_len;
+    zend_string**  strings;
+    unsigned long  count;
+    unsigned long  string_count;
+} script_args_t;
+
+/* Object creation and destruction */
+static zend_object* create_valkey_glide_script_object(zend_class_entry* ce) {
+    valkey_glide_script_object* script =
+        ecalloc(1, sizeof(valkey_glide_script_object) + zend_object_properties_size(ce));
+
+    zend_object_std_init(&script->std, ce);
+    object_properties_init(&script->std, ce);
+    script->std.handlers = &valkey_glide_script_object_handlers;
+
+    return &script->std;
+}
+
+static void free_valkey_glide_script_object(zend_object* object) {
+    valkey_glide_script_object* script =
+        VALKEY_GLIDE_PHP_GET_OBJECT(valkey_glide_script_object, object);
+
+    if (script->code) {
+        zend_string_release(script->code);
+    }
+
+    /* Clean up the standard object */
+    zend_object_std_dtor(&script->std);
+}
+
+static valkey_glide_script_object* get_script_object(zval* script) {
+    valkey_glide_script_object* object =
+        VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_script_object, script);
+
+    if (!object->code) {
+        zend_throw_error(NULL, "ValkeyGlideScript is not initialized");
+        return NULL;
+    }
+    return object;
+}
+
+/* {{{ proto ValkeyGlideScript::__construct(string code) */
+PHP_METHOD(ValkeyGlideScript, __construct) {
+    zend_string*                code;
+    valkey_glide_script_object* object;
+    PHP_SHA1_CTX                context;
+    unsigned char               digest[20];
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+    Z_PARAM_STR(code)
+    ZEND_PARSE_PARAMETERS_END();
+
+    object = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_script_object, ZEND_THIS);
+    if (object->code) {
+        zend_throw_error(NULL, "ValkeyGlideScript is immutable");
+        RETURN_THROWS();
+    }
+
+    /* Hashed once here instead of on every invocation */
+    PHP_SHA1Init(&context);
+    PHP_SHA1Update(&context, (const unsigned char*) ZSTR_VAL(code), ZSTR_LEN(code));
+    PHP_SHA1Final(digest, &context);
+    make_sha1_digest(object->sha1, digest);
+
+    object->code = zend_string_copy(code);
+}
+/* }}} */
+
+/* {{{ proto string ValkeyGlideScript::getHash() */
+PHP_METHOD(ValkeyGlideScript, getHash) {
+    valkey_glide_script_object* object;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    object = get_script_object(ZEND_THIS);
+    if (!object) {
+        RETURN_THROWS();
+    }
+    RETURN_STRINGL(object->sha1, VALKEY_GLIDE_SCRIPT_SHA1_LEN);
+}
+/* }}} */
+
+/* {{{ proto string ValkeyGlideScript::getCode() */
+PHP_METHOD(ValkeyGlideScript, getCode) {
+    valkey_glide_script_object* object;
+
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    object = get_script_object(ZEND_THIS);
+    if (!object) {
+        RETURN_THROWS();
+    }
+    RETURN_STR_COPY(object->code);
+}
+/* }}} */
+
+void register_valkey_glide_script_class(void) {
+    valkey_glide_script_ce                = register_class_ValkeyGlideScript();
+    valkey_glide_script_ce->create_object = create_valkey_glide_script_object;
+
+    memcpy(&valkey_glide_script_object_handlers,
+           zend_get_std_object_handlers(),
+           sizeof(valkey_glide_script_object_handlers));
+    valkey_glide_script_object_handlers.offset    = XtOffsetOf(valkey_glide_script_object, std);
+    valkey_glide_script_object_handlers.free_obj  = free_valkey_glide_script_object;
+    valkey_glide_script_object_handlers.clone_obj = NULL;
+}
+
+/* ====================================================================
+ * COMMANDS
+ * ==================================================================== */
+
+static void script_args_init(script_args_t* args, unsigned long capacity) {
+    args->args         = emalloc(capacity * sizeof(uintptr_t));
+    args->args_len     = emalloc(capacity * sizeof(unsigned long));
+    args->strings      = emalloc(capacity * sizeof(zend_string*));
+    args->count        = 0;
+    args->string_count = 0;
+}
+
+static void script_args_add(script_args_t* args, const char* data, size_t len) {
+    args->args[args->count]     = (uintptr_t) data;
+    args->args_len[args->count] = len;
+    args->count++;
+}
+
+static void script_args_add_zval(script_args_t* args, zval* value) {
+    zend_string* str = zval_get_string(value);
+
+    args->strings[args->string_count++] = str;
+    script_args_add(args, ZSTR_VAL(str), ZSTR_LEN(str));
+}
+
+static void script_args_add_array(script_args_t* args, zval* array) {
+    zval* value;
+
+    if (!array) {
+        return;
+    }
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(array), value) {
+        script_args_add_zval(args, value);
+    }
+    ZEND_HASH_FOREACH_END();
+}
+
+static void script_args_free(script_args_t* args) {
+    for (unsigned long i = 0; i < args->string_count; i++) {
+        zend_string_release(args->strings[i]);
+    }
+    efree(args->strings);
+    efree(args->args_len);
+    efree(args->args);
+}
+
+static int process_script_response(CommandResponse* response, void* output, zval* return_value) {
+    return command_response_to_zval(
+        response, return_value, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, false);
+}
+
+/* Convert a direct call's result and free it */
+static int script_handle_result(CommandResult* result, zval* return_value) {
+    int status = 0;
+
+    if (!result) {
+        return 0;
+    }
+    if (!result->command_error && result->response) {
+        status = process_script_response(result->response, NULL, return_value);
+    }
+    free_command_result(result);
+    return status;
+}
+
+static bool script_is_noscript(CommandResult* result) {
+    const char* message;
+
+    if (!result || !result->command_error) {
+        return false;
+    }
+    message = result->command_error->command_error_message;
+    return message && (strstr(message, "NOSCRIPT") || strstr(message, "NoScriptError"));
+}
+
+/*
+ * Whether an EVAL queued earlier in this batch already cached the script where this call
+ * runs. The first call sends EVAL instead, so a batch never relies on the server's cache.
+ */
+static bool script_sent_in_batch(valkey_glide_object*        valkey_glide,
+                                 valkey_glide_script_object* script,
+                                 const script_args_t*        cmd_args,
+                                 uint32_t                    key_count,
+                                 bool                        is_cluster) {
+    zend_string* id;
+    size_t       key_len = 0;
+    bool         sent;
+
+    /* A keyless call may land on any cluster node */
+    if (is_cluster && key_count == 0) {
+        return false;
+    }
+
+    /* Calls sharing their first key share its slot, hence its node */
+    if (is_cluster) {
+        key_len = cmd_args->args_len[2];
+    }
+    id = zend_string_alloc(VALKEY_GLIDE_SCRIPT_SHA1_LEN + key_len, 0);
+    memcpy(ZSTR_VAL(id), script->sha1, VALKEY_GLIDE_SCRIPT_SHA1_LEN);
+    if (key_len) {
+        memcpy(ZSTR_VAL(id) + VALKEY_GLIDE_SCRIPT_SHA1_LEN,
+               (const char*) cmd_args->args[2],
+               key_len);
+    }
+    ZSTR_VAL(id)[ZSTR_LEN(id)] = '\0';
+
+    if (!valkey_glide->scripts) {
+        ALLOC_HASHTABLE(valkey_glide->scripts);
+        zend_hash_init(valkey_glide->scripts, 8, NULL, NULL, 0);
+    }
+    sent = zend_hash_exists(valkey_glide->scripts, id);
+    if (!sent) {
+        zend_hash_add_empty_element(valkey_glide->scripts, id);
+    }
+    zend_string_release(id);
+    return sent;
+}
+
+int execute_invoke_script_command(zval*             object,
+                                  int               argc,
+                                  zval*             return_value,
+                                  zend_class_entry* ce) {
+    valkey_glide_object*        valkey_glide;
+    valkey_glide_script_object* script;
+    zval*                       z_script;
+    zval*                       keys      = NULL;
+    zval*                       args      = NULL;
+    zend_bool                   read_only = 0;
+    script_args_t               cmd_args;
+    CommandResult*              result;
+    char                        numkeys[MAX_LENGTH_OF_LONG + 1];
+    enum RequestType            evalsha_type;
+    enum RequestType            eval_type;
+    unsigned long               capacity;
+    uint32_t                    key_count;
+    int                         status;
+
+    if (zend_parse_method_parameters(argc,
+                                     object,
+                                     "OO|aab",
+                                     &object,
+                                     ce,
+                                     &z_script,
+                                     valkey_glide_script_ce,
+                                     &keys,
+                                     &args,
+                                     &read_only) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+    script = get_script_object(z_script);
+    if (!script) {
+        return 0;
+    }
+
+    evalsha_type = read_only ? EvalShaReadOnly : EvalSha;
+    eval_type    = read_only ? EvalReadOnly : Eval;
+
+    /* sha1 numkeys key... arg... */
+    key_count = keys ? zend_hash_num_elements(Z_ARRVAL_P(keys)) : 0;
+    capacity  = 2 + key_count + (args ? zend_hash_num_elements(Z_ARRVAL_P(args)) : 0);
+    script_args_init(&cmd_args, capacity);
+    script_args_add(&cmd_args, script->sha1, VALKEY_GLIDE_SCRIPT_SHA1_LEN);
+    snprintf(numkeys, sizeof(numkeys), "%u", key_count);
+    script_args_add(&cmd_args, numkeys, strlen(numkeys));
+    script_args_add_array(&cmd_args, keys);
+    script_args_add_array(&cmd_args, args);
+
+    if (valkey_glide->is_in_batch_mode) {
+        bool sent = script_sent_in_batch(
+            valkey_glide, script, &cmd_args, key_count, ce == get_valkey_glide_cluster_ce());
+
+        if (!sent) {
+            cmd_args.args[0]     = (uintptr_t) ZSTR_VAL(script->code);
+            cmd_args.args_len[0] = ZSTR_LEN(script->code);
+        }
+        status = buffer_command_for_batch(valkey_glide,
+                                          sent ? evalsha_type : eval_type,
+                                          cmd_args.args,
+                                          cmd_args.args_len,
+                                          cmd_args.count,
+                                          NULL,
+                                          process_script_response);
+        script_args_free(&cmd_args);
+        if (status) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
+        return status;
+    }
+
+    result = execute_command(valkey_glide->glide_client,
+                             evalsha_type,
+                             cmd_args.count,
+                             cmd_args.args,
+                             cmd_args.args_len);
+
+    /* Not cached on that server yet: EVAL runs the body and caches it there */
+    if (script_is_noscript(result)) {
+        free_command_result(result);
+        cmd_args.args[0]     = (uintptr_t) ZSTR_VAL(script->code);
+        cmd_args.args_len[0] = ZSTR_LEN(script->code);
+
+        result = execute_command(valkey_glide->glide_client,
+                                 eval_type,
+                                 cmd_args.count,
+                                 cmd_args.args,
+                                 cmd_args.args_len);
+    }
+
+    status = script_handle_result(result, return_value);
+    script_args_free(&cmd_args);
+    return status;
+}
+
+int execute_eval_command(zval*             object,
+                         int               argc,
+                         zval*             return_value,
+                         zend_class_entry* ce,
+                         enum RequestType  cmd_type) {
+    valkey_glide_object* valkey_glide;
+    zend_string*         script;
+    zval*                args     = NULL;
+    zend_long            num_keys = 0;
+    script_args_t        cmd_args;
+    char                 numkeys[MAX_LENGTH_OF_LONG + 1];
+    uint32_t             args_count;
+    int                  status;
+
+    if (zend_parse_method_parameters(
+            argc, object, "OS|al", &object, ce, &script, &args, &num_keys) == FAILURE) {
+        return 0;
+    }
+
+    args_count = args ? zend_hash_num_elements(Z_ARRVAL_P(args)) : 0;
+    if (num_keys < 0 || num_keys > (zend_long) args_count) {
+        zend_argument_value_error(3, "must be between 0 and the number of arguments");
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    /* script|sha1 numkeys arg..., the first num_keys arguments being keys */
+    script_args_init(&cmd_args, 2 + args_count);
+    script_args_add(&cmd_args, ZSTR_VAL(script), ZSTR_LEN(script));
+    snprintf(numkeys, sizeof(numkeys), ZEND_LONG_FMT, num_keys);
+    script_args_add(&cmd_args, numkeys, strlen(numkeys));
+    script_args_add_array(&cmd_args, args);
+
+    if (valkey_glide->is_in_batch_mode) {
+        status = buffer_command_for_batch(valkey_glide,
+                                          cmd_type,
+                                          cmd_args.args,
+                                          cmd_args.args_len,
+                                          cmd_args.count,
+                                          NULL,
+                                          process_script_response);
+        script_args_free(&cmd_args);
+        if (status) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
+        return status;
+    }
+
+    status = script_handle_result(
+        execute_command(
+            valkey_glide->glide_client, cmd_type, cmd_args.count, cmd_args.args, cmd_args.args_len),
+        return_value);
+    script_args_free(&cmd_args);
+    return status;
+}
+
+int execute_script_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_args     = NULL;
+    int                  args_count = 0;
+    zval*                route      = NULL;
+    zend_string*         operation;
+    script_args_t        cmd_args;
+    CommandResult*       result;
+    enum RequestType     command_type;
+    unsigned long        capacity;
+    bool                 is_cluster = (ce == get_valkey_glide_cluster_ce());
+    int                  status;
+
+    /* Cluster clients take a route before the subcommand */
+    if (is_cluster) {
+        if (zend_parse_method_parameters(
+                argc, object, "Oz+", &object, ce, &route, &z_args, &args_count) == FAILURE) {
+            return 0;
+        }
+    } else if (zend_parse_method_parameters(
+                   argc, object, "O+", &object, ce, &z_args, &args_count) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    operation = zval_get_string(&z_args[0]);
+    if (zend_string_equals_literal_ci(operation, "LOAD")) {
+        command_type = ScriptLoad;
+    } else if (zend_string_equals_literal_ci(operation, "EXISTS")) {
+        command_type = ScriptExists;
+    } else if (zend_string_equals_literal_ci(operation, "FLUSH")) {
+        command_type = ScriptFlush;
+    } else if (zend_string_equals_literal_ci(operation, "KILL")) {
+        command_type = ScriptKill;
+    } else {
+        php_error_docref(NULL, E_WARNING, "Unknown SCRIPT operation '%s'", ZSTR_VAL(operation));
+        zend_string_release(operation);
+        return 0;
+    }
+    zend_string_release(operation);
+
+    /* SCRIPT EXISTS also takes an array of hashes */
+    capacity = 0;
+    for (int i = 1; i < args_count; i++) {
+        capacity += Z_TYPE(z_args[i]) == IS_ARRAY ? zend_hash_num_elements(Z_ARRVAL(z_args[i])) : 1;
+    }
+    script_args_init(&cmd_args, capacity);
+    for (int i = 1; i < args_count; i++) {
+        if (Z_TYPE(z_args[i]) == IS_ARRAY) {
+            script_args_add_array(&cmd_args, &z_args[i]);
+        } else {
+            script_args_add_zval(&cmd_args, &z_args[i]);
+        }
+    }
+
+    /* Scripts queued earlier in the batch are no longer cached after this */
+    if (command_type == ScriptFlush && valkey_glide->scripts) {
+        zend_hash_clean(valkey_glide->scripts);
+    }
+
+    /* Cluster pipelines keep the route, as outside a batch */
+    if (valkey_glide->is_in_batch_mode) {
+        status = buffer_routed_command_for_batch(valkey_glide,
+                                                 command_type,
+                                                 cmd_args.args,
+                                                 cmd_args.args_len,
+                                                 cmd_args.count,
+                                                 route,
+                                                 NULL,
+                                                 process_script_response);
+        script_args_free(&cmd_args);
+        if (status) {
+            /* In batch mode, return $this for method chaining */
+            ZVAL_COPY(return_value, object);
+        }
+        return status;
+    }
+
+    if (route) {
+        result = execute_command_with_route(valkey_glide->glide_client,
+                                            command_type,
+                                            cmd_args.count,
+                                            cmd_args.args,
+                                            cmd_args.args_len,
+                                            route);
+    } else {
+        result = execute_command(valkey_glide->glide_client,
+                                 command_type,
+                                 cmd_args.count,
+                                 cmd_args.args,
+                                 cmd_args.args_len);
+    }
+
+    status = script_handle_result(result, return_value);
+    script_args_free(&cmd_args);
+    return status;
+}
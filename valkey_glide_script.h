@@ -0,0 +1,54 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_SCRIPT_H
+#define VALKEY_GLIDE_SCRIPT_H
+
+#include "common.h"
+#include "include/glide_bindings.h"
+
+/* ====================================================================
+ * LUA SCRIPTS
+ * ==================================================================== */
+
+/*
+ * A ValkeyGlideScript hashes its body once, at construction. invokeScript()
+ * sends EVALSHA and only falls back to EVAL, which also caches the body on
+ * that server, when the server answers NOSCRIPT. Batches cannot retry a
+ * single command, so the first call of a script in a batch is queued as EVAL
+ * and later calls that reach the same server as EVALSHA.
+ */
+
+#define VALKEY_GLIDE_SCRIPT_SHA1_LEN 40
+
+/* ValkeyGlideScript object structure */
+typedef struct {
+    zend_string* code;                                 /* Lua body */
+    char         sha1[VALKEY_GLIDE_SCRIPT_SHA1_LEN + 1]; /* Lowercase hex, NUL terminated */
+    zend_object  std;                                  /* Standard PHP object */
+} valkey_glide_script_object;
+
+/* Class entry */
+extern zend_class_entry* valkey_glide_script_ce;
+
+/* Class methods */
+PHP_METHOD(ValkeyGlideScript, __construct);
+PHP_METHOD(ValkeyGlideScript, getHash);
+PHP_METHOD(ValkeyGlideScript, getCode);
+
+/* Class registration function */
+void register_valkey_glide_script_class(void);
+
+/* invokeScript(ValkeyGlideScript $script, array $keys, array $args, bool $read_only) */
+int execute_invoke_script_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+
+/* EVAL, EVAL_RO, EVALSHA and EVALSHA_RO with phpredis' ($script, $args, $num_keys) */
+int execute_eval_command(zval*             object,
+                         int               argc,
+                         zval*             return_value,
+                         zend_class_entry* ce,
+                         enum RequestType  cmd_type);
+
+/* SCRIPT LOAD/EXISTS/FLUSH/KILL; cluster clients take a route first */
+int execute_script_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+
+#endif /* VALKEY_GLIDE_SCRIPT_H */
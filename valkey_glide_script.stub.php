@@ -0,0 +1,42 @@
+<?php
+
+/**
+ * @generate-function-entries
+ * @generate-legacy-arginfo
+ * @generate-class-entries
+ */
+
+/**
+ * ValkeyGlideScript is a Lua script whose SHA1 is computed once, when it is created.
+ * ValkeyGlide::invokeScript() and ValkeyGlideCluster::invokeScript() send only the hash with
+ * EVALSHA and send the body once per server, when it answers NOSCRIPT. Scripts can be queued in
+ * pipeline() and multi() batches, where the first call of each script is sent with EVAL.
+ * @example
+ * $script = new ValkeyGlideScript("return redis.call('INCRBY', KEYS[1], ARGV[1])");
+ * $valkey_glide->invokeScript($script, ['counter'], [5]);
+ * $valkey_glide->pipeline()->invokeScript($script, ['counter'], [1])->exec();
+ * @not-serializable
+ */
+final class ValkeyGlideScript
+{
+    /**
+     * @param string $code The Lua body of the script.
+     */
+    public function __construct(string $code)
+    {
+    }
+
+    /**
+     * @return string The SHA1 of the script, as used by EVALSHA.
+     */
+    public function getHash(): string
+    {
+    }
+
+    /**
+     * @return string The Lua body of the script.
+     */
+    public function getCode(): string
+    {
+    }
+}
@@ -0,0 +1,339 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "valkey_glide_serializer.h"
+
+#include <ext/standard/php_var.h>
+#include <zend_exceptions.h>
+#include <zend_smart_str.h>
+
+#include "command_response.h"
+
+#ifdef VALKEY_GLIDE_IGBINARY
+#include <ext/igbinary/igbinary.h>
+#endif
+#ifdef VALKEY_GLIDE_MSGPACK
+#include <ext/msgpack/php_msgpack.h>
+#endif
+
+/* Every igbinary payload starts with a format version, 1 or 2, as a big-endian uint32 */
+#define IGBINARY_HEADER_LEN 4
+
+bool valkey_glide_serializer_available(valkey_glide_serializer_t serializer) {
+    switch (serializer) {
+        case VALKEY_GLIDE_SERIALIZER_NONE:
+        case VALKEY_GLIDE_SERIALIZER_PHP:
+            return true;
+        case VALKEY_GLIDE_SERIALIZER_IGBINARY:
+#ifdef VALKEY_GLIDE_IGBINARY
+            return true;
+#else
+            return false;
+#endif
+        case VALKEY_GLIDE_SERIALIZER_MSGPACK:
+#ifdef VALKEY_GLIDE_MSGPACK
+            return true;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+}
+
+zend_string* valkey_glide_serialize(valkey_glide_serializer_t serializer, zval* value) {
+    smart_str buf = {0};
+
+    switch (serializer) {
+        case VALKEY_GLIDE_SERIALIZER_PHP: {
+            php_serialize_data_t var_hash;
+
+            PHP_VAR_SERIALIZE_INIT(var_hash);
+            php_var_serialize(&buf, value, &var_hash);
+            PHP_VAR_SERIALIZE_DESTROY(var_hash);
+            break;
+        }
+#ifdef VALKEY_GLIDE_IGBINARY
+        case VALKEY_GLIDE_SERIALIZER_IGBINARY: {
+            uint8_t*     data;
+            size_t       len;
+            zend_string* result;
+
+            if (igbinary_serialize(&data, &len, value) != 0) {
+                if (!EG(exception)) {
+                    zend_throw_exception(
+                        get_valkey_glide_exception_ce(), "Failed to serialize value", 0);
+                }
+                return NULL;
+            }
+            result = zend_string_init((const char*) data, len, 0);
+            efree(data);
+            return result;
+        }
+#endif
+#ifdef VALKEY_GLIDE_MSGPACK
+        case VALKEY_GLIDE_SERIALIZER_MSGPACK:
+            php_msgpack_serialize(&buf, value);
+            break;
+#endif
+        default:
+            zend_throw_exception(get_valkey_glide_exception_ce(), "Serializer is not available", 0);
+            return NULL;
+    }
+
+    /* Objects may refuse to be serialized by throwing */
+    if (EG(exception)) {
+        smart_str_free(&buf);
+        return NULL;
+    }
+
+    smart_str_0(&buf);
+    return buf.s ? buf.s : ZSTR_EMPTY_ALLOC();
+}
+
+valkey_glide_codec_t* valkey_glide_codec_new(
+    const valkey_glide_advanced_base_client_configuration_t* config, const char** error) {
+    valkey_glide_codec_t* codec;
+
+    if (!config || (config->serializer == VALKEY_GLIDE_SERIALIZER_NONE && !config->compression)) {
+        return NULL;
+    }
+    if (!valkey_glide_serializer_available(config->serializer)) {
+        *error = "The requested serializer is not available in this build";
+        return NULL;
+    }
+    if (config->compression &&
+        !valkey_glide_compression_available(config->compression->algorithm)) {
+        *error = "The requested compression is not available in this build";
+        return NULL;
+    }
+
+    codec             = emalloc(sizeof(valkey_glide_codec_t));
+    codec->serializer = config->serializer;
+    if (!valkey_glide_compressor_init(&codec->compressor, config->compression)) {
+        efree(codec);
+        *error = "Failed to load the compression dictionary";
+        return NULL;
+    }
+    return codec;
+}
+
+void valkey_glide_codec_free(valkey_glide_codec_t* codec) {
+    if (codec) {
+        valkey_glide_compressor_destroy(&codec->compressor);
+        efree(codec);
+    }
+}
+
+zend_string* valkey_glide_pack_value(const valkey_glide_codec_t* codec, zval* value) {
+    zend_string* packed;
+    zend_string* compressed;
+
+    if (codec && codec->serializer != VALKEY_GLIDE_SERIALIZER_NONE) {
+        packed = valkey_glide_serialize(codec->serializer, value);
+    } else if (Z_TYPE_P(value) == IS_ARRAY) {
+        zend_type_error("Value must be of type string, array given");
+        return NULL;
+    } else {
+        packed = zval_try_get_string(value);
+    }
+
+    if (!packed || !codec) {
+        return packed;
+    }
+    compressed = valkey_glide_compress(&codec->compressor, ZSTR_VAL(packed), ZSTR_LEN(packed));
+    if (!compressed) {
+        return packed;
+    }
+    zend_string_release(packed);
+    return compressed;
+}
+
+zend_string* valkey_glide_compress_value(const valkey_glide_codec_t* codec,
+                                         const char*                 data,
+                                         size_t                      len) {
+    return codec ? valkey_glide_compress(&codec->compressor, data, len) : NULL;
+}
+
+void valkey_glide_unserialize(valkey_glide_serializer_t serializer,
+                              const char*               data,
+                              size_t                    len,
+                              zval*                     output) {
+    switch (serializer) {
+        case VALKEY_GLIDE_SERIALIZER_PHP: {
+            php_unserialize_data_t var_hash;
+            const unsigned char*   pos = (const unsigned char*) data;
+            int                    ok;
+
+            ZVAL_UNDEF(output);
+            PHP_VAR_UNSERIALIZE_INIT(var_hash);
+            ok = php_var_unserialize(output, &pos, pos + len, &var_hash);
+            PHP_VAR_UNSERIALIZE_DESTROY(var_hash);
+            if (ok) {
+                return;
+            }
+            zval_ptr_dtor(output);
+            break;
+        }
+#ifdef VALKEY_GLIDE_IGBINARY
+        case VALKEY_GLIDE_SERIALIZER_IGBINARY:
+            /* igbinary warns on foreign data, so only try payloads carrying its header */
+            if (len > IGBINARY_HEADER_LEN && data[0] == 0 && data[1] == 0 && data[2] == 0 &&
+                (data[3] == 1 || data[3] == 2)) {
+                ZVAL_UNDEF(output);
+                if (igbinary_unserialize((const uint8_t*) data, len, output) == 0) {
+                    return;
+                }
+                zval_ptr_dtor(output);
+            }
+            break;
+#endif
+#ifdef VALKEY_GLIDE_MSGPACK
+        case VALKEY_GLIDE_SERIALIZER_MSGPACK: {
+            /* msgpack has no header, so foreign data is only known once it fails to parse */
+            zend_bool error_display = MSGPACK_G(error_display);
+            int       status;
+
+            ZVAL_UNDEF(output);
+            MSGPACK_G(error_display) = 0;
+            status                   = php_msgpack_unserialize(output, (char*) data, len);
+            MSGPACK_G(error_display) = error_display;
+            if (status == SUCCESS) {
+                return;
+            }
+            zval_ptr_dtor(output);
+            break;
+        }
+#endif
+        default:
+            break;
+    }
+
+    ZVAL_STRINGL(output, data, len);
+}
+
+void valkey_glide_decode_value(const valkey_glide_codec_t* codec,
+                               const char*                 data,
+                               size_t                      len,
+                               zval*                       output) {
+    zend_string* raw = NULL;
+
+    /* Anything that fails to decompress is returned as stored */
+    if (codec && valkey_glide_is_compressed(data, len)) {
+        raw = valkey_glide_decompress(&codec->compressor, data, len);
+    }
+
+    if (!codec || codec->serializer == VALKEY_GLIDE_SERIALIZER_NONE) {
+        if (raw) {
+            ZVAL_STR(output, raw);
+        } else {
+            ZVAL_STRINGL(output, data, len);
+        }
+        return;
+    }
+
+    if (raw) {
+        valkey_glide_unserialize(codec->serializer, ZSTR_VAL(raw), ZSTR_LEN(raw), output);
+        zend_string_release(raw);
+    } else {
+        valkey_glide_unserialize(codec->serializer, data, len, output);
+    }
+}
+
+int valkey_glide_response_to_zval(const valkey_glide_codec_t* codec,
+                                  CommandResponse*            response,
+                                  zval*                       output,
+                                  int                         use_associative_array,
+                                  bool                        use_false_if_null) {
+    int64_t i;
+
+    if (!codec || !response) {
+        return command_response_to_zval(response, output, use_associative_array, use_false_if_null);
+    }
+
+    switch (response->response_type) {
+        case String:
+            valkey_glide_decode_value(
+                codec, response->string_value, response->string_value_len, output);
+            return 1;
+        case Array:
+            if (use_associative_array != COMMAND_RESPONSE_NOT_ASSOSIATIVE) {
+                break;
+            }
+            array_init_size(output, (uint32_t) response->array_value_len);
+            for (i = 0; i < response->array_value_len; i++) {
+                zval value;
+
+                valkey_glide_response_to_zval(codec,
+                                              &response->array_value[i],
+                                              &value,
+                                              use_associative_array,
+                                              use_false_if_null);
+                add_next_index_zval(output, &value);
+            }
+            return 1;
+        case Map:
+            if (use_associative_array != COMMAND_RESPONSE_NOT_ASSOSIATIVE &&
+                use_associative_array != COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP) {
+                break;
+            }
+            array_init_size(output, (uint32_t) response->array_value_len);
+            for (i = 0; i < response->array_value_len; i++) {
+                CommandResponse* element = &response->array_value[i];
+                zval             key, value;
+
+                command_response_to_zval(
+                    element->map_key, &key, COMMAND_RESPONSE_NOT_ASSOSIATIVE, use_false_if_null);
+                if (element->map_value) {
+                    valkey_glide_response_to_zval(codec,
+                                                  element->map_value,
+                                                  &value,
+                                                  use_associative_array,
+                                                  use_false_if_null);
+                } else {
+                    ZVAL_NULL(&value);
+                }
+
+                if (use_associative_array != COMMAND_RESPONSE_NOT_ASSOSIATIVE &&
+                    Z_TYPE(key) == IS_STRING) {
+                    zend_symtable_update(Z_ARRVAL_P(output), Z_STR(key), &value);
+                    zval_ptr_dtor(&key);
+                } else {
+                    add_next_index_zval(output, &key);
+                    add_next_index_zval(output, &value);
+                }
+            }
+            return 1;
+        default:
+            break;
+    }
+
+    return command_response_to_zval(response, output, use_associative_array, use_false_if_null);
+}
+
+void* valkey_glide_codec_context_new(const valkey_glide_codec_t* codec) {
+    const valkey_glide_codec_t** context;
+
+    if (!codec) {
+        return NULL;
+    }
+
+    context  = emalloc(sizeof(*context));
+    *context = codec;
+    return context;
+}
+
+const valkey_glide_codec_t* valkey_glide_codec_context_take(void* context) {
+    const valkey_glide_codec_t* codec;
+
+    if (!context) {
+        return NULL;
+    }
+
+    codec = *(const valkey_glide_codec_t**) context;
+    efree(context);
+    return codec;
+}
@@ -0,0 +1,103 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_SERIALIZER_H
+#define VALKEY_GLIDE_SERIALIZER_H
+
+#include <stdbool.h>
+
+#include "common.h"
+#include "include/glide_bindings.h"
+#include "valkey_glide_compression.h"
+
+/* ====================================================================
+ * VALUE SERIALIZERS
+ * ==================================================================== */
+
+/*
+ * A client may serialize the values it writes and unserialize the values it
+ * reads, selected with advanced_config['serializer']. Keys and hash field names
+ * are never touched. The PHP serializer is always available; igbinary and
+ * msgpack need the extension to be built with --enable-valkey-glide-igbinary or
+ * --enable-valkey-glide-msgpack. advanced_config['compression'] then compresses
+ * the encoded values, see valkey_glide_compression.h.
+ */
+
+/* How a client encodes values, NULL on clients without a serializer or compression */
+typedef struct valkey_glide_codec {
+    valkey_glide_serializer_t serializer;
+    valkey_glide_compressor_t compressor;
+} valkey_glide_codec_t;
+
+/* Whether a serializer can be used by this build */
+bool valkey_glide_serializer_available(valkey_glide_serializer_t serializer);
+
+/**
+ * Serialize a value. Returns NULL with an exception set if it cannot be
+ * serialized. Must not be called with VALKEY_GLIDE_SERIALIZER_NONE.
+ */
+zend_string* valkey_glide_serialize(valkey_glide_serializer_t serializer, zval* value);
+
+/**
+ * Create the codec of a client. Returns NULL if no value encoding is configured,
+ * or if it is not available in this build, with *error set in that case.
+ */
+valkey_glide_codec_t* valkey_glide_codec_new(
+    const valkey_glide_advanced_base_client_configuration_t* config, const char** error);
+
+/* Free a codec from valkey_glide_codec_new(), NULL is ignored */
+void valkey_glide_codec_free(valkey_glide_codec_t* codec);
+
+/**
+ * Encode a value argument for sending. With a serializer any value is accepted,
+ * without one it is converted like a string parameter. Returns NULL with an
+ * exception set on failure; the caller releases the result.
+ */
+zend_string* valkey_glide_pack_value(const valkey_glide_codec_t* codec, zval* value);
+
+/**
+ * Compress a value that is already encoded. Returns NULL if it is sent as is,
+ * for callers that convert values themselves.
+ */
+zend_string* valkey_glide_compress_value(const valkey_glide_codec_t* codec,
+                                         const char*                 data,
+                                         size_t                      len);
+
+/**
+ * Unserialize a value read from the server into output. With the PHP
+ * serializer and igbinary, data that was not written by the serializer is
+ * returned as the raw string. msgpack has no header: foreign data that happens
+ * to parse, such as a single digit, is decoded, and only the rest comes back raw.
+ */
+void valkey_glide_unserialize(valkey_glide_serializer_t serializer,
+                              const char*               data,
+                              size_t                    len,
+                              zval*                     output);
+
+/* Decompress then unserialize a value read from the server into output */
+void valkey_glide_decode_value(const valkey_glide_codec_t* codec,
+                               const char*                 data,
+                               size_t                      len,
+                               zval*                       output);
+
+/**
+ * Convert a reply like command_response_to_zval(), decoding strings straight
+ * from the reply buffer. Arrays are walked; map keys are left as is.
+ */
+int valkey_glide_response_to_zval(const valkey_glide_codec_t* codec,
+                                  CommandResponse*            response,
+                                  zval*                       output,
+                                  int                         use_associative_array,
+                                  bool                        use_false_if_null);
+
+/**
+ * Result processor output carrying a codec, for executors that free the output
+ * on failure such as execute_core_command(). NULL without a codec. Executors
+ * that leave the output alone, like execute_h_simple_command(), take the codec
+ * pointer itself.
+ */
+void* valkey_glide_codec_context_new(const valkey_glide_codec_t* codec);
+
+/* Read the codec of a context from valkey_glide_codec_context_new() and free it */
+const valkey_glide_codec_t* valkey_glide_codec_context_take(void* context);
+
+#endif /* VALKEY_GLIDE_SERIALIZER_H */
@@ -0,0 +1,341 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_slot.h"
+
+#include <stdlib.h>
+
+#include "command_response.h"
+#include "logger.h"
+#include "valkey_glide_commands_common.h"
+#include "valkey_glide_core_common.h"
+
+/* CRC16-CCITT (XMODEM), the variant used for cluster key hashing */
+static const uint16_t crc16_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
+    0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
+    0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
+    0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+    0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+    0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12,
+    0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+    0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41,
+    0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+    0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70,
+    0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+    0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
+    0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
+    0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
+    0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
+    0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+    0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
+    0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+    0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
+    0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+    0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
+    0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0,
+};
+
+static uint16_t crc16(const char* buf, size_t len) {
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        crc = (crc << 8) ^ crc16_table[((crc >> 8) ^ (uint8_t) buf[i]) & 0xff];
+    }
+    return crc;
+}
+
+uint16_t valkey_glide_key_slot(const char* key, size_t key_len) {
+    size_t start, end;
+
+    for (start = 0; start < key_len; start++) {
+        if (key[start] == '{') {
+            break;
+        }
+    }
+
+    /* Only hash the tag when there is a matching '}' with something in between */
+    if (start < key_len) {
+        for (end = start + 1; end < key_len; end++) {
+            if (key[end] == '}') {
+                break;
+            }
+        }
+        if (end < key_len && end != start + 1) {
+            key += start + 1;
+            key_len = end - start - 1;
+        }
+    }
+
+    return crc16(key, key_len) & (VALKEY_GLIDE_CLUSTER_SLOTS - 1);
+}
+
+/* A key and its position in the caller's array */
+typedef struct {
+    uint32_t slot;
+    uint32_t index;
+} slot_key_t;
+
+static int compare_slot_keys(const void* a, const void* b) {
+    const slot_key_t* left  = a;
+    const slot_key_t* right = b;
+
+    if (left->slot != right->slot) {
+        return left->slot < right->slot ? -1 : 1;
+    }
+    return left->index < right->index ? -1 : (left->index > right->index);
+}
+
+/* Multi-key command sent once per hash slot */
+typedef enum { SLOT_BATCH_MGET, SLOT_BATCH_MSET, SLOT_BATCH_DEL } slot_batch_kind_t;
+
+/*
+ * Send one MGET, MSET or DEL per hash slot in a single non-atomic batch. The
+ * core splits the batch by node and sends every node its commands
+ * concurrently, so the whole call costs one round trip per node and never
+ * hits CROSSSLOT.
+ */
+static int execute_by_slot(valkey_glide_object* valkey_glide,
+                           HashTable*           ht,
+                           slot_batch_kind_t    kind,
+                           zval*                return_value) {
+    bool                        with_values = kind == SLOT_BATCH_MSET;
+    uint32_t                    count       = zend_hash_num_elements(ht);
+    uint32_t                    stride      = with_values ? 2 : 1;
+    zend_string**               strings;
+    slot_key_t*                 keys;
+    uint32_t*                   group_starts;
+    uint32_t                    group_count = 0;
+    uintptr_t*                  args;
+    unsigned long*              args_len;
+    valkey_glide_batch_buffer_t buffer;
+    zval                        results;
+    zend_string*                str_key;
+    zend_ulong                  num_key;
+    zval*                       value;
+    uint32_t                    i = 0, g;
+    int                         status = 0;
+
+    if (count == 0) {
+        switch (kind) {
+            case SLOT_BATCH_MGET:
+                array_init(return_value);
+                break;
+            case SLOT_BATCH_MSET:
+                ZVAL_TRUE(return_value);
+                break;
+            case SLOT_BATCH_DEL:
+                ZVAL_LONG(return_value, 0);
+                break;
+        }
+        return 1;
+    }
+
+    strings = safe_emalloc(count, stride * sizeof(zend_string*), 0);
+    keys    = safe_emalloc(count, sizeof(slot_key_t), 0);
+
+    ZEND_HASH_FOREACH_KEY_VAL(ht, num_key, str_key, value) {
+        zend_string* key;
+
+        if (with_values) {
+            key                = str_key ? zend_string_copy(str_key) : zend_long_to_str(num_key);
+            strings[i * 2 + 1] = zval_get_string(value);
+        } else {
+            key = zval_get_string(value);
+        }
+        strings[i * stride] = key;
+
+        keys[i].slot  = valkey_glide_key_slot(ZSTR_VAL(key), ZSTR_LEN(key));
+        keys[i].index = i;
+        i++;
+    }
+    ZEND_HASH_FOREACH_END();
+
+    qsort(keys, count, sizeof(slot_key_t), compare_slot_keys);
+
+    /* One command per slot; the argument arrays are reused for every group */
+    memset(&buffer, 0, sizeof(buffer));
+    group_starts = safe_emalloc(count + 1, sizeof(uint32_t), 0);
+    args         = safe_emalloc(count, stride * sizeof(uintptr_t), 0);
+    args_len     = safe_emalloc(count, stride * sizeof(unsigned long), 0);
+
+    for (i = 0; i < count; group_count++) {
+        uint32_t start = i, arg_count = 0;
+
+        group_starts[group_count] = start;
+        for (; i < count && keys[i].slot == keys[start].slot; i++) {
+            zend_string** entry = &strings[keys[i].index * stride];
+
+            for (uint32_t s = 0; s < stride; s++) {
+                args[arg_count]     = (uintptr_t) ZSTR_VAL(entry[s]);
+                args_len[arg_count] = ZSTR_LEN(entry[s]);
+                arg_count++;
+            }
+        }
+
+        switch (kind) {
+            case SLOT_BATCH_MGET:
+                valkey_glide_batch_buffer_append(
+                    &buffer, MGet, args, args_len, arg_count, NULL, process_core_array_result);
+                break;
+            case SLOT_BATCH_MSET:
+                valkey_glide_batch_buffer_append(
+                    &buffer, MSet, args, args_len, arg_count, NULL, process_core_bool_result);
+                break;
+            case SLOT_BATCH_DEL:
+                valkey_glide_batch_buffer_append(
+                    &buffer, Del, args, args_len, arg_count, NULL, process_core_int_result);
+                break;
+        }
+    }
+    group_starts[group_count] = count;
+
+    VALKEY_LOG_DEBUG_FMT(
+        "slot_batch", "Sending %u keys as %u per-slot commands", count, group_count);
+
+    array_init_size(&results, group_count);
+    if (valkey_glide_batch_buffer_send(
+            valkey_glide->glide_client, &buffer, 0, group_count, false, &results)) {
+        status = 1;
+
+        if (kind == SLOT_BATCH_MSET) {
+            zval* reply;
+
+            ZVAL_TRUE(return_value);
+            ZEND_HASH_FOREACH_VAL(Z_ARRVAL(results), reply) {
+                if (!zend_is_true(reply)) {
+                    ZVAL_FALSE(return_value);
+                }
+            }
+            ZEND_HASH_FOREACH_END();
+        } else if (kind == SLOT_BATCH_DEL) {
+            zval*     reply;
+            zend_long deleted = 0;
+
+            ZEND_HASH_FOREACH_VAL(Z_ARRVAL(results), reply) {
+                if (Z_TYPE_P(reply) == IS_LONG) {
+                    deleted += Z_LVAL_P(reply);
+                }
+            }
+            ZEND_HASH_FOREACH_END();
+            ZVAL_LONG(return_value, deleted);
+        } else {
+            /* Put every value back at the position of its key */
+            zval* values = safe_emalloc(count, sizeof(zval), 0);
+
+            for (g = 0; g < group_count; g++) {
+                zval* reply = zend_hash_index_find(Z_ARRVAL(results), g);
+
+                for (i = group_starts[g]; i < group_starts[g + 1]; i++) {
+                    zval* item = reply && Z_TYPE_P(reply) == IS_ARRAY
+                                     ? zend_hash_index_find(Z_ARRVAL_P(reply), i - group_starts[g])
+                                     : NULL;
+                    if (item) {
+                        ZVAL_COPY(&values[keys[i].index], item);
+                    } else {
+                        ZVAL_FALSE(&values[keys[i].index]);
+                    }
+                }
+            }
+
+            array_init_size(return_value, count);
+            for (i = 0; i < count; i++) {
+                add_next_index_zval(return_value, &values[i]);
+            }
+            efree(values);
+        }
+    }
+
+    zval_ptr_dtor(&results);
+    valkey_glide_batch_buffer_free(&buffer);
+    for (i = 0; i < count * stride; i++) {
+        zend_string_release(strings[i]);
+    }
+    efree(args_len);
+    efree(args);
+    efree(group_starts);
+    efree(keys);
+    efree(strings);
+
+    return status;
+}
+
+int execute_key_slot_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
+    char*  key;
+    size_t key_len;
+
+    if (zend_parse_method_parameters(argc, object, "Os", &object, ce, &key, &key_len) ==
+        FAILURE) {
+        return 0;
+    }
+
+    ZVAL_LONG(return_value, valkey_glide_key_slot(key, key_len));
+    return 1;
+}
+
+int execute_mget_by_slot_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_keys;
+
+    if (zend_parse_method_parameters(argc, object, "Oa", &object, ce, &z_keys) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Per-slot commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    return execute_by_slot(valkey_glide, Z_ARRVAL_P(z_keys), SLOT_BATCH_MGET, return_value);
+}
+
+int execute_mset_by_slot_command(zval*             object,
+                                 int               argc,
+                                 zval*             return_value,
+                                 zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_key_values;
+
+    if (zend_parse_method_parameters(argc, object, "Oa", &object, ce, &z_key_values) ==
+        FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Per-slot commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    return execute_by_slot(valkey_glide, Z_ARRVAL_P(z_key_values), SLOT_BATCH_MSET, return_value);
+}
+
+int execute_del_by_slot_command(zval*             object,
+                                int               argc,
+                                zval*             return_value,
+                                zend_class_entry* ce) {
+    valkey_glide_object* valkey_glide;
+    zval*                z_keys;
+
+    if (zend_parse_method_parameters(argc, object, "Oa", &object, ce, &z_keys) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide = get_unbatched_client(object, "Per-slot commands");
+    if (!valkey_glide) {
+        return 0;
+    }
+
+    return execute_by_slot(valkey_glide, Z_ARRVAL_P(z_keys), SLOT_BATCH_DEL, return_value);
+}
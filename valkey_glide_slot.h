@@ -0,0 +1,20 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_SLOT_H
+#define VALKEY_GLIDE_SLOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "php.h"
+
+/* Number of hash slots in a Valkey cluster */
+#define VALKEY_GLIDE_CLUSTER_SLOTS 16384
+
+/**
+ * Hash slot of a key, as computed by the server: CRC16 of the key, or of the
+ * first non-empty {hashtag} in it, modulo 16384.
+ */
+uint16_t valkey_glide_key_slot(const char* key, size_t key_len);
+
+#endif /* VALKEY_GLIDE_SLOT_H */
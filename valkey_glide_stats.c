@@ -0,0 +1,314 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#include "valkey_glide_stats.h"
+
+#include <string.h>
+
+#include "logger.h"
+
+/*
+ * Statistics are looked up by native client pointer. Each thread has its own
+ * registry (one per process without ZTS), so the hot path takes no lock, and a
+ * one-entry cache makes the lookup free for the usual single-client worker.
+ */
+static ZEND_TLS HashTable*            registry      = NULL;
+static ZEND_TLS const void*           cached_client = NULL;
+static ZEND_TLS valkey_glide_stats_t* cached_stats  = NULL;
+
+static void stats_commands_dtor(zval* zv) {
+    pefree(Z_PTR_P(zv), 1);
+}
+
+static void stats_dtor(zval* zv) {
+    valkey_glide_stats_t* stats = Z_PTR_P(zv);
+
+    zend_hash_destroy(&stats->commands);
+    pefree(stats, 1);
+}
+
+static valkey_glide_stats_t* stats_find(const void* glide_client) {
+    if (glide_client == cached_client) {
+        return cached_stats;
+    }
+    if (!registry) {
+        return NULL;
+    }
+
+    valkey_glide_stats_t* stats = zend_hash_index_find_ptr(registry, (zend_ulong) glide_client);
+    if (stats) {
+        cached_client = glide_client;
+        cached_stats  = stats;
+    }
+    return stats;
+}
+
+void valkey_glide_stats_attach(const void* glide_client) {
+    valkey_glide_stats_t* stats;
+
+    if (!glide_client) {
+        return;
+    }
+    if (!registry) {
+        registry = pemalloc(sizeof(HashTable), 1);
+        zend_hash_init(registry, 4, NULL, stats_dtor, 1);
+    }
+
+    stats = zend_hash_index_find_ptr(registry, (zend_ulong) glide_client);
+    if (!stats) {
+        stats = pecalloc(1, sizeof(valkey_glide_stats_t), 1);
+        zend_hash_init(&stats->commands, 16, NULL, stats_commands_dtor, 1);
+        stats->since = time(NULL);
+        zend_hash_index_add_new_ptr(registry, (zend_ulong) glide_client, stats);
+    }
+    stats->refs++;
+}
+
+void valkey_glide_stats_detach(const void* glide_client) {
+    valkey_glide_stats_t* stats = glide_client ? stats_find(glide_client) : NULL;
+
+    if (!stats || --stats->refs > 0) {
+        return;
+    }
+
+    cached_client = NULL;
+    cached_stats  = NULL;
+    zend_hash_index_del(registry, (zend_ulong) glide_client);
+
+    if (zend_hash_num_elements(registry) == 0) {
+        zend_hash_destroy(registry);
+        pefree(registry, 1);
+        registry = NULL;
+    }
+}
+
+uint64_t valkey_glide_stats_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/* Histogram bucket of a latency: linear below 8us, then 8 sub-buckets per power of two */
+static uint32_t bucket_index(uint64_t value) {
+    if (value < VALKEY_GLIDE_STATS_SUB_BUCKETS) {
+        return (uint32_t) value;
+    }
+
+    uint32_t shift = (63 - __builtin_clzll(value)) - VALKEY_GLIDE_STATS_SUB_BUCKET_BITS;
+    uint32_t index = VALKEY_GLIDE_STATS_SUB_BUCKETS * (shift + 1) +
+                     (uint32_t) ((value >> shift) & (VALKEY_GLIDE_STATS_SUB_BUCKETS - 1));
+
+    return index < VALKEY_GLIDE_STATS_BUCKETS ? index : VALKEY_GLIDE_STATS_BUCKETS - 1;
+}
+
+/* Largest latency that falls into a bucket */
+static uint64_t bucket_upper_bound(uint32_t index) {
+    if (index < VALKEY_GLIDE_STATS_SUB_BUCKETS) {
+        return index;
+    }
+
+    uint32_t shift = index / VALKEY_GLIDE_STATS_SUB_BUCKETS - 1;
+    uint64_t sub   = index % VALKEY_GLIDE_STATS_SUB_BUCKETS;
+
+    return ((VALKEY_GLIDE_STATS_SUB_BUCKETS + sub + 1) << shift) - 1;
+}
+
+/* Sum of the string payloads in a reply */
+static uint64_t response_bytes(const CommandResponse* response) {
+    uint64_t bytes = 0;
+    int64_t  i;
+
+    if (!response) {
+        return 0;
+    }
+
+    switch (response->response_type) {
+        case String:
+            return response->string_value_len;
+        case Array:
+            for (i = 0; i < response->array_value_len; i++) {
+                bytes += response_bytes(&response->array_value[i]);
+            }
+            return bytes;
+        case Map:
+            for (i = 0; i < response->array_value_len; i++) {
+                bytes += response_bytes(response->array_value[i].map_key);
+                bytes += response_bytes(response->array_value[i].map_value);
+            }
+            return bytes;
+        case Sets:
+            for (i = 0; i < response->sets_value_len; i++) {
+                bytes += response_bytes(&response->sets_value[i]);
+            }
+            return bytes;
+        default:
+            return 0;
+    }
+}
+
+static void record_sample(valkey_glide_command_stats_t* entry,
+                          uint64_t                      start_ns,
+                          uint64_t                      bytes_sent,
+                          const CommandResult*          result) {
+    uint64_t latency_us = (valkey_glide_stats_now() - start_ns) / 1000;
+
+    entry->calls++;
+    entry->bytes_sent += bytes_sent;
+    if (!result || result->command_error) {
+        entry->errors++;
+    } else {
+        entry->bytes_received += response_bytes(result->response);
+    }
+
+    entry->latency_sum_us += latency_us;
+    if (latency_us > entry->latency_max_us) {
+        entry->latency_max_us = latency_us;
+    }
+    entry->histogram[bucket_index(latency_us)]++;
+}
+
+void valkey_glide_stats_record_command(const void*          glide_client,
+                                       enum RequestType     command_type,
+                                       uint64_t             start_ns,
+                                       unsigned long        arg_count,
+                                       const unsigned long* args_len,
+                                       const CommandResult* result) {
+    valkey_glide_stats_t*         stats = stats_find(glide_client);
+    valkey_glide_command_stats_t* entry;
+    uint64_t                      bytes_sent = 0;
+    unsigned long                 i;
+
+    if (!stats) {
+        return;
+    }
+
+    entry = zend_hash_index_find_ptr(&stats->commands, (zend_ulong) command_type);
+    if (!entry) {
+        entry = pecalloc(1, sizeof(valkey_glide_command_stats_t), 1);
+        zend_hash_index_add_new_ptr(&stats->commands, (zend_ulong) command_type, entry);
+    }
+
+    for (i = 0; args_len && i < arg_count; i++) {
+        bytes_sent += args_len[i];
+    }
+
+    record_sample(entry, start_ns, bytes_sent, result);
+}
+
+void valkey_glide_stats_record_batch(const void*          glide_client,
+                                     uint64_t             start_ns,
+                                     size_t               command_count,
+                                     uint64_t             bytes_sent,
+                                     const CommandResult* result) {
+    valkey_glide_stats_t* stats = stats_find(glide_client);
+
+    if (!stats) {
+        return;
+    }
+
+    stats->batched_commands += command_count;
+    record_sample(&stats->batch, start_ns, bytes_sent, result);
+}
+
+/* Value at percentile (0-100) of a histogram, capped at the exact maximum */
+static zend_long histogram_percentile(const valkey_glide_command_stats_t* entry,
+                                      double                              percentile) {
+    uint64_t target = (uint64_t) ((double) entry->calls * percentile / 100.0 + 0.5);
+    uint64_t seen   = 0;
+    uint32_t i;
+
+    if (target == 0) {
+        target = 1;
+    }
+
+    for (i = 0; i < VALKEY_GLIDE_STATS_BUCKETS; i++) {
+        seen += entry->histogram[i];
+        if (seen >= target) {
+            uint64_t value = bucket_upper_bound(i);
+            return (zend_long) (value < entry->latency_max_us ? value : entry->latency_max_us);
+        }
+    }
+    return (zend_long) entry->latency_max_us;
+}
+
+static void command_stats_to_zval(const valkey_glide_command_stats_t* entry, zval* output) {
+    zval latency;
+
+    array_init_size(output, 5);
+    add_assoc_long(output, "calls", (zend_long) entry->calls);
+    add_assoc_long(output, "errors", (zend_long) entry->errors);
+    add_assoc_long(output, "bytes_sent", (zend_long) entry->bytes_sent);
+    add_assoc_long(output, "bytes_received", (zend_long) entry->bytes_received);
+
+    array_init_size(&latency, 6);
+    add_assoc_double(&latency,
+                     "mean",
+                     entry->calls ? (double) entry->latency_sum_us / (double) entry->calls : 0.0);
+    add_assoc_long(&latency, "p50", entry->calls ? histogram_percentile(entry, 50.0) : 0);
+    add_assoc_long(&latency, "p90", entry->calls ? histogram_percentile(entry, 90.0) : 0);
+    add_assoc_long(&latency, "p99", entry->calls ? histogram_percentile(entry, 99.0) : 0);
+    add_assoc_long(&latency, "p999", entry->calls ? histogram_percentile(entry, 99.9) : 0);
+    add_assoc_long(&latency, "max", (zend_long) entry->latency_max_us);
+    add_assoc_zval(output, "latency_us", &latency);
+}
+
+void valkey_glide_stats_to_zval(const void* glide_client, zval* return_value) {
+    valkey_glide_stats_t*         stats = stats_find(glide_client);
+    valkey_glide_command_stats_t* entry;
+    zend_ulong                    command_type;
+    zval                          commands, batch, item;
+    uint64_t                      calls = 0, errors = 0, bytes_sent = 0, bytes_received = 0;
+
+    array_init(return_value);
+    array_init(&commands);
+
+    if (stats) {
+        ZEND_HASH_FOREACH_NUM_KEY_PTR(&stats->commands, command_type, entry) {
+            command_stats_to_zval(entry, &item);
+            add_index_zval(&commands, command_type, &item);
+
+            calls += entry->calls;
+            errors += entry->errors;
+            bytes_sent += entry->bytes_sent;
+            bytes_received += entry->bytes_received;
+        }
+        ZEND_HASH_FOREACH_END();
+
+        command_stats_to_zval(&stats->batch, &batch);
+        add_assoc_long(&batch, "commands", (zend_long) stats->batched_commands);
+
+        calls += stats->batched_commands;
+        errors += stats->batch.errors;
+        bytes_sent += stats->batch.bytes_sent;
+        bytes_received += stats->batch.bytes_received;
+    } else {
+        valkey_glide_command_stats_t empty;
+
+        memset(&empty, 0, sizeof(empty));
+        command_stats_to_zval(&empty, &batch);
+        add_assoc_long(&batch, "commands", 0);
+    }
+
+    add_assoc_long(return_value, "since", stats ? (zend_long) stats->since : 0);
+    add_assoc_long(return_value, "calls", (zend_long) calls);
+    add_assoc_long(return_value, "errors", (zend_long) errors);
+    add_assoc_long(return_value, "bytes_sent", (zend_long) bytes_sent);
+    add_assoc_long(return_value, "bytes_received", (zend_long) bytes_received);
+    add_assoc_zval(return_value, "commands", &commands);
+    add_assoc_zval(return_value, "batch", &batch);
+}
+
+void valkey_glide_stats_reset(const void* glide_client) {
+    valkey_glide_stats_t* stats = stats_find(glide_client);
+
+    if (!stats) {
+        return;
+    }
+
+    VALKEY_LOG_DEBUG("stats", "Resetting client statistics");
+
+    zend_hash_clean(&stats->commands);
+    memset(&stats->batch, 0, sizeof(stats->batch));
+    stats->batched_commands = 0;
+    stats->since            = time(NULL);
+}
@@ -0,0 +1,81 @@
+/** Copyright Valkey GLIDE Project Contributors - SPDX Identifier: Apache-2.0 */
+
+#ifndef VALKEY_GLIDE_STATS_H
+#define VALKEY_GLIDE_STATS_H
+
+#include <stdint.h>
+#include <time.h>
+
+#include "include/glide_bindings.h"
+#include "php.h"
+
+/* ====================================================================
+ * IN-PROCESS CLIENT STATISTICS
+ * ==================================================================== */
+
+/*
+ * Latencies go into a log-linear histogram in the spirit of HdrHistogram:
+ * every power of two is split into 8 linear sub-buckets, so any recorded
+ * value is reported within 12.5%, from 1us up to more than a day, in a fixed
+ * array with no allocation on the hot path.
+ */
+#define VALKEY_GLIDE_STATS_SUB_BUCKET_BITS 3
+#define VALKEY_GLIDE_STATS_SUB_BUCKETS (1 << VALKEY_GLIDE_STATS_SUB_BUCKET_BITS)
+#define VALKEY_GLIDE_STATS_MAGNITUDES 34
+#define VALKEY_GLIDE_STATS_BUCKETS \
+    (VALKEY_GLIDE_STATS_SUB_BUCKETS * (VALKEY_GLIDE_STATS_MAGNITUDES + 1))
+
+/* Counters and latency histogram for one request type (or for batches) */
+typedef struct {
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t bytes_sent;     /* Argument bytes handed to the core */
+    uint64_t bytes_received; /* String payload bytes in the replies */
+    uint64_t latency_sum_us;
+    uint64_t latency_max_us;
+    uint64_t histogram[VALKEY_GLIDE_STATS_BUCKETS];
+} valkey_glide_command_stats_t;
+
+/**
+ * Statistics for one native client.
+ * Objects sharing a persistent client share its statistics.
+ */
+typedef struct {
+    HashTable                    commands; /* RequestType => valkey_glide_command_stats_t* */
+    valkey_glide_command_stats_t batch;    /* One sample per FFI batch() call */
+    uint64_t                     batched_commands;
+    time_t                       since; /* Creation or last reset */
+    uint32_t                     refs;  /* Attached PHP objects */
+} valkey_glide_stats_t;
+
+/* Start collecting statistics for a client; call once per object using it */
+void valkey_glide_stats_attach(const void* glide_client);
+
+/* Counterpart of valkey_glide_stats_attach(), before the object releases the client */
+void valkey_glide_stats_detach(const void* glide_client);
+
+/* Monotonic timestamp taken right before an FFI call */
+uint64_t valkey_glide_stats_now(void);
+
+/* Record one command() call that started at start_ns */
+void valkey_glide_stats_record_command(const void*          glide_client,
+                                       enum RequestType     command_type,
+                                       uint64_t             start_ns,
+                                       unsigned long        arg_count,
+                                       const unsigned long* args_len,
+                                       const CommandResult* result);
+
+/* Record one batch() call of command_count commands that started at start_ns */
+void valkey_glide_stats_record_batch(const void*          glide_client,
+                                     uint64_t             start_ns,
+                                     size_t               command_count,
+                                     uint64_t             bytes_sent,
+                                     const CommandResult* result);
+
+/* Build the array returned by getStats() */
+void valkey_glide_stats_to_zval(const void* glide_client, zval* return_value);
+
+/* Clear every counter and histogram of a client */
+void valkey_glide_stats_reset(const void* glide_client);
+
+#endif /* VALKEY_GLIDE_STATS_H */
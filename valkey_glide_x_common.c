@@ -330,18 +330,19 @@ int parse_x_claim_options(zval* options, x_claim_options_t* opts) {
  * UTILITY FUNCTIONS
  * ==================================================================== */
 
-/**
- * Allocate command arguments arrays
- */
-int allocate_command_args(int count, uintptr_t** args_out, unsigned long** args_len_out) {
-    *args_out     = (uintptr_t*) emalloc(count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(count * sizeof(unsigned long));
-
-
-    return 1;
+/* Append a value, converting non-strings into the arena */
+static void add_x_zval_arg(valkey_glide_arena_t* arena,
+                           zval*                 value,
+                           uintptr_t*            args,
+                           unsigned long*        args_len,
+                           unsigned int*         arg_idx) {
+    size_t len;
+
+    args[*arg_idx]     = (uintptr_t) valkey_glide_arena_zval_to_string(arena, value, &len);
+    args_len[*arg_idx] = len;
+    (*arg_idx)++;
 }
 
-
 /**
  * Generic command execution framework with integrated batch support
  */
@@ -352,11 +353,13 @@ int execute_x_generic_command(valkey_glide_object* valkey_glide,
                               x_result_processor_t process_result,
                               zval*                return_value) {
     /* Prepare arguments ONCE - single switch statement eliminates duplication */
-    uintptr_t*     cmd_args          = NULL;
-    unsigned long* args_len          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
+    uintptr_t*           cmd_args  = NULL;
+    unsigned long*       args_len  = NULL;
+    int                  arg_count = 0;
+    valkey_glide_arena_t arena;
+
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
 
     /* Single argument preparation logic for both batch and normal modes */
     switch (cmd_type) {
@@ -365,80 +368,56 @@ int execute_x_generic_command(valkey_glide_object* valkey_glide,
         case XGroupDelConsumer:
         case XGroupDestroy:
         case XGroupSetId:
-            arg_count = prepare_x_group_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_group_args(args, &cmd_args, &args_len);
             break;
         case XLen:
-            arg_count = prepare_x_len_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_len_args(args, &cmd_args, &args_len);
             break;
         case XDel:
-            arg_count = prepare_x_del_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_del_args(args, &cmd_args, &args_len);
             break;
         case XAck:
-            arg_count = prepare_x_ack_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_ack_args(args, &cmd_args, &args_len);
             break;
         case XAdd:
-            arg_count = prepare_x_add_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_add_args(args, &cmd_args, &args_len);
             break;
         case XTrim:
-            arg_count = prepare_x_trim_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_trim_args(args, &cmd_args, &args_len);
             break;
         case XRange:
         case XRevRange:
-            arg_count = prepare_x_range_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_range_args(args, &cmd_args, &args_len);
             break;
         case XPending:
-            arg_count = prepare_x_pending_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_pending_args(args, &cmd_args, &args_len);
             break;
         case XRead:
-            arg_count = prepare_x_read_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_read_args(args, &cmd_args, &args_len);
             break;
         case XReadGroup:
-            arg_count = prepare_x_readgroup_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_readgroup_args(args, &cmd_args, &args_len);
             break;
         case XAutoClaim:
-            arg_count = prepare_x_autoclaim_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_autoclaim_args(args, &cmd_args, &args_len);
             break;
         case XClaim:
-            arg_count = prepare_x_claim_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_claim_args(args, &cmd_args, &args_len);
             break;
         case XInfoGroups:
         case XInfoConsumers:
         case XInfoStream:
-            /* XINFO commands need special handling for allocated strings */
-            arg_count = prepare_x_info_args(
-                args, &cmd_args, &args_len, &allocated_strings, &allocated_count);
+            arg_count = prepare_x_info_args(args, &cmd_args, &args_len);
             break;
-        default: {
+        default:
             VALKEY_LOG_ERROR_FMT("command_processing", "Unknown command type: %d", cmd_type);
-            return 0;
-        }
+            break;
     }
 
     /* Check if argument preparation was successful */
     if (arg_count <= 0) {
-        if (cmd_args)
-            efree(cmd_args);
-        if (args_len)
-            efree(args_len);
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        if (allocated_strings)
-            efree(allocated_strings);
+        valkey_glide_arena_reset(&arena);
+        args->arena = NULL;
         return 0;
     }
 
@@ -446,19 +425,8 @@ int execute_x_generic_command(valkey_glide_object* valkey_glide,
         int result = buffer_command_for_batch(
             valkey_glide, cmd_type, cmd_args, args_len, arg_count, result_ptr, process_result);
 
-        if (cmd_args)
-            efree(cmd_args);
-        if (args_len)
-            efree(args_len);
-
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        if (allocated_strings)
-            efree(allocated_strings);
-
+        valkey_glide_arena_reset(&arena);
+        args->arena = NULL;
         return result;
     }
 
@@ -466,19 +434,8 @@ int execute_x_generic_command(valkey_glide_object* valkey_glide,
     CommandResult* result =
         execute_command(valkey_glide->glide_client, cmd_type, arg_count, cmd_args, args_len);
 
-    /* Free allocated strings */
-    int i;
-    for (i = 0; i < allocated_count; i++) {
-        if (allocated_strings[i]) {
-            efree(allocated_strings[i]);
-        }
-    }
-    if (allocated_strings)
-        efree(allocated_strings);
-    if (cmd_args)
-        efree(cmd_args);
-    if (args_len)
-        efree(args_len);
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
 
     /* Check if the command was successful */
     if (!result) {
@@ -703,18 +660,12 @@ int process_x_info_result(CommandResponse* response, void* output, zval* return_
  */
 int prepare_x_info_args(x_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->subcommand || args->subcommand_len <= 0) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Calculate arg count based on subcommand */
     unsigned long    arg_count    = 0;
     enum RequestType command_type = 0;
@@ -758,93 +709,45 @@ int prepare_x_info_args(x_command_args_t* args,
                 has_full = 1;
                 extra_args += 1; /* FULL */
 
-                /* Check for COUNT option */
+                /* Check for COUNT option, matching the checks used to fill it below */
                 if (args->args_count >= 3 && Z_TYPE(args->args[2]) != IS_NULL) {
                     if (Z_TYPE(args->args[2]) == IS_LONG) {
-                        long count_value = Z_LVAL(args->args[2]);
-                        if (count_value != -1) {
-                            has_count = 1;
-                            extra_args += 2; /* COUNT + value */
-                        }
+                        has_count = Z_LVAL(args->args[2]) != -1;
+                    } else if (Z_TYPE(args->args[2]) == IS_STRING) {
+                        has_count = Z_STRLEN(args->args[2]) != 2 ||
+                                    strcmp(Z_STRVAL(args->args[2]), "-1") != 0;
+                    }
+                    if (has_count) {
+                        extra_args += 2; /* COUNT + value */
                     }
                 }
             }
         }
 
         arg_count = 1 + extra_args; /* key + options */
-
-        /* Allocate memory to track dynamic strings */
-        if (has_count) {
-            *allocated_strings = (char**) ecalloc(1, sizeof(char*));
-            if (!*allocated_strings) {
-                return 0;
-            }
-        }
     } else {
         /* Unknown subcommand */
         return 0;
     }
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        if (*allocated_strings) {
-            efree(*allocated_strings);
-            *allocated_strings = NULL;
-        }
-        return 0;
-    }
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments based on subcommand */
     unsigned int arg_idx = 0;
 
     if (strcasecmp(args->subcommand, "CONSUMERS") == 0) {
         /* First argument: key */
-        if (Z_TYPE(args->args[0]) == IS_STRING) {
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        } else {
-            convert_to_string(&args->args[0]);
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        }
+        add_x_zval_arg(args->arena, &args->args[0], *args_out, *args_len_out, &arg_idx);
 
         /* Second argument: group */
-        if (Z_TYPE(args->args[1]) == IS_STRING) {
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[1]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[1]);
-            arg_idx++;
-        } else {
-            convert_to_string(&args->args[1]);
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[1]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[1]);
-            arg_idx++;
-        }
+        add_x_zval_arg(args->arena, &args->args[1], *args_out, *args_len_out, &arg_idx);
     } else if (strcasecmp(args->subcommand, "GROUPS") == 0) {
         /* Only argument: key */
-        if (Z_TYPE(args->args[0]) == IS_STRING) {
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        } else {
-            convert_to_string(&args->args[0]);
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        }
+        add_x_zval_arg(args->arena, &args->args[0], *args_out, *args_len_out, &arg_idx);
     } else if (strcasecmp(args->subcommand, "STREAM") == 0) {
         /* First argument: key */
-        if (Z_TYPE(args->args[0]) == IS_STRING) {
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        } else {
-            convert_to_string(&args->args[0]);
-            (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL(args->args[0]);
-            (*args_len_out)[arg_idx] = Z_STRLEN(args->args[0]);
-            arg_idx++;
-        }
+        add_x_zval_arg(args->arena, &args->args[0], *args_out, *args_len_out, &arg_idx);
 
         /* Check for FULL option */
         zend_bool has_full = 0;
@@ -878,19 +781,8 @@ int prepare_x_info_args(x_command_args_t* args,
                     (*args_len_out)[arg_idx] = sizeof("COUNT") - 1;
                     arg_idx++;
 
-                    /* Convert count to string */
-                    char   count_str[32];
-                    size_t count_str_len =
-                        snprintf(count_str, sizeof(count_str), "%ld", count_value);
-                    char* count_copy = estrndup(count_str, count_str_len);
-                    if (count_copy) {
-                        (*allocated_strings)[*allocated_count] = count_copy;
-                        (*allocated_count)++;
-
-                        (*args_out)[arg_idx]     = (uintptr_t) count_copy;
-                        (*args_len_out)[arg_idx] = count_str_len;
-                        arg_idx++;
-                    }
+                    valkey_glide_arena_add_long_arg(
+                        args->arena, count_value, *args_out, *args_len_out, arg_idx++);
                 }
             }
         }
@@ -908,21 +800,14 @@ int prepare_x_info_args(x_command_args_t* args,
  */
 int prepare_x_len_args(x_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     /* Check if client and key are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Allocate memory for arguments */
-    *args_out     = (uintptr_t*) emalloc(sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, 1, args_out, args_len_out);
 
     /* Set key as the only argument */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -936,23 +821,16 @@ int prepare_x_len_args(x_command_args_t* args,
  */
 int prepare_x_ack_args(x_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->group ||
         args->group_len <= 0 || !args->ids || args->id_count <= 0) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Prepare command arguments: key + group + IDs */
     unsigned long arg_count = 2 + args->id_count;
-    *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key as first argument */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -964,14 +842,9 @@ int prepare_x_ack_args(x_command_args_t* args,
 
     /* Add all stream IDs */
     zval* z_id;
-    int   i = 2;
+    unsigned int i = 2;
     ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(args->ids), z_id) {
-        if (Z_TYPE_P(z_id) != IS_STRING) {
-            convert_to_string(z_id);
-        }
-        (*args_out)[i]     = (uintptr_t) Z_STRVAL_P(z_id);
-        (*args_len_out)[i] = Z_STRLEN_P(z_id);
-        i++;
+        add_x_zval_arg(args->arena, z_id, *args_out, *args_len_out, &i);
     }
     ZEND_HASH_FOREACH_END();
 
@@ -983,23 +856,16 @@ int prepare_x_ack_args(x_command_args_t* args,
  */
 int prepare_x_del_args(x_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->ids ||
         args->id_count <= 0) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Prepare command arguments: key + IDs */
     unsigned long arg_count = 1 + args->id_count;
-    *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key as first argument */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -1007,14 +873,9 @@ int prepare_x_del_args(x_command_args_t* args,
 
     /* Add all stream IDs */
     zval* z_id;
-    int   i = 1;
+    unsigned int i = 1;
     ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(args->ids), z_id) {
-        if (Z_TYPE_P(z_id) != IS_STRING) {
-            convert_to_string(z_id);
-        }
-        (*args_out)[i]     = (uintptr_t) Z_STRVAL_P(z_id);
-        (*args_len_out)[i] = Z_STRLEN_P(z_id);
-        i++;
+        add_x_zval_arg(args->arena, z_id, *args_out, *args_len_out, &i);
     }
     ZEND_HASH_FOREACH_END();
 
@@ -1026,9 +887,7 @@ int prepare_x_del_args(x_command_args_t* args,
  */
 int prepare_x_range_args(x_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
+                         unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->start ||
         args->start_len <= 0 || !args->end || args->end_len <= 0) {
@@ -1037,8 +896,7 @@ int prepare_x_range_args(x_command_args_t* args,
 
     /* Calculate total args: key + start + end + (COUNT + count_value) */
     unsigned long arg_count = 1 + 1 + 1 + (args->range_opts.has_count ? 2 : 0);
-    *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
 
     /* Set arguments */
@@ -1067,25 +925,8 @@ int prepare_x_range_args(x_command_args_t* args,
         arg_idx++;
 
 
-        /* Convert count to string */
-        char          count_str[32];
-        unsigned long count_str_len =
-            snprintf(count_str, sizeof(count_str), "%ld", args->range_opts.count);
-
-        /* Allocate memory for the string */
-        char* count_str_copy                 = emalloc(count_str_len + 1);
-        *allocated_strings                   = (char**) ecalloc(1, sizeof(char*));
-        *allocated_count                     = 0;
-        *allocated_strings[*allocated_count] = count_str_copy;
-        (*allocated_count)++;
-        if (count_str_copy) {
-            memcpy(count_str_copy, count_str, count_str_len);
-            count_str_copy[count_str_len] = '\0';
-
-            (*args_out)[arg_idx]     = (uintptr_t) count_str_copy;
-            (*args_len_out)[arg_idx] = count_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->range_opts.count, *args_out, *args_len_out, arg_idx++);
     }
 
     return arg_count;
@@ -1096,9 +937,7 @@ int prepare_x_range_args(x_command_args_t* args,
  */
 int prepare_x_add_args(x_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
+                       unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->id || args->id_len <= 0 ||
         !args->field_values || args->fv_count <= 0) {
@@ -1119,12 +958,7 @@ int prepare_x_add_args(x_command_args_t* args,
 
     /* Calculate total args: key + options + ID + field/value pairs (each entry is a pair) */
     unsigned long arg_count = 1 + extra_args + 1 + (args->fv_count * 2);
-    *args_out               = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out           = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-
-    /* Allocate array to track temporary string allocations */
-    *allocated_strings = (char**) ecalloc(args->fv_count + 5, sizeof(char*));
-    *allocated_count   = 0;
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key as first argument */
     unsigned int arg_idx     = 0;
@@ -1141,10 +975,6 @@ int prepare_x_add_args(x_command_args_t* args,
 
     /* Add MAXLEN/MINID if specified */
     if (args->add_opts.has_maxlen) {
-        char          maxlen_str[64];
-        unsigned long maxlen_str_len = 0;
-        maxlen_str_len = snprintf(maxlen_str, sizeof(maxlen_str), "%ld", args->add_opts.maxlen);
-
         if (args->add_opts.minid_strategy) {
             (*args_out)[arg_idx]     = (uintptr_t) "MINID";
             (*args_len_out)[arg_idx] = sizeof("MINID") - 1;
@@ -1161,16 +991,9 @@ int prepare_x_add_args(x_command_args_t* args,
             arg_idx++;
         }
 
-        /* Add the threshold value - need to allocate a copy for persistence */
-        char* maxlen_str_copy = estrndup(maxlen_str, maxlen_str_len);
-        if (maxlen_str_copy) {
-            (*allocated_strings)[*allocated_count] = maxlen_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) maxlen_str_copy;
-            (*args_len_out)[arg_idx] = maxlen_str_len;
-            arg_idx++;
-        }
+        /* Add the threshold value */
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->add_opts.maxlen, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add stream ID */
@@ -1190,29 +1013,8 @@ int prepare_x_add_args(x_command_args_t* args,
             (*args_len_out)[arg_idx] = ZSTR_LEN(field_str);
             arg_idx++;
 
-            /* Add field value, convert to string if needed */
-            if (Z_TYPE_P(z_value) != IS_STRING) {
-                zval temp;
-                ZVAL_COPY(&temp, z_value);
-                convert_to_string(&temp);
-
-                /* Create persistent copy of the string */
-                char* str_copy = estrndup(Z_STRVAL(temp), Z_STRLEN(temp));
-                if (str_copy) {
-                    (*allocated_strings)[*allocated_count] = str_copy;
-                    (*allocated_count)++;
-
-                    (*args_out)[arg_idx]     = (uintptr_t) str_copy;
-                    (*args_len_out)[arg_idx] = Z_STRLEN(temp);
-                    arg_idx++;
-                }
-
-                zval_dtor(&temp);
-            } else {
-                (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_value);
-                (*args_len_out)[arg_idx] = Z_STRLEN_P(z_value);
-                arg_idx++;
-            }
+            /* Add field value, converting non-strings into the arena */
+            add_x_zval_arg(args->arena, z_value, *args_out, *args_len_out, &arg_idx);
         }
     }
     ZEND_HASH_FOREACH_END();
@@ -1225,22 +1027,14 @@ int prepare_x_add_args(x_command_args_t* args,
  */
 int prepare_x_group_args(x_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
+                         unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->subcommand || args->subcommand_len <= 0 || !args->args) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Allocate memory for arguments */
-    if (!allocate_command_args(args->args_count, args_out, args_len_out)) {
-        return 0;
-    }
+    valkey_glide_arena_alloc_arg_arrays(args->arena, args->args_count, args_out, args_len_out);
 
     /* Set subcommand as first argument */
     unsigned int arg_idx = 0;
@@ -1253,13 +1047,7 @@ int prepare_x_group_args(x_command_args_t* args,
         zval* arg = &args->args[i];
 
         /* Convert to string if not already a string */
-        if (Z_TYPE_P(arg) != IS_STRING) {
-            convert_to_string(arg);
-        }
-
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(arg);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(arg);
-        arg_idx++;
+        add_x_zval_arg(args->arena, arg, *args_out, *args_len_out, &arg_idx);
     }
 
     return args->args_count;
@@ -1270,19 +1058,13 @@ int prepare_x_group_args(x_command_args_t* args,
  */
 int prepare_x_pending_args(x_command_args_t* args,
                            uintptr_t**       args_out,
-                           unsigned long**   args_len_out,
-                           char***           allocated_strings,
-                           int*              allocated_count) {
+                           unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->group ||
         args->group_len <= 0) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Count extra args based on options */
     unsigned long extra_args = 0;
     if (args->pending_opts.start)
@@ -1298,9 +1080,7 @@ int prepare_x_pending_args(x_command_args_t* args,
     unsigned long arg_count = 2 + extra_args;
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key and group as first two arguments */
     unsigned int arg_idx     = 0;
@@ -1326,26 +1106,8 @@ int prepare_x_pending_args(x_command_args_t* args,
     }
 
     if (args->pending_opts.has_count) {
-        /* Convert count to string */
-        char          count_str[32];
-        unsigned long count_str_len =
-            snprintf(count_str, sizeof(count_str), "%ld", args->pending_opts.count);
-
-        /* Allocate memory for the count string */
-        char* count_str_copy = emalloc(count_str_len + 1);
-        if (count_str_copy) {
-            memcpy(count_str_copy, count_str, count_str_len);
-            count_str_copy[count_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            *allocated_strings      = (char**) ecalloc(1, sizeof(char*));
-            (*allocated_strings)[0] = count_str_copy;
-            *allocated_count        = 1;
-
-            (*args_out)[arg_idx]     = (uintptr_t) count_str_copy;
-            (*args_len_out)[arg_idx] = count_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->pending_opts.count, *args_out, *args_len_out, arg_idx++);
     }
 
     if (args->pending_opts.consumer) {
@@ -1362,19 +1124,13 @@ int prepare_x_pending_args(x_command_args_t* args,
  */
 int prepare_x_readgroup_args(x_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
+                             unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->group || args->group_len <= 0 || !args->consumer ||
         args->consumer_len <= 0 || !args->streams || !args->ids) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Get the number of streams and IDs */
     HashTable* streams_ht    = Z_ARRVAL_P(args->streams);
     HashTable* ids_ht        = Z_ARRVAL_P(args->ids);
@@ -1399,20 +1155,7 @@ int prepare_x_readgroup_args(x_command_args_t* args,
     unsigned long arg_count = 3 + extra_args + 1 + streams_count + ids_count;
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Allocate memory to track dynamic strings if needed */
-    int max_strings = 0;
-    if (args->read_opts.has_count)
-        max_strings++;
-    if (args->read_opts.has_block)
-        max_strings++;
-
-    if (max_strings > 0) {
-        *allocated_strings = (char**) ecalloc(max_strings, sizeof(char*));
-    }
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments */
     unsigned int arg_idx = 0;
@@ -1436,25 +1179,8 @@ int prepare_x_readgroup_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("COUNT") - 1;
         arg_idx++;
 
-        /* Convert count to string */
-        char          count_str[32];
-        unsigned long count_str_len =
-            snprintf(count_str, sizeof(count_str), "%ld", args->read_opts.count);
-
-        /* Allocate memory for the count string */
-        char* count_str_copy = emalloc(count_str_len + 1);
-        if (count_str_copy) {
-            memcpy(count_str_copy, count_str, count_str_len);
-            count_str_copy[count_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = count_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) count_str_copy;
-            (*args_len_out)[arg_idx] = count_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->read_opts.count, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add BLOCK if specified */
@@ -1463,25 +1189,8 @@ int prepare_x_readgroup_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("BLOCK") - 1;
         arg_idx++;
 
-        /* Convert block to string */
-        char          block_str[32];
-        unsigned long block_str_len =
-            snprintf(block_str, sizeof(block_str), "%ld", args->read_opts.block);
-
-        /* Allocate memory for the block string */
-        char* block_str_copy = emalloc(block_str_len + 1);
-        if (block_str_copy) {
-            memcpy(block_str_copy, block_str, block_str_len);
-            block_str_copy[block_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = block_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) block_str_copy;
-            (*args_len_out)[arg_idx] = block_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->read_opts.block, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add NOACK if specified */
@@ -1499,24 +1208,14 @@ int prepare_x_readgroup_args(x_command_args_t* args,
     /* Add all stream keys */
     zval* z_stream;
     ZEND_HASH_FOREACH_VAL(streams_ht, z_stream) {
-        if (Z_TYPE_P(z_stream) != IS_STRING) {
-            convert_to_string(z_stream);
-        }
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_stream);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(z_stream);
-        arg_idx++;
+        add_x_zval_arg(args->arena, z_stream, *args_out, *args_len_out, &arg_idx);
     }
     ZEND_HASH_FOREACH_END();
 
     /* Add all stream IDs */
     zval* z_id;
     ZEND_HASH_FOREACH_VAL(ids_ht, z_id) {
-        if (Z_TYPE_P(z_id) != IS_STRING) {
-            convert_to_string(z_id);
-        }
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_id);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(z_id);
-        arg_idx++;
+        add_x_zval_arg(args->arena, z_id, *args_out, *args_len_out, &arg_idx);
     }
     ZEND_HASH_FOREACH_END();
 
@@ -1528,18 +1227,12 @@ int prepare_x_readgroup_args(x_command_args_t* args,
  */
 int prepare_x_read_args(x_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->streams || !args->ids) {
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Get the number of streams and IDs */
     HashTable* streams_ht    = Z_ARRVAL_P(args->streams);
     HashTable* ids_ht        = Z_ARRVAL_P(args->ids);
@@ -1564,20 +1257,7 @@ int prepare_x_read_args(x_command_args_t* args,
     unsigned long arg_count = extra_args + 1 + streams_count + ids_count;
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Allocate memory to track dynamic strings if needed */
-    int max_strings = 0;
-    if (args->read_opts.has_count)
-        max_strings++;
-    if (args->read_opts.has_block)
-        max_strings++;
-
-    if (max_strings > 0) {
-        *allocated_strings = (char**) ecalloc(max_strings, sizeof(char*));
-    }
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments */
     unsigned int arg_idx = 0;
@@ -1588,25 +1268,8 @@ int prepare_x_read_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("COUNT") - 1;
         arg_idx++;
 
-        /* Convert count to string */
-        char          count_str[32];
-        unsigned long count_str_len =
-            snprintf(count_str, sizeof(count_str), "%ld", args->read_opts.count);
-
-        /* Allocate memory for the count string */
-        char* count_str_copy = emalloc(count_str_len + 1);
-        if (count_str_copy) {
-            memcpy(count_str_copy, count_str, count_str_len);
-            count_str_copy[count_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = count_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) count_str_copy;
-            (*args_len_out)[arg_idx] = count_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->read_opts.count, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add BLOCK if specified */
@@ -1615,25 +1278,8 @@ int prepare_x_read_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("BLOCK") - 1;
         arg_idx++;
 
-        /* Convert block to string */
-        char          block_str[32];
-        unsigned long block_str_len =
-            snprintf(block_str, sizeof(block_str), "%ld", args->read_opts.block);
-
-        /* Allocate memory for the block string */
-        char* block_str_copy = emalloc(block_str_len + 1);
-        if (block_str_copy) {
-            memcpy(block_str_copy, block_str, block_str_len);
-            block_str_copy[block_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = block_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) block_str_copy;
-            (*args_len_out)[arg_idx] = block_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->read_opts.block, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add NOACK if specified */
@@ -1651,24 +1297,14 @@ int prepare_x_read_args(x_command_args_t* args,
     /* Add all stream keys */
     zval* z_stream;
     ZEND_HASH_FOREACH_VAL(streams_ht, z_stream) {
-        if (Z_TYPE_P(z_stream) != IS_STRING) {
-            convert_to_string(z_stream);
-        }
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_stream);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(z_stream);
-        arg_idx++;
+        add_x_zval_arg(args->arena, z_stream, *args_out, *args_len_out, &arg_idx);
     }
     ZEND_HASH_FOREACH_END();
 
     /* Add all stream IDs */
     zval* z_id;
     ZEND_HASH_FOREACH_VAL(ids_ht, z_id) {
-        if (Z_TYPE_P(z_id) != IS_STRING) {
-            convert_to_string(z_id);
-        }
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_id);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(z_id);
-        arg_idx++;
+        add_x_zval_arg(args->arena, z_id, *args_out, *args_len_out, &arg_idx);
     }
     ZEND_HASH_FOREACH_END();
 
@@ -1680,9 +1316,7 @@ int prepare_x_read_args(x_command_args_t* args,
  */
 int prepare_x_claim_args(x_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
+                         unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->group ||
         args->group_len <= 0 || !args->consumer || args->consumer_len <= 0 || !args->ids ||
@@ -1690,10 +1324,6 @@ int prepare_x_claim_args(x_command_args_t* args,
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Count options */
     unsigned long extra_args = 0;
     if (args->claim_opts.has_idle)
@@ -1711,21 +1341,7 @@ int prepare_x_claim_args(x_command_args_t* args,
     unsigned long arg_count = 4 + extra_args + args->id_count;
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Calculate maximum number of strings we might allocate */
-    int max_strings = 1; /* min_idle_time */
-    if (args->claim_opts.has_idle)
-        max_strings++;
-    if (args->claim_opts.has_time)
-        max_strings++;
-    if (args->claim_opts.has_retrycount)
-        max_strings++;
-
-    /* Allocate memory to track dynamic strings */
-    *allocated_strings = (char**) ecalloc(max_strings, sizeof(char*));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key, group, consumer, min_idle_time */
     unsigned int arg_idx     = 0;
@@ -1741,35 +1357,13 @@ int prepare_x_claim_args(x_command_args_t* args,
     (*args_len_out)[arg_idx] = args->consumer_len;
     arg_idx++;
 
-    /* Convert min_idle_time to string */
-    char          min_idle_str[32];
-    unsigned long min_idle_str_len =
-        snprintf(min_idle_str, sizeof(min_idle_str), "%ld", args->min_idle_time);
-
-    /* Allocate memory for the min_idle_time string */
-    char* min_idle_str_copy = emalloc(min_idle_str_len + 1);
-    if (min_idle_str_copy) {
-        memcpy(min_idle_str_copy, min_idle_str, min_idle_str_len);
-        min_idle_str_copy[min_idle_str_len] = '\0';
-
-        /* Track this string for cleanup */
-        (*allocated_strings)[*allocated_count] = min_idle_str_copy;
-        (*allocated_count)++;
-
-        (*args_out)[arg_idx]     = (uintptr_t) min_idle_str_copy;
-        (*args_len_out)[arg_idx] = min_idle_str_len;
-        arg_idx++;
-    }
+    valkey_glide_arena_add_long_arg(
+        args->arena, args->min_idle_time, *args_out, *args_len_out, arg_idx++);
 
     /* Add all message IDs */
     zval* z_id;
     ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(args->ids), z_id) {
-        if (Z_TYPE_P(z_id) != IS_STRING) {
-            convert_to_string(z_id);
-        }
-        (*args_out)[arg_idx]     = (uintptr_t) Z_STRVAL_P(z_id);
-        (*args_len_out)[arg_idx] = Z_STRLEN_P(z_id);
-        arg_idx++;
+        add_x_zval_arg(args->arena, z_id, *args_out, *args_len_out, &arg_idx);
     }
     ZEND_HASH_FOREACH_END();
 
@@ -1779,25 +1373,8 @@ int prepare_x_claim_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("IDLE") - 1;
         arg_idx++;
 
-        /* Convert idle to string */
-        char          idle_str[32];
-        unsigned long idle_str_len =
-            snprintf(idle_str, sizeof(idle_str), "%ld", args->claim_opts.idle);
-
-        /* Allocate memory for the idle string */
-        char* idle_str_copy = emalloc(idle_str_len + 1);
-        if (idle_str_copy) {
-            memcpy(idle_str_copy, idle_str, idle_str_len);
-            idle_str_copy[idle_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = idle_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) idle_str_copy;
-            (*args_len_out)[arg_idx] = idle_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->claim_opts.idle, *args_out, *args_len_out, arg_idx++);
     }
 
     if (args->claim_opts.has_time) {
@@ -1805,25 +1382,8 @@ int prepare_x_claim_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("TIME") - 1;
         arg_idx++;
 
-        /* Convert time to string */
-        char          time_str[32];
-        unsigned long time_str_len =
-            snprintf(time_str, sizeof(time_str), "%ld", args->claim_opts.time);
-
-        /* Allocate memory for the time string */
-        char* time_str_copy = emalloc(time_str_len + 1);
-        if (time_str_copy) {
-            memcpy(time_str_copy, time_str, time_str_len);
-            time_str_copy[time_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = time_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) time_str_copy;
-            (*args_len_out)[arg_idx] = time_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->claim_opts.time, *args_out, *args_len_out, arg_idx++);
     }
 
     if (args->claim_opts.has_retrycount) {
@@ -1831,25 +1391,8 @@ int prepare_x_claim_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("RETRYCOUNT") - 1;
         arg_idx++;
 
-        /* Convert retrycount to string */
-        char          retry_str[32];
-        unsigned long retry_str_len =
-            snprintf(retry_str, sizeof(retry_str), "%ld", args->claim_opts.retrycount);
-
-        /* Allocate memory for the retry string */
-        char* retry_str_copy = emalloc(retry_str_len + 1);
-        if (retry_str_copy) {
-            memcpy(retry_str_copy, retry_str, retry_str_len);
-            retry_str_copy[retry_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = retry_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) retry_str_copy;
-            (*args_len_out)[arg_idx] = retry_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->claim_opts.retrycount, *args_out, *args_len_out, arg_idx++);
     }
 
     if (args->claim_opts.force) {
@@ -1872,9 +1415,7 @@ int prepare_x_claim_args(x_command_args_t* args,
  */
 int prepare_x_autoclaim_args(x_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
+                             unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->group ||
         args->group_len <= 0 || !args->consumer || args->consumer_len <= 0 || !args->start ||
@@ -1882,10 +1423,6 @@ int prepare_x_autoclaim_args(x_command_args_t* args,
         return 0;
     }
 
-    /* Initialize allocated strings tracking */
-    *allocated_strings = NULL;
-    *allocated_count   = 0;
-
     /* Count options */
     unsigned long extra_args = 0;
     if (args->claim_opts.has_count)
@@ -1897,17 +1434,7 @@ int prepare_x_autoclaim_args(x_command_args_t* args,
     unsigned long arg_count = 5 + extra_args;
 
     /* Allocate memory for arguments */
-    if (!allocate_command_args(arg_count, args_out, args_len_out)) {
-        return 0;
-    }
-
-    /* Calculate maximum number of strings we might allocate */
-    int max_strings = 1; /* min_idle_time */
-    if (args->claim_opts.has_count)
-        max_strings++;
-
-    /* Allocate memory to track dynamic strings */
-    *allocated_strings = (char**) ecalloc(max_strings, sizeof(char*));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key, group, consumer */
     unsigned int arg_idx     = 0;
@@ -1923,25 +1450,8 @@ int prepare_x_autoclaim_args(x_command_args_t* args,
     (*args_len_out)[arg_idx] = args->consumer_len;
     arg_idx++;
 
-    /* Convert min_idle_time to string */
-    char          min_idle_str[32];
-    unsigned long min_idle_str_len =
-        snprintf(min_idle_str, sizeof(min_idle_str), "%ld", args->min_idle_time);
-
-    /* Allocate memory for the min_idle_time string */
-    char* min_idle_str_copy = emalloc(min_idle_str_len + 1);
-    if (min_idle_str_copy) {
-        memcpy(min_idle_str_copy, min_idle_str, min_idle_str_len);
-        min_idle_str_copy[min_idle_str_len] = '\0';
-
-        /* Track this string for cleanup */
-        (*allocated_strings)[*allocated_count] = min_idle_str_copy;
-        (*allocated_count)++;
-
-        (*args_out)[arg_idx]     = (uintptr_t) min_idle_str_copy;
-        (*args_len_out)[arg_idx] = min_idle_str_len;
-        arg_idx++;
-    }
+    valkey_glide_arena_add_long_arg(
+        args->arena, args->min_idle_time, *args_out, *args_len_out, arg_idx++);
 
     /* Add start ID */
     (*args_out)[arg_idx]     = (uintptr_t) args->start;
@@ -1954,25 +1464,8 @@ int prepare_x_autoclaim_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("COUNT") - 1;
         arg_idx++;
 
-        /* Convert count to string */
-        char          count_str[32];
-        unsigned long count_str_len =
-            snprintf(count_str, sizeof(count_str), "%ld", args->claim_opts.count);
-
-        /* Allocate memory for the count string */
-        char* count_str_copy = emalloc(count_str_len + 1);
-        if (count_str_copy) {
-            memcpy(count_str_copy, count_str, count_str_len);
-            count_str_copy[count_str_len] = '\0';
-
-            /* Track this string for cleanup */
-            (*allocated_strings)[*allocated_count] = count_str_copy;
-            (*allocated_count)++;
-
-            (*args_out)[arg_idx]     = (uintptr_t) count_str_copy;
-            (*args_len_out)[arg_idx] = count_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->claim_opts.count, *args_out, *args_len_out, arg_idx++);
     }
 
     /* Add JUSTID if specified */
@@ -1990,9 +1483,7 @@ int prepare_x_autoclaim_args(x_command_args_t* args,
  */
 int prepare_x_trim_args(x_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     /* Check if client and arguments are valid */
     if (!args->glide_client || !args->key || args->key_len <= 0 || !args->strategy ||
         args->strategy_len <= 0 || !args->threshold || args->threshold_len <= 0) {
@@ -2002,8 +1493,7 @@ int prepare_x_trim_args(x_command_args_t* args,
     /* Calculate total args: key + strategy + [~] + threshold + [LIMIT + value] */
     unsigned long arg_count =
         1 + 1 + (args->trim_opts.approximate ? 1 : 0) + 1 + (args->trim_opts.has_limit ? 2 : 0);
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key as first argument */
     unsigned int arg_idx     = 0;
@@ -2034,25 +1524,8 @@ int prepare_x_trim_args(x_command_args_t* args,
         (*args_len_out)[arg_idx] = sizeof("LIMIT") - 1;
         arg_idx++;
 
-        /* Convert limit to string */
-        char          limit_str[32];
-        unsigned long limit_str_len =
-            snprintf(limit_str, sizeof(limit_str), "%ld", args->trim_opts.limit);
-
-        /* Need to allocate memory for the string */
-        char* limit_str_copy = emalloc(limit_str_len + 1);
-        if (limit_str_copy) {
-            memcpy(limit_str_copy, limit_str, limit_str_len);
-            *allocated_strings                   = (char**) ecalloc(1, sizeof(char*));
-            *allocated_count                     = 0;
-            *allocated_strings[*allocated_count] = limit_str_copy;
-            *allocated_count                     = 1;
-            limit_str_copy[limit_str_len]        = '\0';
-
-            (*args_out)[arg_idx]     = (uintptr_t) limit_str_copy;
-            (*args_len_out)[arg_idx] = limit_str_len;
-            arg_idx++;
-        }
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->trim_opts.limit, *args_out, *args_len_out, arg_idx++);
     }
 
     return arg_count;
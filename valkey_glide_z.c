@@ -663,6 +663,83 @@ int execute_zrange_command(zval* object, int argc, zval* return_value, zend_clas
     return result;
 }
 
+int execute_zrange_iterator_command(zval*             object,
+                                    int               argc,
+                                    zval*             return_value,
+                                    zend_class_entry* ce) {
+    char*     key = NULL;
+    size_t    key_len;
+    zval*     z_iter;
+    zend_long count      = VALKEY_GLIDE_ZRANGE_ITERATOR_COUNT;
+    zend_bool withscores = 0;
+    zend_long offset     = 0;
+    uint32_t  fetched;
+    zval      z_start, z_end, z_withscores;
+
+    if (zend_parse_method_parameters(argc,
+                                     object,
+                                     "Osz|lb",
+                                     &object,
+                                     ce,
+                                     &key,
+                                     &key_len,
+                                     &z_iter,
+                                     &count,
+                                     &withscores) == FAILURE) {
+        return 0;
+    }
+
+    valkey_glide_object* valkey_glide =
+        VALKEY_GLIDE_PHP_ZVAL_GET_OBJECT(valkey_glide_object, object);
+    if (!valkey_glide || !valkey_glide->glide_client) {
+        return 0;
+    }
+
+    /* The next offset lives in the caller's iterator, so chunks cannot be queued in a batch */
+    if (valkey_glide->is_in_batch_mode) {
+        php_error_docref(NULL, E_WARNING, "zRangeIterator cannot be used in a batch");
+        return 0;
+    }
+    if (count <= 0) {
+        php_error_docref(NULL, E_WARNING, "Count must be positive");
+        return 0;
+    }
+
+    /* NULL starts at the first member, 0 means the previous chunk was the last one */
+    ZVAL_DEREF(z_iter);
+    if (Z_TYPE_P(z_iter) != IS_NULL) {
+        offset = zval_get_long(z_iter);
+        if (offset <= 0) {
+            return 0;
+        }
+    }
+
+    z_command_args_t args = {0};
+    args.key              = key;
+    args.key_len          = key_len;
+    ZVAL_LONG(&z_start, offset);
+    ZVAL_LONG(&z_end, offset + count - 1);
+    ZVAL_BOOL(&z_withscores, withscores);
+    args.z_start = &z_start;
+    args.z_end   = &z_end;
+    args.options = &z_withscores;
+
+    if (!execute_z_generic_command(
+            valkey_glide, ZRange, &args, NULL, process_z_array_result, return_value) ||
+        Z_TYPE_P(return_value) != IS_ARRAY ||
+        zend_hash_num_elements(Z_ARRVAL_P(return_value)) == 0) {
+        zval_ptr_dtor(z_iter);
+        ZVAL_LONG(z_iter, 0);
+        return 0;
+    }
+
+    /* A short chunk is the last one */
+    fetched = zend_hash_num_elements(Z_ARRVAL_P(return_value));
+    zval_ptr_dtor(z_iter);
+    ZVAL_LONG(z_iter, fetched < (uint32_t) count ? 0 : offset + count);
+    return 1;
+}
+
 int execute_zcard_command(zval* object, int argc, zval* return_value, zend_class_entry* ce) {
     char*       key = NULL;
     size_t      key_len;
@@ -1627,6 +1704,18 @@ int prepare_mpop_arguments(const void*     glide_client,
 int process_zmpop_result(CommandResponse* response,
                          void*            output,
                          zval*            return_value) { /* Process the result */
+    /* [key, {member: score, ...}], the scores going straight into a member => score table */
+    if (response && response->response_type == Array && response->array_value_len == 2 &&
+        response->array_value[0].response_type == String) {
+        zval key, scores;
+
+        ZVAL_STR(&key, command_response_to_zend_string(&response->array_value[0]));
+        command_response_to_score_map(&response->array_value[1], &scores, false);
+        array_init_size(return_value, 2);
+        add_next_index_zval(return_value, &key);
+        add_next_index_zval(return_value, &scores);
+        return 1;
+    }
     return command_response_to_zval(
         response, return_value, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, false);
 }
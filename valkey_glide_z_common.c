@@ -23,10 +23,7 @@
 #include "command_response.h"
 #include "valkey_glide_commands_common.h"
 #include "valkey_glide_core_common.h"
-
-/* Import the string conversion functions from command_response.c */
-extern char* long_to_string(long value, size_t* len);
-extern char* double_to_string(double value, size_t* len);
+#include "valkey_glide_near_cache.h"
 
 /* ====================================================================
  * OPTIONS PARSING HELPERS
@@ -263,12 +260,13 @@ int parse_store_options(zval* weights, zval* options, store_options_t* opts) {
  * Create LIMIT arguments (offset, count)
  * Returns number of arguments added (0 or 3)
  */
-int create_limit_args(range_options_t* opts,
-                      uintptr_t*       args,
-                      unsigned long*   args_len,
-                      int              start_idx,
-                      char**           allocated_strings,
-                      int*             allocated_count) {
+int create_limit_args(valkey_glide_arena_t* arena,
+                      range_options_t*      opts,
+                      uintptr_t*            args,
+                      unsigned long*        args_len,
+                      int                   start_idx) {
+    size_t len;
+
     if (!opts->has_limit) {
         return 0;
     }
@@ -278,74 +276,38 @@ int create_limit_args(range_options_t* opts,
     args_len[start_idx] = 5;
 
     /* Add offset parameter */
-    size_t len;
-    char*  offset_str = long_to_string(opts->limit_offset, &len);
-    if (!offset_str) {
-        return 0;
-    }
-    args[start_idx + 1]                     = (uintptr_t) offset_str;
-    args_len[start_idx + 1]                 = len;
-    allocated_strings[(*allocated_count)++] = offset_str;
+    args[start_idx + 1] =
+        (uintptr_t) valkey_glide_arena_long_to_string(arena, opts->limit_offset, &len);
+    args_len[start_idx + 1] = len;
 
     /* Add count parameter */
-    char* count_str = long_to_string(opts->limit_count, &len);
-    if (!count_str) {
-        return 0;
-    }
-    args[start_idx + 2]                     = (uintptr_t) count_str;
-    args_len[start_idx + 2]                 = len;
-    allocated_strings[(*allocated_count)++] = count_str;
+    args[start_idx + 2] =
+        (uintptr_t) valkey_glide_arena_long_to_string(arena, opts->limit_count, &len);
+    args_len[start_idx + 2] = len;
 
     return 3; /* LIMIT + offset + count */
 }
 
-/* ====================================================================
- * RESPONSE PROCESSING HELPERS
- * ==================================================================== */
-
-
-/**
- * Flatten withscores array from [[member, score]] to [member => score]
- * Returns 1 on success, 0 on failure
- */
-int flatten_withscores_array(zval* return_value) {
-    if (!return_value || Z_TYPE_P(return_value) != IS_ARRAY) {
-        return 0;
-    }
-
-    HashTable* ht = Z_ARRVAL_P(return_value);
-    zval       tmp_arr;
-    array_init(&tmp_arr);
-
-    zval* entry;
-    ZEND_HASH_FOREACH_VAL(ht, entry) {
-        if (Z_TYPE_P(entry) == IS_ARRAY && zend_hash_num_elements(Z_ARRVAL_P(entry)) == 2) {
-            zval* z_member = zend_hash_index_find(Z_ARRVAL_P(entry), 0);
-            zval* z_score  = zend_hash_index_find(Z_ARRVAL_P(entry), 1);
-
-            if (z_member && z_score) {
-                /* Convert member to string if needed for use as key */
-                if (Z_TYPE_P(z_member) != IS_STRING) {
-                    convert_to_string_ex(z_member);
-                }
+/* Append the keys of an array, returning the index after the last one */
+static int add_z_keys(valkey_glide_arena_t* arena,
+                      HashTable*            keys_hash,
+                      uintptr_t*            args,
+                      unsigned long*        args_len,
+                      int                   idx) {
+    zval* key;
 
-                /* Add to associative array: member => score */
-                Z_TRY_ADDREF_P(z_score);
+    ZEND_HASH_FOREACH_VAL(keys_hash, key) {
+        size_t len;
 
-                add_assoc_zval(&tmp_arr, Z_STRVAL_P(z_member), z_score);
-            }
-        }
+        args[idx]     = (uintptr_t) valkey_glide_arena_zval_to_string(arena, key, &len);
+        args_len[idx] = len;
+        idx++;
     }
     ZEND_HASH_FOREACH_END();
 
-    /* Replace the original array with our flattened array */
-    zval_ptr_dtor(return_value);
-    ZVAL_COPY_VALUE(return_value, &tmp_arr);
-
-    return 1;
+    return idx;
 }
 
-
 /* ====================================================================
  * COMMON EXECUTION FRAMEWORK IMPLEMENTATION
  * ==================================================================== */
@@ -365,11 +327,13 @@ int execute_z_generic_command(valkey_glide_object* valkey_glide,
     }
 
     /* Prepare arguments ONCE - single switch statement eliminates duplication */
-    uintptr_t*     arg_values        = NULL;
-    unsigned long* arg_lens          = NULL;
-    char**         allocated_strings = NULL;
-    int            allocated_count   = 0;
-    int            arg_count         = 0;
+    uintptr_t*           arg_values = NULL;
+    unsigned long*       arg_lens   = NULL;
+    int                  arg_count  = 0;
+    valkey_glide_arena_t arena;
+
+    valkey_glide_arena_init(&arena);
+    args->arena = &arena;
 
     /* Single argument preparation logic for both batch and normal modes */
     switch (cmd_type) {
@@ -392,9 +356,7 @@ int execute_z_generic_command(valkey_glide_object* valkey_glide,
 
         case ZRem:
         case ZMScore:
-            allocated_strings = (char**) emalloc(args->member_count * sizeof(char*));
-            arg_count         = prepare_z_members_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_members_args(args, &arg_values, &arg_lens);
             break;
 
         case ZRange:
@@ -403,161 +365,93 @@ int execute_z_generic_command(valkey_glide_object* valkey_glide,
         case ZRangeByLex:
         case ZRevRangeByScore:
         case ZRevRangeByLex:
-            allocated_strings = (char**) emalloc(VALKEY_GLIDE_MAX_OPTIONS * sizeof(char*));
-
-            arg_count = prepare_z_complex_range_args(
-                args, &arg_values, cmd_type, &arg_lens, &allocated_strings, &allocated_count);
-            cmd_type = ZRange;
+            arg_count = prepare_z_complex_range_args(args, &arg_values, cmd_type, &arg_lens);
+            cmd_type  = ZRange;
             break;
 
-        case ZIncrBy:
-            arg_count         = 3; /* key + increment + member */
-            arg_values        = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-            arg_lens          = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-            allocated_strings = (char**) emalloc(1 * sizeof(char*));
+        case ZIncrBy: {
+            size_t increment_len;
+
+            arg_count = 3; /* key + increment + member */
+            valkey_glide_arena_alloc_arg_arrays(&arena, arg_count, &arg_values, &arg_lens);
 
             /* Set arguments */
             arg_values[0] = (uintptr_t) args->key;
             arg_lens[0]   = args->key_len;
 
             /* Add increment parameter */
-            char increment_str[64];
-            int  increment_str_len =
-                snprintf(increment_str, sizeof(increment_str), "%.6g", args->increment);
-            char* increment_str_copy = estrndup(increment_str, increment_str_len);
-
-            arg_values[1]        = (uintptr_t) increment_str_copy;
-            arg_lens[1]          = increment_str_len;
-            allocated_strings[0] = increment_str_copy;
-            allocated_count      = 1;
+            arg_values[1] = (uintptr_t) valkey_glide_arena_double_to_string(
+                &arena, args->increment, &increment_len);
+            arg_lens[1] = increment_len;
 
             /* Add member parameter */
             arg_values[2] = (uintptr_t) args->member;
             arg_lens[2]   = args->member_len;
             break;
+        }
 
         case ZRemRangeByRank:
-            arg_count         = 3; /* key + start + stop */
-            arg_values        = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-            arg_lens          = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
-            allocated_strings = (char**) emalloc(2 * sizeof(char*));
+            arg_count = 3; /* key + start + stop */
+            valkey_glide_arena_alloc_arg_arrays(&arena, arg_count, &arg_values, &arg_lens);
 
             /* Set arguments */
             arg_values[0] = (uintptr_t) args->key;
             arg_lens[0]   = args->key_len;
-            int arg_idx   = 1; /* Start after key */
 
             /* Add start and end parameters */
-            size_t start_len, end_len;
-            char*  start_str_copy = safe_format_long_long(args->start, &start_len);
-            char*  end_str_copy   = safe_format_long_long(args->end, &end_len);
-
-            add_string_arg(start_str_copy,
-                           start_len,
-                           &arg_values,
-                           &arg_lens,
-                           &arg_idx,
-                           &allocated_strings,
-                           &allocated_count);
-            add_string_arg(end_str_copy,
-                           end_len,
-                           &arg_values,
-                           &arg_lens,
-                           &arg_idx,
-                           &allocated_strings,
-                           &allocated_count);
+            valkey_glide_arena_add_long_arg(&arena, args->start, arg_values, arg_lens, 1);
+            valkey_glide_arena_add_long_arg(&arena, args->end, arg_values, arg_lens, 2);
             break;
 
         case ZDiffStore:
         case ZInterStore:
         case ZUnionStore:
-            allocated_strings =
-                (char**) emalloc(20 * sizeof(char*)); /* Enough for store commands */
-
-            arg_count = prepare_z_store_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_store_args(args, &arg_values, &arg_lens);
             break;
 
         case ZInterCard:
-            allocated_strings = (char**) emalloc(5 * sizeof(char*)); /* Enough for ZINTERCARD */
-
-            arg_count = prepare_z_intercard_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_intercard_args(args, &arg_values, &arg_lens);
             break;
 
         case ZUnion:
-            allocated_strings = (char**) emalloc(20 * sizeof(char*)); /* Enough for ZUNION */
-
-            arg_count = prepare_z_union_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+        case ZInter:
+            arg_count = prepare_z_union_args(args, &arg_values, &arg_lens);
             break;
 
         case ZPopMax:
         case ZPopMin:
-            allocated_strings = (char**) emalloc(2 * sizeof(char*)); /* Enough for ZPOP commands */
-            arg_count         = prepare_z_pop_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_pop_args(args, &arg_values, &arg_lens);
             break;
 
         case ZRangeStore:
-            allocated_strings = (char**) emalloc(VALKEY_GLIDE_MAX_OPTIONS * sizeof(char*));
-
-            arg_count = prepare_z_rangestore_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_rangestore_args(args, &arg_values, &arg_lens);
             break;
 
         case ZAdd:
-            allocated_strings = (char**) emalloc(20 * sizeof(char*)); /* Enough for ZADD */
-
-            arg_count = prepare_z_zadd_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_zadd_args(args, &arg_values, &arg_lens);
             break;
 
         case ZDiff:
-            allocated_strings = (char**) emalloc(5 * sizeof(char*)); /* Enough for ZDIFF */
-
-            arg_count = prepare_z_zdiff_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
-            break;
-
-        case ZInter:
-            allocated_strings = (char**) emalloc(20 * sizeof(char*)); /* Enough for ZINTER */
-
-            arg_count = prepare_z_union_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_zdiff_args(args, &arg_values, &arg_lens);
             break;
 
         case ZRandMember:
-            allocated_strings = (char**) emalloc(2 * sizeof(char*)); /* Enough for ZRANDMEMBER */
-
-            arg_count = prepare_z_randmember_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_randmember_args(args, &arg_values, &arg_lens);
             break;
 
         case BZPopMax:
         case BZPopMin:
-            allocated_strings = (char**) emalloc(2 * sizeof(char*)); /* Enough for BZPOP commands */
-            arg_count         = prepare_z_bzpop_args(
-                args, &arg_values, &arg_lens, &allocated_strings, &allocated_count);
+            arg_count = prepare_z_bzpop_args(args, &arg_values, &arg_lens);
             break;
 
         default:
             /* Unsupported command type */
-            return 0;
+            break;
     }
     /* Check if argument preparation was successful */
     if (arg_count <= 0) {
-        if (arg_values)
-            efree(arg_values);
-        if (arg_lens)
-            efree(arg_lens);
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        if (allocated_strings)
-            efree(allocated_strings);
+        valkey_glide_arena_reset(&arena);
+        args->arena = NULL;
         return 0;
     }
 
@@ -571,38 +465,36 @@ int execute_z_generic_command(valkey_glide_object* valkey_glide,
                                               result_ptr,
                                               process_result);
 
-        if (arg_values)
-            efree(arg_values);
-        if (arg_lens)
-            efree(arg_lens);
-
-        for (int i = 0; i < allocated_count; i++) {
-            if (allocated_strings[i]) {
-                efree(allocated_strings[i]);
-            }
-        }
-        if (allocated_strings)
-            efree(allocated_strings);
-
+        valkey_glide_arena_reset(&arena);
+        args->arena = NULL;
         return result;
     }
-    /* Execute the command */
-    CommandResult* result =
-        execute_command(valkey_glide->glide_client, cmd_type, arg_count, arg_values, arg_lens);
-
-    /* Free allocated strings */
-    int i;
-    for (i = 0; i < allocated_count; i++) {
-        if (allocated_strings[i]) {
-            efree(allocated_strings[i]);
-        }
+    /* Execute the command, unless the near cache already holds the reply */
+    CommandResult* result  = NULL;
+    int            success = 0;
+    bool           cached  = valkey_glide_near_cache_fetch(valkey_glide->near_cache,
+                                                           cmd_type,
+                                                           arg_values,
+                                                           arg_lens,
+                                                           arg_count,
+                                                           result_ptr,
+                                                           process_result,
+                                                           return_value,
+                                                           &success);
+    if (!cached) {
+        result =
+            execute_command(valkey_glide->glide_client, cmd_type, arg_count, arg_values, arg_lens);
+        valkey_glide_near_cache_store(
+            valkey_glide->near_cache, cmd_type, arg_values, arg_lens, arg_count, result);
+    }
+
+    /* The arguments are no longer needed */
+    valkey_glide_arena_reset(&arena);
+    args->arena = NULL;
+
+    if (cached) {
+        return success;
     }
-    if (allocated_strings)
-        efree(allocated_strings);
-    if (arg_values)
-        efree(arg_values);
-    if (arg_lens)
-        efree(arg_lens);
 
     /* Check if the command was successful */
     if (!result) {
@@ -616,7 +508,7 @@ int execute_z_generic_command(valkey_glide_object* valkey_glide,
     }
 
     /* Process the result */
-    int success = process_result(result->response, result_ptr, return_value);
+    success = process_result(result->response, result_ptr, return_value);
 
     /* Free the result */
     free_command_result(result);
@@ -638,8 +530,7 @@ int prepare_z_key_args(z_command_args_t* args, uintptr_t** args_out, unsigned lo
 
     unsigned long arg_count = 1; /* just key */
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -648,37 +539,23 @@ int prepare_z_key_args(z_command_args_t* args, uintptr_t** args_out, unsigned lo
     return arg_count;
 }
 
-int prepare_z_pop_args(z_command_args_t* args,
-                       uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count) {
-    if (!args || !args->key || !args_out || !args_len_out || !allocated_strings ||
-        !allocated_count) {
+int prepare_z_pop_args(z_command_args_t* args, uintptr_t** args_out, unsigned long** args_len_out) {
+    if (!args || !args->key || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     unsigned long arg_count = 1;
     if (args->start > 1) {
         arg_count++;
     }
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     if (args->start > 1) {
-        char count_str[32];
-        snprintf(count_str, sizeof(count_str), "%ld", args->start);
-        char* count_str_copy = estrdup(count_str);
-
-        (*args_out)[1]                             = (uintptr_t) count_str_copy;
-        (*args_len_out)[1]                         = strlen(count_str);
-        (*allocated_strings)[(*allocated_count)++] = count_str_copy;
+        valkey_glide_arena_add_long_arg(args->arena, args->start, *args_out, *args_len_out, 1);
     }
 
     return arg_count;
@@ -700,8 +577,7 @@ int prepare_z_member_args(z_command_args_t* args,
         arg_count++; /* Add WITHSCORE parameter */
     }
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -732,8 +608,7 @@ int prepare_z_range_args(z_command_args_t* args,
 
     unsigned long arg_count = 3; /* key + min + max */
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set arguments */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -753,49 +628,29 @@ int prepare_z_range_args(z_command_args_t* args,
  */
 int prepare_z_members_args(z_command_args_t* args,
                            uintptr_t**       args_out,
-                           unsigned long**   args_len_out,
-                           char***           allocated_strings,
-                           int*              allocated_count) {
+                           unsigned long**   args_len_out) {
     if (!args || !args->key || !args->members || args->member_count <= 0 || !args_out ||
-        !args_len_out || !allocated_strings || !allocated_count) {
+        !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Prepare command arguments */
     unsigned long arg_count = 1 + args->member_count; /* key + members */
 
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
-    /* Add members as arguments */
+    /* Add members as arguments, converting non-string values into the arena */
     int i;
     for (i = 0; i < args->member_count; i++) {
-        zval* z_member = &args->members[i];
-
-        if (Z_TYPE_P(z_member) == IS_STRING) {
-            (*args_out)[i + 1]     = (uintptr_t) Z_STRVAL_P(z_member);
-            (*args_len_out)[i + 1] = Z_STRLEN_P(z_member);
-        } else {
-            /* Convert non-string values to string */
-            char*  str_val   = NULL;
-            size_t str_len   = 0;
-            int    need_free = 0;
+        size_t str_len;
 
-            str_val = zval_to_string_safe(z_member, &str_len, &need_free);
-
-            (*args_out)[i + 1]     = (uintptr_t) str_val;
-            (*args_len_out)[i + 1] = str_len;
-
-            if (need_free) {
-                (*allocated_strings)[(*allocated_count)++] = str_val;
-            }
-        }
+        (*args_out)[i + 1] = (uintptr_t) valkey_glide_arena_zval_to_string(
+            args->arena, &args->members[i], &str_len);
+        (*args_len_out)[i + 1] = str_len;
     }
 
     return arg_count;
@@ -804,32 +659,14 @@ int prepare_z_members_args(z_command_args_t* args,
 /**
  * Convert a zval to a string argument
  */
-static int convert_zval_to_string_arg(zval*          z_value,
-                                      uintptr_t*     arg_ptr,
-                                      unsigned long* arg_len_ptr,
-                                      char***        allocated_strings,
-                                      int*           allocated_count) {
-    if (Z_TYPE_P(z_value) == IS_STRING) {
-        *arg_ptr     = (uintptr_t) Z_STRVAL_P(z_value);
-        *arg_len_ptr = Z_STRLEN_P(z_value);
-        return 1;
-    } else {
-        /* Convert non-string values to string */
-        char*  str_val   = NULL;
-        size_t str_len   = 0;
-        int    need_free = 0;
-
-        str_val = zval_to_string_safe(z_value, &str_len, &need_free);
-
-        *arg_ptr     = (uintptr_t) str_val;
-        *arg_len_ptr = str_len;
-
-        if (need_free) {
-            (*allocated_strings)[(*allocated_count)++] = str_val;
-        }
-
-        return 1;
-    }
+static void convert_zval_to_string_arg(valkey_glide_arena_t* arena,
+                                       zval*                 z_value,
+                                       uintptr_t*            arg_ptr,
+                                       unsigned long*        arg_len_ptr) {
+    size_t str_len;
+
+    *arg_ptr     = (uintptr_t) valkey_glide_arena_zval_to_string(arena, z_value, &str_len);
+    *arg_len_ptr = str_len;
 }
 
 /**
@@ -838,16 +675,11 @@ static int convert_zval_to_string_arg(zval*          z_value,
 int prepare_z_complex_range_args(z_command_args_t* args,
                                  uintptr_t**       args_out,
                                  enum RequestType  cmd_type,
-                                 unsigned long**   args_len_out,
-                                 char***           allocated_strings,
-                                 int*              allocated_count) {
-    if (!args || !args->key || !args->z_start || !args->z_end || !args_out || !args_len_out ||
-        !allocated_strings || !allocated_count) {
+                                 unsigned long**   args_len_out) {
+    if (!args || !args->key || !args->z_start || !args->z_end || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse range options */
     range_options_t range_opts = {0};
     if (!parse_range_options(args->options, &range_opts)) {
@@ -889,37 +721,16 @@ int prepare_z_complex_range_args(z_command_args_t* args,
         arg_count += 3; /* Add LIMIT + offset + count parameters */
 
     /* Allocate memory for arguments */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* First argument: key */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     /* Convert start and end to strings if needed */
-    if (!convert_zval_to_string_arg(args->z_start,
-                                    &((*args_out)[1]),
-                                    &((*args_len_out)[1]),
-                                    allocated_strings,
-                                    allocated_count)) {
-        efree(*args_out);
-        efree(*args_len_out);
-        return 0;
-    }
-
-    if (!convert_zval_to_string_arg(args->z_end,
-                                    &((*args_out)[2]),
-                                    &((*args_len_out)[2]),
-                                    allocated_strings,
-                                    allocated_count)) {
-        int i;
-        for (i = 0; i < *allocated_count; i++) {
-            efree((*allocated_strings)[i]);
-        }
-        efree(*args_out);
-        efree(*args_len_out);
-        return 0;
-    }
+    convert_zval_to_string_arg(
+        args->arena, args->z_start, &((*args_out)[1]), &((*args_len_out)[1]));
+    convert_zval_to_string_arg(args->arena, args->z_end, &((*args_out)[2]), &((*args_len_out)[2]));
 
     /* Add optional parameters in the correct order */
     int arg_idx = 3; /* Start after key, start, end */
@@ -951,8 +762,7 @@ int prepare_z_complex_range_args(z_command_args_t* args,
     /* Add LIMIT parameter if required */
     if (range_opts.has_limit) {
         /* Add LIMIT + offset + count using common helper */
-        arg_idx += create_limit_args(
-            &range_opts, *args_out, *args_len_out, arg_idx, *allocated_strings, allocated_count);
+        arg_idx += create_limit_args(args->arena, &range_opts, *args_out, *args_len_out, arg_idx);
     }
 
     /* Add WITHSCORES if required - add it last as per ValkeyGlide command syntax */
@@ -971,16 +781,12 @@ int prepare_z_complex_range_args(z_command_args_t* args,
  */
 int prepare_z_store_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
+                         unsigned long**   args_len_out) {
     if (!args || !args->key || !args->members || args->member_count <= 0 || !args_out ||
-        !args_len_out || !allocated_strings || !allocated_count) {
+        !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse store options */
     store_options_t store_opts = {0};
     parse_store_options(args->weights, args->options, &store_opts);
@@ -1000,37 +806,18 @@ int prepare_z_store_args(z_command_args_t* args,
     }
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set destination */
     (*args_out)[0]     = (uintptr_t) args->key;
     (*args_len_out)[0] = args->key_len;
 
     /* Add numkeys as the second argument */
-    char numkeys_str[32];
-    snprintf(numkeys_str, sizeof(numkeys_str), "%d", args->member_count);
-    char* numkeys_str_copy = estrdup(numkeys_str);
-
-    (*args_out)[1]                             = (uintptr_t) numkeys_str_copy;
-    (*args_len_out)[1]                         = strlen(numkeys_str);
-    (*allocated_strings)[(*allocated_count)++] = numkeys_str_copy;
-
-    /* Add keys starting from index 2 */
-    HashTable* keys_hash = Z_ARRVAL_P(args->members); /* members field is reused for keys */
-    zval*      key;
-    int        idx = 2;
-    ZEND_HASH_FOREACH_VAL(keys_hash, key) {
-        if (Z_TYPE_P(key) != IS_STRING) {
-            convert_to_string(key);
-        }
-        (*args_out)[idx]     = (uintptr_t) Z_STRVAL_P(key);
-        (*args_len_out)[idx] = Z_STRLEN_P(key);
-        idx++;
-    }
-    ZEND_HASH_FOREACH_END();
+    valkey_glide_arena_add_long_arg(args->arena, args->member_count, *args_out, *args_len_out, 1);
 
-    unsigned int offset = 2 + args->member_count;
+    /* Add keys starting from index 2 (members field is reused for keys) */
+    int offset =
+        add_z_keys(args->arena, Z_ARRVAL_P(args->members), *args_out, *args_len_out, 2);
 
     /* Add WEIGHTS if present */
     if (store_opts.has_weights) {
@@ -1038,37 +825,9 @@ int prepare_z_store_args(z_command_args_t* args,
         (*args_len_out)[offset] = 7;
         offset++;
 
-        /* Add weights values using framework helper */
-        HashTable* weights_hash = Z_ARRVAL_P(store_opts.weights);
-        zval*      weight;
-        ZEND_HASH_FOREACH_VAL(weights_hash, weight) {
-            char*  weight_str = NULL;
-            size_t weight_len = 0;
-            int    need_free  = 0;
-
-            weight_str = zval_to_string_safe(weight, &weight_len, &need_free);
-
-            if (!weight_str) {
-                /* Cleanup on error */
-                int j;
-                for (j = 0; j < *allocated_count; j++) {
-                    efree((*allocated_strings)[j]);
-                }
-                efree(*args_out);
-                efree(*args_len_out);
-                return 0;
-            }
-
-            (*args_out)[offset]     = (uintptr_t) weight_str;
-            (*args_len_out)[offset] = weight_len;
-
-            if (need_free) {
-                (*allocated_strings)[(*allocated_count)++] = weight_str;
-            }
-
-            offset++;
-        }
-        ZEND_HASH_FOREACH_END();
+        /* Add weights values */
+        offset = add_z_keys(
+            args->arena, Z_ARRVAL_P(store_opts.weights), *args_out, *args_len_out, offset);
     }
 
     /* Add AGGREGATE if present */
@@ -1077,12 +836,8 @@ int prepare_z_store_args(z_command_args_t* args,
         (*args_len_out)[offset] = 9;
         offset++;
 
-        const char* agg_str      = Z_STRVAL_P(store_opts.aggregate);
-        char*       agg_str_copy = estrdup(agg_str);
-
-        (*args_out)[offset]                        = (uintptr_t) agg_str_copy;
-        (*args_len_out)[offset]                    = Z_STRLEN_P(store_opts.aggregate);
-        (*allocated_strings)[(*allocated_count)++] = agg_str_copy;
+        (*args_out)[offset]     = (uintptr_t) Z_STRVAL_P(store_opts.aggregate);
+        (*args_len_out)[offset] = Z_STRLEN_P(store_opts.aggregate);
     }
 
     return arg_count;
@@ -1093,16 +848,11 @@ int prepare_z_store_args(z_command_args_t* args,
  */
 int prepare_z_intercard_args(z_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count) {
-    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out ||
-        !allocated_strings || !allocated_count) {
+                             unsigned long**   args_len_out) {
+    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Calculate total arguments (numkeys + keys + LIMIT if present) */
     unsigned long arg_count = 1 + args->member_count; /* +1 for numkeys */
     int           has_limit = 0;
@@ -1119,49 +869,24 @@ int prepare_z_intercard_args(z_command_args_t* args,
     }
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Add numkeys as the first argument */
-    char numkeys_str[32];
-    snprintf(numkeys_str, sizeof(numkeys_str), "%d", args->member_count);
-    char* numkeys_str_copy = estrdup(numkeys_str);
-
-    (*args_out)[0]                             = (uintptr_t) numkeys_str_copy;
-    (*args_len_out)[0]                         = strlen(numkeys_str);
-    (*allocated_strings)[(*allocated_count)++] = numkeys_str_copy;
-
-    /* Add keys starting from index 1 */
-    HashTable* keys_hash = Z_ARRVAL_P(args->members); /* members field is reused for keys */
-    zval*      key;
-    int        idx = 1;
-    ZEND_HASH_FOREACH_VAL(keys_hash, key) {
-        if (Z_TYPE_P(key) != IS_STRING) {
-            convert_to_string(key);
-        }
-        (*args_out)[idx]     = (uintptr_t) Z_STRVAL_P(key);
-        (*args_len_out)[idx] = Z_STRLEN_P(key);
-        idx++;
-    }
-    ZEND_HASH_FOREACH_END();
+    valkey_glide_arena_add_long_arg(args->arena, args->member_count, *args_out, *args_len_out, 0);
+
+    /* Add keys starting from index 1 (members field is reused for keys) */
+    int offset =
+        add_z_keys(args->arena, Z_ARRVAL_P(args->members), *args_out, *args_len_out, 1);
 
     /* Add LIMIT option if present */
     if (has_limit) {
-        unsigned int offset = 1 + args->member_count; /* +1 for numkeys */
-
         /* Add LIMIT keyword */
         (*args_out)[offset]     = (uintptr_t) "LIMIT";
         (*args_len_out)[offset] = 5;
         offset++;
 
         /* Add limit value */
-        char limit_str[32];
-        snprintf(limit_str, sizeof(limit_str), "%ld", limit);
-        char* limit_str_copy = estrdup(limit_str);
-
-        (*args_out)[offset]                        = (uintptr_t) limit_str_copy;
-        (*args_len_out)[offset]                    = strlen(limit_str);
-        (*allocated_strings)[(*allocated_count)++] = limit_str_copy;
+        valkey_glide_arena_add_long_arg(args->arena, limit, *args_out, *args_len_out, offset);
     }
 
     return arg_count;
@@ -1172,16 +897,11 @@ int prepare_z_intercard_args(z_command_args_t* args,
  */
 int prepare_z_union_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
-    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out ||
-        !allocated_strings || !allocated_count) {
+                         unsigned long**   args_len_out) {
+    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse union options */
     store_options_t union_opts = {0};
     parse_store_options(args->weights, args->options, &union_opts);
@@ -1205,31 +925,14 @@ int prepare_z_union_args(z_command_args_t* args,
     }
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Add numkeys as the first argument */
-    char numkeys_str[32];
-    snprintf(numkeys_str, sizeof(numkeys_str), "%d", args->member_count);
-    char* numkeys_str_copy = estrdup(numkeys_str);
-
-    (*args_out)[0]                             = (uintptr_t) numkeys_str_copy;
-    (*args_len_out)[0]                         = strlen(numkeys_str);
-    (*allocated_strings)[(*allocated_count)++] = numkeys_str_copy;
-
-    /* Add keys starting from index 1 */
-    HashTable*   keys_hash = Z_ARRVAL_P(args->members); /* members field is reused for keys */
-    zval*        key;
-    unsigned int offset = 1;
-    ZEND_HASH_FOREACH_VAL(keys_hash, key) {
-        if (Z_TYPE_P(key) != IS_STRING) {
-            convert_to_string(key);
-        }
-        (*args_out)[offset]     = (uintptr_t) Z_STRVAL_P(key);
-        (*args_len_out)[offset] = Z_STRLEN_P(key);
-        offset++;
-    }
-    ZEND_HASH_FOREACH_END();
+    valkey_glide_arena_add_long_arg(args->arena, args->member_count, *args_out, *args_len_out, 0);
+
+    /* Add keys starting from index 1 (members field is reused for keys) */
+    int offset =
+        add_z_keys(args->arena, Z_ARRVAL_P(args->members), *args_out, *args_len_out, 1);
 
     /* Add WEIGHTS if present */
     if (union_opts.has_weights) {
@@ -1238,37 +941,9 @@ int prepare_z_union_args(z_command_args_t* args,
         (*args_len_out)[offset] = 7;
         offset++;
 
-        /* Add weights values using framework helper */
-        HashTable* weights_hash = Z_ARRVAL_P(union_opts.weights);
-        zval*      weight;
-        ZEND_HASH_FOREACH_VAL(weights_hash, weight) {
-            char*  weight_str = NULL;
-            size_t weight_len = 0;
-            int    need_free  = 0;
-
-            weight_str = zval_to_string_safe(weight, &weight_len, &need_free);
-
-            if (!weight_str) {
-                /* Cleanup on error */
-                int j;
-                for (j = 0; j < *allocated_count; j++) {
-                    efree((*allocated_strings)[j]);
-                }
-                efree(*args_out);
-                efree(*args_len_out);
-                return 0;
-            }
-
-            (*args_out)[offset]     = (uintptr_t) weight_str;
-            (*args_len_out)[offset] = weight_len;
-
-            if (need_free) {
-                (*allocated_strings)[(*allocated_count)++] = weight_str;
-            }
-
-            offset++;
-        }
-        ZEND_HASH_FOREACH_END();
+        /* Add weights values */
+        offset = add_z_keys(
+            args->arena, Z_ARRVAL_P(union_opts.weights), *args_out, *args_len_out, offset);
     }
 
     /* Add AGGREGATE if present */
@@ -1279,12 +954,8 @@ int prepare_z_union_args(z_command_args_t* args,
         offset++;
 
         /* Add aggregate value */
-        const char* agg_str      = Z_STRVAL_P(union_opts.aggregate);
-        char*       agg_str_copy = estrdup(agg_str);
-
-        (*args_out)[offset]                        = (uintptr_t) agg_str_copy;
-        (*args_len_out)[offset]                    = Z_STRLEN_P(union_opts.aggregate);
-        (*allocated_strings)[(*allocated_count)++] = agg_str_copy;
+        (*args_out)[offset]     = (uintptr_t) Z_STRVAL_P(union_opts.aggregate);
+        (*args_len_out)[offset] = Z_STRLEN_P(union_opts.aggregate);
         offset++;
     }
 
@@ -1304,16 +975,12 @@ int prepare_z_union_args(z_command_args_t* args,
  */
 int prepare_z_rangestore_args(z_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count) {
+                              unsigned long**   args_len_out) {
     if (!args || !args->key || !args->member || !args->z_start || !args->z_end || !args_out ||
-        !args_len_out || !allocated_strings || !allocated_count) {
+        !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse range options */
     range_options_t range_opts = {0};
     parse_range_options(args->options, &range_opts);
@@ -1330,8 +997,7 @@ int prepare_z_rangestore_args(z_command_args_t* args,
         arg_count += 3; /* LIMIT + offset + count */
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set dst and src (args->key is dst, args->member is src) */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -1339,31 +1005,10 @@ int prepare_z_rangestore_args(z_command_args_t* args,
     (*args_out)[1]     = (uintptr_t) args->member;
     (*args_len_out)[1] = args->member_len;
 
-    /* Add start and end using framework helper */
-    int    need_free = 0;
-    size_t len       = 0;
-    char*  str       = zval_to_string_safe(args->z_start, &len, &need_free);
-    if (!str) {
-        efree(*args_out);
-        efree(*args_len_out);
-        return 0;
-    }
-    (*args_out)[2]     = (uintptr_t) str;
-    (*args_len_out)[2] = len;
-    if (need_free)
-        (*allocated_strings)[(*allocated_count)++] = str;
-
-    str = zval_to_string_safe(args->z_end, &len, &need_free);
-    if (!str) {
-        free_allocated_strings(*allocated_strings, *allocated_count);
-        efree(*args_out);
-        efree(*args_len_out);
-        return 0;
-    }
-    (*args_out)[3]     = (uintptr_t) str;
-    (*args_len_out)[3] = len;
-    if (need_free)
-        (*allocated_strings)[(*allocated_count)++] = str;
+    /* Add start and end */
+    convert_zval_to_string_arg(
+        args->arena, args->z_start, &((*args_out)[2]), &((*args_len_out)[2]));
+    convert_zval_to_string_arg(args->arena, args->z_end, &((*args_out)[3]), &((*args_len_out)[3]));
 
     /* Add range options */
     unsigned int offset = 4;
@@ -1382,8 +1027,7 @@ int prepare_z_rangestore_args(z_command_args_t* args,
         offset++;
     }
     if (range_opts.has_limit) {
-        offset += create_limit_args(
-            &range_opts, *args_out, *args_len_out, offset, *allocated_strings, allocated_count);
+        offset += create_limit_args(args->arena, &range_opts, *args_out, *args_len_out, offset);
     }
 
     return arg_count;
@@ -1394,16 +1038,12 @@ int prepare_z_rangestore_args(z_command_args_t* args,
  */
 int prepare_z_zadd_args(z_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count) {
+                        unsigned long**   args_len_out) {
     if (!args || !args->key || !args->members || args->member_count < 2 || !args_out ||
-        !args_len_out || !allocated_strings || !allocated_count) {
+        !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse ZADD options from the first element if it's an array */
     zadd_options_t zadd_opts       = {0};
     int            first_score_idx = 0;
@@ -1433,8 +1073,7 @@ int prepare_z_zadd_args(z_command_args_t* args,
     unsigned long arg_count = 1 + num_options + (score_member_pairs * 2);
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -1467,44 +1106,23 @@ int prepare_z_zadd_args(z_command_args_t* args,
         (*args_len_out)[arg_idx++] = 4;
     }
 
-    /* Add score-member pairs using existing framework helpers */
+    /* Add score-member pairs */
     for (int i = first_score_idx; i < args->member_count; i += 2) {
-        /* Score - use existing zval_to_string_safe */
-        zval*  score     = &args->members[i];
-        char*  score_str = NULL;
-        size_t score_len = 0;
-        int    need_free = 0;
-
-        if (Z_TYPE_P(score) == IS_DOUBLE) {
-            score_str = double_to_string(Z_DVAL_P(score), &score_len);
-            need_free = 1;
-        } else if (Z_TYPE_P(score) == IS_LONG) {
-            score_str = long_to_string(Z_LVAL_P(score), &score_len);
-            need_free = 1;
-        } else if (Z_TYPE_P(score) == IS_STRING) {
-            score_str = Z_STRVAL_P(score);
-            score_len = Z_STRLEN_P(score);
-        } else {
-            /* Cleanup and return error */
-            free_allocated_strings(*allocated_strings, *allocated_count);
-            efree(*args_out);
-            efree(*args_len_out);
+        /* Scores must be numbers or numeric strings */
+        zval*  score = &args->members[i];
+        size_t score_len;
+
+        if (Z_TYPE_P(score) != IS_DOUBLE && Z_TYPE_P(score) != IS_LONG &&
+            Z_TYPE_P(score) != IS_STRING) {
             return 0;
         }
-
-        (*args_out)[arg_idx]       = (uintptr_t) score_str;
+        (*args_out)[arg_idx] =
+            (uintptr_t) valkey_glide_arena_zval_to_string(args->arena, score, &score_len);
         (*args_len_out)[arg_idx++] = score_len;
-        if (need_free) {
-            (*allocated_strings)[(*allocated_count)++] = score_str;
-        }
 
         /* Member - validate it's a string */
         zval* member = &args->members[i + 1];
         if (Z_TYPE_P(member) != IS_STRING) {
-            /* Cleanup and return error */
-            free_allocated_strings(*allocated_strings, *allocated_count);
-            efree(*args_out);
-            efree(*args_len_out);
             return 0;
         }
         (*args_out)[arg_idx]       = (uintptr_t) Z_STRVAL_P(member);
@@ -1519,16 +1137,11 @@ int prepare_z_zadd_args(z_command_args_t* args,
  */
 int prepare_z_zdiff_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
-    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out ||
-        !allocated_strings || !allocated_count) {
+                         unsigned long**   args_len_out) {
+    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Parse ZDIFF options (only WITHSCORES supported) */
     store_options_t zdiff_opts = {0};
     parse_store_options(NULL, args->options, &zdiff_opts);
@@ -1540,32 +1153,15 @@ int prepare_z_zdiff_args(z_command_args_t* args,
     }
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
 
     /* Add numkeys as the first argument */
-    char numkeys_str[32];
-    snprintf(numkeys_str, sizeof(numkeys_str), "%d", args->member_count);
-    char* numkeys_str_copy = estrdup(numkeys_str);
-
-    (*args_out)[0]                             = (uintptr_t) numkeys_str_copy;
-    (*args_len_out)[0]                         = strlen(numkeys_str);
-    (*allocated_strings)[(*allocated_count)++] = numkeys_str_copy;
-
-    /* Add keys starting from index 1 */
-    HashTable*   keys_hash = Z_ARRVAL_P(args->members); /* members field is reused for keys */
-    zval*        key;
-    unsigned int offset = 1;
-    ZEND_HASH_FOREACH_VAL(keys_hash, key) {
-        if (Z_TYPE_P(key) != IS_STRING) {
-            convert_to_string(key);
-        }
-        (*args_out)[offset]     = (uintptr_t) Z_STRVAL_P(key);
-        (*args_len_out)[offset] = Z_STRLEN_P(key);
-        offset++;
-    }
-    ZEND_HASH_FOREACH_END();
+    valkey_glide_arena_add_long_arg(args->arena, args->member_count, *args_out, *args_len_out, 0);
+
+    /* Add keys starting from index 1 (members field is reused for keys) */
+    int offset =
+        add_z_keys(args->arena, Z_ARRVAL_P(args->members), *args_out, *args_len_out, 1);
 
     /* Add WITHSCORES if present */
     if (zdiff_opts.withscores) {
@@ -1583,16 +1179,11 @@ int prepare_z_zdiff_args(z_command_args_t* args,
  */
 int prepare_z_randmember_args(z_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count) {
-    if (!args || !args->key || !args_out || !args_len_out || !allocated_strings ||
-        !allocated_count) {
+                              unsigned long**   args_len_out) {
+    if (!args || !args->key || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Calculate argument count: key + optional count + optional WITHSCORES */
     unsigned long arg_count = 1; /* key */
     if (args->start != 1)        /* reuse start field for count */
@@ -1604,8 +1195,7 @@ int prepare_z_randmember_args(z_command_args_t* args,
     }
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Set key */
     (*args_out)[0]     = (uintptr_t) args->key;
@@ -1614,13 +1204,8 @@ int prepare_z_randmember_args(z_command_args_t* args,
 
     /* Add count if not default (1) */
     if (args->start != 1) {
-        char count_str[32];
-        snprintf(count_str, sizeof(count_str), "%ld", args->start);
-        char* count_str_copy = estrdup(count_str);
-
-        (*args_out)[arg_idx]                       = (uintptr_t) count_str_copy;
-        (*args_len_out)[arg_idx]                   = strlen(count_str);
-        (*allocated_strings)[(*allocated_count)++] = count_str_copy;
+        valkey_glide_arena_add_long_arg(
+            args->arena, args->start, *args_out, *args_len_out, arg_idx);
         arg_idx++;
     }
 
@@ -1640,16 +1225,11 @@ int prepare_z_randmember_args(z_command_args_t* args,
  */
 int prepare_z_bzpop_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count) {
-    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out ||
-        !allocated_strings || !allocated_count) {
+                         unsigned long**   args_len_out) {
+    if (!args || !args->members || args->member_count <= 0 || !args_out || !args_len_out) {
         return 0;
     }
 
-    *allocated_count = 0;
-
     /* Detect format: array format vs variadic format */
     int        actual_key_count = 0;
     zval*      keys_array       = NULL;
@@ -1677,49 +1257,26 @@ int prepare_z_bzpop_args(z_command_args_t* args,
     unsigned long arg_count = actual_key_count + 1; /* keys + timeout */
 
     /* Allocate final args arrays */
-    *args_out     = (uintptr_t*) emalloc(arg_count * sizeof(uintptr_t));
-    *args_len_out = (unsigned long*) emalloc(arg_count * sizeof(unsigned long));
+    valkey_glide_arena_alloc_arg_arrays(args->arena, arg_count, args_out, args_len_out);
 
     /* Add keys as arguments based on format */
     if (is_array_format) {
         /* Array format: iterate through the array */
-        int   idx = 0;
-        zval* key_entry;
-        ZEND_HASH_FOREACH_VAL(keys_ht, key_entry) {
-            if (Z_TYPE_P(key_entry) != IS_STRING) {
-                /* Convert to string if needed */
-                convert_to_string(key_entry);
-            }
-            (*args_out)[idx]     = (uintptr_t) Z_STRVAL_P(key_entry);
-            (*args_len_out)[idx] = Z_STRLEN_P(key_entry);
-            idx++;
-        }
-        ZEND_HASH_FOREACH_END();
+        add_z_keys(args->arena, keys_ht, *args_out, *args_len_out, 0);
     } else {
         /* Variadic format: iterate through individual zvals */
         int i;
         for (i = 0; i < actual_key_count; i++) {
-            zval* key = &args->members[i];
-            if (Z_TYPE_P(key) != IS_STRING) {
-                /* Convert to string if needed */
-                convert_to_string(key);
-            }
-            (*args_out)[i]     = (uintptr_t) Z_STRVAL_P(key);
-            (*args_len_out)[i] = Z_STRLEN_P(key);
+            convert_zval_to_string_arg(
+                args->arena, &args->members[i], &(*args_out)[i], &(*args_len_out)[i]);
         }
     }
 
     /* Add timeout as the last argument (reuse increment field for timeout) */
     size_t timeout_len;
-    char*  timeout_str = double_to_string(args->increment, &timeout_len);
-    if (!timeout_str) {
-        efree(*args_out);
-        efree(*args_len_out);
-        return 0;
-    }
-    (*args_out)[actual_key_count]              = (uintptr_t) timeout_str;
-    (*args_len_out)[actual_key_count]          = timeout_len;
-    (*allocated_strings)[(*allocated_count)++] = timeout_str;
+    (*args_out)[actual_key_count] = (uintptr_t) valkey_glide_arena_double_to_string(
+        args->arena, args->increment, &timeout_len);
+    (*args_len_out)[actual_key_count] = timeout_len;
 
     return arg_count;
 }
@@ -1802,7 +1359,13 @@ int process_z_array_zrand_result(CommandResponse* response, void* output, zval*
         return 0;
     }
 
-    /* Process the result */
+    /* [[member, score], ...] decoded in one pass into member => score */
+    if (array_data->withscores) {
+        int success = command_response_to_score_map(response, return_value, false);
+
+        efree(output);
+        return success;
+    }
 
     int success =
         command_response_to_zval(response, return_value, COMMAND_RESPONSE_NOT_ASSOSIATIVE, false);
@@ -1818,10 +1381,6 @@ int process_z_array_zrand_result(CommandResponse* response, void* output, zval*
         add_next_index_str(return_value, str);
     }
 
-    if (array_data->withscores && success && Z_TYPE_P(return_value) == IS_ARRAY) {
-        /* Use common helper to flatten withscores array */
-        flatten_withscores_array(return_value);
-    }
     efree(output);
     return success;
 }
@@ -1834,11 +1393,12 @@ int process_z_array_result(CommandResponse* response, void* output, zval* return
         return 0;
     }
 
-    /* Process the result */
-    int success = command_response_to_zval(
-        response, return_value, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, true);
-
-    return success;
+    /* WITHSCORES replies are member => score maps, the rest lists of members */
+    if (response->response_type == Map) {
+        return command_response_to_score_map(response, return_value, true);
+    }
+    return command_response_to_string_list(
+        NULL, response, return_value, COMMAND_RESPONSE_ASSOSIATIVE_ARRAY_MAP, true);
 }
 
 /**
@@ -19,6 +19,10 @@
 
 #include "common.h"
 #include "include/glide_bindings.h"
+#include "valkey_glide_arena.h"
+
+/* Members fetched per zRangeIterator() call when no count is given */
+#define VALKEY_GLIDE_ZRANGE_ITERATOR_COUNT 1000
 
 /* ====================================================================
  * STRUCTURE DEFINITIONS
@@ -105,6 +109,9 @@ typedef struct {
     long*   long_result;
     double* double_result;
     zval*   zval_result;
+
+    /* Per-command allocations, owned by execute_z_generic_command */
+    valkey_glide_arena_t* arena;
 } z_command_args_t;
 
 
@@ -202,9 +209,7 @@ int prepare_z_range_args(z_command_args_t* args,
  */
 int prepare_z_members_args(z_command_args_t* args,
                            uintptr_t**       args_out,
-                           unsigned long**   args_len_out,
-                           char***           allocated_strings,
-                           int*              allocated_count);
+                           unsigned long**   args_len_out);
 
 /**
  * Prepare complex range Z-command arguments with options
@@ -212,90 +217,70 @@ int prepare_z_members_args(z_command_args_t* args,
 int prepare_z_complex_range_args(z_command_args_t* args,
                                  uintptr_t**       args_out,
                                  enum RequestType  cmd_type,
-                                 unsigned long**   args_len_out,
-                                 char***           allocated_strings,
-                                 int*              allocated_count);
+                                 unsigned long**   args_len_out);
 
 /**
  * Prepare store command arguments (destination + numkeys + keys + weights + aggregate)
  */
 int prepare_z_store_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count);
+                         unsigned long**   args_len_out);
 
 /**
  * Prepare ZINTERCARD command arguments (numkeys + keys + optional LIMIT)
  */
 int prepare_z_intercard_args(z_command_args_t* args,
                              uintptr_t**       args_out,
-                             unsigned long**   args_len_out,
-                             char***           allocated_strings,
-                             int*              allocated_count);
+                             unsigned long**   args_len_out);
 
 /**
  * Prepare ZUNION command arguments (numkeys + keys + WEIGHTS + AGGREGATE + WITHSCORES)
  */
 int prepare_z_union_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count);
+                         unsigned long**   args_len_out);
 
 /**
  * Prepare ZPOP command arguments (key + optional count)
  */
 int prepare_z_pop_args(z_command_args_t* args,
                        uintptr_t**       args_out,
-                       unsigned long**   args_len_out,
-                       char***           allocated_strings,
-                       int*              allocated_count);
+                       unsigned long**   args_len_out);
 
 /**
  * Prepare ZRANGESTORE command arguments (dst + src + start + end + range options)
  */
 int prepare_z_rangestore_args(z_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count);
+                              unsigned long**   args_len_out);
 
 /**
  * Prepare ZADD command arguments (key + options + score-member pairs)
  */
 int prepare_z_zadd_args(z_command_args_t* args,
                         uintptr_t**       args_out,
-                        unsigned long**   args_len_out,
-                        char***           allocated_strings,
-                        int*              allocated_count);
+                        unsigned long**   args_len_out);
 
 /**
  * Prepare ZDIFF command arguments (numkeys + keys + optional WITHSCORES)
  */
 int prepare_z_zdiff_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count);
+                         unsigned long**   args_len_out);
 
 /**
  * Prepare ZRANDMEMBER command arguments (key + optional count + optional WITHSCORES)
  */
 int prepare_z_randmember_args(z_command_args_t* args,
                               uintptr_t**       args_out,
-                              unsigned long**   args_len_out,
-                              char***           allocated_strings,
-                              int*              allocated_count);
+                              unsigned long**   args_len_out);
 
 /**
  * Prepare BZPOP command arguments (keys + timeout)
  */
 int prepare_z_bzpop_args(z_command_args_t* args,
                          uintptr_t**       args_out,
-                         unsigned long**   args_len_out,
-                         char***           allocated_strings,
-                         int*              allocated_count);
+                         unsigned long**   args_len_out);
 
 /* ====================================================================
  * OPTIONS PARSING HELPERS
@@ -327,23 +312,16 @@ int parse_store_options(zval* weights, zval* options, store_options_t* opts);
  * Create LIMIT arguments (offset, count)
  * Returns number of arguments added (0 or 3)
  */
-int create_limit_args(range_options_t* opts,
-                      uintptr_t*       args,
-                      unsigned long*   args_len,
-                      int              start_idx,
-                      char**           allocated_strings,
-                      int*             allocated_count);
+int create_limit_args(valkey_glide_arena_t* arena,
+                      range_options_t*      opts,
+                      uintptr_t*            args,
+                      unsigned long*        args_len,
+                      int                   start_idx);
 
 /* ====================================================================
  * RESPONSE PROCESSING HELPERS
  * ==================================================================== */
 
-/**
- * Flatten withscores array from [[member, score]] to [member => score]
- * Returns 1 on success, 0 on failure
- */
-int flatten_withscores_array(zval* return_value);
-
 int prepare_mpop_arguments(const void*     glide_client,
                            int             is_blocking,
                            double          timeout,
@@ -380,6 +358,11 @@ int execute_zremrangebyrank_command(zval*             object,
                                     zval*             return_value,
                                     zend_class_entry* ce);
 int execute_zrange_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
+/* Walk a sorted set by rank in chunks of count, the offset kept in a by-reference iterator */
+int execute_zrange_iterator_command(zval*             object,
+                                    int               argc,
+                                    zval*             return_value,
+                                    zend_class_entry* ce);
 int execute_zcard_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
 /* ZADD command with options */
 int execute_zadd_command(zval* object, int argc, zval* return_value, zend_class_entry* ce);
@@ -429,6 +412,15 @@ int buffer_command_for_batch(valkey_glide_object* valkey_glide,
                              uintptr_t            arg_count,
                              void*                result_ptr,
                              z_result_processor_t process_result);
+/* Same, sending the command to `route` in cluster pipelines; transactions ignore the route */
+int buffer_routed_command_for_batch(valkey_glide_object* valkey_glide,
+                                    enum RequestType     cmd_type,
+                                    const uintptr_t*     args,
+                                    const unsigned long* args_len,
+                                    uintptr_t            arg_count,
+                                    zval*                route,
+                                    void*                result_ptr,
+                                    z_result_processor_t process_result);
 /**
  * Initialize array return value and check for allocation success
  */
@@ -810,6 +802,21 @@ int buffer_command_for_batch(valkey_glide_object* valkey_glide,
         RETURN_FALSE;                                                              \
     }
 
+/* Ultra-simple macro for zRangeIterator method implementation */
+#define ZRANGE_ITERATOR_METHOD_IMPL(class_name)                                            \
+    PHP_METHOD(class_name, zRangeIterator) {                                               \
+        if (execute_zrange_iterator_command(getThis(),                                     \
+                                            ZEND_NUM_ARGS(),                               \
+                                            return_value,                                  \
+                                            strcmp(#class_name, "ValkeyGlideCluster") == 0 \
+                                                ? get_valkey_glide_cluster_ce()            \
+                                                : get_valkey_glide_ce())) {                \
+            return;                                                                        \
+        }                                                                                  \
+        zval_dtor(return_value);                                                           \
+        RETURN_FALSE;                                                                      \
+    }
+
 /* Ultra-simple macro for ZSCAN method implementation */
 #define ZSCAN_METHOD_IMPL(class_name)                                            \
     PHP_METHOD(class_name, zscan) {                                              \
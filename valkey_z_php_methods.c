@@ -17,6 +17,8 @@
 #include "valkey_glide_geo_common.h"
 #include "valkey_glide_hash_common.h" /* Include hash command framework */
 #include "valkey_glide_list_common.h"
+#include "valkey_glide_pubsub.h"
+#include "valkey_glide_script.h"
 #include "valkey_glide_s_common.h"
 #include "valkey_glide_x_common.h"
 #include "valkey_glide_z_common.h"
@@ -39,10 +41,64 @@ extern char* double_to_string(double value, size_t* len);
 OBJECT_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
+/* {{{ proto bool ValkeyGlide::subscribe(array channels, [callable cb]) */
+SUBSCRIBE_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlide::psubscribe(array patterns, [callable cb]) */
+PSUBSCRIBE_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::unsubscribe([array channels]) */
+UNSUBSCRIBE_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::punsubscribe([array patterns]) */
+PUNSUBSCRIBE_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto long ValkeyGlide::publish(string channel, string message) */
+PUBLISH_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::poll([long max_messages, double timeout]) */
+POLL_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::eval(string script, [array args, int num_keys]) */
+EVAL_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::eval_ro(string script, [array args, int num_keys]) */
+EVAL_RO_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::evalsha(string sha, [array args, int num_keys]) */
+EVALSHA_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::evalsha_ro(string sha, [array args, int num_keys]) */
+EVALSHA_RO_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::script(string command, mixed ...args) */
+SCRIPT_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto mixed ValkeyGlide::invokeScript(ValkeyGlideScript script, [array keys, array args,
+ *                                           bool read_only]) */
+INVOKE_SCRIPT_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto array ValkeyGlide::zRange(string key, mixed start, mixed end [, bool|array options]) */
 ZRANGE_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
+/* {{{ proto array ValkeyGlide::zRangeIterator(string key, int &iterator [, int count,
+ *                                             bool withscores]) */
+ZRANGE_ITERATOR_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto int ValkeyGlide::zRangeStore(string dest, string src, mixed start, mixed end [, array
  * options]) */
 ZRANGESTORE_METHOD_IMPL(ValkeyGlide)
@@ -435,6 +491,26 @@ HSETNX_METHOD_IMPL(ValkeyGlide)
 HGET_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
+/* {{{ proto ValkeyGlideFuture ValkeyGlide::getAsync(string key) */
+GET_ASYNC_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::getStats() */
+GET_STATS_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlide::resetStats() */
+RESET_STATS_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array|false ValkeyGlide::getNearCacheStats() */
+GET_NEAR_CACHE_STATS_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto bool ValkeyGlide::clearNearCache() */
+CLEAR_NEAR_CACHE_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto long ValkeyGlide::hLen(string key) */
 HLEN_METHOD_IMPL(ValkeyGlide);
 /* }}} */
@@ -541,6 +617,18 @@ HMGET_METHOD_IMPL(ValkeyGlide);
 HMSET_METHOD_IMPL(ValkeyGlide);
 /* }}} */
 
+/* {{{ proto array ValkeyGlide::hGetAllMany(array keys) */
+HGETALL_MANY_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::hMgetMany(array keys, array fields) */
+HMGET_MANY_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
+/* {{{ proto array ValkeyGlide::hMsetMany(array key_fields) */
+HMSET_MANY_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto array|string ValkeyGlide::hRandField(string key [, array options]) */
 HRANDFIELD_METHOD_IMPL(ValkeyGlide);
 
@@ -659,6 +747,10 @@ CLIENT_METHOD_IMPL(ValkeyGlide)
 RAWCOMMAND_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
+/* {{{ proto ValkeyGlideFuture ValkeyGlide::sendAsync(string cmd, ...) */
+SEND_ASYNC_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto long ValkeyGlide::dbSize() */
 DBSIZE_METHOD_IMPL(ValkeyGlide)
 /* }}} */
@@ -679,7 +771,7 @@ FUNCTION_METHOD_IMPL(ValkeyGlide)
 MULTI_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
-/* {{{ proto bool ValkeyGlide::pipeline() */
+/* {{{ proto bool ValkeyGlide::pipeline([int flush_commands, int flush_bytes]) */
 PIPELINE_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
@@ -691,6 +783,10 @@ DISCARD_METHOD_IMPL(ValkeyGlide)
 EXEC_METHOD_IMPL(ValkeyGlide)
 /* }}} */
 
+/* {{{ proto ValkeyGlideBatchIterator ValkeyGlide::execIterator([int chunk_size]) */
+EXEC_ITERATOR_METHOD_IMPL(ValkeyGlide)
+/* }}} */
+
 /* {{{ proto mixed ValkeyGlide::fcall(string name, int numkeys, mixed ...args) */
 FCALL_METHOD_IMPL(ValkeyGlide)
 /* }}} */